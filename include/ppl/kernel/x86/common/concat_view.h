@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_COMMON_CONCAT_VIEW_H_
+#define __ST_PPL_KERNEL_X86_COMMON_CONCAT_VIEW_H_
+
+#include "ppl/kernel/x86/common/general_include.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+/*
+    zero copy concat and split:
+        a concat input is produced straight into its slice of the concat
+        output, a split output is consumed straight from its slice of the
+        split input. n16cx conv2d executors take channel slices through
+        set_dst_total_channels/set_src_total_channels, n16cx arithmetic
+        through the *_n16cx_fp32_dst_view entries of arithmetic.h, any other
+        kernel can take a contiguous slice as a plain tensor.
+
+        concat and split kernels skip the copy when every pointer already
+        sits at its view, so a graph can keep the node.
+*/
+// the in place checks of the concat and split kernels keep their views on
+// the stack. wider concats and splits take the copy, which is still correct
+// for inputs that alias their slice.
+#define PPL_X86_CONCAT_MAX_VIEWS() 64
+
+struct concat_view_t {
+    int64_t offset; // elements from the start of the whole tensor
+    int64_t axis_offset; // slice start on the concat axis
+    int64_t axis_len; // concat axis length of the whole tensor
+    bool contiguous; // the slice is one dense range
+};
+
+/*
+    returns RC_UNSUPPORTED when a slice can not be written in place:
+        n16cx channel slices must start on a multiple of 16 channels, or
+        their padding lanes would overlap the next slice. n16cx slices along
+        other axes must be contiguous.
+*/
+ppl::common::RetCode concat_ndarray_select_views(
+    const ppl::common::TensorShape **src_shape_list,
+    const int32_t num_src,
+    const int32_t axis,
+    concat_view_t *views);
+
+ppl::common::RetCode concat_n16cx_select_views(
+    const ppl::common::TensorShape **src_shape_list,
+    const int32_t num_src,
+    const int32_t axis,
+    concat_view_t *views);
+
+ppl::common::RetCode split_ndarray_select_views(
+    const ppl::common::TensorShape **dst_shape_list,
+    const int32_t num_dst,
+    const int32_t slice_axis,
+    concat_view_t *views);
+
+ppl::common::RetCode split_n16cx_select_views(
+    const ppl::common::TensorShape **dst_shape_list,
+    const int32_t num_dst,
+    const int32_t slice_axis,
+    concat_view_t *views);
+
+}}}; // namespace ppl::kernel::x86
+
+#endif // !__ST_PPL_KERNEL_X86_COMMON_CONCAT_VIEW_H_
@@ -0,0 +1,75 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_COMMON_FUSED_ELTWISE_COMMON_H_
+#define __ST_PPL_KERNEL_X86_COMMON_FUSED_ELTWISE_COMMON_H_
+
+#include "ppl/kernel/x86/common/general_include.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+#define PPL_X86_FUSED_ELTWISE_MAX_SRC() 8
+#define PPL_X86_FUSED_ELTWISE_MAX_NODES() 32
+
+typedef int32_t fused_eltwise_op_t;
+class fused_eltwise_op {
+public:
+    // binary: src[0] op src[1]
+    static const fused_eltwise_op_t ADD = 0;
+    static const fused_eltwise_op_t SUB = 1;
+    static const fused_eltwise_op_t MUL = 2;
+    static const fused_eltwise_op_t DIV = 3;
+    static const fused_eltwise_op_t MAX = 4;
+    static const fused_eltwise_op_t MIN = 5;
+    // unary: op(src[0])
+    static const fused_eltwise_op_t NEG = 6;
+    static const fused_eltwise_op_t ABS = 7;
+    static const fused_eltwise_op_t RELU = 8;
+    static const fused_eltwise_op_t SIGMOID = 9;
+    static const fused_eltwise_op_t TANH = 10;
+    static const fused_eltwise_op_t EXP = 11;
+    static const fused_eltwise_op_t ERF = 12;
+    static const fused_eltwise_op_t SQRT = 13;
+    static const fused_eltwise_op_t CLIP = 14; // min(max(x, alpha), beta)
+    static const fused_eltwise_op_t LEAKY_RELU = 15; // x >= 0 ? x : alpha * x
+    static const fused_eltwise_op_t AFFINE = 16; // alpha * x + beta
+    // ternary
+    static const fused_eltwise_op_t FMA = 17; // src[0] * src[1] + src[2]
+    static const fused_eltwise_op_t SELECT = 18; // src[0] != 0 ? src[1] : src[2]
+};
+
+inline int32_t fused_eltwise_op_num_src(const fused_eltwise_op_t op)
+{
+    if (op >= fused_eltwise_op::ADD && op <= fused_eltwise_op::MIN) return 2;
+    if (op >= fused_eltwise_op::NEG && op <= fused_eltwise_op::AFFINE) return 1;
+    if (op == fused_eltwise_op::FMA || op == fused_eltwise_op::SELECT) return 3;
+    return 0;
+}
+
+// A fused program is a list of nodes in topological order. Operand index i
+// refers to the i-th input tensor when i < num_src, and to the result of
+// node (i - num_src) otherwise. The result of the last node is the output.
+struct fused_eltwise_node {
+    fused_eltwise_op_t op;
+    int32_t src[3];
+    float alpha;
+    float beta;
+};
+
+}}}; // namespace ppl::kernel::x86
+
+#endif
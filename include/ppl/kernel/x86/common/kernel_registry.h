@@ -0,0 +1,98 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_COMMON_KERNEL_REGISTRY_H_
+#define __ST_PPL_KERNEL_X86_COMMON_KERNEL_REGISTRY_H_
+
+#include <atomic>
+#include <vector>
+
+#include "ppl/kernel/x86/common/general_include.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+// cpu features beyond ppl::common::isa_t, detected once by cpuid and only
+// reported when the os saves the matching register state. the amx bits stay
+// off until request_amx_permission() succeeds.
+enum cpu_feature_t {
+    CPU_FEATURE_AVX512_VNNI = 1 << 0,
+    CPU_FEATURE_AVX512_BF16 = 1 << 1,
+    CPU_FEATURE_AVX512_FP16 = 1 << 2,
+    CPU_FEATURE_AMX_TILE    = 1 << 3,
+    CPU_FEATURE_AMX_BF16    = 1 << 4,
+    CPU_FEATURE_AMX_INT8    = 1 << 5,
+};
+
+uint32_t get_cpu_features();
+
+// opt-in for amx kernels. on linux it asks for the tile data state of the
+// whole process with arch_prctl, which also grows the signal frame of every
+// thread, so the library never does it on its own. returns RC_UNSUPPORTED
+// without amx and RC_PERMISSION_DENIED when the os refuses.
+ppl::common::RetCode request_amx_permission();
+
+typedef void (*kernel_func_t)();
+// shapes are passed in the order of the op signature, inputs first
+typedef bool (*kernel_predicate_t)(const ppl::common::TensorShape **shapes, const int32_t num_shapes);
+
+/*
+    one implementation of an op. it is runnable when the cpu has every bit
+    of isa and cpu_features, and predicate (null accepts all) accepts the
+    shapes of the call. the runnable kernel of highest priority wins, ties
+    go to the earliest registered. func is cast back to the op's own
+    function type by the op entry.
+*/
+struct kernel_desc_t {
+    const char *op;
+    const char *name;
+    ppl::common::isa_t isa;
+    uint32_t cpu_features;
+    int32_t priority;
+    kernel_predicate_t predicate;
+    kernel_func_t func;
+};
+
+// the desc is copied, op and name must stay alive
+ppl::common::RetCode register_kernel(const kernel_desc_t *desc);
+
+// every kernel registered for op in registry order, runnable or not
+std::vector<kernel_desc_t> get_registered_kernels(const char *op);
+
+// hide isa and feature bits from dispatch, ~0 restores the detected cpu
+void set_kernel_dispatch_mask(const ppl::common::isa_t isa_mask, const uint32_t feature_mask);
+
+// per call site cache of the runnable kernels of one op, sorted by
+// priority. rebuilt when the registry or the dispatch mask changes. the
+// registry keeps the address of every site it has seen to drop lists of
+// older generations, so sites have to be static.
+struct kernel_dispatch_site_t {
+    const char *op;
+    std::atomic<const void *> candidates;
+};
+
+#define PPL_X86_KERNEL_DISPATCH_SITE(NAME, OP) \
+    static ppl::kernel::x86::kernel_dispatch_site_t NAME = {OP, {nullptr}}
+
+// returns null when no kernel of the op can run on these shapes
+const kernel_desc_t *resolve_kernel(
+    kernel_dispatch_site_t *site,
+    const ppl::common::TensorShape **shapes,
+    const int32_t num_shapes);
+
+}}}; // namespace ppl::kernel::x86
+
+#endif
@@ -0,0 +1,157 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_COMMON_PERF_COUNTER_H_
+#define __ST_PPL_KERNEL_X86_COMMON_PERF_COUNTER_H_
+
+#include <vector>
+
+#include "ppl/kernel/x86/common/general_include.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+/*
+    hardware events counted by perf_counter_t.
+    l2 misses and avx512 license cycles are intel core events, dram bytes
+    come from the intel uncore imc cas counters and are system wide, so
+    they need perf_event_paranoid <= 0 or CAP_PERFMON.
+*/
+enum perf_event_t {
+    PERF_EVENT_CYCLES = 0,
+    PERF_EVENT_INSTRUCTIONS,
+    PERF_EVENT_L1D_MISSES,
+    PERF_EVENT_L2_MISSES,
+    PERF_EVENT_LLC_MISSES,
+    PERF_EVENT_DRAM_BYTES,
+    PERF_EVENT_AVX512_L1_LICENSE_CYCLES,
+    PERF_EVENT_AVX512_L2_LICENSE_CYCLES,
+    PERF_EVENT_COUNT,
+};
+
+#define PPL_X86_PERF_EVENT_BIT(EVENT) (1u << (EVENT))
+#define PPL_X86_PERF_EVENT_ALL() ((1u << ppl::kernel::x86::PERF_EVENT_COUNT) - 1)
+
+const char *get_perf_event_name(const perf_event_t event);
+
+// core events are summed over every thread that was open()ed
+struct perf_counter_result_t {
+    uint32_t valid_mask;
+    uint64_t values[PERF_EVENT_COUNT];
+    double seconds;
+    int32_t num_threads;
+};
+
+/*
+    perf_event_open counters around a region of kernel calls.
+    open() creates the core events on each omp thread of the calling
+    context, so it must be called outside of a parallel region with the
+    thread count the kernels will use. events the host, kernel or
+    permissions do not allow are dropped, check valid_mask() after open.
+    start() and stop() can be called from the master thread only and are
+    cheap enough to bracket a single layer. RC_UNSUPPORTED off linux.
+*/
+class perf_counter_t {
+public:
+    perf_counter_t() {}
+    ~perf_counter_t()
+    {
+        close();
+    }
+
+    ppl::common::RetCode open(const uint32_t event_mask);
+    void close();
+
+    uint32_t valid_mask() const
+    {
+        return valid_mask_;
+    }
+
+    ppl::common::RetCode start();
+    ppl::common::RetCode stop(perf_counter_result_t *result);
+
+private:
+    perf_counter_t(const perf_counter_t &) = delete;
+    perf_counter_t &operator=(const perf_counter_t &) = delete;
+
+    struct event_fd_t {
+        int32_t fd;
+        int32_t event;
+        uint64_t scale; // dram cas lines to bytes
+    };
+
+    std::vector<event_fd_t> fds_;
+    uint32_t valid_mask_ = 0;
+    int64_t start_ns_    = 0;
+    int32_t num_threads_ = 0;
+};
+
+// theoretical fp32 peak of num_cores cores running isa code at freq_ghz
+struct machine_peak_t {
+    ppl::common::isa_t isa;
+    int32_t num_cores;
+    double freq_ghz;
+    double flops_per_cycle; // per core
+    double gflops;
+};
+
+/*
+    num_cores <= 0 uses the omp max threads, freq_ghz <= 0 reads the max
+    cpu frequency from sysfs, or the cpu0 clock of /proc/cpuinfo. flops
+    per cycle assume two fma ports for fma and avx512, and one add plus
+    one mul port for sse and avx.
+*/
+machine_peak_t get_machine_peak(const ppl::common::isa_t isa, const int32_t num_cores, const double freq_ghz);
+
+enum perf_bound_t {
+    PERF_BOUND_UNKNOWN = 0,
+    PERF_BOUND_COMPUTE,
+    PERF_BOUND_BANDWIDTH,
+};
+
+const char *get_perf_bound_name(const perf_bound_t bound);
+
+// ratios are 0 when the counters or peaks they need are missing
+struct perf_roofline_t {
+    double gflops;
+    double gbps;                 // dram bytes when counted, else model bytes
+    double arithmetic_intensity; // flops per byte of gbps
+    double ipc;
+    double freq_ghz;             // user cycles per thread per second
+    double compute_efficiency;   // gflops / peak gflops
+    double bandwidth_efficiency; // gbps / peak bandwidth
+    double avx512_license_ratio; // l1 + l2 license cycles / cycles
+    double l1d_mpki;
+    double l2_mpki;
+    double llc_mpki;
+    perf_bound_t bound;          // which roof the intensity sits under
+};
+
+/*
+    gops and gbytes are the model workload of the measured region.
+    peak_bandwidth_gbps is usually measured by the caller, 0 leaves the
+    bound unknown.
+*/
+perf_roofline_t analyze_perf_roofline(
+    const perf_counter_result_t *result,
+    const double gops,
+    const double gbytes,
+    const machine_peak_t *peak,
+    const double peak_bandwidth_gbps);
+
+}}}; // namespace ppl::kernel::x86
+
+#endif
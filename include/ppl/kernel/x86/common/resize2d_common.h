@@ -0,0 +1,71 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_COMMON_RESIZE2D_COMMON_H_
+#define __ST_PPL_KERNEL_X86_COMMON_RESIZE2D_COMMON_H_
+
+#include "ppl/kernel/x86/common/general_include.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+typedef int32_t resize2d_coord_trans_mode_t;
+class resize2d_coord_trans_mode {
+public:
+    static const resize2d_coord_trans_mode_t HALF_PIXEL = 0;
+    static const resize2d_coord_trans_mode_t PYTORCH_HALF_PIXEL = 1;
+    static const resize2d_coord_trans_mode_t ALIGN_CORNERS = 2;
+    static const resize2d_coord_trans_mode_t ASYMMETRIC = 3;
+    static const resize2d_coord_trans_mode_t TF_HALF_PIXEL_FOR_NN = 4;
+    static const resize2d_coord_trans_mode_t TF_CROP_AND_RESIZE = 5;
+};
+
+typedef int32_t resize2d_interp_mode_t;
+class resize2d_interp_mode {
+public:
+    static const resize2d_interp_mode_t NEAREST = 0;
+    static const resize2d_interp_mode_t LINEAR = 1;
+    static const resize2d_interp_mode_t CUBIC = 2;
+};
+
+typedef int32_t resize2d_nearest_mode_t;
+class resize2d_nearest_mode {
+public:
+    static const resize2d_nearest_mode_t ROUND_PREFER_FLOOR = 0;
+    static const resize2d_nearest_mode_t ROUND_PREFER_CEIL = 1;
+    static const resize2d_nearest_mode_t FLOOR = 2;
+    static const resize2d_nearest_mode_t CEIL = 3;
+};
+
+struct resize2d_param {
+    resize2d_coord_trans_mode_t coord_trans_mode;
+    resize2d_interp_mode_t interp_mode;
+    resize2d_nearest_mode_t nearest_mode;
+    float scale_h; // dst / src
+    float scale_w;
+    float cubic_coeff_a;
+    bool exclude_outside;
+    // only for TF_CROP_AND_RESIZE, roi is normalized to [0, 1]
+    float extrapolation_value;
+    float roi_start_h;
+    float roi_start_w;
+    float roi_end_h;
+    float roi_end_w;
+};
+
+}}}; // namespace ppl::kernel::x86
+
+#endif
@@ -34,6 +34,17 @@ void set_omp_core_binding(const int32_t *cores, const int32_t num_cores, const i
 int32_t get_omp_max_threads();
 void set_omp_num_threads(int32_t n);
 
+/*
+    reproducible mode:
+        kernels that split one reduction across threads switch to fixed size
+        chunks and a fixed combine tree, so outputs are bit-identical for any
+        number of threads. covers reduce, cumsum and gemm k blocking, softmax
+        never splits a reduction across threads. off by default, the overhead
+        budget is 5% against the default mode.
+*/
+void set_reproducible_mode(const int32_t on);
+bool get_reproducible_mode();
+
 template<typename T1, typename T2>
 void parallel_task_distribution_1d(
     const T1 thread_id,
@@ -28,6 +28,66 @@ ppl::common::RetCode argmax_ndarray_fp32(
     const int64_t axis,
     int64_t *dst);
 
+ppl::common::RetCode argmax_ndarray_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src_shape,
+    const float *src,
+    const int64_t axis,
+    const int64_t select_last_index,
+    int64_t *dst);
+
+ppl::common::RetCode argmin_ndarray_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src_shape,
+    const float *src,
+    const int64_t axis,
+    const int64_t select_last_index,
+    int64_t *dst);
+
+ppl::common::RetCode argmax_ndarray_fp32_sse(
+    const ppl::common::TensorShape *src_shape,
+    const float *src,
+    const int64_t axis,
+    const int64_t select_last_index,
+    int64_t *dst);
+
+ppl::common::RetCode argmin_ndarray_fp32_sse(
+    const ppl::common::TensorShape *src_shape,
+    const float *src,
+    const int64_t axis,
+    const int64_t select_last_index,
+    int64_t *dst);
+
+ppl::common::RetCode argmax_ndarray_fp32_fma(
+    const ppl::common::TensorShape *src_shape,
+    const float *src,
+    const int64_t axis,
+    const int64_t select_last_index,
+    int64_t *dst);
+
+ppl::common::RetCode argmin_ndarray_fp32_fma(
+    const ppl::common::TensorShape *src_shape,
+    const float *src,
+    const int64_t axis,
+    const int64_t select_last_index,
+    int64_t *dst);
+
+#ifdef PPL_USE_X86_AVX512
+ppl::common::RetCode argmax_ndarray_fp32_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const float *src,
+    const int64_t axis,
+    const int64_t select_last_index,
+    int64_t *dst);
+
+ppl::common::RetCode argmin_ndarray_fp32_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const float *src,
+    const int64_t axis,
+    const int64_t select_last_index,
+    int64_t *dst);
+#endif
+
 }}}; // namespace ppl::kernel::x86
 
 #endif
@@ -22,6 +22,172 @@
 
 namespace ppl { namespace kernel { namespace x86 {
 
+ppl::common::RetCode add_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    float *dst);
+
+ppl::common::RetCode sub_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    float *dst);
+
+ppl::common::RetCode mul_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    float *dst);
+
+ppl::common::RetCode div_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    float *dst);
+
+// resolved through the kernel registry against the running cpu
+ppl::common::RetCode add_fp32(
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    float *dst);
+
+ppl::common::RetCode sub_fp32(
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    float *dst);
+
+ppl::common::RetCode mul_fp32(
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    float *dst);
+
+ppl::common::RetCode div_fp32(
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    float *dst);
+
+/*
+    n16cx arithmetic writing a channel slice of a wider n16cx tensor, so an
+    elementwise concat input is produced straight into the concat output.
+    dst_shape describes the slice, dst points at its first channel and
+    dst_total_channels is the channel count of the whole tensor. the slice
+    must start on a multiple of 16 channels, see concat_view.h.
+*/
+ppl::common::RetCode add_n16cx_fp32_dst_view(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    const int64_t dst_total_channels,
+    float *dst);
+
+ppl::common::RetCode sub_n16cx_fp32_dst_view(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    const int64_t dst_total_channels,
+    float *dst);
+
+ppl::common::RetCode mul_n16cx_fp32_dst_view(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    const int64_t dst_total_channels,
+    float *dst);
+
+ppl::common::RetCode div_n16cx_fp32_dst_view(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    const int64_t dst_total_channels,
+    float *dst);
+
+#ifdef PPL_USE_X86_AVX512
+ppl::common::RetCode add_fp32_avx512(
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    float *dst);
+
+ppl::common::RetCode sub_fp32_avx512(
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    float *dst);
+
+ppl::common::RetCode mul_fp32_avx512(
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    float *dst);
+
+ppl::common::RetCode div_fp32_avx512(
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    float *dst);
+#endif
+
 ppl::common::RetCode add_fp32_avx(
     const ppl::common::TensorShape *src0_shape,
     const ppl::common::TensorShape *src1_shape,
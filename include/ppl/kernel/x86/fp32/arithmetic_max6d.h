@@ -22,6 +22,46 @@
 
 namespace ppl { namespace kernel { namespace x86 {
 
+ppl::common::RetCode add_ndarray_max6d_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *lhs_shape,
+    const ppl::common::TensorShape *rhs_shape,
+    const float *lhs,
+    const float *rhs,
+    float *dst);
+
+ppl::common::RetCode sub_ndarray_max6d_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *lhs_shape,
+    const ppl::common::TensorShape *rhs_shape,
+    const float *lhs,
+    const float *rhs,
+    float *dst);
+
+ppl::common::RetCode mul_ndarray_max6d_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *lhs_shape,
+    const ppl::common::TensorShape *rhs_shape,
+    const float *lhs,
+    const float *rhs,
+    float *dst);
+
+ppl::common::RetCode div_ndarray_max6d_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *lhs_shape,
+    const ppl::common::TensorShape *rhs_shape,
+    const float *lhs,
+    const float *rhs,
+    float *dst);
+
+ppl::common::RetCode pow_ndarray_max6d_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *lhs_shape,
+    const ppl::common::TensorShape *rhs_shape,
+    const float *lhs,
+    const float *rhs,
+    float *dst);
+
 ppl::common::RetCode add_ndarray_max6d_fp32_sse(
     const ppl::common::TensorShape *lhs_shape,
     const ppl::common::TensorShape *rhs_shape,
@@ -92,6 +132,43 @@ ppl::common::RetCode pow_ndarray_max6d_fp32_avx(
     const float *rhs,
     float *dst);
 
+#ifdef PPL_USE_X86_AVX512
+ppl::common::RetCode add_ndarray_max6d_fp32_avx512(
+    const ppl::common::TensorShape *lhs_shape,
+    const ppl::common::TensorShape *rhs_shape,
+    const float *lhs,
+    const float *rhs,
+    float *dst);
+
+ppl::common::RetCode sub_ndarray_max6d_fp32_avx512(
+    const ppl::common::TensorShape *lhs_shape,
+    const ppl::common::TensorShape *rhs_shape,
+    const float *lhs,
+    const float *rhs,
+    float *dst);
+
+ppl::common::RetCode mul_ndarray_max6d_fp32_avx512(
+    const ppl::common::TensorShape *lhs_shape,
+    const ppl::common::TensorShape *rhs_shape,
+    const float *lhs,
+    const float *rhs,
+    float *dst);
+
+ppl::common::RetCode div_ndarray_max6d_fp32_avx512(
+    const ppl::common::TensorShape *lhs_shape,
+    const ppl::common::TensorShape *rhs_shape,
+    const float *lhs,
+    const float *rhs,
+    float *dst);
+
+ppl::common::RetCode pow_ndarray_max6d_fp32_avx512(
+    const ppl::common::TensorShape *lhs_shape,
+    const ppl::common::TensorShape *rhs_shape,
+    const float *lhs,
+    const float *rhs,
+    float *dst);
+#endif
+
 }}}; // namespace ppl::kernel::x86
 
 #endif
@@ -36,6 +36,15 @@ ppl::common::RetCode concat_ndarray_fp32(
     const int32_t axis,
     float *dst);
 
+ppl::common::RetCode concat_n16cx_interleave_channels_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape **src_shape_list,
+    const float **src_list,
+    const int32_t num_src,
+    const int32_t axis,
+    const int32_t c_dim_idx,
+    float *dst);
+
 ppl::common::RetCode concat_n16cx_interleave_channels_fp32_avx(
     const ppl::common::TensorShape **src_shape_list,
     const float **src_list,
@@ -44,6 +53,16 @@ ppl::common::RetCode concat_n16cx_interleave_channels_fp32_avx(
     const int32_t c_dim_idx,
     float *dst);
 
+#ifdef PPL_USE_X86_AVX512
+ppl::common::RetCode concat_n16cx_interleave_channels_fp32_avx512(
+    const ppl::common::TensorShape **src_shape_list,
+    const float **src_list,
+    const int32_t num_src,
+    const int32_t axis,
+    const int32_t c_dim_idx,
+    float *dst);
+#endif
+
 }}}; // namespace ppl::kernel::x86
 
 #endif
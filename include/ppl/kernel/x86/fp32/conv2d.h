@@ -51,6 +51,10 @@ protected:
     const float *sum_src_;
     const ppl::common::TensorShape *sum_src_shape_;
 
+    // channels of the tensors src_ and dst_ point into, see concat_view.h
+    int64_t src_total_channels_;
+    int64_t dst_total_channels_;
+
     void *temp_buffer_;
 
 public:
@@ -64,6 +68,8 @@ public:
         , dst_shape_(nullptr)
         , sum_src_(nullptr)
         , sum_src_shape_(nullptr)
+        , src_total_channels_(0)
+        , dst_total_channels_(0)
         , temp_buffer_(nullptr) {}
 
     conv2d_fp32_executor(const conv2d_param *conv_param, const float *cvt_filter, const float *cvt_bias)
@@ -76,6 +82,8 @@ public:
         , dst_shape_(nullptr)
         , sum_src_(nullptr)
         , sum_src_shape_(nullptr)
+        , src_total_channels_(0)
+        , dst_total_channels_(0)
         , temp_buffer_(nullptr) {}
 
     virtual uint64_t cal_temp_buffer_size() = 0;
@@ -174,6 +182,26 @@ public:
         return sum_src_shape_;
     }
 
+    // src_ is a channel slice of a split input, 0 for a plain tensor
+    void set_src_total_channels(const int64_t src_total_channels)
+    {
+        src_total_channels_ = src_total_channels;
+    }
+    int64_t src_total_channels() const
+    {
+        return src_total_channels_ > 0 ? src_total_channels_ : src_shape_->GetDim(1);
+    }
+
+    // dst_ is a channel slice of a concat output, 0 for a plain tensor
+    void set_dst_total_channels(const int64_t dst_total_channels)
+    {
+        dst_total_channels_ = dst_total_channels;
+    }
+    int64_t dst_total_channels() const
+    {
+        return dst_total_channels_ > 0 ? dst_total_channels_ : dst_shape_->GetDim(1);
+    }
+
     void set_temp_buffer(void *temp_buffer)
     {
         temp_buffer_ = temp_buffer;
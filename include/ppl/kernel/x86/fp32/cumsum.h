@@ -30,6 +30,41 @@ ppl::common::RetCode cumsum_ndarray_fp32(
     const int64_t reverse,
     float *y);
 
+ppl::common::RetCode cumsum_ndarray_fp32_sse(
+    const ppl::common::TensorShape *x_shape,
+    const float *x,
+    const int64_t axis,
+    const int64_t exclusive,
+    const int64_t reverse,
+    float *y);
+
+ppl::common::RetCode cumsum_ndarray_fp32_fma(
+    const ppl::common::TensorShape *x_shape,
+    const float *x,
+    const int64_t axis,
+    const int64_t exclusive,
+    const int64_t reverse,
+    float *y);
+
+#ifdef PPL_USE_X86_AVX512
+ppl::common::RetCode cumsum_ndarray_fp32_avx512(
+    const ppl::common::TensorShape *x_shape,
+    const float *x,
+    const int64_t axis,
+    const int64_t exclusive,
+    const int64_t reverse,
+    float *y);
+#endif
+
+ppl::common::RetCode cumsum_ndarray_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *x_shape,
+    const float *x,
+    const int64_t axis,
+    const int64_t exclusive,
+    const int64_t reverse,
+    float *y);
+
 }}}; // namespace ppl::kernel::x86
 
 #endif
@@ -84,6 +84,110 @@ ppl::common::RetCode deform_conv2d_fp32_fma(
     void *temp_buffer,
     float *dst);
 
+// src and dst are n16cx, offset and mask stay ndarray as in the functions
+// above. group > 1 needs channels and num_output per group aligned to 16,
+// offset_group > 1 needs channels per offset group aligned to 16.
+// filter and bias are converted once by gen_cvt_weights, like the
+// gen_cvt_weights of the conv2d managers, and cvt_weights is then passed
+// to every call. the temp buffer only holds the sampled columns.
+uint64_t deform_conv2d_n16cx_fp32_fma_get_buffer_bytes(
+    const int64_t dst_h,
+    const int64_t dst_w,
+    const int64_t group,
+    const int64_t channels,
+    const int64_t num_output,
+    const int64_t kernel_h,
+    const int64_t kernel_w);
+
+uint64_t deform_conv2d_n16cx_fp32_fma_get_cvt_weights_bytes(
+    const int64_t group,
+    const int64_t channels,
+    const int64_t num_output,
+    const int64_t kernel_h,
+    const int64_t kernel_w);
+
+ppl::common::RetCode deform_conv2d_n16cx_fp32_fma_gen_cvt_weights(
+    const float *filter,
+    const float *bias,
+    const int64_t group,
+    const int64_t channels,
+    const int64_t num_output,
+    const int64_t kernel_h,
+    const int64_t kernel_w,
+    void *cvt_weights);
+
+ppl::common::RetCode deform_conv2d_n16cx_fp32_fma(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const float *offset,
+    const float *mask,
+    const void *cvt_weights,
+    const int64_t group,
+    const int64_t offset_group,
+    const int64_t channels,
+    const int64_t num_output,
+    const int64_t kernel_h,
+    const int64_t kernel_w,
+    const int64_t stride_h,
+    const int64_t stride_w,
+    const int64_t pad_h,
+    const int64_t pad_w,
+    const int64_t dilation_h,
+    const int64_t dilation_w,
+    void *temp_buffer,
+    float *dst);
+
+#ifdef PPL_USE_X86_AVX512
+uint64_t deform_conv2d_n16cx_fp32_avx512_get_buffer_bytes(
+    const int64_t dst_h,
+    const int64_t dst_w,
+    const int64_t group,
+    const int64_t channels,
+    const int64_t num_output,
+    const int64_t kernel_h,
+    const int64_t kernel_w);
+
+uint64_t deform_conv2d_n16cx_fp32_avx512_get_cvt_weights_bytes(
+    const int64_t group,
+    const int64_t channels,
+    const int64_t num_output,
+    const int64_t kernel_h,
+    const int64_t kernel_w);
+
+ppl::common::RetCode deform_conv2d_n16cx_fp32_avx512_gen_cvt_weights(
+    const float *filter,
+    const float *bias,
+    const int64_t group,
+    const int64_t channels,
+    const int64_t num_output,
+    const int64_t kernel_h,
+    const int64_t kernel_w,
+    void *cvt_weights);
+
+ppl::common::RetCode deform_conv2d_n16cx_fp32_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const float *offset,
+    const float *mask,
+    const void *cvt_weights,
+    const int64_t group,
+    const int64_t offset_group,
+    const int64_t channels,
+    const int64_t num_output,
+    const int64_t kernel_h,
+    const int64_t kernel_w,
+    const int64_t stride_h,
+    const int64_t stride_w,
+    const int64_t pad_h,
+    const int64_t pad_w,
+    const int64_t dilation_h,
+    const int64_t dilation_w,
+    void *temp_buffer,
+    float *dst);
+#endif
+
 }}}; // namespace ppl::kernel::x86
 
 #endif
@@ -0,0 +1,165 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_FP32_EMBEDDING_BAG_H_
+#define __ST_PPL_KERNEL_X86_FP32_EMBEDDING_BAG_H_
+
+#include "ppl/kernel/x86/common/general_include.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+/*
+    gathers rows of table[num_embeddings, embedding_dim] and pools every
+    bag into one row of dst[num_bags, embedding_dim] without materializing
+    the gathered rows.
+
+    bags are given by offsets or lengths, the other one is nullptr:
+        offsets[b] is the first index of bag b, bag num_bags - 1 ends at
+        num_indices. lengths[b] is the index count of bag b.
+        with both nullptr every index is a bag of its own, which makes it
+        a row gather with num_bags == num_indices.
+    mode: 0: sum, 1: mean, 2: max. empty bags produce zeros.
+    per_sample_weights scales every gathered row, sum mode only, nullable.
+*/
+ppl::common::RetCode embedding_bag_fp32(
+    const ppl::common::isa_t isa,
+    const float *table,
+    const int64_t *indices,
+    const int64_t *offsets,
+    const int64_t *lengths,
+    const float *per_sample_weights,
+    const int64_t num_embeddings,
+    const int64_t embedding_dim,
+    const int64_t num_indices,
+    const int64_t num_bags,
+    const int32_t mode,
+    float *dst);
+
+ppl::common::RetCode embedding_bag_fp32_sse(
+    const float *table,
+    const int64_t *indices,
+    const int64_t *offsets,
+    const int64_t *lengths,
+    const float *per_sample_weights,
+    const int64_t num_embeddings,
+    const int64_t embedding_dim,
+    const int64_t num_indices,
+    const int64_t num_bags,
+    const int32_t mode,
+    float *dst);
+
+ppl::common::RetCode embedding_bag_fp32_fma(
+    const float *table,
+    const int64_t *indices,
+    const int64_t *offsets,
+    const int64_t *lengths,
+    const float *per_sample_weights,
+    const int64_t num_embeddings,
+    const int64_t embedding_dim,
+    const int64_t num_indices,
+    const int64_t num_bags,
+    const int32_t mode,
+    float *dst);
+
+#ifdef PPL_USE_X86_AVX512
+ppl::common::RetCode embedding_bag_fp32_avx512(
+    const float *table,
+    const int64_t *indices,
+    const int64_t *offsets,
+    const int64_t *lengths,
+    const float *per_sample_weights,
+    const int64_t num_embeddings,
+    const int64_t embedding_dim,
+    const int64_t num_indices,
+    const int64_t num_bags,
+    const int32_t mode,
+    float *dst);
+#endif
+
+/*
+    embedding_bag_fp32 over a compressed table, rows are dequantized to
+    fp32 in registers. bags, mode and weights work as above.
+
+    table_type: 0: fp16, 1: int8 rowwise, 2: int4 rowwise
+        fp16 rows are embedding_dim halves.
+        rowwise rows hold embedding_dim unsigned levels followed by an
+        unaligned fp32 scale and fp32 bias, value = level * scale + bias.
+        int8 levels take one byte each. int4 levels take div_up(embedding_dim, 2)
+        bytes, even columns in the low nibble.
+*/
+ppl::common::RetCode embedding_bag_quantized_fp32(
+    const ppl::common::isa_t isa,
+    const void *table,
+    const int32_t table_type,
+    const int64_t *indices,
+    const int64_t *offsets,
+    const int64_t *lengths,
+    const float *per_sample_weights,
+    const int64_t num_embeddings,
+    const int64_t embedding_dim,
+    const int64_t num_indices,
+    const int64_t num_bags,
+    const int32_t mode,
+    float *dst);
+
+ppl::common::RetCode embedding_bag_quantized_fp32_sse(
+    const void *table,
+    const int32_t table_type,
+    const int64_t *indices,
+    const int64_t *offsets,
+    const int64_t *lengths,
+    const float *per_sample_weights,
+    const int64_t num_embeddings,
+    const int64_t embedding_dim,
+    const int64_t num_indices,
+    const int64_t num_bags,
+    const int32_t mode,
+    float *dst);
+
+ppl::common::RetCode embedding_bag_quantized_fp32_fma(
+    const void *table,
+    const int32_t table_type,
+    const int64_t *indices,
+    const int64_t *offsets,
+    const int64_t *lengths,
+    const float *per_sample_weights,
+    const int64_t num_embeddings,
+    const int64_t embedding_dim,
+    const int64_t num_indices,
+    const int64_t num_bags,
+    const int32_t mode,
+    float *dst);
+
+#ifdef PPL_USE_X86_AVX512
+ppl::common::RetCode embedding_bag_quantized_fp32_avx512(
+    const void *table,
+    const int32_t table_type,
+    const int64_t *indices,
+    const int64_t *offsets,
+    const int64_t *lengths,
+    const float *per_sample_weights,
+    const int64_t num_embeddings,
+    const int64_t embedding_dim,
+    const int64_t num_indices,
+    const int64_t num_bags,
+    const int32_t mode,
+    float *dst);
+#endif
+
+}}}; // namespace ppl::kernel::x86
+
+#endif
@@ -86,6 +86,42 @@ ppl::common::RetCode batch_gemm_fp32(
     const gemm_post_t post,
     float **C_list);
 
+// Run prod(batch_dims) gemms whose operands are addressed by per batch dimension strides
+// (in elements) instead of pointer lists. A zero stride broadcasts the operand along
+// that dimension, a null stride array shares the operand across the whole batch.
+// When typeB is PACKED, B_batch_strides step over whole packed matrices, which are
+// gemm_fp32_get_packed_b_bytes(isa, N, K) / sizeof(float) elements each.
+ppl::common::RetCode strided_batch_gemm_fp32(
+    const ppl::common::isa_t isa,
+    const float *A,
+    const float *B,
+    const float *bias,
+    const float *sum,
+    const gemm_m_type_t typeA,
+    const gemm_m_type_t typeB,
+    const gemm_v_type_t typebias,
+    const gemm_m_type_t typesum,
+    const int64_t batch_dim_count,
+    const int64_t *batch_dims,
+    const int64_t *A_batch_strides,
+    const int64_t *B_batch_strides,
+    const int64_t *bias_batch_strides,
+    const int64_t *sum_batch_strides,
+    const int64_t *C_batch_strides,
+    const int64_t M,
+    const int64_t N,
+    const int64_t K,
+    const int64_t lda,
+    const int64_t ldb,
+    const int64_t ldc,
+    const int64_t ldsum,
+    const float alpha,
+    const float beta,
+    const float beta_bias,
+    const float beta_sum,
+    const gemm_post_t post,
+    float *C);
+
 uint64_t gemm_fp32_ref_get_packed_b_bytes(
     const int64_t N,
     const int64_t K);
@@ -145,6 +181,36 @@ ppl::common::RetCode batch_gemm_fp32_ref(
     const gemm_post_t post,
     float **C_list);
 
+ppl::common::RetCode strided_batch_gemm_fp32_ref(
+    const float *A,
+    const float *B,
+    const float *bias,
+    const float *sum,
+    const gemm_m_type_t typeA,
+    const gemm_m_type_t typeB,
+    const gemm_v_type_t typebias,
+    const gemm_m_type_t typesum,
+    const int64_t batch_dim_count,
+    const int64_t *batch_dims,
+    const int64_t *A_batch_strides,
+    const int64_t *B_batch_strides,
+    const int64_t *bias_batch_strides,
+    const int64_t *sum_batch_strides,
+    const int64_t *C_batch_strides,
+    const int64_t M,
+    const int64_t N,
+    const int64_t K,
+    const int64_t lda,
+    const int64_t ldb,
+    const int64_t ldc,
+    const int64_t ldsum,
+    const float alpha,
+    const float beta,
+    const float beta_bias,
+    const float beta_sum,
+    const gemm_post_t post,
+    float *C);
+
 uint64_t gemm_fp32_sse_get_packed_b_bytes(
     const int64_t N,
     const int64_t K);
@@ -204,6 +270,36 @@ ppl::common::RetCode batch_gemm_fp32_sse(
     const gemm_post_t post,
     float **C_list);
 
+ppl::common::RetCode strided_batch_gemm_fp32_sse(
+    const float *A,
+    const float *B,
+    const float *bias,
+    const float *sum,
+    const gemm_m_type_t typeA,
+    const gemm_m_type_t typeB,
+    const gemm_v_type_t typebias,
+    const gemm_m_type_t typesum,
+    const int64_t batch_dim_count,
+    const int64_t *batch_dims,
+    const int64_t *A_batch_strides,
+    const int64_t *B_batch_strides,
+    const int64_t *bias_batch_strides,
+    const int64_t *sum_batch_strides,
+    const int64_t *C_batch_strides,
+    const int64_t M,
+    const int64_t N,
+    const int64_t K,
+    const int64_t lda,
+    const int64_t ldb,
+    const int64_t ldc,
+    const int64_t ldsum,
+    const float alpha,
+    const float beta,
+    const float beta_bias,
+    const float beta_sum,
+    const gemm_post_t post,
+    float *C);
+
 ppl::common::RetCode gemv_fp32_sse(
     const float *A,
     const float *B,
@@ -243,6 +339,32 @@ ppl::common::RetCode batch_gemv_fp32_sse(
     const gemm_post_t post,
     float **C_list);
 
+ppl::common::RetCode strided_batch_gemv_fp32_sse(
+    const float *A,
+    const float *B,
+    const float *bias,
+    const float *sum,
+    const gemm_v_type_t typeA,
+    const gemm_m_type_t typeB,
+    const gemm_v_type_t typebias,
+    const gemm_m_type_t typesum,
+    const int64_t batch_dim_count,
+    const int64_t *batch_dims,
+    const int64_t *A_batch_strides,
+    const int64_t *B_batch_strides,
+    const int64_t *bias_batch_strides,
+    const int64_t *sum_batch_strides,
+    const int64_t *C_batch_strides,
+    const int64_t N,
+    const int64_t K,
+    const int64_t ldb,
+    const float alpha,
+    const float beta,
+    const float beta_bias,
+    const float beta_sum,
+    const gemm_post_t post,
+    float *C);
+
 uint64_t gemm_fp32_fma_get_packed_b_bytes(
     const int64_t N,
     const int64_t K);
@@ -302,6 +424,36 @@ ppl::common::RetCode batch_gemm_fp32_fma(
     const gemm_post_t post,
     float **C_list);
 
+ppl::common::RetCode strided_batch_gemm_fp32_fma(
+    const float *A,
+    const float *B,
+    const float *bias,
+    const float *sum,
+    const gemm_m_type_t typeA,
+    const gemm_m_type_t typeB,
+    const gemm_v_type_t typebias,
+    const gemm_m_type_t typesum,
+    const int64_t batch_dim_count,
+    const int64_t *batch_dims,
+    const int64_t *A_batch_strides,
+    const int64_t *B_batch_strides,
+    const int64_t *bias_batch_strides,
+    const int64_t *sum_batch_strides,
+    const int64_t *C_batch_strides,
+    const int64_t M,
+    const int64_t N,
+    const int64_t K,
+    const int64_t lda,
+    const int64_t ldb,
+    const int64_t ldc,
+    const int64_t ldsum,
+    const float alpha,
+    const float beta,
+    const float beta_bias,
+    const float beta_sum,
+    const gemm_post_t post,
+    float *C);
+
 ppl::common::RetCode gemv_fp32_fma(
     const float *A,
     const float *B,
@@ -341,6 +493,32 @@ ppl::common::RetCode batch_gemv_fp32_fma(
     const gemm_post_t post,
     float **C_list);
 
+ppl::common::RetCode strided_batch_gemv_fp32_fma(
+    const float *A,
+    const float *B,
+    const float *bias,
+    const float *sum,
+    const gemm_v_type_t typeA,
+    const gemm_m_type_t typeB,
+    const gemm_v_type_t typebias,
+    const gemm_m_type_t typesum,
+    const int64_t batch_dim_count,
+    const int64_t *batch_dims,
+    const int64_t *A_batch_strides,
+    const int64_t *B_batch_strides,
+    const int64_t *bias_batch_strides,
+    const int64_t *sum_batch_strides,
+    const int64_t *C_batch_strides,
+    const int64_t N,
+    const int64_t K,
+    const int64_t ldb,
+    const float alpha,
+    const float beta,
+    const float beta_bias,
+    const float beta_sum,
+    const gemm_post_t post,
+    float *C);
+
 #ifdef PPL_USE_X86_AVX512
 uint64_t gemm_fp32_avx512_get_packed_b_bytes(
     const int64_t N,
@@ -400,6 +578,36 @@ ppl::common::RetCode batch_gemm_fp32_avx512(
     const float beta_sum,
     const gemm_post_t post,
     float **C_list);
+
+ppl::common::RetCode strided_batch_gemm_fp32_avx512(
+    const float *A,
+    const float *B,
+    const float *bias,
+    const float *sum,
+    const gemm_m_type_t typeA,
+    const gemm_m_type_t typeB,
+    const gemm_v_type_t typebias,
+    const gemm_m_type_t typesum,
+    const int64_t batch_dim_count,
+    const int64_t *batch_dims,
+    const int64_t *A_batch_strides,
+    const int64_t *B_batch_strides,
+    const int64_t *bias_batch_strides,
+    const int64_t *sum_batch_strides,
+    const int64_t *C_batch_strides,
+    const int64_t M,
+    const int64_t N,
+    const int64_t K,
+    const int64_t lda,
+    const int64_t ldb,
+    const int64_t ldc,
+    const int64_t ldsum,
+    const float alpha,
+    const float beta,
+    const float beta_bias,
+    const float beta_sum,
+    const gemm_post_t post,
+    float *C);
 #endif
 
 }}}; // namespace ppl::kernel::x86
@@ -0,0 +1,88 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_FP32_GRID_SAMPLE_H_
+#define __ST_PPL_KERNEL_X86_FP32_GRID_SAMPLE_H_
+
+#include "ppl/kernel/x86/common/general_include.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+/*
+    onnx GridSample over 4-d src, grid is [N, dst_h, dst_w, 2] of (x, y).
+    mode: 0: bilinear, 1: nearest, 2: bicubic
+    padding_mode: 0: zeros, 1: border, 2: reflection
+    n16cx variants compute the sampling taps of a pixel once and apply them
+    to every 16 channel block.
+*/
+ppl::common::RetCode grid_sample_ndarray_fp32(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *grid_shape,
+    const float *src,
+    const float *grid,
+    const int64_t mode,
+    const int64_t padding_mode,
+    const bool align_corners,
+    float *dst);
+
+// picks the layout from src_shape and the kernel from the running cpu
+ppl::common::RetCode grid_sample_fp32(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *grid_shape,
+    const float *src,
+    const float *grid,
+    const int64_t mode,
+    const int64_t padding_mode,
+    const bool align_corners,
+    float *dst);
+
+ppl::common::RetCode grid_sample_n16cx_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *grid_shape,
+    const float *src,
+    const float *grid,
+    const int64_t mode,
+    const int64_t padding_mode,
+    const bool align_corners,
+    float *dst);
+
+ppl::common::RetCode grid_sample_n16cx_fp32_fma(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *grid_shape,
+    const float *src,
+    const float *grid,
+    const int64_t mode,
+    const int64_t padding_mode,
+    const bool align_corners,
+    float *dst);
+
+#ifdef PPL_USE_X86_AVX512
+ppl::common::RetCode grid_sample_n16cx_fp32_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *grid_shape,
+    const float *src,
+    const float *grid,
+    const int64_t mode,
+    const int64_t padding_mode,
+    const bool align_corners,
+    float *dst);
+#endif
+
+}}}; // namespace ppl::kernel::x86
+
+#endif
@@ -0,0 +1,300 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_FP32_IR_CONV2D_H_
+#define __ST_PPL_KERNEL_X86_FP32_IR_CONV2D_H_
+
+#include "ppl/kernel/x86/common/general_include.h"
+#include "ppl/kernel/x86/fp32/conv2d.h"
+#include "ppl/kernel/x86/fp32/pd_conv2d.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+typedef uint32_t ir_conv2d_fp32_algo_t;
+
+class ir_conv2d_fp32_algo {
+public:
+    static const ir_conv2d_fp32_algo_t UNKNOWN     = 0;
+    static const ir_conv2d_fp32_algo_t GEMM_DIRECT = 1;
+};
+
+struct ir_conv2d_fp32_algo_info {
+    ir_conv2d_fp32_algo_t algo_type;
+    ppl::common::isa_t isa;
+    ppl::common::dataformat_t input_format;
+    ppl::common::dataformat_t output_format;
+};
+
+// Inverted Residual Conv2d: expand(pointwise) -> depthwise -> project(pointwise) [+ residual]
+class ir_conv2d_fp32_executor {
+protected:
+    conv2d_fp32_executor *expand_conv2d_executor_;
+    conv2d_fp32_executor *depthwise_conv2d_executor_;
+    conv2d_fp32_executor *project_conv2d_executor_;
+    pd_conv2d_fp32_mode_t mode_; // available after prepare()
+    ppl::common::TensorShape expand_shape_; // available after prepare()
+    ppl::common::TensorShape depthwise_shape_; // available after prepare()
+
+    const float *src_;
+    const ppl::common::TensorShape *src_shape_;
+    float *dst_;
+    const ppl::common::TensorShape *dst_shape_;
+
+    const float *sum_src_;
+    const ppl::common::TensorShape *sum_src_shape_;
+
+    void *temp_buffer_;
+
+public:
+    ir_conv2d_fp32_executor()
+        : expand_conv2d_executor_(nullptr)
+        , depthwise_conv2d_executor_(nullptr)
+        , project_conv2d_executor_(nullptr)
+        , mode_(pd_conv2d_fp32_mode::UNKNOWN)
+        , src_(nullptr)
+        , src_shape_(nullptr)
+        , dst_(nullptr)
+        , dst_shape_(nullptr)
+        , sum_src_(nullptr)
+        , sum_src_shape_(nullptr)
+        , temp_buffer_(nullptr) {}
+    ir_conv2d_fp32_executor(
+        conv2d_fp32_executor *expand_exec,
+        conv2d_fp32_executor *depthwise_exec,
+        conv2d_fp32_executor *project_exec)
+        : mode_(pd_conv2d_fp32_mode::UNKNOWN)
+        , src_(nullptr)
+        , src_shape_(nullptr)
+        , dst_(nullptr)
+        , dst_shape_(nullptr)
+        , sum_src_(nullptr)
+        , sum_src_shape_(nullptr)
+        , temp_buffer_(nullptr) {
+        this->expand_conv2d_executor_ = expand_exec;
+        this->depthwise_conv2d_executor_ = depthwise_exec;
+        this->project_conv2d_executor_ = project_exec;
+    }
+
+    virtual uint64_t cal_temp_buffer_size() = 0;
+    virtual ppl::common::RetCode prepare() = 0;
+    virtual ppl::common::RetCode execute() = 0;
+    virtual ~ir_conv2d_fp32_executor() {}
+
+    pd_conv2d_fp32_mode_t mode() const {
+        return mode_;
+    }
+
+    const ppl::common::TensorShape &expand_shape() const {
+        return expand_shape_;
+    }
+    const ppl::common::TensorShape &depthwise_shape() const {
+        return depthwise_shape_;
+    }
+
+    void set_expand_conv2d_executor(conv2d_fp32_executor *exec) {
+        expand_conv2d_executor_ = exec;
+    }
+    conv2d_fp32_executor *expand_conv2d_executor() const
+    {
+        return expand_conv2d_executor_;
+    }
+    void set_depthwise_conv2d_executor(conv2d_fp32_executor *exec) {
+        depthwise_conv2d_executor_ = exec;
+    }
+    conv2d_fp32_executor *depthwise_conv2d_executor() const
+    {
+        return depthwise_conv2d_executor_;
+    }
+    void set_project_conv2d_executor(conv2d_fp32_executor *exec) {
+        project_conv2d_executor_ = exec;
+    }
+    conv2d_fp32_executor *project_conv2d_executor() const
+    {
+        return project_conv2d_executor_;
+    }
+
+    void set_src(const float *src)
+    {
+        src_ = src;
+    }
+    const float *src() const
+    {
+        return src_;
+    }
+
+    void set_src_shape(const ppl::common::TensorShape *src_shape)
+    {
+        src_shape_ = src_shape;
+    }
+    const ppl::common::TensorShape *src_shape() const
+    {
+        return src_shape_;
+    }
+
+    void set_dst(float *dst)
+    {
+        dst_ = dst;
+    }
+    float *dst() const
+    {
+        return dst_;
+    }
+
+    void set_dst_shape(const ppl::common::TensorShape *dst_shape)
+    {
+        dst_shape_ = dst_shape;
+    }
+    const ppl::common::TensorShape *dst_shape() const
+    {
+        return dst_shape_;
+    }
+
+    // residual, fused by project conv with conv_fuse_flag::SUM. usually the same tensor as src
+    void set_sum_src(const float *sum_src)
+    {
+        sum_src_ = sum_src;
+    }
+    const float *sum_src() const
+    {
+        return sum_src_;
+    }
+
+    void set_sum_src_shape(const ppl::common::TensorShape *sum_src_shape)
+    {
+        sum_src_shape_ = sum_src_shape;
+    }
+    const ppl::common::TensorShape *sum_src_shape() const
+    {
+        return sum_src_shape_;
+    }
+
+    void set_temp_buffer(void *temp_buffer)
+    {
+        temp_buffer_ = temp_buffer;
+    }
+    void *temp_buffer() const
+    {
+        return temp_buffer_;
+    }
+};
+
+class ir_conv2d_fp32_manager {
+protected:
+    conv2d_fp32_manager *expand_conv2d_manager_;
+    conv2d_fp32_manager *depthwise_conv2d_manager_;
+    conv2d_fp32_manager *project_conv2d_manager_;
+
+public:
+    ir_conv2d_fp32_manager()
+        : expand_conv2d_manager_(nullptr)
+        , depthwise_conv2d_manager_(nullptr)
+        , project_conv2d_manager_(nullptr) {};
+    ir_conv2d_fp32_manager(
+        conv2d_fp32_manager *expand_mgr,
+        conv2d_fp32_manager *depthwise_mgr,
+        conv2d_fp32_manager *project_mgr)
+    {
+        this->expand_conv2d_manager_ = expand_mgr;
+        this->depthwise_conv2d_manager_ = depthwise_mgr;
+        this->project_conv2d_manager_ = project_mgr;
+    }
+
+    virtual ir_conv2d_fp32_executor *gen_executor() = 0;
+
+    void set_expand_conv2d_manager(conv2d_fp32_manager *mgr)
+    {
+        expand_conv2d_manager_ = mgr;
+    }
+    conv2d_fp32_manager *expand_conv2d_manager()
+    {
+        return expand_conv2d_manager_;
+    }
+    void set_depthwise_conv2d_manager(conv2d_fp32_manager *mgr)
+    {
+        depthwise_conv2d_manager_ = mgr;
+    }
+    conv2d_fp32_manager *depthwise_conv2d_manager()
+    {
+        return depthwise_conv2d_manager_;
+    }
+    void set_project_conv2d_manager(conv2d_fp32_manager *mgr)
+    {
+        project_conv2d_manager_ = mgr;
+    }
+    conv2d_fp32_manager *project_conv2d_manager()
+    {
+        return project_conv2d_manager_;
+    }
+
+    ppl::common::RetCode gen_cvt_weights(
+        const float *expand_filter,
+        const float *expand_bias,
+        const float *depthwise_filter,
+        const float *depthwise_bias,
+        const float *project_filter,
+        const float *project_bias)
+    {
+        if (!expand_conv2d_manager_ || !depthwise_conv2d_manager_ || !project_conv2d_manager_) {
+            return ppl::common::RC_OTHER_ERROR;
+        }
+        ppl::common::RetCode rc;
+        rc = expand_conv2d_manager_->gen_cvt_weights(expand_filter, expand_bias);
+        if (ppl::common::RC_SUCCESS != rc) {
+            return rc;
+        }
+        rc = depthwise_conv2d_manager_->gen_cvt_weights(depthwise_filter, depthwise_bias);
+        if (ppl::common::RC_SUCCESS != rc) {
+            return rc;
+        }
+        return project_conv2d_manager_->gen_cvt_weights(project_filter, project_bias);
+    }
+
+    void release_cvt_weights()
+    {
+        if (expand_conv2d_manager_) expand_conv2d_manager_->release_cvt_weights();
+        if (depthwise_conv2d_manager_) depthwise_conv2d_manager_->release_cvt_weights();
+        if (project_conv2d_manager_) project_conv2d_manager_->release_cvt_weights();
+    }
+
+    virtual ~ir_conv2d_fp32_manager() {};
+};
+
+class ir_conv2d_algo_selector {
+public:
+    static ir_conv2d_fp32_algo_info select_algo(
+        const conv2d_algo_info &expand_algo,
+        const conv2d_algo_info &depthwise_algo,
+        const conv2d_algo_info &project_algo,
+        const conv2d_param &expand_param,
+        const conv2d_param &depthwise_param,
+        const conv2d_param &project_param);
+    static ir_conv2d_fp32_manager *gen_algo(
+        const conv2d_param &expand_param,
+        const conv2d_param &depthwise_param,
+        const conv2d_param &project_param,
+        const ir_conv2d_fp32_algo_info &algo_info,
+        ppl::common::Allocator *allocator);
+    static ir_conv2d_fp32_manager *gen_algo(
+        const ir_conv2d_fp32_algo_info &algo_info,
+        conv2d_fp32_manager *expand_mgr,
+        conv2d_fp32_manager *depthwise_mgr,
+        conv2d_fp32_manager *project_mgr);
+};
+
+}}};
+
+#endif
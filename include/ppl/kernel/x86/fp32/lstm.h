@@ -111,6 +111,26 @@ ppl::common::RetCode lstm_fp32(
     float *Y_h,
     float *Y_c);
 
+// picks the kernel through the kernel registry. the packed weight layout
+// depends on the isa of the kernel, so W and R are taken unpacked here,
+// callers packing them have to use the isa-taking entry above.
+ppl::common::RetCode lstm_fp32(
+    const ppl::common::TensorShape *X_shape,
+    const float *X,
+    const float **W,
+    const float **R,
+    const float *P,
+    const float *bias,
+    const int32_t *sequence_lens,
+    const float *initial_h,
+    const float *initial_c,
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    void *temp_buffer,
+    float *Y,
+    float *Y_h,
+    float *Y_c);
+
 }}}; // namespace ppl::kernel::x86
 
 #endif //! __ST_PPL_KERNEL_X86_FP32_GEMM_H_
@@ -22,6 +22,22 @@
 
 namespace ppl { namespace kernel { namespace x86 {
 
+ppl::common::RetCode max_eltwise_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *dst_shape,
+    const float **src_list,
+    const uint32_t num_src,
+    float *dst);
+
+ppl::common::RetCode max_ndarray_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape **src_shape_list,
+    const ppl::common::TensorShape *dst_shape,
+    const float **src_list,
+    const uint32_t num_src,
+    void *temp_buffer,
+    float *dst);
+
 uint64_t max_fp32_avx_get_temp_buffer_bytes(
     const uint32_t num_src);
 
@@ -56,6 +72,25 @@ ppl::common::RetCode max_ndarray_fp32_sse(
     void *temp_buffer,
     float *dst);
 
+#ifdef PPL_USE_X86_AVX512
+uint64_t max_fp32_avx512_get_temp_buffer_bytes(
+    const uint32_t num_src);
+
+ppl::common::RetCode max_eltwise_fp32_avx512(
+    const ppl::common::TensorShape *dst_shape,
+    const float **src_list,
+    const uint32_t num_src,
+    float *dst);
+
+ppl::common::RetCode max_ndarray_fp32_avx512(
+    const ppl::common::TensorShape **src_shape_list,
+    const ppl::common::TensorShape *dst_shape,
+    const float **src_list,
+    const uint32_t num_src,
+    void *temp_buffer,
+    float *dst);
+#endif
+
 }}}; // namespace ppl::kernel::x86
 
 #endif // !__ST_PPL_KERNEL_X86_FP32_MAX_H_
@@ -31,6 +31,30 @@ ppl::common::RetCode mmcv_nms_ndarray_fp32(
         int64_t *dst,
         int64_t *num_boxes_out);
 
+// same result as above, suppression is computed as a bit matrix with simd
+ppl::common::RetCode mmcv_nms_ndarray_fp32(
+        const ppl::common::isa_t isa,
+        const float *boxes,
+        const float *scores,
+        const uint32_t num_boxes_in,
+        const float iou_threshold,
+        const int64_t offset,
+        int64_t *dst,
+        int64_t *num_boxes_out);
+
+// mmcv batched_nms: boxes only suppress boxes of the same class in idxs,
+// dst is sorted by score over all classes
+ppl::common::RetCode mmcv_batched_nms_ndarray_fp32(
+        const ppl::common::isa_t isa,
+        const float *boxes,
+        const float *scores,
+        const int64_t *idxs,
+        const uint32_t num_boxes_in,
+        const float iou_threshold,
+        const int64_t offset,
+        int64_t *dst,
+        int64_t *num_boxes_out);
+
 }}}; // namespace ppl::kernel::x86
 
 #endif //! __ST_PPL_KERNEL_X86_FP32_MMCV_NMS_H_
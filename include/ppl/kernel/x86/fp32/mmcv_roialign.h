@@ -72,6 +72,45 @@ ppl::common::RetCode mmcv_roialign_n16cx_fp32_avx512(
     float *output);
 #endif
 
+/*
+    rois are [num_rois, 6] of (batch, center_x, center_y, w, h, theta) as
+    mmcv roi_align_rotated, always average pooled. clockwise negates theta.
+*/
+ppl::common::RetCode mmcv_roialign_rotated_n16cx_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *input_shape,
+    const ppl::common::TensorShape *rois_shape,
+    const ppl::common::TensorShape *output_shape,
+    const float *input,
+    const float *rois,
+    const int64_t aligned,
+    const int64_t sampling_ratio,
+    const float spatial_scale,
+    const bool clockwise,
+    float *output);
+
+/*
+    fpn roi extractor, every roi of [num_rois, 5] pools from one of the
+    num_levels feature maps. roi_levels gives the level of every roi, when
+    it is null the level is mapped by roi scale as mmdet does:
+    floor(log2(sqrt(w * h) / finest_scale + 1e-6)) clamped to [0, num_levels).
+*/
+ppl::common::RetCode mmcv_roialign_multilevel_n16cx_fp32(
+    const ppl::common::isa_t isa,
+    const int64_t num_levels,
+    const ppl::common::TensorShape **input_shapes,
+    const float **inputs,
+    const float *spatial_scales,
+    const ppl::common::TensorShape *rois_shape,
+    const ppl::common::TensorShape *output_shape,
+    const float *rois,
+    const int32_t *roi_levels,
+    const float finest_scale,
+    const int64_t aligned,
+    const int64_t sampling_ratio,
+    const int32_t pool_mode, // 0: max, 1: avg
+    float *output);
+
 }}}; // namespace ppl::kernel::x86
 
 #endif //! __ST_PPL_KERNEL_X86_FP32_MMCV_ROIALIGN_H_
@@ -31,6 +31,7 @@ public:
     static const pd_conv2d_fp32_algo_t UNKNOWN  = 0;
     static const pd_conv2d_fp32_algo_t GEMM_DIRECT = 1;
     static const pd_conv2d_fp32_algo_t DIRECT = 2;
+    static const pd_conv2d_fp32_algo_t DEPTHWISE_GEMM_DIRECT = 3; // depthwise -> pointwise
 };
 
 class pd_conv2d_fp32_mode {
@@ -59,6 +60,9 @@ protected:
     float *dst_;
     const ppl::common::TensorShape *dst_shape_;
 
+    const float *sum_src_;
+    const ppl::common::TensorShape *sum_src_shape_;
+
     void *temp_buffer_;
 
 public:
@@ -70,6 +74,8 @@ public:
         , src_shape_(nullptr)
         , dst_(nullptr)
         , dst_shape_(nullptr)
+        , sum_src_(nullptr)
+        , sum_src_shape_(nullptr)
         , temp_buffer_(nullptr) {}
     pd_conv2d_fp32_executor(conv2d_fp32_executor *exec, conv2d_fp32_executor *depthwise_exec)
         : mode_(pd_conv2d_fp32_mode::UNKNOWN)
@@ -77,6 +83,8 @@ public:
         , src_shape_(nullptr)
         , dst_(nullptr)
         , dst_shape_(nullptr)
+        , sum_src_(nullptr)
+        , sum_src_shape_(nullptr)
         , temp_buffer_(nullptr) {
         this->conv2d_executor_ = exec;
         this->depthwise_conv2d_executor_ = depthwise_exec;
@@ -146,6 +154,25 @@ public:
         return dst_shape_;
     }
 
+    // only the last conv of the pair could fuse sum
+    void set_sum_src(const float *sum_src)
+    {
+        sum_src_ = sum_src;
+    }
+    const float *sum_src() const
+    {
+        return sum_src_;
+    }
+
+    void set_sum_src_shape(const ppl::common::TensorShape *sum_src_shape)
+    {
+        sum_src_shape_ = sum_src_shape;
+    }
+    const ppl::common::TensorShape *sum_src_shape() const
+    {
+        return sum_src_shape_;
+    }
+
     void set_temp_buffer(void *temp_buffer)
     {
         temp_buffer_ = temp_buffer;
@@ -221,6 +248,9 @@ public:
 };
 
 // Post-Depthwise Conv2d
+// Also select Pre-Depthwise Conv2d(depthwise -> pointwise) when algo is depthwise,
+// in which case post_algo/post_param describe the pointwise conv.
+// gen_algo always take the non-depthwise conv param as param.
 class pd_conv2d_algo_selector {
 public:
     static pd_conv2d_fp32_algo_info select_algo(
@@ -22,6 +22,87 @@
 
 namespace ppl { namespace kernel { namespace x86 {
 
+ppl::common::RetCode reduce_max_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+
+ppl::common::RetCode reduce_min_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+
+ppl::common::RetCode reduce_mean_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+
+ppl::common::RetCode reduce_sum_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+
+ppl::common::RetCode reduce_prod_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+
+ppl::common::RetCode reduce_l1_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+
+ppl::common::RetCode reduce_l2_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+
+ppl::common::RetCode reduce_sum_square_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+
+ppl::common::RetCode reduce_log_sum_exp_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+
 ppl::common::RetCode reduce_max_fp32_avx(
     const ppl::common::TensorShape *src_shape,
     const ppl::common::TensorShape *dst_shape,
@@ -54,6 +135,38 @@ ppl::common::RetCode reduce_sum_fp32_avx(
     const int32_t num_axes,
     float *dst);
 
+ppl::common::RetCode reduce_prod_fp32_avx(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+
+ppl::common::RetCode reduce_l1_fp32_avx(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+
+ppl::common::RetCode reduce_l2_fp32_avx(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+
+ppl::common::RetCode reduce_sum_square_fp32_avx(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+
 ppl::common::RetCode reduce_max_fp32_sse(
     const ppl::common::TensorShape *src_shape,
     const ppl::common::TensorShape *dst_shape,
@@ -86,6 +199,128 @@ ppl::common::RetCode reduce_sum_fp32_sse(
     const int32_t num_axes,
     float *dst);
 
+ppl::common::RetCode reduce_prod_fp32_sse(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+
+ppl::common::RetCode reduce_l1_fp32_sse(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+
+ppl::common::RetCode reduce_l2_fp32_sse(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+
+ppl::common::RetCode reduce_sum_square_fp32_sse(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+
+ppl::common::RetCode reduce_log_sum_exp_fp32_fma(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+
+ppl::common::RetCode reduce_log_sum_exp_fp32_sse(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+
+#ifdef PPL_USE_X86_AVX512
+ppl::common::RetCode reduce_max_fp32_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+
+ppl::common::RetCode reduce_min_fp32_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+
+ppl::common::RetCode reduce_mean_fp32_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+
+ppl::common::RetCode reduce_sum_fp32_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+
+ppl::common::RetCode reduce_prod_fp32_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+
+ppl::common::RetCode reduce_l1_fp32_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+
+ppl::common::RetCode reduce_l2_fp32_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+
+ppl::common::RetCode reduce_sum_square_fp32_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+
+ppl::common::RetCode reduce_log_sum_exp_fp32_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst);
+#endif
+
 }}}; // namespace ppl::kernel::x86
 
 #endif
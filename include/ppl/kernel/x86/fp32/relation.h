@@ -22,6 +22,54 @@
 
 namespace ppl { namespace kernel { namespace x86 {
 
+ppl::common::RetCode greater_eltwise_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    uint8_t *dst);
+
+ppl::common::RetCode greater_ndarray_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    uint8_t *dst);
+
+ppl::common::RetCode equal_eltwise_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    uint8_t *dst);
+
+ppl::common::RetCode equal_ndarray_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    uint8_t *dst);
+
+ppl::common::RetCode less_eltwise_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    uint8_t *dst);
+
+ppl::common::RetCode less_ndarray_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    uint8_t *dst);
+
 ppl::common::RetCode greater_eltwise_fp32_avx(
     const ppl::common::TensorShape *dst_shape,
     const float *src0,
@@ -106,6 +154,50 @@ ppl::common::RetCode less_ndarray_fp32_sse(
     const float *src1,
     uint8_t *dst);
 
+#ifdef PPL_USE_X86_AVX512
+ppl::common::RetCode greater_eltwise_fp32_avx512(
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    uint8_t *dst);
+
+ppl::common::RetCode greater_ndarray_fp32_avx512(
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    uint8_t *dst);
+
+ppl::common::RetCode equal_eltwise_fp32_avx512(
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    uint8_t *dst);
+
+ppl::common::RetCode equal_ndarray_fp32_avx512(
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    uint8_t *dst);
+
+ppl::common::RetCode less_eltwise_fp32_avx512(
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    uint8_t *dst);
+
+ppl::common::RetCode less_ndarray_fp32_avx512(
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    uint8_t *dst);
+#endif
+
 }}}; // namespace ppl::kernel::x86
 
 #endif
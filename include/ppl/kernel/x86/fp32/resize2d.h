@@ -19,6 +19,7 @@
 #define __ST_PPL_KERNEL_X86_FP32_RESIZE_H_
 
 #include "ppl/kernel/x86/common/general_include.h"
+#include "ppl/kernel/x86/common/resize2d_common.h"
 
 namespace ppl { namespace kernel { namespace x86 {
 
@@ -91,6 +92,57 @@ ppl::common::RetCode resize2d_n16cx_pytorch_2linear_floor_fp32_avx512(
     float *dst);
 #endif
 
+// Resize engine for all interp_mode and coord_trans_mode of onnx Resize
+uint64_t resize2d_ndarray_fp32_get_buffer_bytes(
+    const ppl::common::TensorShape *dst_shape,
+    const resize2d_param *param);
+
+uint64_t resize2d_n16cx_fp32_get_buffer_bytes(
+    const ppl::common::TensorShape *dst_shape,
+    const resize2d_param *param);
+
+ppl::common::RetCode resize2d_ndarray_fp32(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const resize2d_param *param,
+    void *temp_buffer,
+    float *dst);
+
+ppl::common::RetCode resize2d_ndarray_fp32_avx(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const resize2d_param *param,
+    void *temp_buffer,
+    float *dst);
+
+ppl::common::RetCode resize2d_n16cx_fp32_avx(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const resize2d_param *param,
+    void *temp_buffer,
+    float *dst);
+
+#ifdef PPL_USE_X86_AVX512
+ppl::common::RetCode resize2d_ndarray_fp32_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const resize2d_param *param,
+    void *temp_buffer,
+    float *dst);
+
+ppl::common::RetCode resize2d_n16cx_fp32_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const resize2d_param *param,
+    void *temp_buffer,
+    float *dst);
+#endif
+
 }}}; // namespace ppl::kernel::x86
 
 #endif
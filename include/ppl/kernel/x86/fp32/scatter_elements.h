@@ -31,6 +31,17 @@ ppl::common::RetCode scatter_elements_ndarray_fp32(
     const int64_t axis,
     float *dst);
 
+// reduction: 0: none, 1: add, 2: mul, 3: max, 4: min
+ppl::common::RetCode scatter_elements_ndarray_fp32(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *indices_shape,
+    const float *src,
+    const int64_t *indices,
+    const float *updates,
+    const int64_t axis,
+    const int32_t reduction,
+    float *dst);
+
 }}}; // namespace ppl::kernel::x86
 
 #endif
\ No newline at end of file
@@ -33,6 +33,20 @@ ppl::common::RetCode scatter_nd_ndarray_fp32(
     const int64_t indices_dim,
     float *dst);
 
+// reduction: 0: none, 1: add, 2: mul, 3: max, 4: min
+// duplicated indices are combined in index order for any thread count
+ppl::common::RetCode scatter_nd_ndarray_fp32(
+    const float *src,
+    const float *updates,
+    const int64_t *indices,
+    const int32_t *strides,
+    const int64_t src_length,
+    const int64_t inner_dim,
+    const int64_t num_indices,
+    const int64_t indices_dim,
+    const int32_t reduction,
+    float *dst);
+
 }}}; // namespace ppl::kernel::x86
 
 #endif
@@ -38,6 +38,16 @@ ppl::common::RetCode split_n16cx_fp32(
     const int32_t num_dst,
     float **dst_list);
 
+ppl::common::RetCode split_n16cx_interleave_channels_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape **dst_shape_list,
+    const float *src,
+    const int32_t slice_axis,
+    const int32_t num_dst,
+    const int32_t c_dim_idx,
+    float **dst_list);
+
 ppl::common::RetCode split_n16cx_interleave_channels_fp32_avx(
     const ppl::common::TensorShape *src_shape,
     const ppl::common::TensorShape **dst_shape_list,
@@ -47,6 +57,17 @@ ppl::common::RetCode split_n16cx_interleave_channels_fp32_avx(
     const int32_t c_dim_idx,
     float **dst_list);
 
+#ifdef PPL_USE_X86_AVX512
+ppl::common::RetCode split_n16cx_interleave_channels_fp32_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape **dst_shape_list,
+    const float *src,
+    const int32_t slice_axis,
+    const int32_t num_dst,
+    const int32_t c_dim_idx,
+    float **dst_list);
+#endif
+
 }}}; // namespace ppl::kernel::x86
 
 #endif
@@ -29,6 +29,22 @@ ppl::common::RetCode transpose_ndarray_fp32(
     const int32_t *perm,
     float *dst);
 
+ppl::common::RetCode transpose_ndarray_fp32_avx(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *perm,
+    float *dst);
+
+#ifdef PPL_USE_X86_AVX512
+ppl::common::RetCode transpose_ndarray_fp32_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *perm,
+    float *dst);
+#endif
+
 ppl::common::RetCode transpose_ndarray_continous2d_fp32(
     const ppl::common::TensorShape *src_shape,
     const float *src,
@@ -23,6 +23,7 @@
 namespace ppl { namespace kernel { namespace x86 {
 
 ppl::common::RetCode where_eltwise_fp32(
+    const ppl::common::isa_t isa,
     const ppl::common::TensorShape *dst_shape,
     const uint8_t *cond,
     const float *src_x,
@@ -30,6 +31,7 @@ ppl::common::RetCode where_eltwise_fp32(
     float *dst);
 
 ppl::common::RetCode where_ndarray_fp32(
+    const ppl::common::isa_t isa,
     const ppl::common::TensorShape *cond_shape,
     const ppl::common::TensorShape *src_x_shape,
     const ppl::common::TensorShape *src_y_shape,
@@ -39,6 +41,42 @@ ppl::common::RetCode where_ndarray_fp32(
     const float *src_y,
     float *dst);
 
+ppl::common::RetCode where_eltwise_fp32(
+    const ppl::common::TensorShape *dst_shape,
+    const uint8_t *cond,
+    const float *src_x,
+    const float *src_y,
+    float *dst);
+
+ppl::common::RetCode where_ndarray_fp32(
+    const ppl::common::TensorShape *cond_shape,
+    const ppl::common::TensorShape *src_x_shape,
+    const ppl::common::TensorShape *src_y_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const uint8_t *cond,
+    const float *src_x,
+    const float *src_y,
+    float *dst);
+
+#ifdef PPL_USE_X86_AVX512
+ppl::common::RetCode where_eltwise_fp32_avx512(
+    const ppl::common::TensorShape *dst_shape,
+    const uint8_t *cond,
+    const float *src_x,
+    const float *src_y,
+    float *dst);
+
+ppl::common::RetCode where_ndarray_fp32_avx512(
+    const ppl::common::TensorShape *cond_shape,
+    const ppl::common::TensorShape *src_x_shape,
+    const ppl::common::TensorShape *src_y_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const uint8_t *cond,
+    const float *src_x,
+    const float *src_y,
+    float *dst);
+#endif
+
 }}}; // namespace ppl::kernel::x86
 
 #endif
@@ -31,6 +31,17 @@ ppl::common::RetCode scatter_elements_ndarray_int64(
     const int64_t axis,
     int64_t *dst);
 
+// reduction: 0: none, 1: add, 2: mul, 3: max, 4: min
+ppl::common::RetCode scatter_elements_ndarray_int64(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *indices_shape,
+    const int64_t *src,
+    const int64_t *indices,
+    const int64_t *updates,
+    const int64_t axis,
+    const int32_t reduction,
+    int64_t *dst);
+
 }}}; // namespace ppl::kernel::x86
 
 #endif
\ No newline at end of file
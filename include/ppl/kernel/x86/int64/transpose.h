@@ -29,6 +29,22 @@ ppl::common::RetCode transpose_ndarray_int64(
     const int32_t *perm,
     int64_t *dst);
 
+ppl::common::RetCode transpose_ndarray_int64_avx(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const int64_t *src,
+    const int32_t *perm,
+    int64_t *dst);
+
+#ifdef PPL_USE_X86_AVX512
+ppl::common::RetCode transpose_ndarray_int64_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const int64_t *src,
+    const int32_t *perm,
+    int64_t *dst);
+#endif
+
 ppl::common::RetCode transpose_ndarray_continous2d_int64(
     const ppl::common::TensorShape *src_shape,
     const int64_t *src,
@@ -23,17 +23,21 @@
 
 namespace ppl { namespace kernel { namespace x86 {
 
-template <typename eT>
-ppl::common::RetCode argmax_ndarray(
+// scalar reference for argmax/argmin. ties keep the first index unless
+// select_last_index is set, NaN never wins
+template <typename eT, bool is_max>
+ppl::common::RetCode arg_reduce_ndarray(
     const ppl::common::TensorShape *src_shape,
     const eT *src,
     const int64_t axis,
+    const int64_t select_last_index,
     int64_t *dst)
 {
     eT numeric_min = std::numeric_limits<eT>().min();
     if (std::is_same<eT, float>().value || std::is_same<eT, double>().value || std::is_same<eT, long double>().value) {
         numeric_min = -std::numeric_limits<eT>().max();
     }
+    const eT init_value     = is_max ? numeric_min : std::numeric_limits<eT>().max();
     const int64_t real_axis = axis < 0 ? axis + src_shape->GetDimCount() : axis;
 
     const int64_t argmax_dim = src_shape->GetDim(real_axis);
@@ -53,12 +57,16 @@ ppl::common::RetCode argmax_ndarray(
 #endif
     for (int64_t i = 0; i < outer_dim; ++i) {
         for (int64_t j = 0; j < inner_dim; ++j) {
-            eT max_value = numeric_min;
-            int64_t idx = 0;
+            eT best_value = init_value;
+            int64_t idx   = 0;
             for (int64_t k = 0; k < argmax_dim; ++k) {
-                if (src[(i * argmax_dim + k) * inner_dim + j] > max_value) {
-                    max_value = src[(i * argmax_dim + k) * inner_dim + j];
-                    idx       = k;
+                const eT v = src[(i * argmax_dim + k) * inner_dim + j];
+                const bool better = is_max
+                    ? (select_last_index ? v >= best_value : v > best_value)
+                    : (select_last_index ? v <= best_value : v < best_value);
+                if (better) {
+                    best_value = v;
+                    idx        = k;
                 }
             }
             dst[i * inner_dim + j] = idx;
@@ -68,6 +76,16 @@ ppl::common::RetCode argmax_ndarray(
     return ppl::common::RC_SUCCESS;
 }
 
+template <typename eT>
+ppl::common::RetCode argmax_ndarray(
+    const ppl::common::TensorShape *src_shape,
+    const eT *src,
+    const int64_t axis,
+    int64_t *dst)
+{
+    return arg_reduce_ndarray<eT, true>(src_shape, src, axis, 0, dst);
+}
+
 }}}; // namespace ppl::kernel::x86
 
 #endif // __ST_PPL_KERNEL_X86_COMMON_ARGMAX_ARGMAX_COMMON_H_
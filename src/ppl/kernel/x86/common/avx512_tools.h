@@ -71,6 +71,49 @@ inline __m512 operator+(const __m512 a) {
 
 #endif
 
+inline void memset32_avx512(void *dst, const int32_t val, const int64_t n32) {
+    int64_t __n32 = n32;
+    float *__dst = (float*)dst;
+    __m512 zmm_val = _mm512_castsi512_ps(_mm512_set1_epi32(val));
+    while (__n32 >= 32) {
+        _mm512_storeu_ps(__dst + 0, zmm_val);
+        _mm512_storeu_ps(__dst + 16, zmm_val);
+        __dst += 32;
+        __n32 -= 32;
+    }
+    if (__n32 & 16) {
+        _mm512_storeu_ps(__dst + 0, zmm_val);
+        __dst += 16;
+        __n32 -= 16;
+    }
+    if (__n32) {
+        _mm512_mask_storeu_ps(__dst, (__mmask16)((1 << __n32) - 1), zmm_val);
+    }
+}
+
+inline void memcpy32_avx512(void *dst, const void *src, const int64_t n32) {
+    int64_t __n32 = n32;
+    float *__dst = (float*)dst;
+    const float *__src = (const float*)src;
+    while (__n32 >= 32) {
+        _mm512_storeu_ps(__dst + 0, _mm512_loadu_ps(__src + 0));
+        _mm512_storeu_ps(__dst + 16, _mm512_loadu_ps(__src + 16));
+        __dst += 32;
+        __src += 32;
+        __n32 -= 32;
+    }
+    if (__n32 & 16) {
+        _mm512_storeu_ps(__dst + 0, _mm512_loadu_ps(__src + 0));
+        __dst += 16;
+        __src += 16;
+        __n32 -= 16;
+    }
+    if (__n32) {
+        const __mmask16 __mask = (__mmask16)((1 << __n32) - 1);
+        _mm512_mask_storeu_ps(__dst, __mask, _mm512_maskz_loadu_ps(__mask, __src));
+    }
+}
+
 }}}; // namespace ppl::kernel::x86
 
 #endif
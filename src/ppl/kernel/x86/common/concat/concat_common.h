@@ -23,6 +23,7 @@
 
 #include "ppl/kernel/x86/common/internal_include.h"
 #include "ppl/kernel/x86/common/threading_tools.h"
+#include "ppl/kernel/x86/common/concat_view.h"
 
 namespace ppl { namespace kernel { namespace x86 {
 
@@ -43,6 +44,35 @@ struct concat_parallel_info {
     int32_t end;
 };
 
+// every input was already produced into its view of dst, all or nothing:
+// an input aliasing dst can only have been written in place.
+template <typename eT>
+bool concat_srcs_in_place(
+    const ppl::common::TensorShape **src_shape_list,
+    const eT **src_list,
+    const int32_t num_src,
+    const int32_t axis,
+    const bool n16cx,
+    const eT *dst)
+{
+    if (num_src > PPL_X86_CONCAT_MAX_VIEWS()) {
+        return false;
+    }
+    concat_view_t views[PPL_X86_CONCAT_MAX_VIEWS()];
+    const ppl::common::RetCode rc = n16cx
+        ? concat_n16cx_select_views(src_shape_list, num_src, axis, views)
+        : concat_ndarray_select_views(src_shape_list, num_src, axis, views);
+    if (rc != ppl::common::RC_SUCCESS) {
+        return false;
+    }
+    for (int32_t n = 0; n < num_src; ++n) {
+        if (src_list[n] != dst + views[n].offset) {
+            return false;
+        }
+    }
+    return true;
+}
+
 template <typename eT>
 ppl::common::RetCode concat_ndarray(
     const ppl::common::TensorShape **src_shape_list,
@@ -51,6 +81,10 @@ ppl::common::RetCode concat_ndarray(
     const int32_t axis,
     eT *dst)
 {
+    if (concat_srcs_in_place<eT>(src_shape_list, src_list, num_src, axis, false, dst)) {
+        return ppl::common::RC_SUCCESS;
+    }
+
     const int32_t ndims      = int32_t(src_shape_list[0]->GetDimCount());
     const int32_t fixed_axis = axis < 0 ? ndims + axis : axis;
 
@@ -299,6 +333,10 @@ ppl::common::RetCode concat_n16cx(
     const int32_t c_dim_idx  = 1;
     const int64_t c_blk      = 16;
 
+    if (concat_srcs_in_place<eT>(src_shape_list, src_list, num_src, axis, true, dst)) {
+        return ppl::common::RC_SUCCESS;
+    }
+
     if (fixed_axis == c_dim_idx) { // concat on C dim
         for (int32_t i = 0; i < num_src - 1; i++) {
             if (src_shape_list[i]->GetDim(c_dim_idx) % c_blk != 0) {
@@ -0,0 +1,124 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/common/concat_view.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+static ppl::common::RetCode concat_select_views(
+    const ppl::common::TensorShape **shape_list,
+    const int32_t num_shape,
+    const int32_t axis,
+    const bool n16cx,
+    concat_view_t *views)
+{
+    const int32_t ndims      = int32_t(shape_list[0]->GetDimCount());
+    const int32_t fixed_axis = axis < 0 ? ndims + axis : axis;
+    const int32_t c_dim_idx  = 1;
+    const int64_t c_blk      = 16;
+
+    if (fixed_axis < 0 || fixed_axis >= ndims || (n16cx && ndims < 2)) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    for (int32_t n = 1; n < num_shape; ++n) {
+        if (int32_t(shape_list[n]->GetDimCount()) != ndims) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+        for (int32_t i = 0; i < ndims; ++i) {
+            if (i != fixed_axis && shape_list[n]->GetDim(i) != shape_list[0]->GetDim(i)) {
+                return ppl::common::RC_INVALID_VALUE;
+            }
+        }
+    }
+
+    int64_t axis_len = 0;
+    for (int32_t n = 0; n < num_shape; ++n) {
+        axis_len += shape_list[n]->GetDim(fixed_axis);
+    }
+
+    // outer_len: independent slices, slice_len: elements per axis index
+    int64_t outer_len = 1;
+    int64_t slice_len = 1;
+    for (int32_t i = 0; i < fixed_axis; ++i) {
+        const int64_t dim = shape_list[0]->GetDim(i);
+        outer_len *= (n16cx && i == c_dim_idx) ? div_up(dim, c_blk) : dim;
+    }
+    for (int32_t i = fixed_axis + 1; i < ndims; ++i) {
+        const int64_t dim = shape_list[0]->GetDim(i);
+        slice_len *= (n16cx && i == c_dim_idx) ? round_up(dim, c_blk) : dim;
+    }
+    if (n16cx && fixed_axis > c_dim_idx) {
+        slice_len *= c_blk;
+    }
+
+    const bool channel_view = n16cx && fixed_axis == c_dim_idx;
+    int64_t axis_offset     = 0;
+    for (int32_t n = 0; n < num_shape; ++n) {
+        if (channel_view && axis_offset % c_blk != 0) {
+            return ppl::common::RC_UNSUPPORTED;
+        }
+        views[n].offset      = axis_offset * slice_len;
+        views[n].axis_offset = axis_offset;
+        views[n].axis_len    = axis_len;
+        views[n].contiguous  = outer_len == 1;
+        if (n16cx && !channel_view && !views[n].contiguous) {
+            return ppl::common::RC_UNSUPPORTED;
+        }
+        axis_offset += shape_list[n]->GetDim(fixed_axis);
+    }
+
+    return ppl::common::RC_SUCCESS;
+}
+
+ppl::common::RetCode concat_ndarray_select_views(
+    const ppl::common::TensorShape **src_shape_list,
+    const int32_t num_src,
+    const int32_t axis,
+    concat_view_t *views)
+{
+    return concat_select_views(src_shape_list, num_src, axis, false, views);
+}
+
+ppl::common::RetCode concat_n16cx_select_views(
+    const ppl::common::TensorShape **src_shape_list,
+    const int32_t num_src,
+    const int32_t axis,
+    concat_view_t *views)
+{
+    return concat_select_views(src_shape_list, num_src, axis, true, views);
+}
+
+ppl::common::RetCode split_ndarray_select_views(
+    const ppl::common::TensorShape **dst_shape_list,
+    const int32_t num_dst,
+    const int32_t slice_axis,
+    concat_view_t *views)
+{
+    return concat_select_views(dst_shape_list, num_dst, slice_axis, false, views);
+}
+
+ppl::common::RetCode split_n16cx_select_views(
+    const ppl::common::TensorShape **dst_shape_list,
+    const int32_t num_dst,
+    const int32_t slice_axis,
+    concat_view_t *views)
+{
+    return concat_select_views(dst_shape_list, num_dst, slice_axis, true, views);
+}
+
+}}}; // namespace ppl::kernel::x86
@@ -19,51 +19,201 @@
 #define __ST_PPL_KERNEL_X86_COMMON_CUMSUM_CUMSUM_COMMON_H_
 
 #include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/common/reduce/reduce_common.h"
 
 namespace ppl { namespace kernel { namespace x86 {
 
-template<typename eT, int64_t exclusive, int64_t reverse>
-void cumsum_ndarray_impl(
+// scans contiguous rows for the inner_dim == 1 case. isa kernels provide the
+// same interface with in-register prefix sums.
+template <typename eT>
+struct cumsum_kernel_generic {
+    static eT sum(const eT *x, const int64_t len)
+    {
+        eT s = static_cast<eT>(0);
+        for (int64_t i = 0; i < len; ++i) {
+            s += x[i];
+        }
+        return s;
+    }
+
+    // returns carry plus the sum of the row
+    template <int64_t exclusive, int64_t reverse>
+    static eT scan(const eT *x, const int64_t len, eT carry, eT *y)
+    {
+        if (reverse) {
+            for (int64_t i = len - 1; i >= 0; --i) {
+                if (exclusive) y[i] = carry;
+                carry += x[i];
+                if (!exclusive) y[i] = carry;
+            }
+        } else {
+            for (int64_t i = 0; i < len; ++i) {
+                if (exclusive) y[i] = carry;
+                carry += x[i];
+                if (!exclusive) y[i] = carry;
+            }
+        }
+        return carry;
+    }
+};
+
+// scans rows of width elements strided by inner_dim, carry holds one running
+// sum per column. the column loops are contiguous and vectorize.
+template <typename eT, int64_t exclusive, int64_t reverse>
+void cumsum_ndarray_cols(
+    const eT *x,
+    const int64_t rows,
+    const int64_t inner_dim,
+    const int64_t width,
+    eT *carry,
+    eT *y)
+{
+    for (int64_t r = 0; r < rows; ++r) {
+        const int64_t off = (reverse ? rows - 1 - r : r) * inner_dim;
+        const eT *cx = x + off;
+        eT *cy = y + off;
+        if (exclusive) {
+            for (int64_t i = 0; i < width; ++i) {
+                cy[i] = carry[i];
+                carry[i] += cx[i];
+            }
+        } else {
+            for (int64_t i = 0; i < width; ++i) {
+                carry[i] += cx[i];
+                cy[i] = carry[i];
+            }
+        }
+    }
+}
+
+template <typename eT>
+void cumsum_ndarray_cols_sum(
+    const eT *x,
+    const int64_t rows,
+    const int64_t inner_dim,
+    const int64_t width,
+    eT *sum)
+{
+    for (int64_t i = 0; i < width; ++i) {
+        sum[i] = static_cast<eT>(0);
+    }
+    for (int64_t r = 0; r < rows; ++r) {
+        const eT *cx = x + r * inner_dim;
+        for (int64_t i = 0; i < width; ++i) {
+            sum[i] += cx[i];
+        }
+    }
+}
+
+// a scan along a long axis with too few independent (outer, inner block)
+// tasks is cut into blocks along the axis: every block sums its input, the
+// block sums are scanned in order into per block offsets, then every block
+// scans again starting from its offset. reading x twice is cheaper than
+// scanning and fixing up y, which reads and writes y twice.
+//
+// the block count comes from reduce_select_num_chunks, so in reproducible
+// mode it only depends on the shape.
+template <typename eT, typename kernel_t, int64_t exclusive, int64_t reverse>
+ppl::common::RetCode cumsum_ndarray_impl(
     const eT *x,
     const int64_t outer_dim,
     const int64_t cumsum_dim,
     const int64_t inner_dim,
     eT *y)
 {
-#ifndef PPL_USE_X86_OMP_COLLAPSE
-    PRAGMA_OMP_PARALLEL_FOR()
-#else
-    PRAGMA_OMP_PARALLEL_FOR_COLLAPSE(2)
-#endif
-    for (int64_t od = 0; od < outer_dim; ++od) {
-        for (int64_t id = 0; id < inner_dim; ++id) {
-            const eT *cx = x + od * cumsum_dim * inner_dim + id;
-            eT *cy = y + od * cumsum_dim * inner_dim + id;
-            if (reverse) {
-                cx += (cumsum_dim - 1) * inner_dim;
-                cy += (cumsum_dim - 1) * inner_dim;
-            }
+    const int64_t inner_blk      = 512;
+    const int64_t width          = min<int64_t>(inner_dim, inner_blk);
+    const int64_t num_inner_blks = div_up(inner_dim, inner_blk);
+    const int64_t num_tasks      = outer_dim * num_inner_blks;
+
+    int64_t num_blocks = reduce_select_num_chunks(num_tasks, num_tasks, cumsum_dim, width, PPL_OMP_MAX_THREADS());
+    const int64_t block_len = div_up(cumsum_dim, num_blocks);
+    num_blocks              = div_up(cumsum_dim, block_len);
 
-            eT current_sum = static_cast<eT>(0);
-            for (int64_t cd = 0; cd < cumsum_dim; ++cd) {
-                if (exclusive) cy[0] = current_sum;
-                current_sum += cx[0];
-                if (!exclusive) cy[0] = current_sum;
-                
-                if (reverse) {
-                    cx -= inner_dim;
-                    cy -= inner_dim;
-                } else {
-                    cx += inner_dim;
-                    cy += inner_dim;
+    if (num_blocks == 1) {
+        PRAGMA_OMP_PARALLEL_FOR()
+        for (int64_t t = 0; t < num_tasks; ++t) {
+            const int64_t od  = t / num_inner_blks;
+            const int64_t id  = (t % num_inner_blks) * inner_blk;
+            const int64_t off = od * cumsum_dim * inner_dim + id;
+            if (inner_dim == 1) {
+                kernel_t::template scan<exclusive, reverse>(x + off, cumsum_dim, static_cast<eT>(0), y + off);
+            } else {
+                const int64_t blk_width = min<int64_t>(inner_dim - id, inner_blk);
+                eT carry[inner_blk];
+                for (int64_t i = 0; i < blk_width; ++i) {
+                    carry[i] = static_cast<eT>(0);
                 }
+                cumsum_ndarray_cols<eT, exclusive, reverse>(x + off, cumsum_dim, inner_dim, blk_width, carry, y + off);
             }
         }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    // offsets[(t * num_blocks + b) * width + i]
+    eT *offsets = (eT*)ppl::common::AlignedAlloc(num_tasks * num_blocks * width * sizeof(eT), PPL_X86_CACHELINE_BYTES());
+    if (!offsets) {
+        return ppl::common::RC_OUT_OF_MEMORY;
     }
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t tb = 0; tb < num_tasks * num_blocks; ++tb) {
+        const int64_t t         = tb / num_blocks;
+        const int64_t b         = tb % num_blocks;
+        const int64_t od        = t / num_inner_blks;
+        const int64_t id        = (t % num_inner_blks) * inner_blk;
+        const int64_t blk_width = min<int64_t>(inner_dim - id, inner_blk);
+        const int64_t rows      = min<int64_t>(cumsum_dim - b * block_len, block_len);
+        const int64_t off       = (od * cumsum_dim + b * block_len) * inner_dim + id;
+        if (inner_dim == 1) {
+            offsets[tb] = kernel_t::sum(x + off, rows);
+        } else {
+            cumsum_ndarray_cols_sum<eT>(x + off, rows, inner_dim, blk_width, offsets + tb * width);
+        }
+    }
+
+    // block sums to exclusive offsets, in scan order
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t t = 0; t < num_tasks; ++t) {
+        const int64_t id        = (t % num_inner_blks) * inner_blk;
+        const int64_t blk_width = min<int64_t>(inner_dim - id, inner_blk);
+        eT carry[inner_blk];
+        for (int64_t i = 0; i < blk_width; ++i) {
+            carry[i] = static_cast<eT>(0);
+        }
+        for (int64_t k = 0; k < num_blocks; ++k) {
+            const int64_t b = reverse ? num_blocks - 1 - k : k;
+            eT *blk_offset  = offsets + (t * num_blocks + b) * width;
+            for (int64_t i = 0; i < blk_width; ++i) {
+                const eT blk_sum = blk_offset[i];
+                blk_offset[i]    = carry[i];
+                carry[i] += blk_sum;
+            }
+        }
+    }
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t tb = 0; tb < num_tasks * num_blocks; ++tb) {
+        const int64_t t         = tb / num_blocks;
+        const int64_t b         = tb % num_blocks;
+        const int64_t od        = t / num_inner_blks;
+        const int64_t id        = (t % num_inner_blks) * inner_blk;
+        const int64_t blk_width = min<int64_t>(inner_dim - id, inner_blk);
+        const int64_t rows      = min<int64_t>(cumsum_dim - b * block_len, block_len);
+        const int64_t off       = (od * cumsum_dim + b * block_len) * inner_dim + id;
+        if (inner_dim == 1) {
+            kernel_t::template scan<exclusive, reverse>(x + off, rows, offsets[tb], y + off);
+        } else {
+            cumsum_ndarray_cols<eT, exclusive, reverse>(x + off, rows, inner_dim, blk_width, offsets + tb * width, y + off);
+        }
+    }
+
+    ppl::common::AlignedFree(offsets);
+    return ppl::common::RC_SUCCESS;
 }
 
-template<typename eT>
-ppl::common::RetCode cumsum_ndarray(
+template <typename eT, typename kernel_t>
+ppl::common::RetCode cumsum_ndarray_common(
     const ppl::common::TensorShape *x_shape,
     const eT *x,
     const int64_t axis,
@@ -90,17 +240,31 @@ ppl::common::RetCode cumsum_ndarray(
         inner_dim *= x_shape->GetDim(i);
     }
 
-    auto impl_func = cumsum_ndarray_impl<eT, true, true>;
+    if (outer_dim == 0 || cumsum_dim == 0 || inner_dim == 0) {
+        return ppl::common::RC_SUCCESS;
+    }
+
+    auto impl_func = cumsum_ndarray_impl<eT, kernel_t, true, true>;
     if (exclusive) {
-        if (!reverse) impl_func = cumsum_ndarray_impl<eT, true, false>;
+        if (!reverse) impl_func = cumsum_ndarray_impl<eT, kernel_t, true, false>;
     } else {
-        if (reverse) impl_func = cumsum_ndarray_impl<eT, false, true>;
-        else impl_func = cumsum_ndarray_impl<eT, false, false>;
+        if (reverse) impl_func = cumsum_ndarray_impl<eT, kernel_t, false, true>;
+        else impl_func = cumsum_ndarray_impl<eT, kernel_t, false, false>;
     }
 
-    impl_func(x, outer_dim, cumsum_dim, inner_dim, y);
+    return impl_func(x, outer_dim, cumsum_dim, inner_dim, y);
+}
 
-    return ppl::common::RC_SUCCESS;
+template<typename eT>
+ppl::common::RetCode cumsum_ndarray(
+    const ppl::common::TensorShape *x_shape,
+    const eT *x,
+    const int64_t axis,
+    const int64_t exclusive,
+    const int64_t reverse,
+    eT *y)
+{
+    return cumsum_ndarray_common<eT, cumsum_kernel_generic<eT>>(x_shape, x, axis, exclusive, reverse, y);
 }
 
 }}} // namespace ppl::kernel::x86
@@ -0,0 +1,85 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/common/kernel_registry/builtin_kernels.h"
+#include "ppl/kernel/x86/fp32/arithmetic.h"
+#include "ppl/kernel/x86/fp32/grid_sample.h"
+#include "ppl/kernel/x86/fp32/lstm.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+#define PPL_X86_BUILTIN_KERNEL(OP, FUNC, ISA, PRIORITY, PREDICATE) \
+    kernels->push_back(kernel_desc_t{OP, #FUNC, ISA, 0, PRIORITY, PREDICATE, reinterpret_cast<kernel_func_t>(FUNC)})
+
+static bool src_is_ndarray(const ppl::common::TensorShape **shapes, const int32_t num_shapes)
+{
+    return shapes[0]->GetDataFormat() == ppl::common::DATAFORMAT_NDARRAY;
+}
+
+static bool src_is_n16cx(const ppl::common::TensorShape **shapes, const int32_t num_shapes)
+{
+    return shapes[0]->GetDataFormat() == ppl::common::DATAFORMAT_N16CX;
+}
+
+static ppl::common::RetCode grid_sample_n16cx_fp32_generic(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *grid_shape,
+    const float *src,
+    const float *grid,
+    const int64_t mode,
+    const int64_t padding_mode,
+    const bool align_corners,
+    float *dst)
+{
+    return grid_sample_n16cx_fp32(0, src_shape, grid_shape, src, grid, mode, padding_mode, align_corners, dst);
+}
+
+void append_builtin_kernels(std::vector<kernel_desc_t> *kernels)
+{
+#ifdef PPL_USE_X86_AVX512
+    PPL_X86_BUILTIN_KERNEL("add_fp32", add_fp32_avx512, ppl::common::ISA_X86_AVX512, KERNEL_PRIORITY_AVX512, nullptr);
+    PPL_X86_BUILTIN_KERNEL("sub_fp32", sub_fp32_avx512, ppl::common::ISA_X86_AVX512, KERNEL_PRIORITY_AVX512, nullptr);
+    PPL_X86_BUILTIN_KERNEL("mul_fp32", mul_fp32_avx512, ppl::common::ISA_X86_AVX512, KERNEL_PRIORITY_AVX512, nullptr);
+    PPL_X86_BUILTIN_KERNEL("div_fp32", div_fp32_avx512, ppl::common::ISA_X86_AVX512, KERNEL_PRIORITY_AVX512, nullptr);
+#endif
+    PPL_X86_BUILTIN_KERNEL("add_fp32", add_fp32_avx, ppl::common::ISA_X86_AVX, KERNEL_PRIORITY_AVX, nullptr);
+    PPL_X86_BUILTIN_KERNEL("sub_fp32", sub_fp32_avx, ppl::common::ISA_X86_AVX, KERNEL_PRIORITY_AVX, nullptr);
+    PPL_X86_BUILTIN_KERNEL("mul_fp32", mul_fp32_avx, ppl::common::ISA_X86_AVX, KERNEL_PRIORITY_AVX, nullptr);
+    PPL_X86_BUILTIN_KERNEL("div_fp32", div_fp32_avx, ppl::common::ISA_X86_AVX, KERNEL_PRIORITY_AVX, nullptr);
+    PPL_X86_BUILTIN_KERNEL("add_fp32", add_fp32_sse, ppl::common::ISA_X86_SSE, KERNEL_PRIORITY_SSE, nullptr);
+    PPL_X86_BUILTIN_KERNEL("sub_fp32", sub_fp32_sse, ppl::common::ISA_X86_SSE, KERNEL_PRIORITY_SSE, nullptr);
+    PPL_X86_BUILTIN_KERNEL("mul_fp32", mul_fp32_sse, ppl::common::ISA_X86_SSE, KERNEL_PRIORITY_SSE, nullptr);
+    PPL_X86_BUILTIN_KERNEL("div_fp32", div_fp32_sse, ppl::common::ISA_X86_SSE, KERNEL_PRIORITY_SSE, nullptr);
+
+#ifdef PPL_USE_X86_AVX512
+    PPL_X86_BUILTIN_KERNEL("grid_sample_fp32", grid_sample_n16cx_fp32_avx512, ppl::common::ISA_X86_AVX512, KERNEL_PRIORITY_AVX512, src_is_n16cx);
+#endif
+    PPL_X86_BUILTIN_KERNEL("grid_sample_fp32", grid_sample_n16cx_fp32_fma, ppl::common::ISA_X86_FMA, KERNEL_PRIORITY_FMA, src_is_n16cx);
+    PPL_X86_BUILTIN_KERNEL("grid_sample_fp32", grid_sample_n16cx_fp32_generic, 0, KERNEL_PRIORITY_GENERIC, src_is_n16cx);
+    PPL_X86_BUILTIN_KERNEL("grid_sample_fp32", grid_sample_ndarray_fp32, 0, KERNEL_PRIORITY_GENERIC, src_is_ndarray);
+
+#ifdef PPL_USE_X86_AVX512
+    PPL_X86_BUILTIN_KERNEL("lstm_fp32", lstm_fp32_avx512, ppl::common::ISA_X86_AVX512, KERNEL_PRIORITY_AVX512, nullptr);
+#endif
+    PPL_X86_BUILTIN_KERNEL("lstm_fp32", lstm_fp32_fma, ppl::common::ISA_X86_FMA, KERNEL_PRIORITY_FMA, nullptr);
+    PPL_X86_BUILTIN_KERNEL("lstm_fp32", lstm_fp32_sse, ppl::common::ISA_X86_SSE, KERNEL_PRIORITY_SSE, nullptr);
+}
+
+#undef PPL_X86_BUILTIN_KERNEL
+
+}}}; // namespace ppl::kernel::x86
@@ -0,0 +1,41 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_COMMON_KERNEL_REGISTRY_BUILTIN_KERNELS_H_
+#define __ST_PPL_KERNEL_X86_COMMON_KERNEL_REGISTRY_BUILTIN_KERNELS_H_
+
+#include <vector>
+
+#include "ppl/kernel/x86/common/kernel_registry.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+// kernels of this library, appended before any user registration. priority
+// follows the isa so a user kernel needs a higher one to take over.
+enum builtin_kernel_priority {
+    KERNEL_PRIORITY_GENERIC = 0,
+    KERNEL_PRIORITY_SSE     = 10,
+    KERNEL_PRIORITY_AVX     = 20,
+    KERNEL_PRIORITY_FMA     = 30,
+    KERNEL_PRIORITY_AVX512  = 40,
+};
+
+void append_builtin_kernels(std::vector<kernel_desc_t> *kernels);
+
+}}}; // namespace ppl::kernel::x86
+
+#endif
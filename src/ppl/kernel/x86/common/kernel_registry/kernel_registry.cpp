@@ -0,0 +1,355 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <string.h>
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+
+#ifdef PPL_USE_X86_MSVC
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/common/kernel_registry.h"
+#include "ppl/kernel/x86/common/kernel_registry/builtin_kernels.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+static void cpuid(const uint32_t leaf, const uint32_t subleaf, uint32_t regs[4])
+{
+#ifdef PPL_USE_X86_MSVC
+    int32_t r[4];
+    __cpuidex(r, leaf, subleaf);
+    for (int32_t i = 0; i < 4; ++i) {
+        regs[i] = r[i];
+    }
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+static uint64_t xgetbv0()
+{
+#ifdef PPL_USE_X86_MSVC
+    return _xgetbv(0);
+#else
+    uint32_t eax, edx;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+}
+
+static uint32_t detect_cpu_features()
+{
+    uint32_t regs[4];
+    cpuid(0, 0, regs);
+    const uint32_t max_leaf = regs[0];
+    if (max_leaf < 7) {
+        return 0;
+    }
+    cpuid(1, 0, regs);
+    const bool osxsave = (regs[2] >> 27) & 1;
+    if (!osxsave) {
+        return 0;
+    }
+
+    const uint64_t xcr0       = xgetbv0();
+    const uint64_t zmm_state  = (1 << 1) | (1 << 2) | (1 << 5) | (1 << 6) | (1 << 7); // sse, avx, opmask, zmm_hi256, hi16_zmm
+    const uint64_t tile_state = (1 << 17) | (1 << 18); // xtilecfg, xtiledata
+    const bool os_avx512      = (xcr0 & zmm_state) == zmm_state;
+    const bool os_amx         = (xcr0 & tile_state) == tile_state;
+
+    uint32_t leaf7[4], leaf7_1[4] = {0, 0, 0, 0};
+    cpuid(7, 0, leaf7);
+    if (leaf7[0] >= 1) {
+        cpuid(7, 1, leaf7_1);
+    }
+
+    uint32_t features = 0;
+    if (os_avx512 && ((leaf7[1] >> 16) & 1)) {
+        if ((leaf7[2] >> 11) & 1) features |= CPU_FEATURE_AVX512_VNNI;
+        if ((leaf7_1[0] >> 5) & 1) features |= CPU_FEATURE_AVX512_BF16;
+        if ((leaf7[3] >> 23) & 1) features |= CPU_FEATURE_AVX512_FP16;
+    }
+    if (os_amx && ((leaf7[3] >> 24) & 1)) {
+        features |= CPU_FEATURE_AMX_TILE;
+        if ((leaf7[3] >> 22) & 1) features |= CPU_FEATURE_AMX_BF16;
+        if ((leaf7[3] >> 25) & 1) features |= CPU_FEATURE_AMX_INT8;
+    }
+    return features;
+}
+
+static const uint32_t CPU_FEATURE_AMX_ALL = CPU_FEATURE_AMX_TILE | CPU_FEATURE_AMX_BF16 | CPU_FEATURE_AMX_INT8;
+
+static uint32_t get_detected_cpu_features()
+{
+    static const uint32_t features = detect_cpu_features();
+    return features;
+}
+
+static std::atomic<bool> amx_permitted(false);
+
+uint32_t get_cpu_features()
+{
+    const uint32_t features = get_detected_cpu_features();
+    return amx_permitted.load(std::memory_order_acquire) ? features : features & ~CPU_FEATURE_AMX_ALL;
+}
+
+namespace {
+
+struct kernel_candidates_t {
+    uint64_t generation;
+    std::vector<const kernel_desc_t *> kernels;
+};
+
+class kernel_registry {
+public:
+    kernel_registry()
+        : generation_(1)
+        , readers_(0)
+        , isa_mask_(~0u)
+        , feature_mask_(~0u)
+    {
+        std::vector<kernel_desc_t> builtins;
+        append_builtin_kernels(&builtins);
+        for (size_t i = 0; i < builtins.size(); ++i) {
+            descs_.push_back(builtins[i]);
+        }
+    }
+
+    ~kernel_registry()
+    {
+        for (auto it = candidate_lists_.begin(); it != candidate_lists_.end(); ++it) {
+            delete it->second;
+        }
+        for (size_t i = 0; i < retired_lists_.size(); ++i) {
+            delete retired_lists_[i];
+        }
+    }
+
+    ppl::common::RetCode add(const kernel_desc_t *desc)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        descs_.push_back(*desc);
+        generation_.fetch_add(1, std::memory_order_release);
+        return ppl::common::RC_SUCCESS;
+    }
+
+    std::vector<kernel_desc_t> list(const char *op)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<kernel_desc_t> ret;
+        for (size_t i = 0; i < descs_.size(); ++i) {
+            if (strcmp(descs_[i].op, op) == 0) {
+                ret.push_back(descs_[i]);
+            }
+        }
+        return ret;
+    }
+
+    void set_mask(const ppl::common::isa_t isa_mask, const uint32_t feature_mask)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        isa_mask_     = isa_mask;
+        feature_mask_ = feature_mask;
+        generation_.fetch_add(1, std::memory_order_release);
+    }
+
+    // cpu features changed, every cached list has to be rebuilt
+    void invalidate()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        generation_.fetch_add(1, std::memory_order_release);
+    }
+
+    uint64_t generation() const
+    {
+        return generation_.load(std::memory_order_acquire);
+    }
+
+    // resolve_kernel() holds a read from loading a site until it is done
+    // with the list, retired lists are only freed while no read is held
+    void enter()
+    {
+        readers_.fetch_add(1);
+    }
+
+    void leave()
+    {
+        readers_.fetch_sub(1, std::memory_order_release);
+    }
+
+    // one list per op shared by every site of the op. the list of an older
+    // generation is retired when the op is rebuilt and freed by reclaim().
+    const kernel_candidates_t *build(kernel_dispatch_site_t *site)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        sites_.insert(site);
+        const uint64_t generation = generation_.load(std::memory_order_relaxed);
+        kernel_candidates_t *&current = candidate_lists_[site->op];
+        if (current && current->generation == generation) {
+            reclaim();
+            return current;
+        }
+        if (current) {
+            retired_lists_.push_back(current);
+        }
+
+        const ppl::common::isa_t isa = ppl::common::GetCpuISA() & isa_mask_;
+        const uint32_t features      = get_cpu_features() & feature_mask_;
+
+        current             = new kernel_candidates_t;
+        current->generation = generation;
+        for (size_t i = 0; i < descs_.size(); ++i) {
+            const kernel_desc_t &d = descs_[i];
+            if (strcmp(d.op, site->op) == 0 && (d.isa & ~isa) == 0 && (d.cpu_features & ~features) == 0) {
+                current->kernels.push_back(&d);
+            }
+        }
+        std::stable_sort(current->kernels.begin(), current->kernels.end(), [](const kernel_desc_t *a, const kernel_desc_t *b) {
+            return a->priority > b->priority;
+        });
+        reclaim();
+        return current;
+    }
+
+private:
+    // sites still pointing at a retired list are reset first, so a read
+    // entered after the readers_ check can only see null or a live list.
+    // a read held during the check keeps the lists until the next build.
+    void reclaim()
+    {
+        if (retired_lists_.empty()) {
+            return;
+        }
+        std::set<const void *> retired(retired_lists_.begin(), retired_lists_.end());
+        for (auto it = sites_.begin(); it != sites_.end(); ++it) {
+            const void *candidates = (*it)->candidates.load();
+            if (retired.count(candidates)) {
+                (*it)->candidates.compare_exchange_strong(candidates, nullptr);
+            }
+        }
+        if (readers_.load() != 0) {
+            return;
+        }
+        for (size_t i = 0; i < retired_lists_.size(); ++i) {
+            delete retired_lists_[i];
+        }
+        retired_lists_.clear();
+    }
+
+    std::mutex mutex_;
+    std::atomic<uint64_t> generation_;
+    std::atomic<int64_t> readers_;
+    ppl::common::isa_t isa_mask_;
+    uint32_t feature_mask_;
+    std::deque<kernel_desc_t> descs_;
+    std::map<std::string, kernel_candidates_t *> candidate_lists_;
+    std::vector<kernel_candidates_t *> retired_lists_;
+    std::set<kernel_dispatch_site_t *> sites_;
+};
+
+kernel_registry &get_kernel_registry()
+{
+    static kernel_registry registry;
+    return registry;
+}
+
+} // namespace
+
+ppl::common::RetCode request_amx_permission()
+{
+    if (!(get_detected_cpu_features() & CPU_FEATURE_AMX_TILE)) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+    if (amx_permitted.load(std::memory_order_acquire)) {
+        return ppl::common::RC_SUCCESS;
+    }
+#if defined(__linux__)
+#ifdef SYS_arch_prctl
+    const int32_t ARCH_REQ_XCOMP_PERM = 0x1023;
+    const int32_t XFEATURE_XTILEDATA  = 18;
+    if (syscall(SYS_arch_prctl, ARCH_REQ_XCOMP_PERM, XFEATURE_XTILEDATA) != 0) {
+        return ppl::common::RC_PERMISSION_DENIED;
+    }
+#else
+    return ppl::common::RC_UNSUPPORTED;
+#endif
+#endif
+    amx_permitted.store(true, std::memory_order_release);
+    get_kernel_registry().invalidate();
+    return ppl::common::RC_SUCCESS;
+}
+
+ppl::common::RetCode register_kernel(const kernel_desc_t *desc)
+{
+    if (!desc || !desc->op || !desc->func) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    return get_kernel_registry().add(desc);
+}
+
+std::vector<kernel_desc_t> get_registered_kernels(const char *op)
+{
+    return get_kernel_registry().list(op);
+}
+
+void set_kernel_dispatch_mask(const ppl::common::isa_t isa_mask, const uint32_t feature_mask)
+{
+    get_kernel_registry().set_mask(isa_mask, feature_mask);
+}
+
+const kernel_desc_t *resolve_kernel(
+    kernel_dispatch_site_t *site,
+    const ppl::common::TensorShape **shapes,
+    const int32_t num_shapes)
+{
+    kernel_registry &registry = get_kernel_registry();
+    registry.enter();
+
+    // a list stored by a slower thread carries its own generation, so a
+    // stale one is simply rebuilt on the next call
+    const kernel_candidates_t *candidates = static_cast<const kernel_candidates_t *>(site->candidates.load());
+    if (!candidates || candidates->generation != registry.generation()) {
+        candidates = registry.build(site);
+        site->candidates.store(candidates, std::memory_order_release);
+    }
+
+    const kernel_desc_t *kernel = nullptr;
+    for (size_t i = 0; i < candidates->kernels.size(); ++i) {
+        const kernel_desc_t *d = candidates->kernels[i];
+        if (!d->predicate || d->predicate(shapes, num_shapes)) {
+            kernel = d;
+            break;
+        }
+    }
+    registry.leave();
+    return kernel;
+}
+
+}}}; // namespace ppl::kernel::x86
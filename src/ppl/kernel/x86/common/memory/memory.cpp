@@ -16,48 +16,138 @@
 // under the License.
 
 #include <string.h>
+#include <emmintrin.h>
 
 #include "ppl/kernel/x86/common/internal_include.h"
 
 namespace ppl { namespace kernel { namespace x86 {
 
+// writes bigger than half of the llc go around the cache with non-temporal
+// stores, they would evict everything else and not be read back from the
+// cache anyway.
+static inline uint64_t memory_stream_threshold()
+{
+    const uint64_t l3_size = ppl::common::GetCpuCacheL3() == 0 ? (PPL_OMP_MAX_THREADS() * 2048 * 1024) : ppl::common::GetCpuCacheL3();
+    return l3_size / 2;
+}
+
+// blocks start on page boundaries of dst, so every page is first touched
+// by a single thread. with the static omp schedule block n belongs to
+// thread n, the same split the following kernels use, so pages land on the
+// numa node of the thread that consumes them.
+static inline int64_t memory_block_bound(
+    const void *dst,
+    const int64_t num_bytes,
+    const int64_t num_block,
+    const int64_t n)
+{
+    const int64_t page_bytes = 4096;
+    if (n <= 0) return 0;
+    if (n >= num_block) return num_bytes;
+    const uintptr_t base  = (uintptr_t)dst;
+    const uintptr_t bound = round_up(base + n * (num_bytes / num_block), page_bytes);
+    return min<int64_t>(bound - base, num_bytes);
+}
+
+static void memory_copy_stream(
+    const uint8_t *src,
+    const int64_t num_bytes,
+    uint8_t *dst)
+{
+    const int64_t head = min<int64_t>(num_bytes, (16 - ((uintptr_t)dst & 15)) & 15);
+    memcpy(dst, src, head);
+
+    int64_t i = head;
+    for (; i <= num_bytes - 64; i += 64) {
+        const __m128i v0 = _mm_loadu_si128((const __m128i*)(src + i + 0));
+        const __m128i v1 = _mm_loadu_si128((const __m128i*)(src + i + 16));
+        const __m128i v2 = _mm_loadu_si128((const __m128i*)(src + i + 32));
+        const __m128i v3 = _mm_loadu_si128((const __m128i*)(src + i + 48));
+        _mm_stream_si128((__m128i*)(dst + i + 0), v0);
+        _mm_stream_si128((__m128i*)(dst + i + 16), v1);
+        _mm_stream_si128((__m128i*)(dst + i + 32), v2);
+        _mm_stream_si128((__m128i*)(dst + i + 48), v3);
+    }
+    for (; i <= num_bytes - 16; i += 16) {
+        _mm_stream_si128((__m128i*)(dst + i), _mm_loadu_si128((const __m128i*)(src + i)));
+    }
+    memcpy(dst + i, src + i, num_bytes - i);
+    _mm_sfence();
+}
+
+// pattern holds two periods of the value, period is a multiple of both 16
+// and the element size, so any 16 bytes starting inside the first period
+// can be loaded from it.
+template <bool stream>
+static void memory_fill_pattern(
+    const uint8_t *pattern,
+    const int64_t period,
+    const int64_t offset, // byte offset of dst in the whole fill
+    const int64_t num_bytes,
+    uint8_t *dst)
+{
+    const int64_t head = min<int64_t>(num_bytes, (16 - ((uintptr_t)dst & 15)) & 15);
+    int64_t phase      = offset % period;
+    for (int64_t i = 0; i < head; ++i) {
+        dst[i] = pattern[phase + i];
+    }
+    phase = (phase + head) % period;
+
+    int64_t i = head;
+    for (; i <= num_bytes - 16; i += 16) {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(pattern + phase));
+        if (stream) _mm_stream_si128((__m128i*)(dst + i), v);
+        else _mm_store_si128((__m128i*)(dst + i), v);
+        phase += 16;
+        if (phase >= period) phase -= period;
+    }
+    for (int64_t j = 0; i < num_bytes; ++i, ++j) {
+        dst[i] = pattern[phase + j];
+    }
+    if (stream) _mm_sfence();
+}
+
 ppl::common::RetCode memory_init(
     const void *src,
     const uint64_t sizeof_elem,
     const uint64_t num_elements,
     void* dst)
 {
-    const int64_t n_elem = num_elements;
-    if (sizeof_elem == 1) {
-        const uint8_t val = ((uint8_t*)src)[0];
-        PRAGMA_OMP_PARALLEL_FOR()
-        for (int64_t i = 0; i < n_elem; i++) {
-            ((uint8_t*)dst)[i] = val;
-        }
-    } else if (sizeof_elem == 2) {
-        const uint16_t val = ((uint16_t*)src)[0];
-        PRAGMA_OMP_PARALLEL_FOR()
-        for (int64_t i = 0; i < n_elem; i++) {
-            ((uint16_t*)dst)[i] = val;
-        }
-    } else if (sizeof_elem == 4) {
-        const uint32_t val = ((uint32_t*)src)[0];
-        PRAGMA_OMP_PARALLEL_FOR()
-        for (int64_t i = 0; i < n_elem; i++) {
-            ((uint32_t*)dst)[i] = val;
-        }
-    } else if (sizeof_elem == 8) {
-        const uint64_t val = ((uint64_t*)src)[0];
+    const int64_t max_pattern_elem = 256;
+    const int64_t min_block_size   = 128 * 1024;
+    const int64_t n_elem           = num_elements;
+
+    if (sizeof_elem > max_pattern_elem) {
         PRAGMA_OMP_PARALLEL_FOR()
         for (int64_t i = 0; i < n_elem; i++) {
-            ((uint64_t*)dst)[i] = val;
+            memcpy((uint8_t*)dst + i * sizeof_elem, src, sizeof_elem);
         }
-    } else {
-        PRAGMA_OMP_PARALLEL_FOR()
-        for (int64_t i = 0; i < n_elem; i++) {
-            for (uint64_t j = 0; j < sizeof_elem; j++) {
-                ((uint8_t*)dst)[i * sizeof_elem + j] = ((uint8_t*)src)[j];
-            }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    const int64_t num_bytes = n_elem * sizeof_elem;
+    if (num_bytes == 0) {
+        return ppl::common::RC_SUCCESS;
+    }
+
+    const int64_t period = sizeof_elem * 16;
+    uint8_t pattern[2 * max_pattern_elem * 16];
+    for (int64_t i = 0; i < 2 * period; i += sizeof_elem) {
+        memcpy(pattern + i, src, sizeof_elem);
+    }
+
+    const bool stream       = (uint64_t)num_bytes >= memory_stream_threshold();
+    const int64_t num_block = min<int64_t>(PPL_OMP_MAX_THREADS(), div_up(num_bytes, min_block_size));
+    uint8_t *l_dst          = (uint8_t*)dst;
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t n = 0; n < num_block; ++n) {
+        const int64_t block_start = memory_block_bound(dst, num_bytes, num_block, n);
+        const int64_t block_size  = memory_block_bound(dst, num_bytes, num_block, n + 1) - block_start;
+        if (stream) {
+            memory_fill_pattern<true>(pattern, period, block_start, block_size, l_dst + block_start);
+        } else {
+            memory_fill_pattern<false>(pattern, period, block_start, block_size, l_dst + block_start);
         }
     }
 
@@ -71,17 +161,20 @@ ppl::common::RetCode memory_copy(
 {
     const int64_t min_block_size = 128 * 1024;
     const int64_t num_block = min<int64_t>(PPL_OMP_MAX_THREADS(), div_up(num_bytes, min_block_size));
-    const int64_t block_body = num_bytes / num_block;
-    const int64_t block_tail = num_bytes % num_block;
+    const bool stream = num_bytes >= memory_stream_threshold();
 
     uint8_t *l_dst        = (uint8_t*)dst;
     const uint8_t * l_src = (const uint8_t*)src;
 
     PRAGMA_OMP_PARALLEL_FOR()
     for (int64_t n = 0; n < num_block; ++n) {
-        const int64_t block_start = n * block_body + (block_tail > n ? n : block_tail);
-        const int64_t block_size = block_body + (block_tail > n ? 1 : 0);
-        memcpy(l_dst + block_start, l_src + block_start, block_size);
+        const int64_t block_start = memory_block_bound(dst, num_bytes, num_block, n);
+        const int64_t block_size  = memory_block_bound(dst, num_bytes, num_block, n + 1) - block_start;
+        if (stream) {
+            memory_copy_stream(l_src + block_start, block_size, l_dst + block_start);
+        } else {
+            memcpy(l_dst + block_start, l_src + block_start, block_size);
+        }
     }
 
     return ppl::common::RC_SUCCESS;
@@ -0,0 +1,434 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+
+#if defined(__linux__)
+#include <cpuid.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/common/perf_counter.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+const char *get_perf_event_name(const perf_event_t event)
+{
+    static const char *names[PERF_EVENT_COUNT] = {
+        "cycles",
+        "instructions",
+        "l1d_misses",
+        "l2_misses",
+        "llc_misses",
+        "dram_bytes",
+        "avx512_l1_license_cycles",
+        "avx512_l2_license_cycles",
+    };
+    if (event < 0 || event >= PERF_EVENT_COUNT) {
+        return "unknown";
+    }
+    return names[event];
+}
+
+const char *get_perf_bound_name(const perf_bound_t bound)
+{
+    if (bound == PERF_BOUND_COMPUTE) return "compute";
+    if (bound == PERF_BOUND_BANDWIDTH) return "bandwidth";
+    return "unknown";
+}
+
+static int64_t steady_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+#if defined(__linux__)
+
+static bool read_text_file(const std::string &path, std::string *text)
+{
+    FILE *fp = fopen(path.c_str(), "r");
+    if (!fp) {
+        return false;
+    }
+    // cpumask lists of large hosts do not fit in one read
+    text->clear();
+    char buf[256];
+    size_t len;
+    while ((len = fread(buf, 1, sizeof(buf), fp)) > 0) {
+        text->append(buf, len);
+    }
+    fclose(fp);
+    return true;
+}
+
+static bool is_intel_cpu()
+{
+    uint32_t eax, ebx, ecx, edx;
+    __cpuid(0, eax, ebx, ecx, edx);
+    return ebx == 0x756e6547 && edx == 0x49656e69 && ecx == 0x6c65746e; // GenuineIntel
+}
+
+static int32_t perf_event_open(perf_event_attr *attr, const int32_t pid, const int32_t cpu)
+{
+    return (int32_t)syscall(SYS_perf_event_open, attr, pid, cpu, -1, 0);
+}
+
+static void init_perf_attr(const uint32_t type, const uint64_t config, const bool user_only, perf_event_attr *attr)
+{
+    memset(attr, 0, sizeof(*attr));
+    attr->size           = sizeof(*attr);
+    attr->type           = type;
+    attr->config         = config;
+    attr->disabled       = 1;
+    attr->exclude_kernel = user_only ? 1 : 0;
+    attr->exclude_hv     = user_only ? 1 : 0;
+    // the kernel multiplexes when there are more events than counters
+    attr->read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+}
+
+// "event=0x04,umask=0x03" -> event | umask << 8
+static bool parse_uncore_event(const std::string &text, uint64_t *config)
+{
+    uint64_t event = 0, umask = 0;
+    bool has_event = false;
+    std::string::size_type begin = 0;
+    while (begin < text.size()) {
+        auto end = text.find(',', begin);
+        if (end == std::string::npos) end = text.size();
+        const std::string term = text.substr(begin, end - begin);
+        const auto eq = term.find('=');
+        if (eq != std::string::npos) {
+            const std::string key = term.substr(0, eq);
+            const uint64_t value  = strtoull(term.c_str() + eq + 1, nullptr, 0);
+            if (key == "event") {
+                event     = value;
+                has_event = true;
+            } else if (key == "umask") {
+                umask = value;
+            }
+        }
+        begin = end + 1;
+    }
+    *config = event | (umask << 8);
+    return has_event;
+}
+
+// "0,28" or "0-1"
+static std::vector<int32_t> parse_cpu_list(const std::string &text)
+{
+    std::vector<int32_t> cpus;
+    const char *p = text.c_str();
+    while (*p) {
+        char *end;
+        const long first = strtol(p, &end, 10);
+        if (end == p) break;
+        long last = first;
+        p = end;
+        if (*p == '-') {
+            last = strtol(p + 1, &end, 10);
+            p    = end;
+        }
+        for (long c = first; c <= last; ++c) {
+            cpus.push_back((int32_t)c);
+        }
+        while (*p == ',' || *p == '\n' || *p == ' ') ++p;
+    }
+    return cpus;
+}
+
+#endif
+
+ppl::common::RetCode perf_counter_t::open(const uint32_t event_mask)
+{
+    close();
+#if defined(__linux__)
+    struct core_event_t {
+        int32_t event;
+        uint32_t type;
+        uint64_t config;
+    };
+
+    const bool intel   = is_intel_cpu();
+    const bool avx512  = (ppl::common::GetCpuISA() & ppl::common::ISA_X86_AVX512) != 0;
+    const uint64_t l1d = PERF_COUNT_HW_CACHE_L1D |
+                         (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                         (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+
+    std::vector<core_event_t> core_events;
+    auto add_core = [&](const int32_t event, const uint32_t type, const uint64_t config) {
+        if (event_mask & PPL_X86_PERF_EVENT_BIT(event)) {
+            core_events.push_back({event, type, config});
+        }
+    };
+    add_core(PERF_EVENT_CYCLES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    add_core(PERF_EVENT_INSTRUCTIONS, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    add_core(PERF_EVENT_L1D_MISSES, PERF_TYPE_HW_CACHE, l1d);
+    add_core(PERF_EVENT_LLC_MISSES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+    if (intel) {
+        add_core(PERF_EVENT_L2_MISSES, PERF_TYPE_RAW, 0x3f24); // L2_RQSTS.MISS
+        if (avx512) {
+            add_core(PERF_EVENT_AVX512_L1_LICENSE_CYCLES, PERF_TYPE_RAW, 0x1828); // CORE_POWER.LVL1_TURBO_LICENSE
+            add_core(PERF_EVENT_AVX512_L2_LICENSE_CYCLES, PERF_TYPE_RAW, 0x2028); // CORE_POWER.LVL2_TURBO_LICENSE
+        }
+    }
+
+    // counters with pid 0 follow the thread that opens them, so every omp
+    // thread opens its own. an event is kept only if all threads got it.
+    num_threads_ = PPL_OMP_MAX_THREADS();
+    std::vector<int32_t> thread_fds(num_threads_ * core_events.size(), -1);
+    PRAGMA_OMP_PARALLEL()
+    {
+        const int32_t t = PPL_OMP_THREAD_ID();
+        for (size_t e = 0; e < core_events.size(); ++e) {
+            perf_event_attr attr;
+            init_perf_attr(core_events[e].type, core_events[e].config, true, &attr);
+            thread_fds[t * core_events.size() + e] = perf_event_open(&attr, 0, -1);
+        }
+    }
+    for (size_t e = 0; e < core_events.size(); ++e) {
+        bool all_opened = true;
+        for (int32_t t = 0; t < num_threads_; ++t) {
+            all_opened = all_opened && thread_fds[t * core_events.size() + e] >= 0;
+        }
+        for (int32_t t = 0; t < num_threads_; ++t) {
+            const int32_t fd = thread_fds[t * core_events.size() + e];
+            if (fd < 0) continue;
+            if (all_opened) {
+                fds_.push_back({fd, core_events[e].event, 1});
+            } else {
+                ::close(fd);
+            }
+        }
+        if (all_opened) {
+            valid_mask_ |= PPL_X86_PERF_EVENT_BIT(core_events[e].event);
+        }
+    }
+
+    // imc cas counts are per memory controller and socket, one 64 byte line each
+    if (intel && (event_mask & PPL_X86_PERF_EVENT_BIT(PERF_EVENT_DRAM_BYTES))) {
+        const std::string root = "/sys/bus/event_source/devices/";
+        DIR *dir = opendir(root.c_str());
+        while (dir) {
+            dirent *ent = readdir(dir);
+            if (!ent) break;
+            if (strncmp(ent->d_name, "uncore_imc", 10) != 0) continue;
+            const std::string pmu = root + ent->d_name;
+            std::string type_text, cpumask_text;
+            if (!read_text_file(pmu + "/type", &type_text) || !read_text_file(pmu + "/cpumask", &cpumask_text)) {
+                continue;
+            }
+            const uint32_t type = (uint32_t)strtoul(type_text.c_str(), nullptr, 10);
+            for (auto name : {"cas_count_read", "cas_count_write"}) {
+                std::string event_text;
+                uint64_t config;
+                if (!read_text_file(pmu + "/events/" + name, &event_text) || !parse_uncore_event(event_text, &config)) {
+                    continue;
+                }
+                for (auto cpu : parse_cpu_list(cpumask_text)) {
+                    perf_event_attr attr;
+                    init_perf_attr(type, config, false, &attr);
+                    const int32_t fd = perf_event_open(&attr, -1, cpu);
+                    if (fd >= 0) {
+                        fds_.push_back({fd, PERF_EVENT_DRAM_BYTES, 64});
+                        valid_mask_ |= PPL_X86_PERF_EVENT_BIT(PERF_EVENT_DRAM_BYTES);
+                    }
+                }
+            }
+        }
+        if (dir) {
+            closedir(dir);
+        }
+    }
+
+    return ppl::common::RC_SUCCESS;
+#else
+    (void)event_mask;
+    return ppl::common::RC_UNSUPPORTED;
+#endif
+}
+
+void perf_counter_t::close()
+{
+#if defined(__linux__)
+    for (auto &efd : fds_) {
+        ::close(efd.fd);
+    }
+#endif
+    fds_.clear();
+    valid_mask_  = 0;
+    num_threads_ = 0;
+}
+
+ppl::common::RetCode perf_counter_t::start()
+{
+#if defined(__linux__)
+    for (auto &efd : fds_) {
+        ioctl(efd.fd, PERF_EVENT_IOC_RESET, 0);
+    }
+    start_ns_ = steady_ns();
+    for (auto &efd : fds_) {
+        ioctl(efd.fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+    return ppl::common::RC_SUCCESS;
+#else
+    start_ns_ = steady_ns();
+    return ppl::common::RC_UNSUPPORTED;
+#endif
+}
+
+ppl::common::RetCode perf_counter_t::stop(perf_counter_result_t *result)
+{
+    const int64_t end_ns = steady_ns();
+    memset(result, 0, sizeof(*result));
+    result->seconds     = (end_ns - start_ns_) / 1e9;
+    result->num_threads = num_threads_;
+#if defined(__linux__)
+    for (auto &efd : fds_) {
+        ioctl(efd.fd, PERF_EVENT_IOC_DISABLE, 0);
+    }
+    for (auto &efd : fds_) {
+        uint64_t data[3]; // value, time_enabled, time_running
+        if (read(efd.fd, data, sizeof(data)) != (ssize_t)sizeof(data)) {
+            continue;
+        }
+        double value = (double)data[0];
+        if (data[2] > 0 && data[2] < data[1]) {
+            value = value * data[1] / data[2];
+        }
+        result->values[efd.event] += (uint64_t)value * efd.scale;
+    }
+    result->valid_mask = valid_mask_;
+    return ppl::common::RC_SUCCESS;
+#else
+    return ppl::common::RC_UNSUPPORTED;
+#endif
+}
+
+static double read_max_freq_ghz()
+{
+#if defined(__linux__)
+    std::string text;
+    if (read_text_file("/sys/devices/system/cpu/cpu0/cpufreq/cpuinfo_max_freq", &text)) {
+        return strtod(text.c_str(), nullptr) / 1e6; // khz
+    }
+    // vms often hide cpufreq, the current clock of cpu0 is the best guess left
+    FILE *fp = fopen("/proc/cpuinfo", "r");
+    if (fp) {
+        char line[256];
+        double mhz = 0.;
+        while (fgets(line, sizeof(line), fp)) {
+            if (strncmp(line, "cpu MHz", 7) == 0) {
+                const char *colon = strchr(line, ':');
+                mhz = colon ? strtod(colon + 1, nullptr) : 0.;
+                break;
+            }
+        }
+        fclose(fp);
+        return mhz / 1e3;
+    }
+#endif
+    return 0.;
+}
+
+machine_peak_t get_machine_peak(const ppl::common::isa_t isa, const int32_t num_cores, const double freq_ghz)
+{
+    machine_peak_t peak;
+    peak.isa       = isa;
+    peak.num_cores = num_cores > 0 ? num_cores : PPL_OMP_MAX_THREADS();
+    peak.freq_ghz  = freq_ghz > 0. ? freq_ghz : read_max_freq_ghz();
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        peak.flops_per_cycle = 2 * 2 * 16;
+    } else if (isa & ppl::common::ISA_X86_FMA) {
+        peak.flops_per_cycle = 2 * 2 * 8;
+    } else if (isa & ppl::common::ISA_X86_AVX) {
+        peak.flops_per_cycle = 2 * 8;
+    } else if (isa & ppl::common::ISA_X86_SSE) {
+        peak.flops_per_cycle = 2 * 4;
+    } else {
+        peak.flops_per_cycle = 2;
+    }
+    peak.gflops = peak.num_cores * peak.freq_ghz * peak.flops_per_cycle;
+    return peak;
+}
+
+perf_roofline_t analyze_perf_roofline(
+    const perf_counter_result_t *result,
+    const double gops,
+    const double gbytes,
+    const machine_peak_t *peak,
+    const double peak_bandwidth_gbps)
+{
+    perf_roofline_t roof;
+    memset(&roof, 0, sizeof(roof));
+    roof.bound = PERF_BOUND_UNKNOWN;
+    if (result->seconds <= 0.) {
+        return roof;
+    }
+
+    auto has = [&](const int32_t event) {
+        return (result->valid_mask & PPL_X86_PERF_EVENT_BIT(event)) != 0;
+    };
+    const double cycles = has(PERF_EVENT_CYCLES) ? (double)result->values[PERF_EVENT_CYCLES] : 0.;
+    const double instrs = has(PERF_EVENT_INSTRUCTIONS) ? (double)result->values[PERF_EVENT_INSTRUCTIONS] : 0.;
+    const double bytes  = has(PERF_EVENT_DRAM_BYTES) ? result->values[PERF_EVENT_DRAM_BYTES] / 1e9 : gbytes;
+
+    roof.gflops = gops / result->seconds;
+    roof.gbps   = bytes / result->seconds;
+    if (bytes > 0.) {
+        roof.arithmetic_intensity = gops / bytes;
+    }
+    if (cycles > 0.) {
+        roof.ipc = instrs / cycles;
+        if (result->num_threads > 0) {
+            roof.freq_ghz = cycles / result->num_threads / result->seconds / 1e9;
+        }
+        if (has(PERF_EVENT_AVX512_L1_LICENSE_CYCLES) && has(PERF_EVENT_AVX512_L2_LICENSE_CYCLES)) {
+            roof.avx512_license_ratio =
+                (result->values[PERF_EVENT_AVX512_L1_LICENSE_CYCLES] +
+                 result->values[PERF_EVENT_AVX512_L2_LICENSE_CYCLES]) / cycles;
+        }
+    }
+    if (instrs > 0.) {
+        if (has(PERF_EVENT_L1D_MISSES)) roof.l1d_mpki = result->values[PERF_EVENT_L1D_MISSES] * 1e3 / instrs;
+        if (has(PERF_EVENT_L2_MISSES)) roof.l2_mpki = result->values[PERF_EVENT_L2_MISSES] * 1e3 / instrs;
+        if (has(PERF_EVENT_LLC_MISSES)) roof.llc_mpki = result->values[PERF_EVENT_LLC_MISSES] * 1e3 / instrs;
+    }
+    if (peak && peak->gflops > 0.) {
+        roof.compute_efficiency = roof.gflops / peak->gflops;
+    }
+    if (peak_bandwidth_gbps > 0.) {
+        roof.bandwidth_efficiency = roof.gbps / peak_bandwidth_gbps;
+    }
+    // below the ridge point the bandwidth roof is the lower one
+    if (peak && peak->gflops > 0. && peak_bandwidth_gbps > 0. && bytes > 0.) {
+        const double ridge = peak->gflops / peak_bandwidth_gbps;
+        roof.bound = roof.arithmetic_intensity >= ridge ? PERF_BOUND_COMPUTE : PERF_BOUND_BANDWIDTH;
+    }
+    return roof;
+}
+
+}}}; // namespace ppl::kernel::x86
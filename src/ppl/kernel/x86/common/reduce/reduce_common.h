@@ -18,16 +18,138 @@
 #ifndef __ST_PPL_KERNEL_X86_COMMON_REDUCE_REDUCE_COMMON_H_
 #define __ST_PPL_KERNEL_X86_COMMON_REDUCE_REDUCE_COMMON_H_
 
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/common/threading_tools.h"
+
 namespace ppl { namespace kernel { namespace x86 {
 
 enum reduce_op_type_t {
-    REDUCE_MAX  = 0,
-    REDUCE_MIN  = 1,
-    REDUCE_SUM  = 2,
-    REDUCE_MEAN = 3,
-    REDUCE_PROD = 4,
+    REDUCE_MAX         = 0,
+    REDUCE_MIN         = 1,
+    REDUCE_SUM         = 2,
+    REDUCE_MEAN        = 3,
+    REDUCE_PROD        = 4,
+    REDUCE_L1          = 5,
+    REDUCE_L2          = 6,
+    REDUCE_SUM_SQUARE  = 7,
+    REDUCE_LOG_SUM_EXP = 8,
+};
+
+// split reduction for outputs too small to feed all threads: the reduced
+// range is cut into contiguous chunks, every (outer, chunk) task reduces into
+// its own partial, and partials are combined pairwise in a fixed tree, so the
+// summation order never depends on scheduling.
+//
+// the chunk count normally follows the thread count. in reproducible mode it
+// only depends on the shape (fixed chunk size), so outputs stay bit-identical
+// when the thread count changes.
+inline int64_t reduce_select_num_chunks(
+    const int64_t kept_tasks, // independent tasks without splitting
+    const int64_t outer_len, // tasks that every chunk count multiplies
+    const int64_t split_len,
+    const int64_t slice_len, // elements per split index
+    const int64_t num_threads)
+{
+    const int64_t min_chunk_elts     = 16384; // keep each chunk big enough to amortize partial combine
+    const int64_t reproducible_width = 64;
+
+    if (split_len <= 1 || slice_len <= 0) {
+        return 1;
+    }
+    if (get_reproducible_mode()) {
+        if (kept_tasks >= reproducible_width) {
+            return 1;
+        }
+        return div_up(split_len, div_up(min_chunk_elts, slice_len));
+    }
+    if (num_threads <= 1 || kept_tasks >= num_threads) {
+        return 1;
+    }
+    int64_t num_chunks = div_up(num_threads, outer_len);
+    num_chunks         = min<int64_t>(num_chunks, split_len * slice_len / min_chunk_elts);
+    num_chunks         = min<int64_t>(num_chunks, split_len);
+    return max<int64_t>(num_chunks, 1);
+}
+
+// the outermost reduced axis of the collapsed shape is the split axis
+struct reduce_split_plan_t {
+    // src dims without size 1 dims, neighbouring dims of the same kind merged
+    int64_t dims[PPL_X86_TENSOR_MAX_DIMS()];
+    int32_t axes[PPL_X86_TENSOR_MAX_DIMS()];
+    int64_t dim_count;
+    int32_t num_axes;
+
+    int64_t split_axis;
+    int64_t outer_len;
+    int64_t num_chunks;
+    int64_t chunk_len;
 };
 
+inline reduce_split_plan_t reduce_select_split_plan(
+    const int64_t *dims,
+    const int64_t dim_count,
+    const int32_t *axes, // sorted
+    const int32_t num_axes,
+    const int64_t num_threads)
+{
+    const int64_t kept_task_len = 32;
+
+    reduce_split_plan_t plan;
+    plan.dim_count  = 0;
+    plan.num_axes   = 0;
+    plan.split_axis = 0;
+    plan.outer_len  = 1;
+    plan.num_chunks = 1;
+    plan.chunk_len  = 1;
+
+    int64_t total_len = 1;
+    int64_t dst_len   = 1;
+    bool last_reduced = false;
+    for (int64_t i = 0; i < dim_count; ++i) {
+        bool reduced = false;
+        for (int64_t a = 0; a < num_axes; ++a) {
+            reduced = reduced || axes[a] == i;
+        }
+        total_len *= dims[i];
+        if (!reduced) {
+            dst_len *= dims[i];
+        }
+        if (dims[i] == 1) {
+            continue;
+        }
+        if (plan.dim_count > 0 && reduced == last_reduced) {
+            plan.dims[plan.dim_count - 1] *= dims[i];
+            continue;
+        }
+        if (reduced) {
+            plan.axes[plan.num_axes++] = plan.dim_count;
+        }
+        plan.dims[plan.dim_count++] = dims[i];
+        last_reduced = reduced;
+    }
+    if (total_len == 0 || plan.num_axes == 0) {
+        return plan;
+    }
+
+    plan.split_axis = plan.axes[0];
+    for (int64_t i = 0; i < plan.split_axis; ++i) {
+        plan.outer_len *= plan.dims[i];
+    }
+    plan.chunk_len = plan.dims[plan.split_axis];
+
+    const int64_t split_len  = plan.dims[plan.split_axis];
+    const int64_t kept_tasks = plan.outer_len * div_up(dst_len / plan.outer_len, kept_task_len);
+    const int64_t num_chunks = reduce_select_num_chunks(
+        kept_tasks, plan.outer_len, split_len, total_len / (plan.outer_len * split_len), num_threads);
+    if (num_chunks < 2) {
+        return plan;
+    }
+
+    plan.chunk_len  = div_up(split_len, num_chunks);
+    plan.num_chunks = div_up(split_len, plan.chunk_len);
+    return plan;
+}
+
 }}}; // namespace ppl::kernel::x86
 
 #endif
@@ -20,6 +20,7 @@
 
 #include "ppl/kernel/x86/common/internal_include.h"
 #include "ppl/kernel/x86/common/memory.h"
+#include "ppl/kernel/x86/common/scatter_reduce/scatter_reduce_common.h"
 
 namespace ppl { namespace kernel { namespace x86 {
 
@@ -73,6 +74,128 @@ ppl::common::RetCode scatter_elements_ndarray_common(
     return ppl::common::RC_SUCCESS;
 }
 
+// Every (outer, inner) column only receives updates from the same column of
+// indices, so columns are independent. Walking each column's updates in
+// order keeps duplicated indices deterministic without any sorting.
+template <typename eT, int32_t reduction>
+void scatter_elements_reduce_columns(
+    const int64_t *indices,
+    const eT *updates,
+    const int64_t outer_dims,
+    const int64_t indices_scatter_dims,
+    const int64_t indices_inner_dims,
+    const int64_t src_scatter_dims,
+    const int64_t src_inner_dims,
+    eT *dst)
+{
+    const int64_t inner_blk = 256;
+#ifndef PPL_USE_X86_OMP_COLLAPSE
+    PRAGMA_OMP_PARALLEL_FOR()
+#else
+    PRAGMA_OMP_PARALLEL_FOR_COLLAPSE(2)
+#endif
+    for (int64_t i = 0; i < outer_dims; i++) {
+        for (int64_t kb = 0; kb < indices_inner_dims; kb += inner_blk) {
+            const int64_t k_end = min(kb + inner_blk, indices_inner_dims);
+            eT *l_dst           = dst + i * src_scatter_dims * src_inner_dims;
+            for (int64_t j = 0; j < indices_scatter_dims; j++) {
+                const int64_t *l_indices = indices + (i * indices_scatter_dims + j) * indices_inner_dims;
+                const eT *l_updates      = updates + (i * indices_scatter_dims + j) * indices_inner_dims;
+                for (int64_t k = kb; k < k_end; k++) {
+                    const int64_t index = l_indices[k] < 0 ? l_indices[k] + src_scatter_dims : l_indices[k];
+                    eT *d               = l_dst + index * src_inner_dims + k;
+                    *d                  = scatter_reduce_op<eT, reduction>(*d, l_updates[k]);
+                }
+            }
+        }
+    }
+}
+
+// reduction: 0: none, 1: add, 2: mul, 3: max, 4: min, indices may be
+// negative. none keeps the plain parallel store above, duplicated indices
+// are undefined there as in onnx.
+template <typename eT>
+ppl::common::RetCode scatter_elements_ndarray_common(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *indices_shape,
+    const eT *src,
+    const int64_t *indices,
+    const eT *updates,
+    const int64_t axis,
+    const int32_t reduction,
+    eT *dst)
+{
+    if (reduction == SCATTER_REDUCTION_NONE) {
+        return scatter_elements_ndarray_common<eT>(src_shape, indices_shape, src, indices, updates, axis, dst);
+    }
+    if (reduction < SCATTER_REDUCTION_ADD || reduction > SCATTER_REDUCTION_MIN) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+
+    const int64_t dim_count    = src_shape->GetDimCount();
+    const int64_t scatter_axis = axis < 0 ? axis + dim_count : axis;
+
+    int64_t src_outer_dims     = 1;
+    int64_t indices_outer_dims = 1;
+    for (int64_t i = 0; i < scatter_axis; i++) {
+        src_outer_dims *= src_shape->GetDim(i);
+        indices_outer_dims *= indices_shape->GetDim(i);
+    }
+
+    const int64_t src_scatter_dims     = src_shape->GetDim(scatter_axis);
+    const int64_t indices_scatter_dims = indices_shape->GetDim(scatter_axis);
+
+    int64_t src_inner_dims     = 1;
+    int64_t indices_inner_dims = 1;
+    for (int64_t i = scatter_axis + 1; i < dim_count; i++) {
+        src_inner_dims *= src_shape->GetDim(i);
+        indices_inner_dims *= indices_shape->GetDim(i);
+    }
+
+    const int64_t num_updates = indices_outer_dims * indices_scatter_dims * indices_inner_dims;
+    for (int64_t u = 0; u < num_updates; u++) {
+        if (indices[u] < -src_scatter_dims || indices[u] >= src_scatter_dims) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+    }
+
+    memory_copy(src, src_shape->CalcBytesExcludingPadding(), dst);
+
+    // few columns, e.g. a 1-d scatter: parallelize over dst instead
+    if (indices_outer_dims * div_up(indices_inner_dims, 256) < PPL_OMP_MAX_THREADS()) {
+        std::vector<int64_t> offsets(num_updates);
+        for (int64_t i = 0; i < indices_outer_dims; i++) {
+            for (int64_t j = 0; j < indices_scatter_dims; j++) {
+                for (int64_t k = 0; k < indices_inner_dims; k++) {
+                    const int64_t u     = (i * indices_scatter_dims + j) * indices_inner_dims + k;
+                    const int64_t index = indices[u] < 0 ? indices[u] + src_scatter_dims : indices[u];
+                    offsets[u]          = (i * src_scatter_dims + index) * src_inner_dims + k;
+                }
+            }
+        }
+        return scatter_reduce_offsets<eT>(
+            offsets.data(), updates, num_updates, 1,
+            src_outer_dims * src_scatter_dims * src_inner_dims, reduction, dst);
+    }
+
+    switch (reduction) {
+        case SCATTER_REDUCTION_ADD:
+            scatter_elements_reduce_columns<eT, SCATTER_REDUCTION_ADD>(indices, updates, indices_outer_dims, indices_scatter_dims, indices_inner_dims, src_scatter_dims, src_inner_dims, dst);
+            break;
+        case SCATTER_REDUCTION_MUL:
+            scatter_elements_reduce_columns<eT, SCATTER_REDUCTION_MUL>(indices, updates, indices_outer_dims, indices_scatter_dims, indices_inner_dims, src_scatter_dims, src_inner_dims, dst);
+            break;
+        case SCATTER_REDUCTION_MAX:
+            scatter_elements_reduce_columns<eT, SCATTER_REDUCTION_MAX>(indices, updates, indices_outer_dims, indices_scatter_dims, indices_inner_dims, src_scatter_dims, src_inner_dims, dst);
+            break;
+        default:
+            scatter_elements_reduce_columns<eT, SCATTER_REDUCTION_MIN>(indices, updates, indices_outer_dims, indices_scatter_dims, indices_inner_dims, src_scatter_dims, src_inner_dims, dst);
+            break;
+    }
+
+    return ppl::common::RC_SUCCESS;
+}
+
 }}}; // namespace ppl::kernel::x86
 
 #endif // __ST_PPL_KERNEL_X86_COMMON_SCATTER_ELEMENTS_SCATTER_ELEMENTS_COMMON_H_
\ No newline at end of file
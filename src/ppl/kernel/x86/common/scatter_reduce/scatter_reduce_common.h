@@ -0,0 +1,132 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_COMMON_SCATTER_REDUCE_SCATTER_REDUCE_COMMON_H_
+#define __ST_PPL_KERNEL_X86_COMMON_SCATTER_REDUCE_SCATTER_REDUCE_COMMON_H_
+
+#include <vector>
+
+#include "ppl/kernel/x86/common/internal_include.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+// onnx scatter reduction attribute
+enum scatter_reduction_t {
+    SCATTER_REDUCTION_NONE = 0,
+    SCATTER_REDUCTION_ADD  = 1,
+    SCATTER_REDUCTION_MUL  = 2,
+    SCATTER_REDUCTION_MAX  = 3,
+    SCATTER_REDUCTION_MIN  = 4,
+};
+
+template <typename eT, int32_t reduction>
+inline eT scatter_reduce_op(const eT a, const eT b)
+{
+    switch (reduction) {
+        case SCATTER_REDUCTION_ADD: return a + b;
+        case SCATTER_REDUCTION_MUL: return a * b;
+        case SCATTER_REDUCTION_MAX: return max(a, b);
+        case SCATTER_REDUCTION_MIN: return min(a, b);
+        default: return b;
+    }
+}
+
+// Apply updates[k * inner_dim, (k + 1) * inner_dim) onto dst + offsets[k]
+// for every k. Duplicated offsets are combined in the order of k, so the
+// result matches a serial loop whatever the thread count.
+//
+// Updates are bucketed by a stable counting sort on which part of dst they
+// land in. Every part is owned by one thread, so no two threads ever touch
+// the same element and no atomics are needed. Wide slices are also split
+// along inner_dim when there are fewer parts than threads.
+template <typename eT, int32_t reduction>
+ppl::common::RetCode scatter_reduce_offsets(
+    const int64_t *offsets,
+    const eT *updates,
+    const int64_t num_updates,
+    const int64_t inner_dim,
+    const int64_t dst_length,
+    eT *dst)
+{
+    if (num_updates <= 0 || inner_dim <= 0) {
+        return ppl::common::RC_SUCCESS;
+    }
+    const int64_t num_slots   = dst_length / inner_dim;
+    const int64_t num_threads = PPL_OMP_MAX_THREADS();
+    const int64_t num_parts   = max<int64_t>(min<int64_t>(num_threads, num_slots), 1);
+
+    std::vector<int64_t> part_begin(num_parts + 1, 0);
+    std::vector<int64_t> order(num_updates);
+    for (int64_t k = 0; k < num_updates; ++k) {
+        if (offsets[k] < 0 || offsets[k] + inner_dim > dst_length) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+        part_begin[offsets[k] / inner_dim * num_parts / num_slots + 1] += 1;
+    }
+    for (int64_t p = 0; p < num_parts; ++p) {
+        part_begin[p + 1] += part_begin[p];
+    }
+    {
+        std::vector<int64_t> part_fill(part_begin.begin(), part_begin.end() - 1);
+        for (int64_t k = 0; k < num_updates; ++k) {
+            order[part_fill[offsets[k] / inner_dim * num_parts / num_slots]++] = k;
+        }
+    }
+
+    const int64_t min_inner_blk  = 64;
+    const int64_t num_inner_blks = max<int64_t>(min<int64_t>(div_up(num_threads, num_parts), inner_dim / min_inner_blk), 1);
+    const int64_t inner_blk      = div_up(inner_dim, num_inner_blks);
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t t = 0; t < num_parts * num_inner_blks; ++t) {
+        const int64_t p         = t / num_inner_blks;
+        const int64_t inner_beg = (t % num_inner_blks) * inner_blk;
+        const int64_t inner_end = min(inner_beg + inner_blk, inner_dim);
+        for (int64_t o = part_begin[p]; o < part_begin[p + 1]; ++o) {
+            const int64_t k  = order[o];
+            const eT *l_upd  = updates + k * inner_dim;
+            eT *l_dst        = dst + offsets[k];
+            for (int64_t i = inner_beg; i < inner_end; ++i) {
+                l_dst[i] = scatter_reduce_op<eT, reduction>(l_dst[i], l_upd[i]);
+            }
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <typename eT>
+ppl::common::RetCode scatter_reduce_offsets(
+    const int64_t *offsets,
+    const eT *updates,
+    const int64_t num_updates,
+    const int64_t inner_dim,
+    const int64_t dst_length,
+    const int32_t reduction,
+    eT *dst)
+{
+    switch (reduction) {
+        case SCATTER_REDUCTION_NONE: return scatter_reduce_offsets<eT, SCATTER_REDUCTION_NONE>(offsets, updates, num_updates, inner_dim, dst_length, dst);
+        case SCATTER_REDUCTION_ADD: return scatter_reduce_offsets<eT, SCATTER_REDUCTION_ADD>(offsets, updates, num_updates, inner_dim, dst_length, dst);
+        case SCATTER_REDUCTION_MUL: return scatter_reduce_offsets<eT, SCATTER_REDUCTION_MUL>(offsets, updates, num_updates, inner_dim, dst_length, dst);
+        case SCATTER_REDUCTION_MAX: return scatter_reduce_offsets<eT, SCATTER_REDUCTION_MAX>(offsets, updates, num_updates, inner_dim, dst_length, dst);
+        case SCATTER_REDUCTION_MIN: return scatter_reduce_offsets<eT, SCATTER_REDUCTION_MIN>(offsets, updates, num_updates, inner_dim, dst_length, dst);
+        default: return ppl::common::RC_UNSUPPORTED;
+    }
+}
+
+}}}; // namespace ppl::kernel::x86
+
+#endif
@@ -23,6 +23,7 @@
 
 #include "ppl/kernel/x86/common/internal_include.h"
 #include "ppl/kernel/x86/common/threading_tools.h"
+#include "ppl/kernel/x86/common/concat_view.h"
 
 namespace ppl { namespace kernel { namespace x86 {
 
@@ -43,6 +44,34 @@ struct split_parallel_info {
     int32_t end;
 };
 
+// every output is consumed straight from its view of src, all or nothing
+template <typename eT>
+bool split_dsts_in_place(
+    const ppl::common::TensorShape **dst_shape_list,
+    const eT *src,
+    const int32_t slice_axis,
+    const int32_t num_dst,
+    const bool n16cx,
+    eT **dst_list)
+{
+    if (num_dst > PPL_X86_CONCAT_MAX_VIEWS()) {
+        return false;
+    }
+    concat_view_t views[PPL_X86_CONCAT_MAX_VIEWS()];
+    const ppl::common::RetCode rc = n16cx
+        ? split_n16cx_select_views(dst_shape_list, num_dst, slice_axis, views)
+        : split_ndarray_select_views(dst_shape_list, num_dst, slice_axis, views);
+    if (rc != ppl::common::RC_SUCCESS) {
+        return false;
+    }
+    for (int32_t n = 0; n < num_dst; ++n) {
+        if (dst_list[n] != src + views[n].offset) {
+            return false;
+        }
+    }
+    return true;
+}
+
 template <typename eT>
 ppl::common::RetCode split_ndarray(
     const ppl::common::TensorShape *src_shape,
@@ -52,6 +81,10 @@ ppl::common::RetCode split_ndarray(
     const int32_t num_dst,
     eT **dst_list)
 {
+    if (split_dsts_in_place<eT>(dst_shape_list, src, slice_axis, num_dst, false, dst_list)) {
+        return ppl::common::RC_SUCCESS;
+    }
+
     const int32_t ndims         = src_shape->GetDimCount();
     const int32_t fixed_axis    = slice_axis < 0 ? slice_axis + ndims : slice_axis;
     const int64_t src_split_dim = src_shape->GetDim(fixed_axis);
@@ -240,6 +273,10 @@ ppl::common::RetCode split_n16cx(
     const int64_t c_dim_idx  = 1;
     const int64_t c_blk      = 16;
 
+    if (split_dsts_in_place<eT>(dst_shape_list, src, slice_axis, num_dst, true, dst_list)) {
+        return ppl::common::RC_SUCCESS;
+    }
+
     if (fixed_axis == 1) {
         for (int32_t i = 0; i < num_dst - 1; i++) {
             if (dst_shape_list[i]->GetDim(c_dim_idx) % c_blk != 0) {
@@ -22,6 +22,8 @@
 #include <pthread.h>
 #endif
 
+#include <atomic>
+
 #include "ppl/kernel/x86/common/threading_tools.h"
 #include "ppl/kernel/x86/common/internal_include.h"
 #include "ppl/common/log.h"
@@ -61,6 +63,19 @@ void set_omp_num_threads(int32_t n)
     PPL_OMP_SET_NUM_THREADS(n);
 }
 
+// read by every kernel call, possibly from several threads at once
+static std::atomic<bool> g_reproducible_mode(false);
+
+void set_reproducible_mode(const int32_t on)
+{
+    g_reproducible_mode.store(on != 0, std::memory_order_relaxed);
+}
+
+bool get_reproducible_mode()
+{
+    return g_reproducible_mode.load(std::memory_order_relaxed);
+}
+
 // A very naive version
 single_parallel_loop_config_t select_single_parallel_loop(
     const std::vector<int64_t> &iter_of_loop,
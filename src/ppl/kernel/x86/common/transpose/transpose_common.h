@@ -22,369 +22,210 @@
 #include <string.h>
 
 #include "ppl/kernel/x86/common/internal_include.h"
-#include "ppl/kernel/x86/common/threading_tools.h"
 
 namespace ppl { namespace kernel { namespace x86 {
 
+// Scalar block kernel, simd kernels provide BLK x BLK register transposes with the same interface
 template <typename eT>
-ppl::common::RetCode transpose2d_ndarray(
-    const eT *src,
-    const int64_t *dst_dims,
-    const int64_t *map_stride,
-    const int64_t *dst_stride,
-    eT *dst)
-{
-#ifndef PPL_USE_X86_OMP_COLLAPSE
-    PRAGMA_OMP_PARALLEL_FOR()
-#else
-    PRAGMA_OMP_PARALLEL_FOR_COLLAPSE(1)
-#endif
-    for (int64_t d0 = 0; d0 < dst_dims[0]; ++d0) {
-        auto l_src = src
-            + d0 * map_stride[0];
-        auto l_dst = dst
-            + d0 * dst_stride[0];
-
-        int64_t inner_dim  = dst_dims[1];
-        int64_t src_stride = map_stride[1];
-
-        if (src_stride == 1) {
-            for (int64_t i = 0; i < inner_dim; ++i) {
-                l_dst[i] = l_src[i];
-            }
-        } else {
-            for (int64_t i = 0; i < inner_dim; ++i) {
-                l_dst[i] = l_src[i * src_stride];
-            }
-        }
+struct transpose_block_kernel_ref {
+    static const int64_t BLK = 1;
+    static inline void transpose_blk(
+        const eT *src,
+        const int64_t src_stride,
+        const int64_t dst_stride,
+        eT *dst)
+    {
+        dst[0] = src[0];
     }
-    return ppl::common::RC_SUCCESS;
-}
+};
 
+// src is rows x cols with row stride src_stride, dst is cols x rows with row stride dst_stride
 template <typename eT>
-ppl::common::RetCode transpose3d_ndarray(
+inline void transpose_tile_ref(
     const eT *src,
-    const int64_t *dst_dims,
-    const int64_t *map_stride,
-    const int64_t *dst_stride,
+    const int64_t src_stride,
+    const int64_t dst_stride,
+    const int64_t rows,
+    const int64_t cols,
     eT *dst)
 {
-#ifndef PPL_USE_X86_OMP_COLLAPSE
-    PRAGMA_OMP_PARALLEL_FOR()
-#else
-    PRAGMA_OMP_PARALLEL_FOR_COLLAPSE(2)
-#endif
-    for (int64_t d0 = 0; d0 < dst_dims[0]; ++d0) {
-        for (int64_t d1 = 0; d1 < dst_dims[1]; ++d1) {
-            auto l_src = src
-                + d0 * map_stride[0]
-                + d1 * map_stride[1];
-            auto l_dst = dst
-                + d0 * dst_stride[0]
-                + d1 * dst_stride[1];
-
-            int64_t inner_dim  = dst_dims[2];
-            int64_t src_stride = map_stride[2];
-
-            if (src_stride == 1) {
-                for (int64_t i = 0; i < inner_dim; ++i) {
-                    l_dst[i] = l_src[i];
-                }
-            } else {
-                for (int64_t i = 0; i < inner_dim; ++i) {
-                    l_dst[i] = l_src[i * src_stride];
-                }
-            }
+    for (int64_t c = 0; c < cols; ++c) {
+        for (int64_t r = 0; r < rows; ++r) {
+            dst[c * dst_stride + r] = src[r * src_stride + c];
         }
     }
-    return ppl::common::RC_SUCCESS;
 }
 
-
-template <typename eT>
-ppl::common::RetCode transpose4d_ndarray(
+template <typename eT, typename block_kernel_t>
+inline void transpose_tile(
     const eT *src,
-    const int64_t *dst_dims,
-    const int64_t *map_stride,
-    const int64_t *dst_stride,
+    const int64_t src_stride,
+    const int64_t dst_stride,
+    const int64_t rows,
+    const int64_t cols,
     eT *dst)
 {
-#ifndef PPL_USE_X86_OMP_COLLAPSE
-    PRAGMA_OMP_PARALLEL_FOR()
-#else
-    PRAGMA_OMP_PARALLEL_FOR_COLLAPSE(3)
-#endif
-    for (int64_t d0 = 0; d0 < dst_dims[0]; ++d0) {
-        for (int64_t d1 = 0; d1 < dst_dims[1]; ++d1) {
-            for (int64_t d2 = 0; d2 < dst_dims[2]; ++d2) {
-                auto l_src = src
-                    + d0 * map_stride[0]
-                    + d1 * map_stride[1]
-                    + d2 * map_stride[2];
-                auto l_dst = dst
-                    + d0 * dst_stride[0]
-                    + d1 * dst_stride[1]
-                    + d2 * dst_stride[2];
-
-                int64_t inner_dim  = dst_dims[3];
-                int64_t src_stride = map_stride[3];
-
-                if (src_stride == 1) {
-                    for (int64_t i = 0; i < inner_dim; ++i) {
-                        l_dst[i] = l_src[i];
-                    }
-                } else {
-                    for (int64_t i = 0; i < inner_dim; ++i) {
-                        l_dst[i] = l_src[i * src_stride];
-                    }
-                }
-            }
-        }
+    const int64_t BLK = block_kernel_t::BLK;
+    if (BLK == 1) {
+        transpose_tile_ref<eT>(src, src_stride, dst_stride, rows, cols, dst);
+        return;
     }
-    return ppl::common::RC_SUCCESS;
-}
-
-template <typename eT>
-ppl::common::RetCode transpose5d_ndarray(
-    const eT *src,
-    const int64_t *dst_dims,
-    const int64_t *map_stride,
-    const int64_t *dst_stride,
-    eT *dst)
-{
-#ifndef PPL_USE_X86_OMP_COLLAPSE
-    PRAGMA_OMP_PARALLEL_FOR()
-#else
-    PRAGMA_OMP_PARALLEL_FOR_COLLAPSE(4)
-#endif
-    for (int64_t d0 = 0; d0 < dst_dims[0]; ++d0) {
-        for (int64_t d1 = 0; d1 < dst_dims[1]; ++d1) {
-            for (int64_t d2 = 0; d2 < dst_dims[2]; ++d2) {
-                for (int64_t d3 = 0; d3 < dst_dims[3]; ++d3) {
-                    auto l_src = src
-                        + d0 * map_stride[0]
-                        + d1 * map_stride[1]
-                        + d2 * map_stride[2]
-                        + d3 * map_stride[3];
-                    auto l_dst = dst
-                        + d0 * dst_stride[0]
-                        + d1 * dst_stride[1]
-                        + d2 * dst_stride[2]
-                        + d3 * dst_stride[3];
-
-                    int64_t inner_dim  = dst_dims[4];
-                    int64_t src_stride = map_stride[4];
-
-                    if (src_stride == 1) {
-                        for (int64_t i = 0; i < inner_dim; ++i) {
-                            l_dst[i] = l_src[i];
-                        }
-                    } else {
-                        for (int64_t i = 0; i < inner_dim; ++i) {
-                            l_dst[i] = l_src[i * src_stride];
-                        }
-                    }
-                }
-            }
+    const int64_t rows_body = round(rows, BLK);
+    const int64_t cols_body = round(cols, BLK);
+    for (int64_t c = 0; c < cols_body; c += BLK) {
+        for (int64_t r = 0; r < rows_body; r += BLK) {
+            block_kernel_t::transpose_blk(src + r * src_stride + c, src_stride, dst_stride, dst + c * dst_stride + r);
         }
     }
-    return ppl::common::RC_SUCCESS;
-}
-
-template <typename eT>
-ppl::common::RetCode transpose6d_ndarray(
-    const eT *src,
-    const int64_t *dst_dims,
-    const int64_t *map_stride,
-    const int64_t *dst_stride,
-    eT *dst)
-{
-#ifndef PPL_USE_X86_OMP_COLLAPSE
-    PRAGMA_OMP_PARALLEL_FOR()
-#else
-    PRAGMA_OMP_PARALLEL_FOR_COLLAPSE(5)
-#endif
-    for (int64_t d0 = 0; d0 < dst_dims[0]; ++d0) {
-        for (int64_t d1 = 0; d1 < dst_dims[1]; ++d1) {
-            for (int64_t d2 = 0; d2 < dst_dims[2]; ++d2) {
-                for (int64_t d3 = 0; d3 < dst_dims[3]; ++d3) {
-                    for (int64_t d4 = 0; d4 < dst_dims[4]; ++d4) {
-                        auto l_src = src
-                            + d0 * map_stride[0]
-                            + d1 * map_stride[1]
-                            + d2 * map_stride[2]
-                            + d3 * map_stride[3]
-                            + d4 * map_stride[4];
-                        auto l_dst = dst
-                            + d0 * dst_stride[0]
-                            + d1 * dst_stride[1]
-                            + d2 * dst_stride[2]
-                            + d3 * dst_stride[3]
-                            + d4 * dst_stride[4];
-
-                        int64_t inner_dim  = dst_dims[5];
-                        int64_t src_stride = map_stride[5];
-
-                        if (src_stride == 1) {
-                            for (int64_t i = 0; i < inner_dim; ++i) {
-                                l_dst[i] = l_src[i];
-                            }
-                        } else {
-                            for (int64_t i = 0; i < inner_dim; ++i) {
-                                l_dst[i] = l_src[i * src_stride];
-                            }
-                        }
-                    }
-                }
-            }
-        }
+    if (rows_body < rows) {
+        transpose_tile_ref<eT>(
+            src + rows_body * src_stride, src_stride, dst_stride,
+            rows - rows_body, cols_body, dst + rows_body);
     }
-    return ppl::common::RC_SUCCESS;
-}
-
-template <typename eT>
-void transpose_ndarray_recursive(
-    const single_parallel_loop_config_t &pc,
-    const int64_t *dst_dims,
-    const int64_t *map_stride,
-    const int64_t *dst_stride,
-    const uint32_t dim_index,
-    const uint32_t dim_count,
-    const int64_t src_offset,
-    const int64_t dst_offset,
-    const eT *src,
-    eT *dst)
-{
-    const int64_t dim_len = dst_dims[dim_index];
-    if (dim_index == dim_count - 1) {
-        const int64_t src_stride = map_stride[dim_index];
-        auto l_dst = dst + dst_offset;
-        auto l_src = src + src_offset;
-        if (dim_index == pc.depth_of_loop && dim_len > 1) {
-            const int64_t thr_len = div_up(dim_len, pc.num_threads);
-            PRAGMA_OMP_PARALLEL_FOR()
-            for (int64_t t = 0; t < pc.num_threads; ++t) {
-                const int64_t beg_idx = t * thr_len;
-                const int64_t end_idx = min<int64_t>(beg_idx + thr_len, dim_len);
-                if (src_stride == 1) {
-                    for (int64_t i = beg_idx; i < end_idx; i++) {
-                        l_dst[i] = l_src[i];
-                    }
-                } else {
-                    for (int64_t i = beg_idx; i < end_idx; i++) {
-                        l_dst[i] = l_src[i * src_stride];
-                    }
-                }
-            }
-        } else {
-            if (src_stride == 1) {
-                for (int64_t i = 0; i < dim_len; i++) {
-                    l_dst[i] = l_src[i];
-                }
-            } else {
-                for (int64_t i = 0; i < dim_len; i++) {
-                    l_dst[i] = l_src[i * src_stride];
-                }
-            }
-        }
-    } else {
-        if (dim_index == pc.depth_of_loop && dim_len > 1) {
-            const int64_t thr_len = div_up(dim_len, pc.num_threads);
-            PRAGMA_OMP_PARALLEL_FOR()
-            for (int64_t t = 0; t < pc.num_threads; ++t) {
-                const int64_t beg_idx = t * thr_len;
-                const int64_t end_idx = min<int64_t>(beg_idx + thr_len, dim_len);
-                for (int64_t i = beg_idx; i < end_idx; i++) {
-                    transpose_ndarray_recursive<eT>(
-                        pc, dst_dims, map_stride, dst_stride,
-                        dim_index + 1, dim_count,
-                        src_offset + i * map_stride[dim_index],
-                        dst_offset + i * dst_stride[dim_index],
-                        src, dst);
-                }
-            }
-        } else {
-            for (int64_t i = 0; i < dim_len; i++) {
-                transpose_ndarray_recursive<eT>(
-                        pc, dst_dims, map_stride, dst_stride,
-                        dim_index + 1, dim_count,
-                        src_offset + i * map_stride[dim_index],
-                        dst_offset + i * dst_stride[dim_index],
-                        src, dst);
-            }
-        }
+    if (cols_body < cols) {
+        transpose_tile_ref<eT>(
+            src + cols_body, src_stride, dst_stride,
+            rows, cols - cols_body, dst + cols_body * dst_stride);
     }
 }
 
-template <typename eT>
-ppl::common::RetCode transpose_ndarray(
+// 1. drop unit dims and merge dst-adjacent axes that are also contiguous in src
+// 2. if the innermost dst axis is the innermost src axis, every inner run is a memcpy
+// 3. otherwise transpose the (innermost dst axis, innermost src axis) pair in L1-sized
+//    tiles made of block_kernel_t register transposes, all other axes are outer loops
+template <typename eT, typename block_kernel_t>
+ppl::common::RetCode transpose_ndarray_engine(
     const ppl::common::TensorShape *src_shape,
-    const ppl::common::TensorShape *dst_shape,
     const int32_t *perm,
     const eT *src,
     eT *dst)
 {
     const int64_t dim_count = src_shape->GetDimCount();
-
-    if (dim_count <= 1) {
+    const int64_t total = src_shape->CalcElementsIncludingPadding();
+    if (total == 0) {
         return ppl::common::RC_SUCCESS;
     }
 
-    std::vector<int32_t> inv_perm(dim_count);
-    std::vector<int64_t> dst_dims(dim_count);
-    std::vector<int64_t> dst_stride(dim_count);
-    std::vector<int64_t> src_dims(dim_count);
     std::vector<int64_t> src_stride(dim_count);
-    std::vector<int64_t> map_stride(dim_count);
+    if (dim_count > 0) {
+        src_stride[dim_count - 1] = 1;
+        for (int64_t i = dim_count - 2; i >= 0; --i) {
+            src_stride[i] = src_stride[i + 1] * src_shape->GetDim(i + 1);
+        }
+    }
 
+    std::vector<int64_t> dims;
+    std::vector<int64_t> map_stride;
     for (int64_t i = 0; i < dim_count; ++i) {
         auto perm_val = perm[i];
         if (perm_val < 0) perm_val += dim_count;
-        inv_perm[perm_val] = i;
-        src_dims[i] = src_shape->GetDim(i);
-        dst_dims[i] = src_shape->GetDim(perm_val);
+        const int64_t len = src_shape->GetDim(perm_val);
+        if (len == 1) continue;
+        if (!dims.empty() && map_stride.back() == src_stride[perm_val] * len) {
+            dims.back() *= len;
+            map_stride.back() = src_stride[perm_val];
+        } else {
+            dims.push_back(len);
+            map_stride.push_back(src_stride[perm_val]);
+        }
     }
 
-    src_stride[dim_count - 1] = 1;
-    dst_stride[dim_count - 1] = 1;
-    for (int64_t i = dim_count - 2; i >= 0; i--) {
-        src_stride[i] = src_stride[i + 1] * src_dims[i + 1];
-        dst_stride[i] = dst_stride[i + 1] * dst_dims[i + 1];
+    const int64_t reduced_count = dims.size();
+    if (reduced_count <= 1 || map_stride[reduced_count - 1] == 1) {
+        const int64_t inner_len = reduced_count ? dims[reduced_count - 1] : 1;
+        const int64_t outer_len = total / inner_len;
+        if (outer_len == 1) {
+            const int64_t num_threads = PPL_OMP_MAX_THREADS();
+            const int64_t blk = round_up(div_up(inner_len, num_threads), PPL_X86_CACHELINE_BYTES() / sizeof(eT));
+            PRAGMA_OMP_PARALLEL_FOR()
+            for (int64_t i = 0; i < inner_len; i += blk) {
+                memcpy(dst + i, src + i, min(blk, inner_len - i) * sizeof(eT));
+            }
+            return ppl::common::RC_SUCCESS;
+        }
+        const int64_t outer_count = reduced_count - 1;
+        PRAGMA_OMP_PARALLEL_FOR()
+        for (int64_t o = 0; o < outer_len; ++o) {
+            int64_t rem = o;
+            int64_t src_ofs = 0;
+            for (int64_t i = outer_count - 1; i >= 0; --i) {
+                src_ofs += (rem % dims[i]) * map_stride[i];
+                rem /= dims[i];
+            }
+            memcpy(dst + o * inner_len, src + src_ofs, inner_len * sizeof(eT));
+        }
+        return ppl::common::RC_SUCCESS;
     }
 
-    for (int64_t i = 0; i < dim_count; ++i) {
-        map_stride[inv_perm[i]] = src_stride[i];
+    std::vector<int64_t> dst_stride(reduced_count);
+    dst_stride[reduced_count - 1] = 1;
+    for (int64_t i = reduced_count - 2; i >= 0; --i) {
+        dst_stride[i] = dst_stride[i + 1] * dims[i + 1];
     }
 
-#ifndef PPL_USE_X86_OMP_COLLAPSE
-    const bool enable_omp_collapse = false;
-#else
-    const bool enable_omp_collapse = true;
-#endif
-
-    if (dim_count <= 6 && (enable_omp_collapse || dst_dims[0] > PPL_OMP_MAX_THREADS())) {
-        auto transpose_func = transpose2d_ndarray<eT>;
-        if (dim_count == 3) transpose_func = transpose3d_ndarray<eT>;
-        if (dim_count == 4) transpose_func = transpose4d_ndarray<eT>;
-        if (dim_count == 5) transpose_func = transpose5d_ndarray<eT>;
-        if (dim_count == 6) transpose_func = transpose6d_ndarray<eT>;
+    const int64_t ax_a = reduced_count - 1;
+    int64_t ax_b = 0;
+    for (int64_t i = 0; i < reduced_count; ++i) {
+        if (map_stride[i] == 1) ax_b = i;
+    }
 
-        return transpose_func(
-            src, dst_dims.data(), map_stride.data(),
-            dst_stride.data(), dst);
+    std::vector<int64_t> outer_dims;
+    std::vector<int64_t> outer_src_stride;
+    std::vector<int64_t> outer_dst_stride;
+    for (int64_t i = 0; i < reduced_count; ++i) {
+        if (i == ax_a || i == ax_b) continue;
+        outer_dims.push_back(dims[i]);
+        outer_src_stride.push_back(map_stride[i]);
+        outer_dst_stride.push_back(dst_stride[i]);
     }
 
-    auto pc = select_single_parallel_loop(
-        dst_dims, ppl::common::ISA_UNKNOWN,
-        sizeof(eT), sizeof(eT), sizeof(eT), 1);
+    const int64_t len_a = dims[ax_a];
+    const int64_t len_b = dims[ax_b];
+    const int64_t src_stride_a = map_stride[ax_a];
+    const int64_t dst_stride_b = dst_stride[ax_b];
+    const int64_t outer_len = total / (len_a * len_b);
+    const int64_t outer_count = outer_dims.size();
 
-    transpose_ndarray_recursive(
-        pc, dst_dims.data(), map_stride.data(), dst_stride.data(),
-        0, dim_count, 0, 0, src, dst);
+    const int64_t tile_len = round_up(sizeof(eT) >= 8 ? 32 : 64, block_kernel_t::BLK);
+    const int64_t tiles_a = div_up(len_a, tile_len);
+    const int64_t tiles_b = div_up(len_b, tile_len);
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t t = 0; t < outer_len * tiles_b * tiles_a; ++t) {
+        const int64_t ta = t % tiles_a;
+        const int64_t tb = (t / tiles_a) % tiles_b;
+        int64_t rem = t / (tiles_a * tiles_b);
+        int64_t src_ofs = 0;
+        int64_t dst_ofs = 0;
+        for (int64_t i = outer_count - 1; i >= 0; --i) {
+            const int64_t idx = rem % outer_dims[i];
+            src_ofs += idx * outer_src_stride[i];
+            dst_ofs += idx * outer_dst_stride[i];
+            rem /= outer_dims[i];
+        }
+        const int64_t a = ta * tile_len;
+        const int64_t b = tb * tile_len;
+        transpose_tile<eT, block_kernel_t>(
+            src + src_ofs + a * src_stride_a + b,
+            src_stride_a, dst_stride_b,
+            min(tile_len, len_a - a), min(tile_len, len_b - b),
+            dst + dst_ofs + b * dst_stride_b + a);
+    }
 
     return ppl::common::RC_SUCCESS;
 }
 
+template <typename eT>
+ppl::common::RetCode transpose_ndarray(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const int32_t *perm,
+    const eT *src,
+    eT *dst)
+{
+    return transpose_ndarray_engine<eT, transpose_block_kernel_ref<eT>>(src_shape, perm, src, dst);
+}
+
 template <typename eT>
 ppl::common::RetCode transpose_ndarray_continous2d(
     const ppl::common::TensorShape *src_shape,
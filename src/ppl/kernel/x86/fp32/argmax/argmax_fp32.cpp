@@ -16,6 +16,7 @@
 // under the License.
 
 #include "ppl/kernel/x86/common/argmax/argmax_common.h"
+#include "ppl/kernel/x86/fp32/argmax.h"
 
 namespace ppl { namespace kernel { namespace x86 {
 
@@ -28,4 +29,42 @@ ppl::common::RetCode argmax_ndarray_fp32(
     return argmax_ndarray<float>(src_shape, src, axis, dst);
 }
 
+ppl::common::RetCode argmax_ndarray_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src_shape,
+    const float *src,
+    const int64_t axis,
+    const int64_t select_last_index,
+    int64_t *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return argmax_ndarray_fp32_avx512(src_shape, src, axis, select_last_index, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_FMA) {
+        return argmax_ndarray_fp32_fma(src_shape, src, axis, select_last_index, dst);
+    }
+    return argmax_ndarray_fp32_sse(src_shape, src, axis, select_last_index, dst);
+}
+
+ppl::common::RetCode argmin_ndarray_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src_shape,
+    const float *src,
+    const int64_t axis,
+    const int64_t select_last_index,
+    int64_t *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return argmin_ndarray_fp32_avx512(src_shape, src, axis, select_last_index, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_FMA) {
+        return argmin_ndarray_fp32_fma(src_shape, src, axis, select_last_index, dst);
+    }
+    return argmin_ndarray_fp32_sse(src_shape, src, axis, select_last_index, dst);
+}
+
 }}}; // namespace ppl::kernel::x86
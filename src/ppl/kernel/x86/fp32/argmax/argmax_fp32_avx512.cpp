@@ -0,0 +1,137 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "ppl/kernel/x86/fp32/argmax/argmax_fp32_common.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+struct arg_reduce_kernel_fp32_avx512 {
+    static const int64_t simd_w = 16;
+
+    template <bool is_max, bool last>
+    static inline __mmask16 better(const __m512 v, const __m512 best)
+    {
+        return _mm512_cmp_ps_mask(v, best, is_max ? (last ? _CMP_GE_OQ : _CMP_GT_OQ) : (last ? _CMP_LE_OQ : _CMP_LT_OQ));
+    }
+
+    template <bool is_max, bool last>
+    static void reduce_row(const float *src, const int64_t len, float *val, int64_t *idx)
+    {
+        const int64_t unroll = 4;
+        const __m512 v_step  = _mm512_set1_ps(simd_w);
+        __m512 v_cur         = _mm512_setr_ps(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+        __m512 v_best[unroll];
+        __m512 v_idx[unroll];
+        for (int64_t u = 0; u < unroll; ++u) {
+            v_best[u] = _mm512_set1_ps(arg_reduce_init_val_fp32<is_max>());
+            v_idx[u]  = _mm512_set1_ps(-1.0f);
+        }
+
+        int64_t i = 0;
+        for (; i + unroll * simd_w <= len; i += unroll * simd_w) {
+            for (int64_t u = 0; u < unroll; ++u) {
+                const __m512 v_src = _mm512_loadu_ps(src + i + u * simd_w);
+                const __mmask16 v_msk = better<is_max, last>(v_src, v_best[u]);
+                v_best[u]          = _mm512_mask_mov_ps(v_best[u], v_msk, v_src);
+                v_idx[u]           = _mm512_mask_mov_ps(v_idx[u], v_msk, v_cur);
+                v_cur              = _mm512_add_ps(v_cur, v_step);
+            }
+        }
+        for (; i + simd_w <= len; i += simd_w) {
+            const __m512 v_src = _mm512_loadu_ps(src + i);
+            const __mmask16 v_msk = better<is_max, last>(v_src, v_best[0]);
+            v_best[0]          = _mm512_mask_mov_ps(v_best[0], v_msk, v_src);
+            v_idx[0]           = _mm512_mask_mov_ps(v_idx[0], v_msk, v_cur);
+            v_cur              = _mm512_add_ps(v_cur, v_step);
+        }
+
+        float lane_val[unroll * simd_w];
+        float lane_idx[unroll * simd_w];
+        for (int64_t u = 0; u < unroll; ++u) {
+            _mm512_storeu_ps(lane_val + u * simd_w, v_best[u]);
+            _mm512_storeu_ps(lane_idx + u * simd_w, v_idx[u]);
+        }
+        *val = arg_reduce_init_val_fp32<is_max>();
+        *idx = -1;
+        arg_reduce_merge_lanes_fp32<is_max, last>(lane_val, lane_idx, unroll * simd_w, val, idx);
+        for (; i < len; ++i) {
+            if (arg_reduce_better_fp32<is_max, last>(src[i], *val)) {
+                *val = src[i];
+                *idx = i;
+            }
+        }
+    }
+
+    template <bool is_max, bool last, int64_t unroll>
+    static void reduce_cols(const float *src, const int64_t len, const int64_t stride, int64_t *dst)
+    {
+        const __m512 v_one = _mm512_set1_ps(1.0f);
+        __m512 v_cur       = _mm512_setzero_ps();
+        __m512 v_best[unroll];
+        __m512 v_idx[unroll];
+        for (int64_t u = 0; u < unroll; ++u) {
+            v_best[u] = _mm512_set1_ps(arg_reduce_init_val_fp32<is_max>());
+            v_idx[u]  = _mm512_setzero_ps();
+        }
+        for (int64_t k = 0; k < len; ++k) {
+            for (int64_t u = 0; u < unroll; ++u) {
+                const __m512 v_src = _mm512_loadu_ps(src + k * stride + u * simd_w);
+                const __mmask16 v_msk = better<is_max, last>(v_src, v_best[u]);
+                v_best[u]          = _mm512_mask_mov_ps(v_best[u], v_msk, v_src);
+                v_idx[u]           = _mm512_mask_mov_ps(v_idx[u], v_msk, v_cur);
+            }
+            v_cur = _mm512_add_ps(v_cur, v_one);
+        }
+        for (int64_t u = 0; u < unroll; ++u) {
+            float lane_idx[simd_w];
+            _mm512_storeu_ps(lane_idx, v_idx[u]);
+            for (int64_t l = 0; l < simd_w; ++l) {
+                dst[u * simd_w + l] = static_cast<int64_t>(lane_idx[l]);
+            }
+        }
+    }
+};
+
+ppl::common::RetCode argmax_ndarray_fp32_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const float *src,
+    const int64_t axis,
+    const int64_t select_last_index,
+    int64_t *dst)
+{
+    if (select_last_index) {
+        return arg_reduce_ndarray_fp32_common<arg_reduce_kernel_fp32_avx512, true, true>(src_shape, src, axis, dst);
+    }
+    return arg_reduce_ndarray_fp32_common<arg_reduce_kernel_fp32_avx512, true, false>(src_shape, src, axis, dst);
+}
+
+ppl::common::RetCode argmin_ndarray_fp32_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const float *src,
+    const int64_t axis,
+    const int64_t select_last_index,
+    int64_t *dst)
+{
+    if (select_last_index) {
+        return arg_reduce_ndarray_fp32_common<arg_reduce_kernel_fp32_avx512, false, true>(src_shape, src, axis, dst);
+    }
+    return arg_reduce_ndarray_fp32_common<arg_reduce_kernel_fp32_avx512, false, false>(src_shape, src, axis, dst);
+}
+
+}}}; // namespace ppl::kernel::x86
@@ -0,0 +1,200 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_FP32_ARGMAX_ARGMAX_FP32_COMMON_H_
+#define __ST_PPL_KERNEL_X86_FP32_ARGMAX_ARGMAX_FP32_COMMON_H_
+
+#include <float.h>
+#include <vector>
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/common/argmax/argmax_common.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+// simd kernels keep a best value and a best index per lane. indices are held
+// as float lanes, which are exact below 2^24, so every lane only sees rows
+// shorter than that. an index < 0 means nothing has qualified yet.
+
+template <bool is_max>
+inline float arg_reduce_init_val_fp32()
+{
+    return is_max ? -FLT_MAX : FLT_MAX;
+}
+
+template <bool is_max, bool last>
+inline bool arg_reduce_better_fp32(const float v, const float best)
+{
+    return is_max ? (last ? v >= best : v > best) : (last ? v <= best : v < best);
+}
+
+// fold lane results into (val, idx): better value wins, equal values take
+// the lower index, or the higher one with select_last_index
+template <bool is_max, bool last>
+inline void arg_reduce_merge_lanes_fp32(
+    const float *lane_val,
+    const float *lane_idx,
+    const int64_t num_lanes,
+    float *val,
+    int64_t *idx)
+{
+    for (int64_t l = 0; l < num_lanes; ++l) {
+        if (lane_idx[l] < 0.0f) {
+            continue;
+        }
+        const int64_t li = static_cast<int64_t>(lane_idx[l]);
+        const bool strict_better = is_max ? lane_val[l] > *val : lane_val[l] < *val;
+        if (*idx < 0 || strict_better || (lane_val[l] == *val && (last ? li > *idx : li < *idx))) {
+            *val = lane_val[l];
+            *idx = li;
+        }
+    }
+}
+
+template <bool is_max, bool last>
+inline int64_t arg_reduce_col_fp32(
+    const float *src,
+    const int64_t len,
+    const int64_t stride)
+{
+    float best  = arg_reduce_init_val_fp32<is_max>();
+    int64_t idx = 0;
+    for (int64_t k = 0; k < len; ++k) {
+        if (arg_reduce_better_fp32<is_max, last>(src[k * stride], best)) {
+            best = src[k * stride];
+            idx  = k;
+        }
+    }
+    return idx;
+}
+
+// kernel_t provides:
+//   simd_w
+//   reduce_row<is_max, last>(src, len, val, idx)        contiguous row, len < 2^24
+//   reduce_cols<is_max, last, unroll>(src, len, stride, dst)
+//                                                       unroll * simd_w columns, len < 2^24
+template <typename kernel_t, bool is_max, bool last>
+ppl::common::RetCode arg_reduce_ndarray_fp32_common(
+    const ppl::common::TensorShape *src_shape,
+    const float *src,
+    const int64_t axis,
+    int64_t *dst)
+{
+    const int64_t max_lane_len = 1 << 24;
+    const int64_t real_axis    = axis < 0 ? axis + src_shape->GetDimCount() : axis;
+    if (real_axis < 0 || real_axis >= src_shape->GetDimCount()) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    const int64_t axis_dim = src_shape->GetDim(real_axis);
+    int64_t outer_dim      = 1;
+    int64_t inner_dim      = 1;
+    for (int64_t i = 0; i < real_axis; i++) {
+        outer_dim *= src_shape->GetDim(i);
+    }
+    for (int64_t i = real_axis + 1; i < src_shape->GetDimCount(); i++) {
+        inner_dim *= src_shape->GetDim(i);
+    }
+    if (outer_dim * inner_dim == 0) {
+        return ppl::common::RC_SUCCESS;
+    }
+
+    if (inner_dim > 1) {
+        if (axis_dim >= max_lane_len) {
+            return arg_reduce_ndarray<float, is_max>(src_shape, src, axis, last, dst);
+        }
+        const int64_t simd_w  = kernel_t::simd_w;
+        const int64_t unroll  = 4;
+        const int64_t col_blk = unroll * simd_w;
+        const int64_t num_blk = div_up(inner_dim, col_blk);
+        PRAGMA_OMP_PARALLEL_FOR()
+        for (int64_t t = 0; t < outer_dim * num_blk; ++t) {
+            const int64_t i       = t / num_blk;
+            const int64_t j       = (t % num_blk) * col_blk;
+            const int64_t j_eff   = min(col_blk, inner_dim - j);
+            const float *base_src = src + i * axis_dim * inner_dim + j;
+            int64_t *base_dst     = dst + i * inner_dim + j;
+            if (j_eff == col_blk) {
+                kernel_t::template reduce_cols<is_max, last, unroll>(base_src, axis_dim, inner_dim, base_dst);
+                continue;
+            }
+            int64_t jj = 0;
+            for (; jj + simd_w <= j_eff; jj += simd_w) {
+                kernel_t::template reduce_cols<is_max, last, 1>(base_src + jj, axis_dim, inner_dim, base_dst + jj);
+            }
+            for (; jj < j_eff; ++jj) {
+                base_dst[jj] = arg_reduce_col_fp32<is_max, last>(base_src + jj, axis_dim, inner_dim);
+            }
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    // inner axis. wide rows with fewer rows than threads are cut into parts,
+    // part results are merged in part order so tie semantics hold
+    const int64_t min_part_len = 16384;
+    const int64_t num_threads  = PPL_OMP_MAX_THREADS();
+    int64_t num_parts          = 1;
+    if (outer_dim < num_threads) {
+        num_parts = min(div_up(num_threads, outer_dim), axis_dim / min_part_len);
+    }
+    num_parts = max<int64_t>(num_parts, div_up(axis_dim, max_lane_len));
+
+    if (num_parts <= 1) {
+        PRAGMA_OMP_PARALLEL_FOR()
+        for (int64_t i = 0; i < outer_dim; ++i) {
+            float val;
+            int64_t idx;
+            kernel_t::template reduce_row<is_max, last>(src + i * axis_dim, axis_dim, &val, &idx);
+            dst[i] = idx < 0 ? 0 : idx;
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    const int64_t part_len = div_up(axis_dim, num_parts);
+    std::vector<float> part_val(outer_dim * num_parts);
+    std::vector<int64_t> part_idx(outer_dim * num_parts);
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t t = 0; t < outer_dim * num_parts; ++t) {
+        const int64_t i     = t / num_parts;
+        const int64_t begin = (t % num_parts) * part_len;
+        const int64_t len   = max<int64_t>(min(part_len, axis_dim - begin), 0);
+        int64_t idx;
+        kernel_t::template reduce_row<is_max, last>(src + i * axis_dim + begin, len, &part_val[t], &idx);
+        part_idx[t] = idx < 0 ? -1 : begin + idx;
+    }
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t i = 0; i < outer_dim; ++i) {
+        float best  = arg_reduce_init_val_fp32<is_max>();
+        int64_t idx = -1;
+        for (int64_t p = 0; p < num_parts; ++p) {
+            const int64_t t = i * num_parts + p;
+            if (part_idx[t] >= 0 && (idx < 0 || arg_reduce_better_fp32<is_max, last>(part_val[t], best))) {
+                best = part_val[t];
+                idx  = part_idx[t];
+            }
+        }
+        dst[i] = idx < 0 ? 0 : idx;
+    }
+
+    return ppl::common::RC_SUCCESS;
+}
+
+}}}; // namespace ppl::kernel::x86
+
+#endif // !__ST_PPL_KERNEL_X86_FP32_ARGMAX_ARGMAX_FP32_COMMON_H_
@@ -0,0 +1,321 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/common/kernel_registry.h"
+#include "ppl/kernel/x86/fp32/arithmetic.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+ppl::common::RetCode add_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    float *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return add_fp32_avx512(src0_shape, src1_shape, dst_shape, src0, src1, fuse_relu, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) {
+        return add_fp32_avx(src0_shape, src1_shape, dst_shape, src0, src1, fuse_relu, dst);
+    }
+    return add_fp32_sse(src0_shape, src1_shape, dst_shape, src0, src1, fuse_relu, dst);
+}
+
+ppl::common::RetCode sub_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    float *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return sub_fp32_avx512(src0_shape, src1_shape, dst_shape, src0, src1, fuse_relu, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) {
+        return sub_fp32_avx(src0_shape, src1_shape, dst_shape, src0, src1, fuse_relu, dst);
+    }
+    return sub_fp32_sse(src0_shape, src1_shape, dst_shape, src0, src1, fuse_relu, dst);
+}
+
+ppl::common::RetCode mul_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    float *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return mul_fp32_avx512(src0_shape, src1_shape, dst_shape, src0, src1, fuse_relu, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) {
+        return mul_fp32_avx(src0_shape, src1_shape, dst_shape, src0, src1, fuse_relu, dst);
+    }
+    return mul_fp32_sse(src0_shape, src1_shape, dst_shape, src0, src1, fuse_relu, dst);
+}
+
+ppl::common::RetCode div_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    float *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return div_fp32_avx512(src0_shape, src1_shape, dst_shape, src0, src1, fuse_relu, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) {
+        return div_fp32_avx(src0_shape, src1_shape, dst_shape, src0, src1, fuse_relu, dst);
+    }
+    return div_fp32_sse(src0_shape, src1_shape, dst_shape, src0, src1, fuse_relu, dst);
+}
+
+typedef ppl::common::RetCode (*arithmetic_fp32_isa_func_t)(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    float *dst);
+
+// a source broadcast on the batch keeps its pointer for every image
+static void arithmetic_n16cx_batch_src(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    ppl::common::TensorShape *batch_shape,
+    int64_t *batch_stride)
+{
+    *batch_shape  = *src_shape;
+    *batch_stride = 0;
+    const int64_t batch = dst_shape->GetDim(0);
+    if (src_shape->GetDimCount() == dst_shape->GetDimCount() && src_shape->GetDim(0) == batch) {
+        *batch_stride = src_shape->CalcElementsIncludingPadding() / batch;
+        batch_shape->SetDim(0, 1);
+        batch_shape->CalcPadding();
+    }
+}
+
+static ppl::common::RetCode arithmetic_n16cx_fp32_dst_view(
+    const arithmetic_fp32_isa_func_t func,
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    const int64_t dst_total_channels,
+    float *dst)
+{
+    if (dst_shape->GetDataFormat() != ppl::common::DATAFORMAT_N16CX || dst_shape->GetDimCount() < 2) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+    const int64_t batch    = dst_shape->GetDim(0);
+    const int64_t channels = dst_shape->GetDim(1);
+    if (dst_total_channels < channels) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (batch == 1 || dst_total_channels == channels) {
+        return func(isa, src0_shape, src1_shape, dst_shape, src0, src1, fuse_relu, dst);
+    }
+
+    int64_t inner_dims = 1;
+    for (uint32_t i = 2; i < dst_shape->GetDimCount(); ++i) {
+        inner_dims *= dst_shape->GetDim(i);
+    }
+    const int64_t dst_batch_stride = round_up(dst_total_channels, 16) * inner_dims;
+
+    ppl::common::TensorShape src0_batch_shape, src1_batch_shape;
+    ppl::common::TensorShape dst_batch_shape(*dst_shape);
+    int64_t src0_batch_stride, src1_batch_stride;
+    arithmetic_n16cx_batch_src(src0_shape, dst_shape, &src0_batch_shape, &src0_batch_stride);
+    arithmetic_n16cx_batch_src(src1_shape, dst_shape, &src1_batch_shape, &src1_batch_stride);
+    dst_batch_shape.SetDim(0, 1);
+    dst_batch_shape.CalcPadding();
+
+    for (int64_t n = 0; n < batch; ++n) {
+        ppl::common::RetCode rc = func(
+            isa, &src0_batch_shape, &src1_batch_shape, &dst_batch_shape,
+            src0 + n * src0_batch_stride, src1 + n * src1_batch_stride,
+            fuse_relu, dst + n * dst_batch_stride);
+        if (rc != ppl::common::RC_SUCCESS) {
+            return rc;
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+ppl::common::RetCode add_n16cx_fp32_dst_view(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    const int64_t dst_total_channels,
+    float *dst)
+{
+    return arithmetic_n16cx_fp32_dst_view(
+        add_fp32, isa, src0_shape, src1_shape, dst_shape,
+        src0, src1, fuse_relu, dst_total_channels, dst);
+}
+
+ppl::common::RetCode sub_n16cx_fp32_dst_view(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    const int64_t dst_total_channels,
+    float *dst)
+{
+    return arithmetic_n16cx_fp32_dst_view(
+        sub_fp32, isa, src0_shape, src1_shape, dst_shape,
+        src0, src1, fuse_relu, dst_total_channels, dst);
+}
+
+ppl::common::RetCode mul_n16cx_fp32_dst_view(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    const int64_t dst_total_channels,
+    float *dst)
+{
+    return arithmetic_n16cx_fp32_dst_view(
+        mul_fp32, isa, src0_shape, src1_shape, dst_shape,
+        src0, src1, fuse_relu, dst_total_channels, dst);
+}
+
+ppl::common::RetCode div_n16cx_fp32_dst_view(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    const int64_t dst_total_channels,
+    float *dst)
+{
+    return arithmetic_n16cx_fp32_dst_view(
+        div_fp32, isa, src0_shape, src1_shape, dst_shape,
+        src0, src1, fuse_relu, dst_total_channels, dst);
+}
+
+ppl::common::RetCode add_fp32(
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    float *dst)
+{
+    PPL_X86_KERNEL_DISPATCH_SITE(site, "add_fp32");
+    const ppl::common::TensorShape *shapes[] = {src0_shape, src1_shape, dst_shape};
+    const kernel_desc_t *kernel = resolve_kernel(&site, shapes, 3);
+    if (!kernel) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+    return reinterpret_cast<decltype(&add_fp32_sse)>(kernel->func)(src0_shape, src1_shape, dst_shape, src0, src1, fuse_relu, dst);
+}
+
+ppl::common::RetCode sub_fp32(
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    float *dst)
+{
+    PPL_X86_KERNEL_DISPATCH_SITE(site, "sub_fp32");
+    const ppl::common::TensorShape *shapes[] = {src0_shape, src1_shape, dst_shape};
+    const kernel_desc_t *kernel = resolve_kernel(&site, shapes, 3);
+    if (!kernel) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+    return reinterpret_cast<decltype(&sub_fp32_sse)>(kernel->func)(src0_shape, src1_shape, dst_shape, src0, src1, fuse_relu, dst);
+}
+
+ppl::common::RetCode mul_fp32(
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    float *dst)
+{
+    PPL_X86_KERNEL_DISPATCH_SITE(site, "mul_fp32");
+    const ppl::common::TensorShape *shapes[] = {src0_shape, src1_shape, dst_shape};
+    const kernel_desc_t *kernel = resolve_kernel(&site, shapes, 3);
+    if (!kernel) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+    return reinterpret_cast<decltype(&mul_fp32_sse)>(kernel->func)(src0_shape, src1_shape, dst_shape, src0, src1, fuse_relu, dst);
+}
+
+ppl::common::RetCode div_fp32(
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    float *dst)
+{
+    PPL_X86_KERNEL_DISPATCH_SITE(site, "div_fp32");
+    const ppl::common::TensorShape *shapes[] = {src0_shape, src1_shape, dst_shape};
+    const kernel_desc_t *kernel = resolve_kernel(&site, shapes, 3);
+    if (!kernel) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+    return reinterpret_cast<decltype(&div_fp32_sse)>(kernel->func)(src0_shape, src1_shape, dst_shape, src0, src1, fuse_relu, dst);
+}
+
+}}}; // namespace ppl::kernel::x86
@@ -0,0 +1,118 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_FP32_ARITHMETIC_AVX512_ARITHMETIC_KERNEL_FP32_AVX512_H_
+#define __ST_PPL_KERNEL_X86_FP32_ARITHMETIC_AVX512_ARITHMETIC_KERNEL_FP32_AVX512_H_
+
+#include <immintrin.h>
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/common/arithmetic/arithmetic_common.h"
+#include "ppl/kernel/x86/common/threading_tools.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+template <arithmetic_op_type_t _op>
+inline __m512 arithmetic_vector_kernel_fp32_avx512(__m512 a, __m512 b);
+
+template <>
+inline __m512 arithmetic_vector_kernel_fp32_avx512<ARITHMETIC_ADD>(__m512 a, __m512 b)
+{
+    return _mm512_add_ps(a, b);
+}
+template <>
+inline __m512 arithmetic_vector_kernel_fp32_avx512<ARITHMETIC_SUB>(__m512 a, __m512 b)
+{
+    return _mm512_sub_ps(a, b);
+}
+template <>
+inline __m512 arithmetic_vector_kernel_fp32_avx512<ARITHMETIC_MUL>(__m512 a, __m512 b)
+{
+    return _mm512_mul_ps(a, b);
+}
+template <>
+inline __m512 arithmetic_vector_kernel_fp32_avx512<ARITHMETIC_DIV>(__m512 a, __m512 b)
+{
+    return _mm512_div_ps(a, b);
+}
+
+inline __mmask16 arithmetic_tail_mask_fp32_avx512(const int64_t len)
+{
+    return len >= 16 ? (__mmask16)0xffff : (__mmask16)((1 << len) - 1);
+}
+
+struct parallel_block {
+    int64_t id;
+    int64_t start[PPL_X86_TENSOR_MAX_DIMS()];
+    int64_t end[PPL_X86_TENSOR_MAX_DIMS()];
+    int64_t idx[PPL_X86_TENSOR_MAX_DIMS()];
+};
+
+inline void pad_shape(
+    const ppl::common::TensorShape *shape,
+    const int64_t padded_dim_count,
+    int64_t *padded_shape)
+{
+    const int64_t dim_diff = padded_dim_count - shape->GetRealDimCount();
+    for (int64_t i = 0; i < dim_diff; i++) {
+        padded_shape[i] = 1;
+    }
+    for (int64_t i = dim_diff; i < padded_dim_count; i++) {
+        padded_shape[i] = shape->GetDim(i - dim_diff);
+    }
+}
+
+inline void idx2dims(
+    const int64_t idx,
+    const int64_t *shape,
+    const int64_t dim_count,
+    int64_t *dims)
+{
+    int64_t _idx = idx;
+    for (int64_t i = dim_count - 1; i >= 0; i--) {
+        dims[i] = _idx % shape[i];
+        _idx /= shape[i];
+    }
+}
+
+inline bool is_first_dim(parallel_block *block, const int64_t dim_idx)
+{
+    bool is_first = true;
+    for (int64_t i = 0; i < dim_idx; i++) {
+        if (block->idx[i] != block->start[i]) {
+            is_first = false;
+            break;
+        }
+    }
+    return is_first;
+}
+
+inline bool is_last_dim(parallel_block *block, const int64_t dim_idx)
+{
+    bool is_last = true;
+    for (int64_t i = 0; i < dim_idx; i++) {
+        if (block->idx[i] != block->end[i]) {
+            is_last = false;
+            break;
+        }
+    }
+    return is_last;
+}
+
+}}}; // namespace ppl::kernel::x86
+
+#endif // __ST_PPL_KERNEL_X86_FP32_ARITHMETIC_AVX512_ARITHMETIC_KERNEL_FP32_AVX512_H_
@@ -0,0 +1,118 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/fp32/arithmetic_max6d.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+ppl::common::RetCode add_ndarray_max6d_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *lhs_shape,
+    const ppl::common::TensorShape *rhs_shape,
+    const float *lhs,
+    const float *rhs,
+    float *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return add_ndarray_max6d_fp32_avx512(lhs_shape, rhs_shape, lhs, rhs, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) {
+        return add_ndarray_max6d_fp32_avx(lhs_shape, rhs_shape, lhs, rhs, dst);
+    }
+    return add_ndarray_max6d_fp32_sse(lhs_shape, rhs_shape, lhs, rhs, dst);
+}
+
+ppl::common::RetCode sub_ndarray_max6d_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *lhs_shape,
+    const ppl::common::TensorShape *rhs_shape,
+    const float *lhs,
+    const float *rhs,
+    float *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return sub_ndarray_max6d_fp32_avx512(lhs_shape, rhs_shape, lhs, rhs, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) {
+        return sub_ndarray_max6d_fp32_avx(lhs_shape, rhs_shape, lhs, rhs, dst);
+    }
+    return sub_ndarray_max6d_fp32_sse(lhs_shape, rhs_shape, lhs, rhs, dst);
+}
+
+ppl::common::RetCode mul_ndarray_max6d_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *lhs_shape,
+    const ppl::common::TensorShape *rhs_shape,
+    const float *lhs,
+    const float *rhs,
+    float *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return mul_ndarray_max6d_fp32_avx512(lhs_shape, rhs_shape, lhs, rhs, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) {
+        return mul_ndarray_max6d_fp32_avx(lhs_shape, rhs_shape, lhs, rhs, dst);
+    }
+    return mul_ndarray_max6d_fp32_sse(lhs_shape, rhs_shape, lhs, rhs, dst);
+}
+
+ppl::common::RetCode div_ndarray_max6d_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *lhs_shape,
+    const ppl::common::TensorShape *rhs_shape,
+    const float *lhs,
+    const float *rhs,
+    float *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return div_ndarray_max6d_fp32_avx512(lhs_shape, rhs_shape, lhs, rhs, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) {
+        return div_ndarray_max6d_fp32_avx(lhs_shape, rhs_shape, lhs, rhs, dst);
+    }
+    return div_ndarray_max6d_fp32_sse(lhs_shape, rhs_shape, lhs, rhs, dst);
+}
+
+ppl::common::RetCode pow_ndarray_max6d_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *lhs_shape,
+    const ppl::common::TensorShape *rhs_shape,
+    const float *lhs,
+    const float *rhs,
+    float *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return pow_ndarray_max6d_fp32_avx512(lhs_shape, rhs_shape, lhs, rhs, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) {
+        return pow_ndarray_max6d_fp32_avx(lhs_shape, rhs_shape, lhs, rhs, dst);
+    }
+    return pow_ndarray_max6d_fp32_sse(lhs_shape, rhs_shape, lhs, rhs, dst);
+}
+
+}}}; // namespace ppl::kernel::x86
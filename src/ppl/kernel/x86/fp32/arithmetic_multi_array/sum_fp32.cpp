@@ -0,0 +1,61 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/fp32/sum.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+ppl::common::RetCode sum_eltwise_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *dst_shape,
+    const float **src_list,
+    const uint32_t num_src,
+    float *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return sum_eltwise_fp32_avx512(dst_shape, src_list, num_src, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) {
+        return sum_eltwise_fp32_avx(dst_shape, src_list, num_src, dst);
+    }
+    return sum_eltwise_fp32_sse(dst_shape, src_list, num_src, dst);
+}
+
+ppl::common::RetCode sum_ndarray_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape **src_shape_list,
+    const ppl::common::TensorShape *dst_shape,
+    const float **src_list,
+    const uint32_t num_src,
+    void *temp_buffer,
+    float *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return sum_ndarray_fp32_avx512(src_shape_list, dst_shape, src_list, num_src, temp_buffer, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) {
+        return sum_ndarray_fp32_avx(src_shape_list, dst_shape, src_list, num_src, temp_buffer, dst);
+    }
+    return sum_ndarray_fp32_sse(src_shape_list, dst_shape, src_list, num_src, temp_buffer, dst);
+}
+
+}}}; // namespace ppl::kernel::x86
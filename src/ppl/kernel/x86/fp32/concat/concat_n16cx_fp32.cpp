@@ -16,6 +16,7 @@
 // under the License.
 
 #include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/fp32/concat.h"
 #include "ppl/kernel/x86/common/concat/concat_common.h"
 
 namespace ppl { namespace kernel { namespace x86 {
@@ -30,4 +31,24 @@ ppl::common::RetCode concat_n16cx_fp32(
     return concat_n16cx<float>(src_shape_list, src_list, num_src, axis, dst);
 }
 
+ppl::common::RetCode concat_n16cx_interleave_channels_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape **src_shape_list,
+    const float **src_list,
+    const int32_t num_src,
+    const int32_t axis,
+    const int32_t c_dim_idx,
+    float *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return concat_n16cx_interleave_channels_fp32_avx512(src_shape_list, src_list, num_src, axis, c_dim_idx, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) {
+        return concat_n16cx_interleave_channels_fp32_avx(src_shape_list, src_list, num_src, axis, c_dim_idx, dst);
+    }
+    return concat_n16cx_interleave_channels<float>(src_shape_list, src_list, num_src, axis, c_dim_idx, dst);
+}
+
 }}}; // namespace ppl::kernel::x86
@@ -164,11 +164,11 @@ ppl::common::RetCode conv2d_n16cx_gemm_direct_fp32_avx512_executor::execute()
     const int64_t src_w     = src_shape_->GetDim(3);
     const int64_t dst_space = dst_shape_->GetDim(2) * dst_shape_->GetDim(3);
 
-    const int64_t src_b_stride   = round_up(src_shape_->GetDim(1), IC_DATA_BLK) * src_h * src_w;
+    const int64_t src_b_stride   = round_up(src_total_channels(), IC_DATA_BLK) * src_h * src_w;
     const int64_t src_g_stride   = sp.padded_ic * src_h * src_w;
     const int64_t src_icb_stride = src_h * src_w * IC_DATA_BLK;
     const int64_t src_h_stride   = src_w * IC_DATA_BLK;
-    const int64_t dst_b_stride   = round_up(dst_shape_->GetDim(1), OC_DATA_BLK) * dst_space;
+    const int64_t dst_b_stride   = round_up(dst_total_channels(), OC_DATA_BLK) * dst_space;
     const int64_t dst_g_stride   = sp.padded_oc * dst_space;
     const int64_t dst_ocb_stride = dst_space * OC_DATA_BLK;
     const int64_t flt_g_stride   = sp.ic_l2_cnt * sp.padded_oc * sp.ic_l2_blk;
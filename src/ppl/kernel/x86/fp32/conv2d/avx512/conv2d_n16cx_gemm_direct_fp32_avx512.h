@@ -26,6 +26,8 @@ namespace ppl { namespace kernel { namespace x86 {
 // forward declare;
 class conv2d_n16cx_gemm_direct_fp32_avx512_manager;
 class pd_conv2d_n16cx_gemm_direct_fp32_avx512_executor;
+class pd_conv2d_n16cx_depthwise_gemm_direct_fp32_avx512_executor;
+class ir_conv2d_n16cx_gemm_direct_fp32_avx512_executor;
 
 class conv2d_n16cx_gemm_direct_fp32_avx512_executor final : public conv2d_fp32_executor {
 public:
@@ -64,6 +66,8 @@ private:
 
     friend conv2d_n16cx_gemm_direct_fp32_avx512_manager;
     friend pd_conv2d_n16cx_gemm_direct_fp32_avx512_executor;
+    friend pd_conv2d_n16cx_depthwise_gemm_direct_fp32_avx512_executor;
+    friend ir_conv2d_n16cx_gemm_direct_fp32_avx512_executor;
 };
 
 class conv2d_n16cx_gemm_direct_fp32_avx512_manager final : public conv2d_fp32_manager {
@@ -609,8 +609,8 @@ ppl::common::RetCode conv2d_n16cx_winograd_b4f3_fp32_avx512_executor::execute()
     const int64_t dst_h = dst_shape_->GetDim(2);
     const int64_t dst_w = dst_shape_->GetDim(3);
 
-    const int64_t padded_src_c = round_up(src_shape_->GetDim(1), CH_DT_BLK());
-    const int64_t padded_dst_c = round_up(dst_shape_->GetDim(1), CH_DT_BLK());
+    const int64_t padded_src_c = round_up(src_total_channels(), CH_DT_BLK());
+    const int64_t padded_dst_c = round_up(dst_total_channels(), CH_DT_BLK());
 
     const int64_t src_g_stride     = sp.padded_ic * src_h * src_w;
     const int64_t src_b_stride     = padded_src_c * src_h * src_w;
@@ -144,8 +144,8 @@ ppl::common::RetCode conv2d_n16cx_depthwise_fp32_fma_executor::execute()
     const int64_t dst_w = dst_shape_->GetDim(3);
     const int64_t padded_src_w = (src_w + 2 * cp.pad_w);
 
-    const int64_t padded_src_c = round_up(src_shape_->GetDim(1), CH_DT_BLK());
-    const int64_t padded_dst_c = round_up(dst_shape_->GetDim(1), CH_DT_BLK());
+    const int64_t padded_src_c = round_up(src_total_channels(), CH_DT_BLK());
+    const int64_t padded_dst_c = round_up(dst_total_channels(), CH_DT_BLK());
 
     const int64_t ext_kernel_h = (cp.kernel_h - 1) * cp.dilation_h + 1;
     const int64_t ext_kernel_w = (cp.kernel_w - 1) * cp.dilation_w + 1;
@@ -203,14 +203,14 @@ ppl::common::RetCode conv2d_n16cx_direct_fp32_fma_executor::execute()
     const int64_t ext_kernel_w = (cp.kernel_w - 1) * cp.dilation_w + 1;
     const int64_t padded_reg_oc = round_up(sp.oc_per_gp, CH_RF_BLK());
 
-    const int64_t src_b_stride   = round_up(src_shape_->GetDim(1), CH_DT_BLK()) * src_h * src_w;
+    const int64_t src_b_stride   = round_up(src_total_channels(), CH_DT_BLK()) * src_h * src_w;
     const int64_t src_g_stride   = sp.padded_ic * src_h * src_w;
     const int64_t src_icb_stride = src_h * src_w * CH_DT_BLK();
     const int64_t src_h_stride   = src_w * CH_DT_BLK();
     const int64_t src_sw_stride  = cp.stride_w * CH_DT_BLK();
     const int64_t src_dh_stride  = cp.dilation_h * src_w * CH_DT_BLK();
     const int64_t src_dw_stride  = cp.dilation_w * CH_DT_BLK();
-    const int64_t dst_b_stride   = round_up(dst_shape_->GetDim(1), CH_DT_BLK()) * dst_h * dst_w;
+    const int64_t dst_b_stride   = round_up(dst_total_channels(), CH_DT_BLK()) * dst_h * dst_w;
     const int64_t dst_g_stride   = sp.padded_oc * dst_h * dst_w;
     const int64_t dst_h_stride   = dst_w * CH_DT_BLK();
     const int64_t flt_g_stride   = sp.ic_l2_cnt * sp.padded_oc * cp.kernel_h * cp.kernel_w * sp.ic_l2_blk;
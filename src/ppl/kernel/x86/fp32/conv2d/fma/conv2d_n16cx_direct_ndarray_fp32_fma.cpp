@@ -135,10 +135,10 @@ ppl::common::RetCode conv2d_n16cx_direct_ndarray_fp32_fma_executor::execute_inne
     const int64_t dst_h = dst_shape_->GetDim(2);
     const int64_t dst_w = dst_shape_->GetDim(3);
 
-    const int64_t src_b_stride = src_shape_->GetDim(1) * src_h * src_w;
+    const int64_t src_b_stride = src_total_channels() * src_h * src_w;
     const int64_t src_g_stride = sp.ic_per_grp * src_h * src_w;
     const int64_t src_c_stride = src_h * src_w;
-    const int64_t dst_b_stride = round_up(dst_shape_->GetDim(1), OC_DATA_BLK) * dst_h * dst_w;
+    const int64_t dst_b_stride = round_up(dst_total_channels(), OC_DATA_BLK) * dst_h * dst_w;
     const int64_t dst_g_stride = sp.padded_oc * dst_h * dst_w;
     const int64_t flt_c_stride = cp.kernel_h * cp.kernel_w * OC_DATA_BLK;
     const int64_t padded_reg_oc = round_up(sp.oc_per_grp, OC_REG_ELTS);
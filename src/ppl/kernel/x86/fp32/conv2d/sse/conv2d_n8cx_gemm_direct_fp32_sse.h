@@ -25,6 +25,7 @@ namespace ppl { namespace kernel { namespace x86 {
 
 // forward declare;
 class conv2d_n8cx_gemm_direct_fp32_sse_manager;
+class pd_conv2d_n8cx_depthwise_gemm_direct_fp32_sse_executor;
 
 class conv2d_n8cx_gemm_direct_fp32_sse_executor final : public conv2d_fp32_executor {
 public:
@@ -62,6 +63,7 @@ private:
     static int64_t cal_ic_l2_blk(const conv2d_param &param);
 
     friend conv2d_n8cx_gemm_direct_fp32_sse_manager;
+    friend pd_conv2d_n8cx_depthwise_gemm_direct_fp32_sse_executor;
 };
 
 class conv2d_n8cx_gemm_direct_fp32_sse_manager final : public conv2d_fp32_manager {
@@ -17,6 +17,7 @@
 
 #include "ppl/kernel/x86/common/internal_include.h"
 #include "ppl/kernel/x86/common/cumsum/cumsum_common.h"
+#include "ppl/kernel/x86/fp32/cumsum.h"
 
 namespace ppl { namespace kernel { namespace x86 {
 
@@ -31,4 +32,27 @@ ppl::common::RetCode cumsum_ndarray_fp32(
     return cumsum_ndarray<float>(x_shape, x, axis, exclusive, reverse, y);
 }
 
+ppl::common::RetCode cumsum_ndarray_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *x_shape,
+    const float *x,
+    const int64_t axis,
+    const int64_t exclusive,
+    const int64_t reverse,
+    float *y)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return cumsum_ndarray_fp32_avx512(x_shape, x, axis, exclusive, reverse, y);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_FMA) {
+        return cumsum_ndarray_fp32_fma(x_shape, x, axis, exclusive, reverse, y);
+    }
+    if (isa & ppl::common::ISA_X86_SSE) {
+        return cumsum_ndarray_fp32_sse(x_shape, x, axis, exclusive, reverse, y);
+    }
+    return cumsum_ndarray<float>(x_shape, x, axis, exclusive, reverse, y);
+}
+
 }}}; // namespace ppl::kernel::x86
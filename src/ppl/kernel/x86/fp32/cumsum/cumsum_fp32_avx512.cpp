@@ -0,0 +1,151 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/common/cumsum/cumsum_common.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+struct cumsum_kernel_fp32_avx512 {
+    static float sum(const float *x, const int64_t len)
+    {
+        __m512 v_sum0 = _mm512_setzero_ps();
+        __m512 v_sum1 = _mm512_setzero_ps();
+        int64_t i     = 0;
+        for (; i <= len - 32; i += 32) {
+            v_sum0 = _mm512_add_ps(v_sum0, _mm512_loadu_ps(x + i + 0));
+            v_sum1 = _mm512_add_ps(v_sum1, _mm512_loadu_ps(x + i + 16));
+        }
+        float s = _mm512_reduce_add_ps(_mm512_add_ps(v_sum0, v_sum1));
+        for (; i < len; ++i) {
+            s += x[i];
+        }
+        return s;
+    }
+
+    // log2(16) steps of shifted adds, the shifts are lane permutes with
+    // the lanes shifted in from outside the register zeroed
+    static inline __m512 scan_fwd(__m512 v)
+    {
+        v = _mm512_add_ps(v, _mm512_maskz_permutexvar_ps(0xfffe, _mm512_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14), v));
+        v = _mm512_add_ps(v, _mm512_maskz_permutexvar_ps(0xfffc, _mm512_setr_epi32(0, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13), v));
+        v = _mm512_add_ps(v, _mm512_maskz_permutexvar_ps(0xfff0, _mm512_setr_epi32(0, 0, 0, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11), v));
+        v = _mm512_add_ps(v, _mm512_maskz_permutexvar_ps(0xff00, _mm512_setr_epi32(0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 5, 6, 7), v));
+        return v;
+    }
+
+    static inline __m512 scan_bwd(__m512 v)
+    {
+        v = _mm512_add_ps(v, _mm512_maskz_permutexvar_ps(0x7fff, _mm512_setr_epi32(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 15), v));
+        v = _mm512_add_ps(v, _mm512_maskz_permutexvar_ps(0x3fff, _mm512_setr_epi32(2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 15, 15), v));
+        v = _mm512_add_ps(v, _mm512_maskz_permutexvar_ps(0x0fff, _mm512_setr_epi32(4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 15, 15, 15, 15), v));
+        v = _mm512_add_ps(v, _mm512_maskz_permutexvar_ps(0x00ff, _mm512_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15), v));
+        return v;
+    }
+
+    // total of a scanned register broadcast to all lanes
+    static inline __m512 total_fwd(const __m512 v)
+    {
+        return _mm512_permutexvar_ps(_mm512_set1_epi32(15), v);
+    }
+
+    static inline __m512 total_bwd(const __m512 v)
+    {
+        return _mm512_broadcastss_ps(_mm512_castps512_ps128(v));
+    }
+
+    // exclusive prefix sums from inclusive ones, lane 0 (fwd) or 15 (bwd) is zero
+    static inline __m512 shift_fwd(const __m512 v)
+    {
+        return _mm512_maskz_permutexvar_ps(0xfffe, _mm512_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14), v);
+    }
+
+    static inline __m512 shift_bwd(const __m512 v)
+    {
+        return _mm512_maskz_permutexvar_ps(0x7fff, _mm512_setr_epi32(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 15), v);
+    }
+
+    // same scheme as the sse kernel, one carry add per 32 elements
+    template <int64_t exclusive, int64_t reverse>
+    static float scan(const float *x, const int64_t len, float carry, float *y)
+    {
+        __m512 v_carry = _mm512_set1_ps(carry);
+        if (reverse) {
+            int64_t i = len - 32;
+            for (; i >= 0; i -= 32) {
+                const __m512 v_s_hi = scan_bwd(_mm512_loadu_ps(x + i + 16));
+                const __m512 v_s_lo = scan_bwd(_mm512_loadu_ps(x + i + 0));
+                const __m512 v_t_hi = total_bwd(v_s_hi);
+                const __m512 v_t_lo = total_bwd(v_s_lo);
+                const __m512 v_c_lo = _mm512_add_ps(v_carry, v_t_hi);
+                if (exclusive) {
+                    _mm512_storeu_ps(y + i + 16, _mm512_add_ps(shift_bwd(v_s_hi), v_carry));
+                    _mm512_storeu_ps(y + i + 0, _mm512_add_ps(shift_bwd(v_s_lo), v_c_lo));
+                } else {
+                    _mm512_storeu_ps(y + i + 16, _mm512_add_ps(v_s_hi, v_carry));
+                    _mm512_storeu_ps(y + i + 0, _mm512_add_ps(v_s_lo, v_c_lo));
+                }
+                v_carry = _mm512_add_ps(v_carry, _mm512_add_ps(v_t_hi, v_t_lo));
+            }
+            carry = _mm512_cvtss_f32(v_carry);
+            for (i += 31; i >= 0; --i) {
+                if (exclusive) y[i] = carry;
+                carry += x[i];
+                if (!exclusive) y[i] = carry;
+            }
+        } else {
+            int64_t i = 0;
+            for (; i <= len - 32; i += 32) {
+                const __m512 v_s_lo = scan_fwd(_mm512_loadu_ps(x + i + 0));
+                const __m512 v_s_hi = scan_fwd(_mm512_loadu_ps(x + i + 16));
+                const __m512 v_t_lo = total_fwd(v_s_lo);
+                const __m512 v_t_hi = total_fwd(v_s_hi);
+                const __m512 v_c_hi = _mm512_add_ps(v_carry, v_t_lo);
+                if (exclusive) {
+                    _mm512_storeu_ps(y + i + 0, _mm512_add_ps(shift_fwd(v_s_lo), v_carry));
+                    _mm512_storeu_ps(y + i + 16, _mm512_add_ps(shift_fwd(v_s_hi), v_c_hi));
+                } else {
+                    _mm512_storeu_ps(y + i + 0, _mm512_add_ps(v_s_lo, v_carry));
+                    _mm512_storeu_ps(y + i + 16, _mm512_add_ps(v_s_hi, v_c_hi));
+                }
+                v_carry = _mm512_add_ps(v_carry, _mm512_add_ps(v_t_lo, v_t_hi));
+            }
+            carry = _mm512_cvtss_f32(v_carry);
+            for (; i < len; ++i) {
+                if (exclusive) y[i] = carry;
+                carry += x[i];
+                if (!exclusive) y[i] = carry;
+            }
+        }
+        return carry;
+    }
+};
+
+ppl::common::RetCode cumsum_ndarray_fp32_avx512(
+    const ppl::common::TensorShape *x_shape,
+    const float *x,
+    const int64_t axis,
+    const int64_t exclusive,
+    const int64_t reverse,
+    float *y)
+{
+    return cumsum_ndarray_common<float, cumsum_kernel_fp32_avx512>(x_shape, x, axis, exclusive, reverse, y);
+}
+
+}}}; // namespace ppl::kernel::x86
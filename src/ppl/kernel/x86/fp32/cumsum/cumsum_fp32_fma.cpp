@@ -0,0 +1,157 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/common/cumsum/cumsum_common.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+struct cumsum_kernel_fp32_fma {
+    static float sum(const float *x, const int64_t len)
+    {
+        __m256 v_sum0 = _mm256_setzero_ps();
+        __m256 v_sum1 = _mm256_setzero_ps();
+        int64_t i     = 0;
+        for (; i <= len - 16; i += 16) {
+            v_sum0 = _mm256_add_ps(v_sum0, _mm256_loadu_ps(x + i + 0));
+            v_sum1 = _mm256_add_ps(v_sum1, _mm256_loadu_ps(x + i + 8));
+        }
+        v_sum0 = _mm256_add_ps(v_sum0, v_sum1);
+        __m128 v_sum = _mm_add_ps(_mm256_castps256_ps128(v_sum0), _mm256_extractf128_ps(v_sum0, 1));
+        v_sum = _mm_add_ps(v_sum, _mm_movehl_ps(v_sum, v_sum));
+        v_sum = _mm_add_ss(v_sum, _mm_shuffle_ps(v_sum, v_sum, 0x55));
+        float s = _mm_cvtss_f32(v_sum);
+        for (; i < len; ++i) {
+            s += x[i];
+        }
+        return s;
+    }
+
+    // prefix sums inside each 128-bit lane, then the low lane total is
+    // carried into the high lane
+    static inline __m256 scan_fwd(__m256 v)
+    {
+        v = _mm256_add_ps(v, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(v), 4)));
+        v = _mm256_add_ps(v, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(v), 8)));
+        const __m256 v_t = _mm256_permute_ps(v, 0xff);
+        return _mm256_add_ps(v, _mm256_permute2f128_ps(v_t, v_t, 0x08));
+    }
+
+    static inline __m256 scan_bwd(__m256 v)
+    {
+        v = _mm256_add_ps(v, _mm256_castsi256_ps(_mm256_srli_si256(_mm256_castps_si256(v), 4)));
+        v = _mm256_add_ps(v, _mm256_castsi256_ps(_mm256_srli_si256(_mm256_castps_si256(v), 8)));
+        const __m256 v_t = _mm256_permute_ps(v, 0x00);
+        return _mm256_add_ps(v, _mm256_permute2f128_ps(v_t, v_t, 0x81));
+    }
+
+    // total of a scanned register broadcast to all lanes
+    static inline __m256 total_fwd(const __m256 v)
+    {
+        const __m256 v_t = _mm256_permute_ps(v, 0xff);
+        return _mm256_permute2f128_ps(v_t, v_t, 0x11);
+    }
+
+    static inline __m256 total_bwd(const __m256 v)
+    {
+        const __m256 v_t = _mm256_permute_ps(v, 0x00);
+        return _mm256_permute2f128_ps(v_t, v_t, 0x00);
+    }
+
+    // exclusive prefix sums from inclusive ones, lane 0 (fwd) or 7 (bwd) is zero
+    static inline __m256 shift_fwd(const __m256 v)
+    {
+        const __m256 v_s = _mm256_permutevar8x32_ps(v, _mm256_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6));
+        return _mm256_blend_ps(v_s, _mm256_setzero_ps(), 0x01);
+    }
+
+    static inline __m256 shift_bwd(const __m256 v)
+    {
+        const __m256 v_s = _mm256_permutevar8x32_ps(v, _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 7));
+        return _mm256_blend_ps(v_s, _mm256_setzero_ps(), 0x80);
+    }
+
+    // same scheme as the sse kernel, one carry add per 16 elements
+    template <int64_t exclusive, int64_t reverse>
+    static float scan(const float *x, const int64_t len, float carry, float *y)
+    {
+        __m256 v_carry = _mm256_set1_ps(carry);
+        if (reverse) {
+            int64_t i = len - 16;
+            for (; i >= 0; i -= 16) {
+                const __m256 v_s_hi = scan_bwd(_mm256_loadu_ps(x + i + 8));
+                const __m256 v_s_lo = scan_bwd(_mm256_loadu_ps(x + i + 0));
+                const __m256 v_t_hi = total_bwd(v_s_hi);
+                const __m256 v_t_lo = total_bwd(v_s_lo);
+                const __m256 v_c_lo = _mm256_add_ps(v_carry, v_t_hi);
+                if (exclusive) {
+                    _mm256_storeu_ps(y + i + 8, _mm256_add_ps(shift_bwd(v_s_hi), v_carry));
+                    _mm256_storeu_ps(y + i + 0, _mm256_add_ps(shift_bwd(v_s_lo), v_c_lo));
+                } else {
+                    _mm256_storeu_ps(y + i + 8, _mm256_add_ps(v_s_hi, v_carry));
+                    _mm256_storeu_ps(y + i + 0, _mm256_add_ps(v_s_lo, v_c_lo));
+                }
+                v_carry = _mm256_add_ps(v_carry, _mm256_add_ps(v_t_hi, v_t_lo));
+            }
+            carry = _mm256_cvtss_f32(v_carry);
+            for (i += 15; i >= 0; --i) {
+                if (exclusive) y[i] = carry;
+                carry += x[i];
+                if (!exclusive) y[i] = carry;
+            }
+        } else {
+            int64_t i = 0;
+            for (; i <= len - 16; i += 16) {
+                const __m256 v_s_lo = scan_fwd(_mm256_loadu_ps(x + i + 0));
+                const __m256 v_s_hi = scan_fwd(_mm256_loadu_ps(x + i + 8));
+                const __m256 v_t_lo = total_fwd(v_s_lo);
+                const __m256 v_t_hi = total_fwd(v_s_hi);
+                const __m256 v_c_hi = _mm256_add_ps(v_carry, v_t_lo);
+                if (exclusive) {
+                    _mm256_storeu_ps(y + i + 0, _mm256_add_ps(shift_fwd(v_s_lo), v_carry));
+                    _mm256_storeu_ps(y + i + 8, _mm256_add_ps(shift_fwd(v_s_hi), v_c_hi));
+                } else {
+                    _mm256_storeu_ps(y + i + 0, _mm256_add_ps(v_s_lo, v_carry));
+                    _mm256_storeu_ps(y + i + 8, _mm256_add_ps(v_s_hi, v_c_hi));
+                }
+                v_carry = _mm256_add_ps(v_carry, _mm256_add_ps(v_t_lo, v_t_hi));
+            }
+            carry = _mm256_cvtss_f32(v_carry);
+            for (; i < len; ++i) {
+                if (exclusive) y[i] = carry;
+                carry += x[i];
+                if (!exclusive) y[i] = carry;
+            }
+        }
+        return carry;
+    }
+};
+
+ppl::common::RetCode cumsum_ndarray_fp32_fma(
+    const ppl::common::TensorShape *x_shape,
+    const float *x,
+    const int64_t axis,
+    const int64_t exclusive,
+    const int64_t reverse,
+    float *y)
+{
+    return cumsum_ndarray_common<float, cumsum_kernel_fp32_fma>(x_shape, x, axis, exclusive, reverse, y);
+}
+
+}}}; // namespace ppl::kernel::x86
@@ -0,0 +1,144 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <nmmintrin.h>
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/common/cumsum/cumsum_common.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+struct cumsum_kernel_fp32_sse {
+    static float sum(const float *x, const int64_t len)
+    {
+        __m128 v_sum0 = _mm_setzero_ps();
+        __m128 v_sum1 = _mm_setzero_ps();
+        int64_t i     = 0;
+        for (; i <= len - 8; i += 8) {
+            v_sum0 = _mm_add_ps(v_sum0, _mm_loadu_ps(x + i + 0));
+            v_sum1 = _mm_add_ps(v_sum1, _mm_loadu_ps(x + i + 4));
+        }
+        v_sum0 = _mm_add_ps(v_sum0, v_sum1);
+        v_sum0 = _mm_add_ps(v_sum0, _mm_movehl_ps(v_sum0, v_sum0));
+        v_sum0 = _mm_add_ss(v_sum0, _mm_shuffle_ps(v_sum0, v_sum0, 0x55));
+        float s = _mm_cvtss_f32(v_sum0);
+        for (; i < len; ++i) {
+            s += x[i];
+        }
+        return s;
+    }
+
+    // prefix sums inside one register, towards the high lanes
+    static inline __m128 scan_fwd(__m128 v)
+    {
+        v = _mm_add_ps(v, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 4)));
+        v = _mm_add_ps(v, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 8)));
+        return v;
+    }
+
+    // prefix sums inside one register, towards the low lanes
+    static inline __m128 scan_bwd(__m128 v)
+    {
+        v = _mm_add_ps(v, _mm_castsi128_ps(_mm_srli_si128(_mm_castps_si128(v), 4)));
+        v = _mm_add_ps(v, _mm_castsi128_ps(_mm_srli_si128(_mm_castps_si128(v), 8)));
+        return v;
+    }
+
+    // exclusive prefix sums from inclusive ones, lane 0 (fwd) or 3 (bwd) is zero
+    static inline __m128 shift_fwd(__m128 v)
+    {
+        return _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 4));
+    }
+
+    static inline __m128 shift_bwd(__m128 v)
+    {
+        return _mm_castsi128_ps(_mm_srli_si128(_mm_castps_si128(v), 4));
+    }
+
+    // two registers per iteration, their totals are added off the carry
+    // chain so the loop carried dependency is one add per 8 elements
+    template <int64_t exclusive, int64_t reverse>
+    static float scan(const float *x, const int64_t len, float carry, float *y)
+    {
+        __m128 v_carry = _mm_set1_ps(carry);
+        if (reverse) {
+            int64_t i = len - 8;
+            for (; i >= 0; i -= 8) {
+                const __m128 v_x_hi = _mm_loadu_ps(x + i + 4);
+                const __m128 v_x_lo = _mm_loadu_ps(x + i + 0);
+                const __m128 v_s_hi = scan_bwd(v_x_hi);
+                const __m128 v_s_lo = scan_bwd(v_x_lo);
+                const __m128 v_t_hi = _mm_shuffle_ps(v_s_hi, v_s_hi, 0x00);
+                const __m128 v_t_lo = _mm_shuffle_ps(v_s_lo, v_s_lo, 0x00);
+                const __m128 v_c_lo = _mm_add_ps(v_carry, v_t_hi);
+                if (exclusive) {
+                    _mm_storeu_ps(y + i + 4, _mm_add_ps(shift_bwd(v_s_hi), v_carry));
+                    _mm_storeu_ps(y + i + 0, _mm_add_ps(shift_bwd(v_s_lo), v_c_lo));
+                } else {
+                    _mm_storeu_ps(y + i + 4, _mm_add_ps(v_s_hi, v_carry));
+                    _mm_storeu_ps(y + i + 0, _mm_add_ps(v_s_lo, v_c_lo));
+                }
+                v_carry = _mm_add_ps(v_carry, _mm_add_ps(v_t_hi, v_t_lo));
+            }
+            carry = _mm_cvtss_f32(v_carry);
+            for (i += 7; i >= 0; --i) {
+                if (exclusive) y[i] = carry;
+                carry += x[i];
+                if (!exclusive) y[i] = carry;
+            }
+        } else {
+            int64_t i = 0;
+            for (; i <= len - 8; i += 8) {
+                const __m128 v_x_lo = _mm_loadu_ps(x + i + 0);
+                const __m128 v_x_hi = _mm_loadu_ps(x + i + 4);
+                const __m128 v_s_lo = scan_fwd(v_x_lo);
+                const __m128 v_s_hi = scan_fwd(v_x_hi);
+                const __m128 v_t_lo = _mm_shuffle_ps(v_s_lo, v_s_lo, 0xff);
+                const __m128 v_t_hi = _mm_shuffle_ps(v_s_hi, v_s_hi, 0xff);
+                const __m128 v_c_hi = _mm_add_ps(v_carry, v_t_lo);
+                if (exclusive) {
+                    _mm_storeu_ps(y + i + 0, _mm_add_ps(shift_fwd(v_s_lo), v_carry));
+                    _mm_storeu_ps(y + i + 4, _mm_add_ps(shift_fwd(v_s_hi), v_c_hi));
+                } else {
+                    _mm_storeu_ps(y + i + 0, _mm_add_ps(v_s_lo, v_carry));
+                    _mm_storeu_ps(y + i + 4, _mm_add_ps(v_s_hi, v_c_hi));
+                }
+                v_carry = _mm_add_ps(v_carry, _mm_add_ps(v_t_lo, v_t_hi));
+            }
+            carry = _mm_cvtss_f32(v_carry);
+            for (; i < len; ++i) {
+                if (exclusive) y[i] = carry;
+                carry += x[i];
+                if (!exclusive) y[i] = carry;
+            }
+        }
+        return carry;
+    }
+};
+
+ppl::common::RetCode cumsum_ndarray_fp32_sse(
+    const ppl::common::TensorShape *x_shape,
+    const float *x,
+    const int64_t axis,
+    const int64_t exclusive,
+    const int64_t reverse,
+    float *y)
+{
+    return cumsum_ndarray_common<float, cumsum_kernel_fp32_sse>(x_shape, x, axis, exclusive, reverse, y);
+}
+
+}}}; // namespace ppl::kernel::x86
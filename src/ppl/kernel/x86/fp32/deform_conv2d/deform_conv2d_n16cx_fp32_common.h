@@ -0,0 +1,331 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_FP32_DEFORM_CONV2D_DEFORM_CONV2D_N16CX_FP32_COMMON_H_
+#define __ST_PPL_KERNEL_X86_FP32_DEFORM_CONV2D_DEFORM_CONV2D_N16CX_FP32_COMMON_H_
+
+#include <math.h>
+#include <string.h>
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/fp32/reorder.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+// Deformable conv on n16cx is run as a pointwise conv over a column tile.
+// For a tile of output pixels every 16 channel block is sampled once per
+// kernel position, so the tile looks like an n16cx source whose channels
+// are ordered (ic block, kh, kw, 16). That is the filter order produced by
+// reorder_goidhw_gIOBidhw16i16o_fp32, so the tile feeds the n16cx
+// gemm_direct micro-kernel as is. Tiles are sized to stay in L2 and are
+// reused by every output channel block.
+//
+// ker_t provides the isa specific parts:
+//     S_KER_BLK: pixels per micro-kernel call
+//     sample(): bilinear blend of 4 corners for 16 channels of num_icb blocks
+//     gemm(): micro-kernel over a tile for all output channel blocks
+
+#define DEFORM_CONV2D_N16CX_CH_DT_BLK() 16
+
+static const int64_t DEFORM_CONV2D_N16CX_ASSUME_L2_BYTES = 256 * 1024;
+static const float DEFORM_CONV2D_N16CX_L2_RATIO          = 0.5f;
+static const int64_t DEFORM_CONV2D_N16CX_K_L2_BLK        = 512;
+
+struct deform_conv2d_n16cx_fp32_blocking {
+    int64_t padded_ic;
+    int64_t padded_oc;
+    int64_t ic_l2_blk;
+    int64_t s_tile;
+    uint64_t flt_bytes;
+    uint64_t bias_bytes;
+    uint64_t col_bytes; // per thread
+};
+
+// the weights layout only depends on the filter shape, so it can be
+// generated once and reused for any source size
+inline deform_conv2d_n16cx_fp32_blocking deform_conv2d_n16cx_fp32_cal_weights_blocking(
+    const int64_t group,
+    const int64_t channels,
+    const int64_t num_output,
+    const int64_t kernel_h,
+    const int64_t kernel_w)
+{
+    const int64_t ch_dt_blk = DEFORM_CONV2D_N16CX_CH_DT_BLK();
+    const int64_t kernel_hw = kernel_h * kernel_w;
+
+    deform_conv2d_n16cx_fp32_blocking blk;
+    blk.padded_ic = round_up(channels / group, ch_dt_blk);
+    blk.padded_oc = round_up(num_output / group, ch_dt_blk);
+    // one filter chunk covers ic_l2_blk channels of every kernel position
+    blk.ic_l2_blk = min(blk.padded_ic, max<int64_t>(round(DEFORM_CONV2D_N16CX_K_L2_BLK / kernel_hw, ch_dt_blk), ch_dt_blk));
+
+    blk.flt_bytes  = round_up(reorder_goidhw_gIOBidhw16i16o_fp32_get_dst_size(group, num_output, channels, 1, kernel_h, kernel_w, blk.ic_l2_blk), PPL_X86_CACHELINE_BYTES());
+    blk.bias_bytes = round_up(group * blk.padded_oc * sizeof(float), PPL_X86_CACHELINE_BYTES());
+    blk.s_tile     = 0;
+    blk.col_bytes  = 0;
+    return blk;
+}
+
+template <typename ker_t>
+inline deform_conv2d_n16cx_fp32_blocking deform_conv2d_n16cx_fp32_cal_blocking(
+    const int64_t dst_h,
+    const int64_t dst_w,
+    const int64_t group,
+    const int64_t channels,
+    const int64_t num_output,
+    const int64_t kernel_h,
+    const int64_t kernel_w)
+{
+    const int64_t kernel_hw = kernel_h * kernel_w;
+    const int64_t l2_bytes  = ppl::common::GetCpuCacheL2() == 0 ? DEFORM_CONV2D_N16CX_ASSUME_L2_BYTES : ppl::common::GetCpuCacheL2();
+
+    deform_conv2d_n16cx_fp32_blocking blk = deform_conv2d_n16cx_fp32_cal_weights_blocking(
+        group, channels, num_output, kernel_h, kernel_w);
+
+    const int64_t col_pixel_len = blk.padded_ic * kernel_hw;
+    const int64_t s_l2          = int64_t(l2_bytes * DEFORM_CONV2D_N16CX_L2_RATIO / sizeof(float)) / col_pixel_len;
+    blk.s_tile = min(round_up(dst_h * dst_w, ker_t::S_KER_BLK), max(round(s_l2, ker_t::S_KER_BLK), ker_t::S_KER_BLK));
+    blk.s_tile = min<int64_t>(blk.s_tile, 16 * ker_t::S_KER_BLK);
+
+    blk.col_bytes = round_up(col_pixel_len * blk.s_tile * sizeof(float), PPL_X86_CACHELINE_BYTES());
+    return blk;
+}
+
+inline uint64_t deform_conv2d_n16cx_fp32_get_cvt_weights_bytes_common(
+    const int64_t group,
+    const int64_t channels,
+    const int64_t num_output,
+    const int64_t kernel_h,
+    const int64_t kernel_w)
+{
+    if (channels % group != 0 || num_output % group != 0) {
+        return 64u;
+    }
+    const deform_conv2d_n16cx_fp32_blocking blk = deform_conv2d_n16cx_fp32_cal_weights_blocking(
+        group, channels, num_output, kernel_h, kernel_w);
+    return blk.flt_bytes + blk.bias_bytes;
+}
+
+// cvt_weights is the reordered filter followed by the zero padded bias
+inline ppl::common::RetCode deform_conv2d_n16cx_fp32_gen_cvt_weights_common(
+    const float *filter,
+    const float *bias,
+    const int64_t group,
+    const int64_t channels,
+    const int64_t num_output,
+    const int64_t kernel_h,
+    const int64_t kernel_w,
+    void *cvt_weights)
+{
+    if (channels % group != 0 || num_output % group != 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    const int64_t oc_per_gp = num_output / group;
+    const deform_conv2d_n16cx_fp32_blocking blk = deform_conv2d_n16cx_fp32_cal_weights_blocking(
+        group, channels, num_output, kernel_h, kernel_w);
+
+    float *cvt_filter = reinterpret_cast<float *>(cvt_weights);
+    float *cvt_bias   = reinterpret_cast<float *>(reinterpret_cast<uint8_t *>(cvt_filter) + blk.flt_bytes);
+
+    ppl::common::RetCode rc = reorder_goidhw_gIOBidhw16i16o_fp32(
+        filter, group, num_output, channels, 1, kernel_h, kernel_w, blk.ic_l2_blk, cvt_filter);
+    if (rc != ppl::common::RC_SUCCESS) {
+        return rc;
+    }
+    for (int64_t g = 0; g < group; ++g) {
+        for (int64_t oc = 0; oc < blk.padded_oc; ++oc) {
+            cvt_bias[g * blk.padded_oc + oc] = (bias && oc < oc_per_gp) ? bias[g * oc_per_gp + oc] : 0.0f;
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <typename ker_t>
+uint64_t deform_conv2d_n16cx_fp32_get_buffer_bytes_common(
+    const int64_t dst_h,
+    const int64_t dst_w,
+    const int64_t group,
+    const int64_t channels,
+    const int64_t num_output,
+    const int64_t kernel_h,
+    const int64_t kernel_w)
+{
+    if (channels % group != 0 || num_output % group != 0) {
+        return 64u;
+    }
+    const deform_conv2d_n16cx_fp32_blocking blk = deform_conv2d_n16cx_fp32_cal_blocking<ker_t>(
+        dst_h, dst_w, group, channels, num_output, kernel_h, kernel_w);
+    return blk.col_bytes * PPL_OMP_MAX_THREADS();
+}
+
+template <typename ker_t>
+ppl::common::RetCode deform_conv2d_n16cx_fp32_common(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const float *offset,
+    const float *mask,
+    const void *cvt_weights,
+    const int64_t group,
+    const int64_t offset_group,
+    const int64_t channels,
+    const int64_t num_output,
+    const int64_t kernel_h,
+    const int64_t kernel_w,
+    const int64_t stride_h,
+    const int64_t stride_w,
+    const int64_t pad_h,
+    const int64_t pad_w,
+    const int64_t dilation_h,
+    const int64_t dilation_w,
+    void *temp_buffer,
+    float *dst)
+{
+    const int64_t ch_dt_blk = DEFORM_CONV2D_N16CX_CH_DT_BLK();
+    if (channels % group != 0 || num_output % group != 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    const int64_t ic_per_gp = channels / group;
+    const int64_t oc_per_gp = num_output / group;
+    if (ic_per_gp % offset_group != 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    // groups start on a channel block, 16 sampled channels share one offset
+    const int64_t ic_per_og = ic_per_gp / offset_group;
+    if ((group > 1 && (ic_per_gp % ch_dt_blk != 0 || oc_per_gp % ch_dt_blk != 0)) ||
+        (offset_group > 1 && ic_per_og % ch_dt_blk != 0)) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+
+    const int64_t batch     = src_shape->GetDim(0);
+    const int64_t src_c     = src_shape->GetDim(1);
+    const int64_t src_h     = src_shape->GetDim(2);
+    const int64_t src_w     = src_shape->GetDim(3);
+    const int64_t dst_c     = dst_shape->GetDim(1);
+    const int64_t dst_h     = dst_shape->GetDim(2);
+    const int64_t dst_w     = dst_shape->GetDim(3);
+    const int64_t dst_space = dst_h * dst_w;
+    const int64_t kernel_hw = kernel_h * kernel_w;
+
+    const deform_conv2d_n16cx_fp32_blocking blk = deform_conv2d_n16cx_fp32_cal_blocking<ker_t>(
+        dst_h, dst_w, group, channels, num_output, kernel_h, kernel_w);
+
+    const float *cvt_filter = reinterpret_cast<const float *>(cvt_weights);
+    const float *cvt_bias   = reinterpret_cast<const float *>(reinterpret_cast<const uint8_t *>(cvt_filter) + blk.flt_bytes);
+    uint8_t *col_base       = reinterpret_cast<uint8_t *>(temp_buffer);
+
+    const int64_t num_icb        = blk.padded_ic / ch_dt_blk;
+    const int64_t ic_tail        = ic_per_gp - (num_icb - 1) * ch_dt_blk;
+    const int64_t icb_per_og     = offset_group > 1 ? ic_per_og / ch_dt_blk : num_icb;
+    const int64_t src_icb_stride = src_h * src_w * ch_dt_blk;
+    const int64_t src_b_stride   = round_up(src_c, ch_dt_blk) * src_h * src_w;
+    const int64_t src_g_stride   = blk.padded_ic * src_h * src_w;
+    const int64_t dst_b_stride   = round_up(dst_c, ch_dt_blk) * dst_space;
+    const int64_t dst_g_stride   = blk.padded_oc * dst_space;
+    const int64_t col_kb_stride  = blk.s_tile * ch_dt_blk;
+    const int64_t col_icb_stride = kernel_hw * col_kb_stride;
+    const int64_t flt_ocb_stride = blk.ic_l2_blk * kernel_hw * ch_dt_blk;
+    const int64_t flt_g_stride   = div_up(blk.padded_ic, blk.ic_l2_blk) * blk.padded_oc * blk.ic_l2_blk * kernel_hw;
+    const int64_t num_tiles      = div_up(dst_space, blk.s_tile);
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t task = 0; task < batch * group * num_tiles; ++task) {
+        const int64_t tile = task % num_tiles;
+        const int64_t g    = task / num_tiles % group;
+        const int64_t b    = task / num_tiles / group;
+        const int64_t s0   = tile * blk.s_tile;
+        const int64_t s_eff = min(dst_space - s0, blk.s_tile);
+
+        float *col              = reinterpret_cast<float *>(col_base + PPL_OMP_THREAD_ID() * blk.col_bytes);
+        const float *l_src      = src + b * src_b_stride + g * src_g_stride;
+        const float *l_offset   = offset + b * offset_group * 2 * kernel_hw * dst_space;
+        const float *l_mask     = mask ? mask + b * offset_group * kernel_hw * dst_space : nullptr;
+
+        for (int64_t k = 0; k < kernel_hw; ++k) {
+            const int64_t kh = k / kernel_w;
+            const int64_t kw = k % kernel_w;
+            for (int64_t s = 0; s < s_eff; ++s) {
+                const int64_t oh = (s0 + s) / dst_w;
+                const int64_t ow = (s0 + s) % dst_w;
+                for (int64_t og = 0; og < num_icb; og += icb_per_og) {
+                    const int64_t og_idx     = og / icb_per_og;
+                    const float *og_offset   = l_offset + og_idx * 2 * kernel_hw * dst_space;
+                    const float offset_h     = og_offset[(2 * k) * dst_space + s0 + s];
+                    const float offset_w     = og_offset[(2 * k + 1) * dst_space + s0 + s];
+                    const float mask_value   = l_mask ? l_mask[(og_idx * kernel_hw + k) * dst_space + s0 + s] : 1.0f;
+                    const float ih           = (oh * stride_h - pad_h) + kh * dilation_h + offset_h;
+                    const float iw           = (ow * stride_w - pad_w) + kw * dilation_w + offset_w;
+
+                    int64_t corner[4] = {0, 0, 0, 0};
+                    float weight[4]   = {0.0f, 0.0f, 0.0f, 0.0f};
+                    if (ih > -1 && ih < src_h && iw > -1 && iw < src_w) {
+                        const int64_t h_low  = (int64_t)::floor(ih);
+                        const int64_t w_low  = (int64_t)::floor(iw);
+                        const int64_t h_high = h_low + 1;
+                        const int64_t w_high = w_low + 1;
+                        const float lh       = ih - h_low;
+                        const float lw       = iw - w_low;
+                        const float hh       = 1 - lh;
+                        const float hw       = 1 - lw;
+                        if (h_low >= 0 && w_low >= 0) {
+                            corner[0] = (h_low * src_w + w_low) * ch_dt_blk;
+                            weight[0] = mask_value * hh * hw;
+                        }
+                        if (h_low >= 0 && w_high <= src_w - 1) {
+                            corner[1] = (h_low * src_w + w_high) * ch_dt_blk;
+                            weight[1] = mask_value * hh * lw;
+                        }
+                        if (h_high <= src_h - 1 && w_low >= 0) {
+                            corner[2] = (h_high * src_w + w_low) * ch_dt_blk;
+                            weight[2] = mask_value * lh * hw;
+                        }
+                        if (h_high <= src_h - 1 && w_high <= src_w - 1) {
+                            corner[3] = (h_high * src_w + w_high) * ch_dt_blk;
+                            weight[3] = mask_value * lh * lw;
+                        }
+                    }
+                    ker_t::sample(
+                        l_src + og * src_icb_stride, src_icb_stride, corner, weight, icb_per_og,
+                        col + og * col_icb_stride + k * col_kb_stride + s * ch_dt_blk, col_icb_stride);
+                }
+                // channel padding of the source is not guaranteed to be zero
+                if (ic_tail < ch_dt_blk) {
+                    float *l_col = col + (num_icb - 1) * col_icb_stride + k * col_kb_stride + s * ch_dt_blk;
+                    memset(l_col + ic_tail, 0, (ch_dt_blk - ic_tail) * sizeof(float));
+                }
+            }
+        }
+
+        for (int64_t icl2 = 0; icl2 < blk.padded_ic; icl2 += blk.ic_l2_blk) {
+            const int64_t icl2_eff = min(blk.padded_ic - icl2, blk.ic_l2_blk);
+            const bool is_first_ic = icl2 == 0;
+            float *l_dst           = dst + b * dst_b_stride + g * dst_g_stride + s0 * ch_dt_blk;
+            ker_t::gemm(
+                col + icl2 / ch_dt_blk * col_icb_stride, col_kb_stride,
+                cvt_filter + g * flt_g_stride + icl2 * blk.padded_oc * kernel_hw, flt_ocb_stride,
+                cvt_bias + g * blk.padded_oc, is_first_ic,
+                icl2_eff * kernel_hw, s_eff, blk.padded_oc,
+                l_dst, dst_space * ch_dt_blk);
+        }
+    }
+
+    return ppl::common::RC_SUCCESS;
+}
+
+}}}; // namespace ppl::kernel::x86
+
+#endif
@@ -0,0 +1,170 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "ppl/kernel/x86/fp32/deform_conv2d.h"
+#include "ppl/kernel/x86/fp32/deform_conv2d/deform_conv2d_n16cx_fp32_common.h"
+#include "ppl/kernel/x86/fp32/conv2d/fma/conv2d_n16cx_gemm_direct_kernel_fp32_fma.h"
+#include "ppl/kernel/x86/common/array_param_helper.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+struct deform_conv2d_n16cx_kernel_fp32_fma {
+    typedef conv2d_n16cx_gemm_direct_kernel_fp32_fma gemm_ker_t;
+    static const int64_t S_KER_BLK = gemm_ker_t::config::MAX_S_REGS;
+
+    static inline void sample(
+        const float *src,
+        const int64_t src_icb_stride,
+        const int64_t *corner,
+        const float *weight,
+        const int64_t num_icb,
+        float *col,
+        const int64_t col_icb_stride)
+    {
+        const __m256 w0 = _mm256_set1_ps(weight[0]);
+        const __m256 w1 = _mm256_set1_ps(weight[1]);
+        const __m256 w2 = _mm256_set1_ps(weight[2]);
+        const __m256 w3 = _mm256_set1_ps(weight[3]);
+        for (int64_t icb = 0; icb < num_icb; ++icb) {
+            const float *l_src = src + icb * src_icb_stride;
+            float *l_col       = col + icb * col_icb_stride;
+            for (int64_t i = 0; i < 16; i += 8) {
+                __m256 v = _mm256_mul_ps(w0, _mm256_loadu_ps(l_src + corner[0] + i));
+                v        = _mm256_fmadd_ps(w1, _mm256_loadu_ps(l_src + corner[1] + i), v);
+                v        = _mm256_fmadd_ps(w2, _mm256_loadu_ps(l_src + corner[2] + i), v);
+                v        = _mm256_fmadd_ps(w3, _mm256_loadu_ps(l_src + corner[3] + i), v);
+                _mm256_storeu_ps(l_col + i, v);
+            }
+        }
+    }
+
+    static inline void gemm(
+        const float *col,
+        const int64_t col_icb_stride,
+        const float *flt,
+        const int64_t flt_ocb_stride,
+        const float *bias,
+        const bool load_bias,
+        const int64_t channels,
+        const int64_t space,
+        const int64_t padded_oc,
+        float *dst,
+        const int64_t dst_ocb_stride)
+    {
+        const int64_t oc_blk = gemm_ker_t::config::OC_DATA_BLK;
+        const int64_t s_body = round(space, S_KER_BLK);
+        const int64_t s_tail = space - s_body;
+
+        int64_t ker_param[gemm_ker_t::param_def::LENGTH];
+        array_param_helper ker_p(ker_param);
+        gemm_ker_t ker(ker_param);
+        ker_p.pick<int64_t>(gemm_ker_t::param_def::SRC_ICB_STRIDE_IDX) = col_icb_stride;
+        ker_p.pick<int64_t>(gemm_ker_t::param_def::CHANNELS_IDX)       = channels;
+        ker_p.pick<int64_t>(gemm_ker_t::param_def::FLAGS_IDX)          = load_bias ? gemm_ker_t::flag::LOAD_BIAS : 0;
+        for (int64_t oc = 0; oc < padded_oc; oc += oc_blk) {
+            const int64_t oc_reg = oc_blk / gemm_ker_t::config::OC_REG_ELTS;
+            float *l_dst         = dst + oc / oc_blk * dst_ocb_stride;
+            ker_p.pick<const float *>(gemm_ker_t::param_def::FLT_PTR_IDX)  = flt + oc / oc_blk * flt_ocb_stride;
+            ker_p.pick<const float *>(gemm_ker_t::param_def::BIAS_PTR_IDX) = bias + oc;
+            if (s_body) {
+                ker_p.pick<const float *>(gemm_ker_t::param_def::SRC_PTR_IDX) = col;
+                ker_p.pick<const float *>(gemm_ker_t::param_def::HIS_PTR_IDX) = l_dst;
+                ker_p.pick<float *>(gemm_ker_t::param_def::DST_PTR_IDX)       = l_dst;
+                ker_p.pick<int64_t>(gemm_ker_t::param_def::SPACE_IDX)         = s_body;
+                ker.execute(0, oc_reg, S_KER_BLK);
+            }
+            if (s_tail) {
+                ker_p.pick<const float *>(gemm_ker_t::param_def::SRC_PTR_IDX) = col + s_body * oc_blk;
+                ker_p.pick<const float *>(gemm_ker_t::param_def::HIS_PTR_IDX) = l_dst + s_body * oc_blk;
+                ker_p.pick<float *>(gemm_ker_t::param_def::DST_PTR_IDX)       = l_dst + s_body * oc_blk;
+                ker_p.pick<int64_t>(gemm_ker_t::param_def::SPACE_IDX)         = s_tail;
+                ker.execute(0, oc_reg, s_tail);
+            }
+        }
+    }
+};
+
+uint64_t deform_conv2d_n16cx_fp32_fma_get_buffer_bytes(
+    const int64_t dst_h,
+    const int64_t dst_w,
+    const int64_t group,
+    const int64_t channels,
+    const int64_t num_output,
+    const int64_t kernel_h,
+    const int64_t kernel_w)
+{
+    return deform_conv2d_n16cx_fp32_get_buffer_bytes_common<deform_conv2d_n16cx_kernel_fp32_fma>(
+        dst_h, dst_w, group, channels, num_output, kernel_h, kernel_w);
+}
+
+uint64_t deform_conv2d_n16cx_fp32_fma_get_cvt_weights_bytes(
+    const int64_t group,
+    const int64_t channels,
+    const int64_t num_output,
+    const int64_t kernel_h,
+    const int64_t kernel_w)
+{
+    return deform_conv2d_n16cx_fp32_get_cvt_weights_bytes_common(
+        group, channels, num_output, kernel_h, kernel_w);
+}
+
+ppl::common::RetCode deform_conv2d_n16cx_fp32_fma_gen_cvt_weights(
+    const float *filter,
+    const float *bias,
+    const int64_t group,
+    const int64_t channels,
+    const int64_t num_output,
+    const int64_t kernel_h,
+    const int64_t kernel_w,
+    void *cvt_weights)
+{
+    return deform_conv2d_n16cx_fp32_gen_cvt_weights_common(
+        filter, bias, group, channels, num_output, kernel_h, kernel_w, cvt_weights);
+}
+
+ppl::common::RetCode deform_conv2d_n16cx_fp32_fma(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const float *offset,
+    const float *mask,
+    const void *cvt_weights,
+    const int64_t group,
+    const int64_t offset_group,
+    const int64_t channels,
+    const int64_t num_output,
+    const int64_t kernel_h,
+    const int64_t kernel_w,
+    const int64_t stride_h,
+    const int64_t stride_w,
+    const int64_t pad_h,
+    const int64_t pad_w,
+    const int64_t dilation_h,
+    const int64_t dilation_w,
+    void *temp_buffer,
+    float *dst)
+{
+    return deform_conv2d_n16cx_fp32_common<deform_conv2d_n16cx_kernel_fp32_fma>(
+        src_shape, dst_shape, src, offset, mask, cvt_weights,
+        group, offset_group, channels, num_output,
+        kernel_h, kernel_w, stride_h, stride_w, pad_h, pad_w,
+        dilation_h, dilation_w, temp_buffer, dst);
+}
+
+}}}; // namespace ppl::kernel::x86
@@ -0,0 +1,85 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/kernel/x86/fp32/embedding_bag.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+ppl::common::RetCode embedding_bag_fp32(
+    const ppl::common::isa_t isa,
+    const float *table,
+    const int64_t *indices,
+    const int64_t *offsets,
+    const int64_t *lengths,
+    const float *per_sample_weights,
+    const int64_t num_embeddings,
+    const int64_t embedding_dim,
+    const int64_t num_indices,
+    const int64_t num_bags,
+    const int32_t mode,
+    float *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return embedding_bag_fp32_avx512(
+            table, indices, offsets, lengths, per_sample_weights, num_embeddings,
+            embedding_dim, num_indices, num_bags, mode, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_FMA) {
+        return embedding_bag_fp32_fma(
+            table, indices, offsets, lengths, per_sample_weights, num_embeddings,
+            embedding_dim, num_indices, num_bags, mode, dst);
+    }
+    return embedding_bag_fp32_sse(
+        table, indices, offsets, lengths, per_sample_weights, num_embeddings,
+        embedding_dim, num_indices, num_bags, mode, dst);
+}
+
+ppl::common::RetCode embedding_bag_quantized_fp32(
+    const ppl::common::isa_t isa,
+    const void *table,
+    const int32_t table_type,
+    const int64_t *indices,
+    const int64_t *offsets,
+    const int64_t *lengths,
+    const float *per_sample_weights,
+    const int64_t num_embeddings,
+    const int64_t embedding_dim,
+    const int64_t num_indices,
+    const int64_t num_bags,
+    const int32_t mode,
+    float *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return embedding_bag_quantized_fp32_avx512(
+            table, table_type, indices, offsets, lengths, per_sample_weights, num_embeddings,
+            embedding_dim, num_indices, num_bags, mode, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_FMA) {
+        return embedding_bag_quantized_fp32_fma(
+            table, table_type, indices, offsets, lengths, per_sample_weights, num_embeddings,
+            embedding_dim, num_indices, num_bags, mode, dst);
+    }
+    return embedding_bag_quantized_fp32_sse(
+        table, table_type, indices, offsets, lengths, per_sample_weights, num_embeddings,
+        embedding_dim, num_indices, num_bags, mode, dst);
+}
+
+}}}; // namespace ppl::kernel::x86
@@ -0,0 +1,90 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "ppl/kernel/x86/fp32/embedding_bag/embedding_bag_fp32_common.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+struct embedding_bag_kernel_fp32_avx512 {
+    typedef __m512 vec_t;
+    static const int64_t simd_w = 16;
+
+    static inline vec_t zero() { return _mm512_setzero_ps(); }
+    static inline vec_t set1(const float v) { return _mm512_set1_ps(v); }
+    static inline vec_t load(const float *p) { return _mm512_loadu_ps(p); }
+    static inline void store(float *p, const vec_t v) { _mm512_storeu_ps(p, v); }
+    static inline vec_t add(const vec_t a, const vec_t b) { return _mm512_add_ps(a, b); }
+    static inline vec_t mul(const vec_t a, const vec_t b) { return _mm512_mul_ps(a, b); }
+    static inline vec_t max(const vec_t a, const vec_t b) { return _mm512_max_ps(a, b); }
+    static inline vec_t fmadd(const vec_t a, const vec_t b, const vec_t c) { return _mm512_fmadd_ps(a, b, c); }
+
+    static inline vec_t load_u8(const uint8_t *p)
+    {
+        return _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i *)p)));
+    }
+
+    static inline vec_t load_u4(const uint8_t *p)
+    {
+        return _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(embedding_unpack_u4(p, simd_w / 2)));
+    }
+
+    static inline vec_t load_fp16(const uint16_t *p)
+    {
+        return _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i *)p));
+    }
+};
+
+ppl::common::RetCode embedding_bag_fp32_avx512(
+    const float *table,
+    const int64_t *indices,
+    const int64_t *offsets,
+    const int64_t *lengths,
+    const float *per_sample_weights,
+    const int64_t num_embeddings,
+    const int64_t embedding_dim,
+    const int64_t num_indices,
+    const int64_t num_bags,
+    const int32_t mode,
+    float *dst)
+{
+    return embedding_bag_fp32_common<embedding_bag_kernel_fp32_avx512, EMBEDDING_TABLE_FP32>(
+        (const uint8_t *)table, indices, offsets, lengths, per_sample_weights, num_embeddings,
+        embedding_dim, num_indices, num_bags, mode, dst);
+}
+
+ppl::common::RetCode embedding_bag_quantized_fp32_avx512(
+    const void *table,
+    const int32_t table_type,
+    const int64_t *indices,
+    const int64_t *offsets,
+    const int64_t *lengths,
+    const float *per_sample_weights,
+    const int64_t num_embeddings,
+    const int64_t embedding_dim,
+    const int64_t num_indices,
+    const int64_t num_bags,
+    const int32_t mode,
+    float *dst)
+{
+    return embedding_bag_quantized_fp32_common<embedding_bag_kernel_fp32_avx512>(
+        table, table_type, indices, offsets, lengths, per_sample_weights, num_embeddings,
+        embedding_dim, num_indices, num_bags, mode, dst);
+}
+
+}}}; // namespace ppl::kernel::x86
@@ -0,0 +1,512 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_FP32_EMBEDDING_BAG_EMBEDDING_BAG_FP32_COMMON_H_
+#define __ST_PPL_KERNEL_X86_FP32_EMBEDDING_BAG_EMBEDDING_BAG_FP32_COMMON_H_
+
+#include <string.h>
+#include <emmintrin.h>
+#include <vector>
+
+#include "ppl/kernel/x86/common/internal_include.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+enum embedding_bag_mode_t {
+    EMBEDDING_BAG_SUM  = 0,
+    EMBEDDING_BAG_MEAN = 1,
+    EMBEDDING_BAG_MAX  = 2,
+};
+
+// values match the table_type of embedding_bag_quantized_fp32, fp32 tables
+// only come in through embedding_bag_fp32
+enum embedding_table_type_t {
+    EMBEDDING_TABLE_FP16         = 0,
+    EMBEDDING_TABLE_INT8_ROWWISE = 1,
+    EMBEDDING_TABLE_INT4_ROWWISE = 2,
+    EMBEDDING_TABLE_FP32         = 3,
+};
+
+// rows are gathered at random, so the hardware prefetcher cannot follow
+// them. touch the same columns of the row this many indices ahead.
+#define EMBEDDING_BAG_PREFETCH_DIST() 8
+
+template <int32_t table_type>
+inline bool embedding_table_is_rowwise()
+{
+    return table_type == EMBEDDING_TABLE_INT8_ROWWISE || table_type == EMBEDDING_TABLE_INT4_ROWWISE;
+}
+
+// bytes of the quantized values of a row, scale and bias follow them
+template <int32_t table_type>
+inline int64_t embedding_table_data_bytes(const int64_t dim)
+{
+    switch (table_type) {
+        case EMBEDDING_TABLE_FP16: return dim * sizeof(uint16_t);
+        case EMBEDDING_TABLE_INT8_ROWWISE: return dim;
+        case EMBEDDING_TABLE_INT4_ROWWISE: return div_up(dim, 2);
+        default: return dim * sizeof(float);
+    }
+}
+
+template <int32_t table_type>
+inline int64_t embedding_table_row_bytes(const int64_t dim)
+{
+    return embedding_table_data_bytes<table_type>(dim) + (embedding_table_is_rowwise<table_type>() ? 2 * sizeof(float) : 0);
+}
+
+// byte offset of column col inside a row, col is even for int4 simd loads
+template <int32_t table_type>
+inline int64_t embedding_table_col_bytes(const int64_t col)
+{
+    switch (table_type) {
+        case EMBEDDING_TABLE_FP16: return col * sizeof(uint16_t);
+        case EMBEDDING_TABLE_INT8_ROWWISE: return col;
+        case EMBEDDING_TABLE_INT4_ROWWISE: return col / 2;
+        default: return col * sizeof(float);
+    }
+}
+
+// scale and bias are stored unaligned right after the row data
+template <int32_t table_type>
+inline void embedding_table_scale_bias(const uint8_t *row, const int64_t dim, float *scale, float *bias)
+{
+    const uint8_t *sb = row + embedding_table_data_bytes<table_type>(dim);
+    memcpy(scale, sb, sizeof(float));
+    memcpy(bias, sb + sizeof(float), sizeof(float));
+}
+
+// exact, handles subnormals without touching denormal floats, so it is not
+// affected by ftz/daz
+inline float embedding_fp16_to_fp32(const uint16_t h)
+{
+    uint32_t o       = (uint32_t)(h & 0x7fff) << 13;
+    const uint32_t e = o & 0x0f800000;
+    o += 0x38000000;
+    float f;
+    if (e == 0x0f800000) {
+        o += 0x38000000;
+        memcpy(&f, &o, sizeof(f));
+    } else if (e == 0) {
+        o += 0x00800000;
+        memcpy(&f, &o, sizeof(f));
+        f -= 6.103515625e-05f; // 2^-14
+    } else {
+        memcpy(&f, &o, sizeof(f));
+    }
+    return (h & 0x8000) ? -f : f;
+}
+
+// raw value of one column: quantized level for rowwise tables
+template <int32_t table_type>
+inline float embedding_table_load_scalar(const uint8_t *row, const int64_t col)
+{
+    switch (table_type) {
+        case EMBEDDING_TABLE_FP16: return embedding_fp16_to_fp32(((const uint16_t *)row)[col]);
+        case EMBEDDING_TABLE_INT8_ROWWISE: return row[col];
+        case EMBEDDING_TABLE_INT4_ROWWISE: return (row[col / 2] >> ((col & 1) * 4)) & 0xf;
+        default: return ((const float *)row)[col];
+    }
+}
+
+// spread num_bytes packed nibbles to one byte each, low nibble first
+inline __m128i embedding_unpack_u4(const uint8_t *src, const int64_t num_bytes)
+{
+    int64_t packed = 0;
+    memcpy(&packed, src, num_bytes);
+    const __m128i mask = _mm_set1_epi8(0x0f);
+    const __m128i x    = _mm_cvtsi64_si128(packed);
+    const __m128i lo   = _mm_and_si128(x, mask);
+    const __m128i hi   = _mm_and_si128(_mm_srli_epi16(x, 4), mask);
+    return _mm_unpacklo_epi8(lo, hi);
+}
+
+template <typename kernel_t, int32_t table_type>
+inline typename kernel_t::vec_t embedding_table_load(const uint8_t *row, const int64_t col)
+{
+    switch (table_type) {
+        case EMBEDDING_TABLE_FP16: return kernel_t::load_fp16((const uint16_t *)row + col);
+        case EMBEDDING_TABLE_INT8_ROWWISE: return kernel_t::load_u8(row + col);
+        case EMBEDDING_TABLE_INT4_ROWWISE: return kernel_t::load_u4(row + col / 2);
+        default: return kernel_t::load((const float *)row + col);
+    }
+}
+
+// pool one bag over columns [col, col + unroll * simd_w). accumulators stay
+// in registers for the whole bag, so every gathered row is read once and
+// nothing but the pooled row is written. rowwise tables dequantize in
+// registers: max needs level * scale + bias per row, sum folds the weight
+// into the scale and adds the weighted biases once at the end.
+template <typename kernel_t, int32_t table_type, int32_t mode, bool weighted, int64_t unroll>
+inline void embedding_bag_cols_fp32(
+    const uint8_t *table,
+    const int64_t dim,
+    const int64_t *indices,
+    const float *weights,
+    const int64_t len,
+    const int64_t col,
+    float *dst)
+{
+    typedef typename kernel_t::vec_t vec_t;
+    const int64_t simd_w        = kernel_t::simd_w;
+    const int64_t prefetch_dist = EMBEDDING_BAG_PREFETCH_DIST();
+    const int64_t row_bytes     = embedding_table_row_bytes<table_type>(dim);
+    const int64_t col_bytes     = embedding_table_col_bytes<table_type>(col);
+    const int64_t blk_bytes     = embedding_table_col_bytes<table_type>(unroll * simd_w);
+    const bool rowwise          = embedding_table_is_rowwise<table_type>();
+
+    vec_t v_acc[unroll];
+    if (len == 0) {
+        for (int64_t u = 0; u < unroll; ++u) {
+            kernel_t::store(dst + col + u * simd_w, kernel_t::zero());
+        }
+        return;
+    }
+
+    int64_t i      = 0;
+    float bias_acc = 0.0f;
+    if (mode == EMBEDDING_BAG_MAX) {
+        const uint8_t *row = table + indices[0] * row_bytes;
+        for (int64_t u = 0; u < unroll; ++u) {
+            v_acc[u] = embedding_table_load<kernel_t, table_type>(row, col + u * simd_w);
+        }
+        if (rowwise) {
+            float scale, bias;
+            embedding_table_scale_bias<table_type>(row, dim, &scale, &bias);
+            const vec_t v_scale = kernel_t::set1(scale);
+            const vec_t v_bias  = kernel_t::set1(bias);
+            for (int64_t u = 0; u < unroll; ++u) {
+                v_acc[u] = kernel_t::fmadd(v_acc[u], v_scale, v_bias);
+            }
+        }
+        i = 1;
+    } else {
+        for (int64_t u = 0; u < unroll; ++u) {
+            v_acc[u] = kernel_t::zero();
+        }
+    }
+
+    for (; i < len; ++i) {
+        if (i + prefetch_dist < len) {
+            const uint8_t *pf_row = table + indices[i + prefetch_dist] * row_bytes;
+            for (int64_t k = 0; k < blk_bytes; k += PPL_X86_CACHELINE_BYTES()) {
+                _mm_prefetch((const char *)(pf_row + col_bytes + k), _MM_HINT_T0);
+            }
+            if (rowwise && col == 0) {
+                _mm_prefetch((const char *)(pf_row + embedding_table_data_bytes<table_type>(dim)), _MM_HINT_T0);
+            }
+        }
+        const uint8_t *row = table + indices[i] * row_bytes;
+        if (rowwise) {
+            float scale, bias;
+            embedding_table_scale_bias<table_type>(row, dim, &scale, &bias);
+            if (mode == EMBEDDING_BAG_MAX) {
+                const vec_t v_scale = kernel_t::set1(scale);
+                const vec_t v_bias  = kernel_t::set1(bias);
+                for (int64_t u = 0; u < unroll; ++u) {
+                    const vec_t v_val = kernel_t::fmadd(embedding_table_load<kernel_t, table_type>(row, col + u * simd_w), v_scale, v_bias);
+                    v_acc[u]          = kernel_t::max(v_acc[u], v_val);
+                }
+            } else {
+                const float w       = weighted ? weights[i] : 1.0f;
+                const vec_t v_scale = kernel_t::set1(scale * w);
+                bias_acc += bias * w;
+                for (int64_t u = 0; u < unroll; ++u) {
+                    v_acc[u] = kernel_t::fmadd(embedding_table_load<kernel_t, table_type>(row, col + u * simd_w), v_scale, v_acc[u]);
+                }
+            }
+        } else if (mode == EMBEDDING_BAG_MAX) {
+            for (int64_t u = 0; u < unroll; ++u) {
+                v_acc[u] = kernel_t::max(v_acc[u], embedding_table_load<kernel_t, table_type>(row, col + u * simd_w));
+            }
+        } else if (weighted) {
+            const vec_t v_w = kernel_t::set1(weights[i]);
+            for (int64_t u = 0; u < unroll; ++u) {
+                v_acc[u] = kernel_t::fmadd(embedding_table_load<kernel_t, table_type>(row, col + u * simd_w), v_w, v_acc[u]);
+            }
+        } else {
+            for (int64_t u = 0; u < unroll; ++u) {
+                v_acc[u] = kernel_t::add(v_acc[u], embedding_table_load<kernel_t, table_type>(row, col + u * simd_w));
+            }
+        }
+    }
+
+    if (rowwise && mode != EMBEDDING_BAG_MAX) {
+        const vec_t v_bias = kernel_t::set1(bias_acc);
+        for (int64_t u = 0; u < unroll; ++u) {
+            v_acc[u] = kernel_t::add(v_acc[u], v_bias);
+        }
+    }
+    if (mode == EMBEDDING_BAG_MEAN) {
+        const vec_t v_scale = kernel_t::set1(1.0f / len);
+        for (int64_t u = 0; u < unroll; ++u) {
+            v_acc[u] = kernel_t::mul(v_acc[u], v_scale);
+        }
+    }
+    for (int64_t u = 0; u < unroll; ++u) {
+        kernel_t::store(dst + col + u * simd_w, v_acc[u]);
+    }
+}
+
+// columns left over after the simd blocks, one row at a time into dst
+template <int32_t table_type, int32_t mode, bool weighted>
+inline void embedding_bag_tail_fp32(
+    const uint8_t *table,
+    const int64_t dim,
+    const int64_t *indices,
+    const float *weights,
+    const int64_t len,
+    const int64_t col,
+    float *dst)
+{
+    if (len == 0) {
+        for (int64_t c = col; c < dim; ++c) {
+            dst[c] = 0.0f;
+        }
+        return;
+    }
+    const int64_t row_bytes = embedding_table_row_bytes<table_type>(dim);
+    for (int64_t i = 0; i < len; ++i) {
+        const uint8_t *row = table + indices[i] * row_bytes;
+        float scale        = 1.0f;
+        float bias         = 0.0f;
+        if (embedding_table_is_rowwise<table_type>()) {
+            embedding_table_scale_bias<table_type>(row, dim, &scale, &bias);
+        }
+        for (int64_t c = col; c < dim; ++c) {
+            const float val = embedding_table_load_scalar<table_type>(row, c) * scale + bias;
+            if (mode == EMBEDDING_BAG_MAX) {
+                dst[c] = i == 0 ? val : max(dst[c], val);
+            } else {
+                const float w_val = weighted ? val * weights[i] : val;
+                dst[c]            = i == 0 ? w_val : dst[c] + w_val;
+            }
+        }
+    }
+    if (mode == EMBEDDING_BAG_MEAN) {
+        const float scale = 1.0f / len;
+        for (int64_t c = col; c < dim; ++c) {
+            dst[c] *= scale;
+        }
+    }
+}
+
+// offsets is nullptr when every index is a bag of its own
+template <typename kernel_t, int32_t table_type, int32_t mode, bool weighted>
+void embedding_bag_bags_fp32(
+    const uint8_t *table,
+    const int64_t *indices,
+    const int64_t *offsets,
+    const float *weights,
+    const int64_t embedding_dim,
+    const int64_t num_indices,
+    const int64_t num_bags,
+    const int64_t bag_start,
+    const int64_t bag_end,
+    float *dst)
+{
+    const int64_t simd_w = kernel_t::simd_w;
+    const int64_t unroll = 4;
+    for (int64_t b = bag_start; b < bag_end; ++b) {
+        const int64_t beg      = offsets ? offsets[b] : b;
+        const int64_t len      = offsets ? (b + 1 < num_bags ? offsets[b + 1] : num_indices) - beg : 1;
+        const int64_t *l_idx   = indices + beg;
+        const float *l_weights = weighted ? weights + beg : nullptr;
+        float *l_dst           = dst + b * embedding_dim;
+        int64_t col            = 0;
+        for (; col + unroll * simd_w <= embedding_dim; col += unroll * simd_w) {
+            embedding_bag_cols_fp32<kernel_t, table_type, mode, weighted, unroll>(table, embedding_dim, l_idx, l_weights, len, col, l_dst);
+        }
+        for (; col + simd_w <= embedding_dim; col += simd_w) {
+            embedding_bag_cols_fp32<kernel_t, table_type, mode, weighted, 1>(table, embedding_dim, l_idx, l_weights, len, col, l_dst);
+        }
+        if (col < embedding_dim) {
+            embedding_bag_tail_fp32<table_type, mode, weighted>(table, embedding_dim, l_idx, l_weights, len, col, l_dst);
+        }
+    }
+}
+
+// first bag of every part, so that each part gathers about the same number
+// of rows. a bag costs its length plus one for writing the pooled row, which
+// keeps runs of empty or short bags from piling up on one thread.
+inline void embedding_bag_balance_parts(
+    const int64_t *offsets,
+    const int64_t num_indices,
+    const int64_t num_bags,
+    const int64_t num_parts,
+    int64_t *part_start)
+{
+    const int64_t total_cost = num_indices + num_bags;
+    part_start[0]            = 0;
+    for (int64_t p = 1; p < num_parts; ++p) {
+        if (!offsets) {
+            part_start[p] = num_bags * p / num_parts;
+            continue;
+        }
+        const int64_t target = total_cost * p / num_parts;
+        // first bag whose starting cost reaches target
+        int64_t lo = part_start[p - 1];
+        int64_t hi = num_bags;
+        while (lo < hi) {
+            const int64_t mid = lo + (hi - lo) / 2;
+            if (offsets[mid] + mid < target) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        part_start[p] = lo;
+    }
+    part_start[num_parts] = num_bags;
+}
+
+template <typename kernel_t, int32_t table_type, int32_t mode, bool weighted>
+void embedding_bag_parallel_fp32(
+    const uint8_t *table,
+    const int64_t *indices,
+    const int64_t *offsets,
+    const float *weights,
+    const int64_t embedding_dim,
+    const int64_t num_indices,
+    const int64_t num_bags,
+    float *dst)
+{
+    const int64_t num_parts = min<int64_t>(PPL_OMP_MAX_THREADS(), num_bags);
+    std::vector<int64_t> part_start(num_parts + 1);
+    embedding_bag_balance_parts(offsets, num_indices, num_bags, num_parts, part_start.data());
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t p = 0; p < num_parts; ++p) {
+        embedding_bag_bags_fp32<kernel_t, table_type, mode, weighted>(
+            table, indices, offsets, weights, embedding_dim,
+            num_indices, num_bags, part_start[p], part_start[p + 1], dst);
+    }
+}
+
+template <typename kernel_t, int32_t table_type>
+ppl::common::RetCode embedding_bag_fp32_common(
+    const uint8_t *table,
+    const int64_t *indices,
+    const int64_t *offsets,
+    const int64_t *lengths,
+    const float *per_sample_weights,
+    const int64_t num_embeddings,
+    const int64_t embedding_dim,
+    const int64_t num_indices,
+    const int64_t num_bags,
+    const int32_t mode,
+    float *dst)
+{
+    if (offsets && lengths) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (!offsets && !lengths && num_bags != num_indices) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if (mode != EMBEDDING_BAG_SUM && mode != EMBEDDING_BAG_MEAN && mode != EMBEDDING_BAG_MAX) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+    if (per_sample_weights && mode != EMBEDDING_BAG_SUM) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+    if (num_bags <= 0 || embedding_dim <= 0) {
+        return ppl::common::RC_SUCCESS;
+    }
+
+    std::vector<int64_t> lengths_offsets;
+    if (lengths) {
+        lengths_offsets.resize(num_bags);
+        int64_t acc = 0;
+        for (int64_t b = 0; b < num_bags; ++b) {
+            if (lengths[b] < 0) {
+                return ppl::common::RC_INVALID_VALUE;
+            }
+            lengths_offsets[b] = acc;
+            acc += lengths[b];
+        }
+        if (acc != num_indices) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+        offsets = lengths_offsets.data();
+    } else if (offsets) {
+        if (offsets[0] != 0 || offsets[num_bags - 1] > num_indices) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+        for (int64_t b = 1; b < num_bags; ++b) {
+            if (offsets[b] < offsets[b - 1]) {
+                return ppl::common::RC_INVALID_VALUE;
+            }
+        }
+    }
+    for (int64_t i = 0; i < num_indices; ++i) {
+        if (indices[i] < 0 || indices[i] >= num_embeddings) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+    }
+
+    if (mode == EMBEDDING_BAG_MAX) {
+        embedding_bag_parallel_fp32<kernel_t, table_type, EMBEDDING_BAG_MAX, false>(
+            table, indices, offsets, nullptr, embedding_dim, num_indices, num_bags, dst);
+    } else if (mode == EMBEDDING_BAG_MEAN) {
+        embedding_bag_parallel_fp32<kernel_t, table_type, EMBEDDING_BAG_MEAN, false>(
+            table, indices, offsets, nullptr, embedding_dim, num_indices, num_bags, dst);
+    } else if (per_sample_weights) {
+        embedding_bag_parallel_fp32<kernel_t, table_type, EMBEDDING_BAG_SUM, true>(
+            table, indices, offsets, per_sample_weights, embedding_dim, num_indices, num_bags, dst);
+    } else {
+        embedding_bag_parallel_fp32<kernel_t, table_type, EMBEDDING_BAG_SUM, false>(
+            table, indices, offsets, nullptr, embedding_dim, num_indices, num_bags, dst);
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+template <typename kernel_t>
+ppl::common::RetCode embedding_bag_quantized_fp32_common(
+    const void *table,
+    const int32_t table_type,
+    const int64_t *indices,
+    const int64_t *offsets,
+    const int64_t *lengths,
+    const float *per_sample_weights,
+    const int64_t num_embeddings,
+    const int64_t embedding_dim,
+    const int64_t num_indices,
+    const int64_t num_bags,
+    const int32_t mode,
+    float *dst)
+{
+    const uint8_t *l_table = (const uint8_t *)table;
+    switch (table_type) {
+        case EMBEDDING_TABLE_FP16:
+            return embedding_bag_fp32_common<kernel_t, EMBEDDING_TABLE_FP16>(
+                l_table, indices, offsets, lengths, per_sample_weights, num_embeddings,
+                embedding_dim, num_indices, num_bags, mode, dst);
+        case EMBEDDING_TABLE_INT8_ROWWISE:
+            return embedding_bag_fp32_common<kernel_t, EMBEDDING_TABLE_INT8_ROWWISE>(
+                l_table, indices, offsets, lengths, per_sample_weights, num_embeddings,
+                embedding_dim, num_indices, num_bags, mode, dst);
+        case EMBEDDING_TABLE_INT4_ROWWISE:
+            return embedding_bag_fp32_common<kernel_t, EMBEDDING_TABLE_INT4_ROWWISE>(
+                l_table, indices, offsets, lengths, per_sample_weights, num_embeddings,
+                embedding_dim, num_indices, num_bags, mode, dst);
+        default:
+            return ppl::common::RC_UNSUPPORTED;
+    }
+}
+
+}}}; // namespace ppl::kernel::x86
+
+#endif
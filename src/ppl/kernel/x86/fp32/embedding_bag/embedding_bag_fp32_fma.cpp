@@ -0,0 +1,105 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "ppl/kernel/x86/fp32/embedding_bag/embedding_bag_fp32_common.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+struct embedding_bag_kernel_fp32_fma {
+    typedef __m256 vec_t;
+    static const int64_t simd_w = 8;
+
+    static inline vec_t zero() { return _mm256_setzero_ps(); }
+    static inline vec_t set1(const float v) { return _mm256_set1_ps(v); }
+    static inline vec_t load(const float *p) { return _mm256_loadu_ps(p); }
+    static inline void store(float *p, const vec_t v) { _mm256_storeu_ps(p, v); }
+    static inline vec_t add(const vec_t a, const vec_t b) { return _mm256_add_ps(a, b); }
+    static inline vec_t mul(const vec_t a, const vec_t b) { return _mm256_mul_ps(a, b); }
+    static inline vec_t max(const vec_t a, const vec_t b) { return _mm256_max_ps(a, b); }
+    static inline vec_t fmadd(const vec_t a, const vec_t b, const vec_t c) { return _mm256_fmadd_ps(a, b, c); }
+
+    static inline vec_t load_u8(const uint8_t *p)
+    {
+        return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)p)));
+    }
+
+    static inline vec_t load_u4(const uint8_t *p)
+    {
+        return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(embedding_unpack_u4(p, simd_w / 2)));
+    }
+
+    // same bit conversion as embedding_fp16_to_fp32, f16c is not part of
+    // the fma build flags
+    static inline vec_t load_fp16(const uint16_t *p)
+    {
+        const __m256i h     = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)p));
+        const __m256i v_exp = _mm256_set1_epi32(0x0f800000);
+        const __m256i v_adj = _mm256_set1_epi32(0x38000000);
+        __m256i o           = _mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(0x7fff)), 13);
+        const __m256i e     = _mm256_and_si256(o, v_exp);
+        o                   = _mm256_add_epi32(o, v_adj);
+        o                   = _mm256_add_epi32(o, _mm256_and_si256(_mm256_cmpeq_epi32(e, v_exp), v_adj));
+        const __m256 sub    = _mm256_sub_ps(
+            _mm256_castsi256_ps(_mm256_add_epi32(o, _mm256_set1_epi32(0x00800000))),
+            _mm256_castsi256_ps(_mm256_set1_epi32(0x38800000)));
+        const __m256 is_sub = _mm256_castsi256_ps(_mm256_cmpeq_epi32(e, _mm256_setzero_si256()));
+        const __m256 f      = _mm256_blendv_ps(_mm256_castsi256_ps(o), sub, is_sub);
+        const __m256i sign  = _mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(0x8000)), 16);
+        return _mm256_or_ps(f, _mm256_castsi256_ps(sign));
+    }
+};
+
+ppl::common::RetCode embedding_bag_fp32_fma(
+    const float *table,
+    const int64_t *indices,
+    const int64_t *offsets,
+    const int64_t *lengths,
+    const float *per_sample_weights,
+    const int64_t num_embeddings,
+    const int64_t embedding_dim,
+    const int64_t num_indices,
+    const int64_t num_bags,
+    const int32_t mode,
+    float *dst)
+{
+    return embedding_bag_fp32_common<embedding_bag_kernel_fp32_fma, EMBEDDING_TABLE_FP32>(
+        (const uint8_t *)table, indices, offsets, lengths, per_sample_weights, num_embeddings,
+        embedding_dim, num_indices, num_bags, mode, dst);
+}
+
+ppl::common::RetCode embedding_bag_quantized_fp32_fma(
+    const void *table,
+    const int32_t table_type,
+    const int64_t *indices,
+    const int64_t *offsets,
+    const int64_t *lengths,
+    const float *per_sample_weights,
+    const int64_t num_embeddings,
+    const int64_t embedding_dim,
+    const int64_t num_indices,
+    const int64_t num_bags,
+    const int32_t mode,
+    float *dst)
+{
+    return embedding_bag_quantized_fp32_common<embedding_bag_kernel_fp32_fma>(
+        table, table_type, indices, offsets, lengths, per_sample_weights, num_embeddings,
+        embedding_dim, num_indices, num_bags, mode, dst);
+}
+
+}}}; // namespace ppl::kernel::x86
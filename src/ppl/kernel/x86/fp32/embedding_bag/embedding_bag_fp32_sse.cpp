@@ -0,0 +1,106 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "ppl/kernel/x86/fp32/embedding_bag/embedding_bag_fp32_common.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+struct embedding_bag_kernel_fp32_sse {
+    typedef __m128 vec_t;
+    static const int64_t simd_w = 4;
+
+    static inline vec_t zero() { return _mm_setzero_ps(); }
+    static inline vec_t set1(const float v) { return _mm_set1_ps(v); }
+    static inline vec_t load(const float *p) { return _mm_loadu_ps(p); }
+    static inline void store(float *p, const vec_t v) { _mm_storeu_ps(p, v); }
+    static inline vec_t add(const vec_t a, const vec_t b) { return _mm_add_ps(a, b); }
+    static inline vec_t mul(const vec_t a, const vec_t b) { return _mm_mul_ps(a, b); }
+    static inline vec_t max(const vec_t a, const vec_t b) { return _mm_max_ps(a, b); }
+    static inline vec_t fmadd(const vec_t a, const vec_t b, const vec_t c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+
+    static inline vec_t load_u8(const uint8_t *p)
+    {
+        int32_t packed;
+        memcpy(&packed, p, sizeof(packed));
+        return _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(packed)));
+    }
+
+    static inline vec_t load_u4(const uint8_t *p)
+    {
+        return _mm_cvtepi32_ps(_mm_cvtepu8_epi32(embedding_unpack_u4(p, simd_w / 2)));
+    }
+
+    // same bit conversion as embedding_fp16_to_fp32, no f16c needed
+    static inline vec_t load_fp16(const uint16_t *p)
+    {
+        const __m128i h     = _mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i *)p));
+        const __m128i v_exp = _mm_set1_epi32(0x0f800000);
+        const __m128i v_adj = _mm_set1_epi32(0x38000000);
+        __m128i o           = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x7fff)), 13);
+        const __m128i e     = _mm_and_si128(o, v_exp);
+        o                   = _mm_add_epi32(o, v_adj);
+        o                   = _mm_add_epi32(o, _mm_and_si128(_mm_cmpeq_epi32(e, v_exp), v_adj));
+        const __m128 sub    = _mm_sub_ps(
+            _mm_castsi128_ps(_mm_add_epi32(o, _mm_set1_epi32(0x00800000))),
+            _mm_castsi128_ps(_mm_set1_epi32(0x38800000)));
+        const __m128 is_sub = _mm_castsi128_ps(_mm_cmpeq_epi32(e, _mm_setzero_si128()));
+        const __m128 f      = _mm_blendv_ps(_mm_castsi128_ps(o), sub, is_sub);
+        const __m128i sign  = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16);
+        return _mm_or_ps(f, _mm_castsi128_ps(sign));
+    }
+};
+
+ppl::common::RetCode embedding_bag_fp32_sse(
+    const float *table,
+    const int64_t *indices,
+    const int64_t *offsets,
+    const int64_t *lengths,
+    const float *per_sample_weights,
+    const int64_t num_embeddings,
+    const int64_t embedding_dim,
+    const int64_t num_indices,
+    const int64_t num_bags,
+    const int32_t mode,
+    float *dst)
+{
+    return embedding_bag_fp32_common<embedding_bag_kernel_fp32_sse, EMBEDDING_TABLE_FP32>(
+        (const uint8_t *)table, indices, offsets, lengths, per_sample_weights, num_embeddings,
+        embedding_dim, num_indices, num_bags, mode, dst);
+}
+
+ppl::common::RetCode embedding_bag_quantized_fp32_sse(
+    const void *table,
+    const int32_t table_type,
+    const int64_t *indices,
+    const int64_t *offsets,
+    const int64_t *lengths,
+    const float *per_sample_weights,
+    const int64_t num_embeddings,
+    const int64_t embedding_dim,
+    const int64_t num_indices,
+    const int64_t num_bags,
+    const int32_t mode,
+    float *dst)
+{
+    return embedding_bag_quantized_fp32_common<embedding_bag_kernel_fp32_sse>(
+        table, table_type, indices, offsets, lengths, per_sample_weights, num_embeddings,
+        embedding_dim, num_indices, num_bags, mode, dst);
+}
+
+}}}; // namespace ppl::kernel::x86
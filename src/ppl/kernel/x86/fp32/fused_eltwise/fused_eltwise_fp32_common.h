@@ -0,0 +1,439 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_FP32_FUSED_ELTWISE_FUSED_ELTWISE_FP32_COMMON_H_
+#define __ST_PPL_KERNEL_X86_FP32_FUSED_ELTWISE_FUSED_ELTWISE_FP32_COMMON_H_
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/common/fused_eltwise_common.h"
+#include "ppl/kernel/x86/common/arithmetic/arithmetic_common.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+// a row is evaluated one node at a time over tiles of this many elements,
+// so the op of a node is resolved once per tile instead of once per vector
+// and the operands of a tile stay in L1
+#define PPL_X86_FUSED_ELTWISE_TILE_LEN() 128
+
+// intermediate tiles, then one tile per broadcast input
+#define PPL_X86_FUSED_ELTWISE_MAX_TILES() (PPL_X86_FUSED_ELTWISE_MAX_NODES() + PPL_X86_FUSED_ELTWISE_MAX_SRC())
+
+// y = op(a, b, c) over len elements
+typedef void (*fused_eltwise_tile_kernel_fp32_func_t)(
+    const float *a,
+    const float *b,
+    const float *c,
+    const float alpha,
+    const float beta,
+    const int64_t len,
+    float *y);
+
+// a program bound to the tile kernels of one isa
+struct fused_eltwise_kernel_fp32 {
+    int32_t num_src;
+    int32_t num_nodes;
+    fused_eltwise_tile_kernel_fp32_func_t func[PPL_X86_FUSED_ELTWISE_MAX_NODES()];
+    int32_t src[PPL_X86_FUSED_ELTWISE_MAX_NODES()][3];
+    float alpha[PPL_X86_FUSED_ELTWISE_MAX_NODES()];
+    float beta[PPL_X86_FUSED_ELTWISE_MAX_NODES()];
+    int32_t tile[PPL_X86_FUSED_ELTWISE_MAX_NODES()];
+};
+
+struct fused_eltwise_plan_fp32 {
+    int64_t dim_count;
+    int64_t dst_dims[PPL_X86_TENSOR_MAX_DIMS()];
+    int64_t src_inc[PPL_X86_FUSED_ELTWISE_MAX_SRC()][PPL_X86_TENSOR_MAX_DIMS()];
+};
+
+inline ppl::common::RetCode fused_eltwise_check_program_fp32(
+    const int32_t num_src,
+    const fused_eltwise_node *nodes,
+    const int32_t num_nodes)
+{
+    if (num_src < 0 || num_src > PPL_X86_FUSED_ELTWISE_MAX_SRC()) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+    if (num_nodes < 1 || num_nodes > PPL_X86_FUSED_ELTWISE_MAX_NODES()) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+    for (int32_t n = 0; n < num_nodes; ++n) {
+        const int32_t node_num_src = fused_eltwise_op_num_src(nodes[n].op);
+        if (node_num_src == 0) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+        for (int32_t i = 0; i < node_num_src; ++i) {
+            // operands must be inputs or nodes evaluated before this one
+            if (nodes[n].src[i] < 0 || nodes[n].src[i] >= num_src + n) {
+                return ppl::common::RC_INVALID_VALUE;
+            }
+        }
+    }
+    return ppl::common::RC_SUCCESS;
+}
+
+inline ppl::common::RetCode fused_eltwise_plan_ndarray_fp32(
+    const ppl::common::TensorShape **src_shape_list,
+    const int32_t num_src,
+    const ppl::common::TensorShape *dst_shape,
+    fused_eltwise_plan_fp32 *plan)
+{
+    const int64_t dim_count = dst_shape->GetDimCount();
+    if (dim_count > PPL_X86_TENSOR_MAX_DIMS()) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+
+    // pad 1 to input's high dims, then drop dims of length 1 in dst
+    int64_t padded_src_dims[PPL_X86_FUSED_ELTWISE_MAX_SRC()][PPL_X86_TENSOR_MAX_DIMS()];
+    int64_t real_src_dims[PPL_X86_FUSED_ELTWISE_MAX_SRC()][PPL_X86_TENSOR_MAX_DIMS()];
+    int64_t real_dst_dims[PPL_X86_TENSOR_MAX_DIMS()];
+    for (int32_t s = 0; s < num_src; ++s) {
+        if (src_shape_list[s]->GetDataFormat() != ppl::common::DATAFORMAT_NDARRAY) {
+            return ppl::common::RC_UNSUPPORTED;
+        }
+        const int64_t src_dim_count = src_shape_list[s]->GetDimCount();
+        if (src_dim_count > dim_count) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+        const int64_t dim_diff = dim_count - src_dim_count;
+        for (int64_t i = 0; i < dim_count; ++i) {
+            padded_src_dims[s][i] = i < dim_diff ? 1 : src_shape_list[s]->GetDim(i - dim_diff);
+            if (padded_src_dims[s][i] != 1 && padded_src_dims[s][i] != dst_shape->GetDim(i)) {
+                return ppl::common::RC_INVALID_VALUE;
+            }
+        }
+    }
+
+    int64_t real_dim_count = 0;
+    for (int64_t i = 0; i < dim_count; ++i) {
+        if (dst_shape->GetDim(i) == 1) {
+            continue;
+        }
+        for (int32_t s = 0; s < num_src; ++s) {
+            real_src_dims[s][real_dim_count] = padded_src_dims[s][i];
+        }
+        real_dst_dims[real_dim_count] = dst_shape->GetDim(i);
+        ++real_dim_count;
+    }
+    if (real_dim_count == 0) { // scalar or all ones
+        for (int32_t s = 0; s < num_src; ++s) {
+            real_src_dims[s][0] = 1;
+        }
+        real_dst_dims[0] = 1;
+        real_dim_count   = 1;
+    }
+
+    // merge adjacent dims which every input broadcasts the same way
+    plan->dim_count = 1;
+    plan->dst_dims[0] = real_dst_dims[0];
+    int64_t merged_src_dims[PPL_X86_FUSED_ELTWISE_MAX_SRC()][PPL_X86_TENSOR_MAX_DIMS()];
+    for (int32_t s = 0; s < num_src; ++s) {
+        merged_src_dims[s][0] = real_src_dims[s][0];
+    }
+    for (int64_t i = 1; i < real_dim_count; ++i) {
+        const int64_t last = plan->dim_count - 1;
+        bool can_merge     = true;
+        for (int32_t s = 0; s < num_src; ++s) {
+            const bool prev_bc = merged_src_dims[s][last] == 1 && plan->dst_dims[last] != 1;
+            const bool cur_bc  = real_src_dims[s][i] == 1;
+            if (prev_bc != cur_bc) {
+                can_merge = false;
+                break;
+            }
+        }
+        if (can_merge) {
+            plan->dst_dims[last] *= real_dst_dims[i];
+            for (int32_t s = 0; s < num_src; ++s) {
+                merged_src_dims[s][last] *= real_src_dims[s][i];
+            }
+        } else {
+            plan->dst_dims[plan->dim_count] = real_dst_dims[i];
+            for (int32_t s = 0; s < num_src; ++s) {
+                merged_src_dims[s][plan->dim_count] = real_src_dims[s][i];
+            }
+            ++plan->dim_count;
+        }
+    }
+
+    for (int32_t s = 0; s < num_src; ++s) {
+        int64_t stride = 1;
+        for (int64_t i = plan->dim_count - 1; i >= 0; --i) {
+            plan->src_inc[s][i] = merged_src_dims[s][i] == 1 ? 0 : stride;
+            stride *= merged_src_dims[s][i];
+        }
+    }
+
+    return ppl::common::RC_SUCCESS;
+}
+
+/*
+    vec_ops provides vec_t and simd_w, load/store/set1/zero, load_tail and
+    store_tail of the first n < simd_w lanes (load_tail zeroes the rest),
+    arithmetic<_op> from the arithmetic kernels of its isa, the math helpers
+    and blend_ge_zero(m, t, f) = m >= 0 ? t : f, blend_ne_zero(m, t, f) = m != 0 ? t : f
+*/
+template <typename vec_ops, fused_eltwise_op_t _op>
+inline typename vec_ops::vec_t fused_eltwise_vector_fp32(
+    const typename vec_ops::vec_t a,
+    const typename vec_ops::vec_t b,
+    const typename vec_ops::vec_t c,
+    const typename vec_ops::vec_t alpha,
+    const typename vec_ops::vec_t beta)
+{
+    switch (_op) {
+    case fused_eltwise_op::ADD: return vec_ops::template arithmetic<ARITHMETIC_ADD>(a, b);
+    case fused_eltwise_op::SUB: return vec_ops::template arithmetic<ARITHMETIC_SUB>(a, b);
+    case fused_eltwise_op::MUL: return vec_ops::template arithmetic<ARITHMETIC_MUL>(a, b);
+    case fused_eltwise_op::DIV: return vec_ops::template arithmetic<ARITHMETIC_DIV>(a, b);
+    case fused_eltwise_op::MAX: return vec_ops::max(a, b);
+    case fused_eltwise_op::MIN: return vec_ops::min(a, b);
+    case fused_eltwise_op::NEG: return vec_ops::neg(a);
+    case fused_eltwise_op::ABS: return vec_ops::abs(a);
+    case fused_eltwise_op::RELU: return vec_ops::max(a, vec_ops::zero());
+    case fused_eltwise_op::SIGMOID: return vec_ops::sigmoid(a);
+    case fused_eltwise_op::TANH: return vec_ops::tanh(a);
+    case fused_eltwise_op::EXP: return vec_ops::exp(a);
+    case fused_eltwise_op::ERF: return vec_ops::erf(a);
+    case fused_eltwise_op::SQRT: return vec_ops::sqrt(a);
+    case fused_eltwise_op::CLIP: return vec_ops::min(vec_ops::max(a, alpha), beta);
+    case fused_eltwise_op::LEAKY_RELU: return vec_ops::blend_ge_zero(a, a, vec_ops::template arithmetic<ARITHMETIC_MUL>(a, alpha));
+    case fused_eltwise_op::AFFINE: return vec_ops::fmadd(a, alpha, beta);
+    case fused_eltwise_op::FMA: return vec_ops::fmadd(a, b, c);
+    case fused_eltwise_op::SELECT: return vec_ops::blend_ne_zero(a, b, c);
+    default: return a;
+    }
+}
+
+template <typename vec_ops, fused_eltwise_op_t _op>
+void fused_eltwise_tile_kernel_fp32(
+    const float *a,
+    const float *b,
+    const float *c,
+    const float alpha,
+    const float beta,
+    const int64_t len,
+    float *y)
+{
+    typedef typename vec_ops::vec_t vec_t;
+    const int64_t simd_w = vec_ops::simd_w;
+    const bool has_b     = fused_eltwise_op_num_src(_op) > 1;
+    const bool has_c     = fused_eltwise_op_num_src(_op) > 2;
+    const vec_t v_alpha  = vec_ops::set1(alpha);
+    const vec_t v_beta   = vec_ops::set1(beta);
+    const vec_t v_zero   = vec_ops::zero();
+    // y may alias an operand, every vector is read before it is written
+    int64_t i = 0;
+    for (; i + simd_w <= len; i += simd_w) {
+        const vec_t v_b = has_b ? vec_ops::load(b + i) : v_zero;
+        const vec_t v_c = has_c ? vec_ops::load(c + i) : v_zero;
+        vec_ops::store(y + i, fused_eltwise_vector_fp32<vec_ops, _op>(vec_ops::load(a + i), v_b, v_c, v_alpha, v_beta));
+    }
+    if (i < len) {
+        const int64_t tail = len - i;
+        const vec_t v_b    = has_b ? vec_ops::load_tail(b + i, tail) : v_zero;
+        const vec_t v_c    = has_c ? vec_ops::load_tail(c + i, tail) : v_zero;
+        vec_ops::store_tail(y + i, fused_eltwise_vector_fp32<vec_ops, _op>(vec_ops::load_tail(a + i, tail), v_b, v_c, v_alpha, v_beta), tail);
+    }
+}
+
+// resolve every node to its tile kernel and give it a tile, a tile is
+// reused once the last node reading it has run
+template <typename vec_ops>
+void fused_eltwise_bind_kernel_fp32(
+    const int32_t num_src,
+    const fused_eltwise_node *nodes,
+    const int32_t num_nodes,
+    fused_eltwise_kernel_fp32 *kernel)
+{
+    // indexed by fused_eltwise_op_t
+    static const fused_eltwise_tile_kernel_fp32_func_t table[] = {
+        fused_eltwise_tile_kernel_fp32<vec_ops, fused_eltwise_op::ADD>,
+        fused_eltwise_tile_kernel_fp32<vec_ops, fused_eltwise_op::SUB>,
+        fused_eltwise_tile_kernel_fp32<vec_ops, fused_eltwise_op::MUL>,
+        fused_eltwise_tile_kernel_fp32<vec_ops, fused_eltwise_op::DIV>,
+        fused_eltwise_tile_kernel_fp32<vec_ops, fused_eltwise_op::MAX>,
+        fused_eltwise_tile_kernel_fp32<vec_ops, fused_eltwise_op::MIN>,
+        fused_eltwise_tile_kernel_fp32<vec_ops, fused_eltwise_op::NEG>,
+        fused_eltwise_tile_kernel_fp32<vec_ops, fused_eltwise_op::ABS>,
+        fused_eltwise_tile_kernel_fp32<vec_ops, fused_eltwise_op::RELU>,
+        fused_eltwise_tile_kernel_fp32<vec_ops, fused_eltwise_op::SIGMOID>,
+        fused_eltwise_tile_kernel_fp32<vec_ops, fused_eltwise_op::TANH>,
+        fused_eltwise_tile_kernel_fp32<vec_ops, fused_eltwise_op::EXP>,
+        fused_eltwise_tile_kernel_fp32<vec_ops, fused_eltwise_op::ERF>,
+        fused_eltwise_tile_kernel_fp32<vec_ops, fused_eltwise_op::SQRT>,
+        fused_eltwise_tile_kernel_fp32<vec_ops, fused_eltwise_op::CLIP>,
+        fused_eltwise_tile_kernel_fp32<vec_ops, fused_eltwise_op::LEAKY_RELU>,
+        fused_eltwise_tile_kernel_fp32<vec_ops, fused_eltwise_op::AFFINE>,
+        fused_eltwise_tile_kernel_fp32<vec_ops, fused_eltwise_op::FMA>,
+        fused_eltwise_tile_kernel_fp32<vec_ops, fused_eltwise_op::SELECT>,
+    };
+
+    int32_t last_use[PPL_X86_FUSED_ELTWISE_MAX_NODES()];
+    for (int32_t n = 0; n < num_nodes; ++n) {
+        last_use[n] = n == num_nodes - 1 ? num_nodes : n;
+        const int32_t node_num_src = fused_eltwise_op_num_src(nodes[n].op);
+        for (int32_t i = 0; i < node_num_src; ++i) {
+            if (nodes[n].src[i] >= num_src) {
+                last_use[nodes[n].src[i] - num_src] = n;
+            }
+        }
+    }
+
+    kernel->num_src   = num_src;
+    kernel->num_nodes = num_nodes;
+    bool tile_used[PPL_X86_FUSED_ELTWISE_MAX_NODES()] = {false};
+    for (int32_t n = 0; n < num_nodes; ++n) {
+        const int32_t node_num_src = fused_eltwise_op_num_src(nodes[n].op);
+        kernel->func[n]  = table[nodes[n].op];
+        kernel->alpha[n] = nodes[n].alpha;
+        kernel->beta[n]  = nodes[n].beta;
+        for (int32_t i = 0; i < 3; ++i) {
+            // unused operands point at the first one, which is never read
+            kernel->src[n][i] = i < node_num_src ? nodes[n].src[i] : nodes[n].src[0];
+        }
+        for (int32_t i = 0; i < node_num_src; ++i) {
+            const int32_t k = nodes[n].src[i] - num_src;
+            if (k >= 0 && last_use[k] == n) {
+                tile_used[kernel->tile[k]] = false;
+            }
+        }
+        int32_t t = 0;
+        while (tile_used[t]) {
+            ++t;
+        }
+        // the result of a dead node is dropped right away
+        tile_used[t]    = last_use[n] != n;
+        kernel->tile[n] = t;
+    }
+}
+
+template <typename vec_ops>
+void fused_eltwise_row_kernel_fp32(
+    const fused_eltwise_kernel_fp32 *kernel,
+    const float **src,
+    const int64_t *src_inc,
+    const int64_t length,
+    float *dst)
+{
+    const int64_t tile_len  = PPL_X86_FUSED_ELTWISE_TILE_LEN();
+    const int64_t src_tile0 = PPL_X86_FUSED_ELTWISE_MAX_NODES();
+    const int32_t num_src   = kernel->num_src;
+    const int32_t num_nodes = kernel->num_nodes;
+
+    alignas(PPL_X86_CACHELINE_BYTES()) float tiles[PPL_X86_FUSED_ELTWISE_MAX_TILES()][PPL_X86_FUSED_ELTWISE_TILE_LEN()];
+    const float *operand[PPL_X86_FUSED_ELTWISE_MAX_SRC() + PPL_X86_FUSED_ELTWISE_MAX_NODES()];
+
+    // a broadcast input is one value for the whole row
+    const int64_t first_len = min(length, tile_len);
+    for (int32_t s = 0; s < num_src; ++s) {
+        if (!src_inc[s]) {
+            float *l_tile = tiles[src_tile0 + s];
+            for (int64_t i = 0; i < first_len; ++i) {
+                l_tile[i] = src[s][0];
+            }
+            operand[s] = l_tile;
+        }
+    }
+
+    for (int64_t i = 0; i < length; i += tile_len) {
+        const int64_t len = min(tile_len, length - i);
+        for (int32_t s = 0; s < num_src; ++s) {
+            if (src_inc[s]) {
+                operand[s] = src[s] + i;
+            }
+        }
+        for (int32_t n = 0; n < num_nodes; ++n) {
+            float *y = n == num_nodes - 1 ? dst + i : tiles[kernel->tile[n]];
+            kernel->func[n](
+                operand[kernel->src[n][0]], operand[kernel->src[n][1]], operand[kernel->src[n][2]],
+                kernel->alpha[n], kernel->beta[n], len, y);
+            operand[num_src + n] = y;
+        }
+    }
+}
+
+template <typename vec_ops>
+ppl::common::RetCode fused_eltwise_ndarray_fp32_common(
+    const ppl::common::TensorShape **src_shape_list,
+    const float **src_list,
+    const int32_t num_src,
+    const fused_eltwise_node *nodes,
+    const int32_t num_nodes,
+    const ppl::common::TensorShape *dst_shape,
+    float *dst)
+{
+    ppl::common::RetCode rc = fused_eltwise_check_program_fp32(num_src, nodes, num_nodes);
+    if (rc != ppl::common::RC_SUCCESS) {
+        return rc;
+    }
+
+    fused_eltwise_plan_fp32 plan;
+    rc = fused_eltwise_plan_ndarray_fp32(src_shape_list, num_src, dst_shape, &plan);
+    if (rc != ppl::common::RC_SUCCESS) {
+        return rc;
+    }
+
+    fused_eltwise_kernel_fp32 kernel;
+    fused_eltwise_bind_kernel_fp32<vec_ops>(num_src, nodes, num_nodes, &kernel);
+
+    const int64_t last_dim  = plan.dim_count - 1;
+    const int64_t inner_len = plan.dst_dims[last_dim];
+    int64_t outer_len       = 1;
+    for (int64_t i = 0; i < last_dim; ++i) {
+        outer_len *= plan.dst_dims[i];
+    }
+
+    // split long rows so that a few broadcast rows still feed every thread
+    const int64_t num_threads   = PPL_OMP_MAX_THREADS();
+    const int64_t min_task_len  = 1024;
+    const int64_t task_len      = round_up(max<int64_t>(min_task_len, div_up(outer_len * inner_len, num_threads * 4)), PPL_X86_FUSED_ELTWISE_TILE_LEN());
+    const int64_t inner_blk     = min(inner_len, task_len);
+    const int64_t num_inner_blk = div_up(inner_len, inner_blk);
+
+    int64_t src_inc_last[PPL_X86_FUSED_ELTWISE_MAX_SRC()];
+    for (int32_t s = 0; s < num_src; ++s) {
+        src_inc_last[s] = plan.src_inc[s][last_dim];
+    }
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t t = 0; t < outer_len * num_inner_blk; ++t) {
+        const int64_t o     = t / num_inner_blk;
+        const int64_t i_off = (t % num_inner_blk) * inner_blk;
+        const int64_t i_len = min(inner_blk, inner_len - i_off);
+
+        const float *row_src[PPL_X86_FUSED_ELTWISE_MAX_SRC()];
+        int64_t src_off[PPL_X86_FUSED_ELTWISE_MAX_SRC()] = {0};
+        int64_t idx = o;
+        for (int64_t d = last_dim - 1; d >= 0; --d) {
+            const int64_t d_idx = idx % plan.dst_dims[d];
+            idx /= plan.dst_dims[d];
+            for (int32_t s = 0; s < num_src; ++s) {
+                src_off[s] += d_idx * plan.src_inc[s][d];
+            }
+        }
+        for (int32_t s = 0; s < num_src; ++s) {
+            row_src[s] = src_list[s] + src_off[s] + i_off * src_inc_last[s];
+        }
+
+        fused_eltwise_row_kernel_fp32<vec_ops>(&kernel, row_src, src_inc_last, i_len, dst + o * inner_len + i_off);
+    }
+
+    return ppl::common::RC_SUCCESS;
+}
+
+}}}; // namespace ppl::kernel::x86
+
+#endif
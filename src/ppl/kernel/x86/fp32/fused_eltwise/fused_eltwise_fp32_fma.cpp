@@ -0,0 +1,74 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/common/math_fma.h"
+#include "ppl/kernel/x86/fp32/arithmetic/avx/arithmetic_kernel_fp32_avx.h"
+#include "ppl/kernel/x86/fp32/fused_eltwise/fused_eltwise_fp32_common.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+// the avx arithmetic kernels, fma only adds the math helpers and fmadd
+struct fused_eltwise_vec_ops_fp32_fma {
+    typedef __m256 vec_t;
+    static const int64_t simd_w = 8;
+
+    static inline vec_t load(const float *p) { return _mm256_loadu_ps(p); }
+    static inline void store(float *p, const vec_t v) { _mm256_storeu_ps(p, v); }
+    static inline vec_t set1(const float v) { return _mm256_set1_ps(v); }
+    static inline vec_t zero() { return _mm256_setzero_ps(); }
+    static inline __m256i tail_mask(const int64_t n)
+    {
+        static const int32_t mask_table[16] = {-1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0};
+        return _mm256_loadu_si256((const __m256i *)(mask_table + 8 - n));
+    }
+    static inline vec_t load_tail(const float *p, const int64_t n) { return _mm256_maskload_ps(p, tail_mask(n)); }
+    static inline void store_tail(float *p, const vec_t v, const int64_t n) { _mm256_maskstore_ps(p, tail_mask(n), v); }
+
+    template <arithmetic_op_type_t _op>
+    static inline vec_t arithmetic(const vec_t a, const vec_t b) { return arithmetic_vector_kernel_fp32_avx<_op>(a, b); }
+
+    static inline vec_t max(const vec_t a, const vec_t b) { return _mm256_max_ps(a, b); }
+    static inline vec_t min(const vec_t a, const vec_t b) { return _mm256_min_ps(a, b); }
+    static inline vec_t neg(const vec_t a) { return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f)); }
+    static inline vec_t abs(const vec_t a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+    static inline vec_t sigmoid(const vec_t a) { return _fma_sigmoid_ps(a); }
+    static inline vec_t tanh(const vec_t a) { return _fma_tanh_ps(a); }
+    static inline vec_t exp(const vec_t a) { return _fma_exp_ps(a); }
+    static inline vec_t erf(const vec_t a) { return _fma_erf_ps(a); }
+    static inline vec_t sqrt(const vec_t a) { return _mm256_sqrt_ps(a); }
+    static inline vec_t fmadd(const vec_t a, const vec_t b, const vec_t c) { return _mm256_fmadd_ps(a, b, c); }
+    static inline vec_t blend_ge_zero(const vec_t m, const vec_t t, const vec_t f) { return _mm256_blendv_ps(f, t, _mm256_cmp_ps(m, _mm256_setzero_ps(), _CMP_GE_OQ)); }
+    static inline vec_t blend_ne_zero(const vec_t m, const vec_t t, const vec_t f) { return _mm256_blendv_ps(f, t, _mm256_cmp_ps(m, _mm256_setzero_ps(), _CMP_NEQ_UQ)); }
+};
+
+ppl::common::RetCode fused_eltwise_fp32_fma(
+    const ppl::common::TensorShape **src_shape_list,
+    const float **src_list,
+    const int32_t num_src,
+    const fused_eltwise_node *nodes,
+    const int32_t num_nodes,
+    const ppl::common::TensorShape *dst_shape,
+    float *dst)
+{
+    return fused_eltwise_ndarray_fp32_common<fused_eltwise_vec_ops_fp32_fma>(
+        src_shape_list, src_list, num_src, nodes, num_nodes, dst_shape, dst);
+}
+
+}}}; // namespace ppl::kernel::x86
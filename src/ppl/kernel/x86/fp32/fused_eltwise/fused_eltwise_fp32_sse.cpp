@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <nmmintrin.h>
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/common/math_sse.h"
+#include "ppl/kernel/x86/fp32/arithmetic/sse/arithmetic_kernel_fp32_sse.h"
+#include "ppl/kernel/x86/fp32/fused_eltwise/fused_eltwise_fp32_common.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+struct fused_eltwise_vec_ops_fp32_sse {
+    typedef __m128 vec_t;
+    static const int64_t simd_w = 4;
+
+    static inline vec_t load(const float *p) { return _mm_loadu_ps(p); }
+    static inline void store(float *p, const vec_t v) { _mm_storeu_ps(p, v); }
+    static inline vec_t set1(const float v) { return _mm_set1_ps(v); }
+    static inline vec_t zero() { return _mm_setzero_ps(); }
+    static inline vec_t load_tail(const float *p, const int64_t n)
+    {
+        if (n == 1) return _mm_load_ss(p);
+        const __m128 lo = _mm_castpd_ps(_mm_load_sd((const double *)p));
+        return n == 2 ? lo : _mm_movelh_ps(lo, _mm_load_ss(p + 2));
+    }
+    static inline void store_tail(float *p, const vec_t v, const int64_t n)
+    {
+        if (n == 1) {
+            _mm_store_ss(p, v);
+            return;
+        }
+        _mm_storel_pi((__m64 *)p, v);
+        if (n == 3) _mm_store_ss(p + 2, _mm_movehl_ps(v, v));
+    }
+
+    template <arithmetic_op_type_t _op>
+    static inline vec_t arithmetic(const vec_t a, const vec_t b) { return arithmetic_vector_kernel_fp32_sse<_op>(a, b); }
+
+    static inline vec_t max(const vec_t a, const vec_t b) { return _mm_max_ps(a, b); }
+    static inline vec_t min(const vec_t a, const vec_t b) { return _mm_min_ps(a, b); }
+    static inline vec_t neg(const vec_t a) { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+    static inline vec_t abs(const vec_t a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+    static inline vec_t sigmoid(const vec_t a) { return _sse_sigmoid_ps(a); }
+    static inline vec_t tanh(const vec_t a) { return _sse_tanh_ps(a); }
+    static inline vec_t exp(const vec_t a) { return _sse_exp_ps(a); }
+    static inline vec_t erf(const vec_t a) { return _sse_erf_ps(a); }
+    static inline vec_t sqrt(const vec_t a) { return _mm_sqrt_ps(a); }
+    static inline vec_t fmadd(const vec_t a, const vec_t b, const vec_t c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+    static inline vec_t blend_ge_zero(const vec_t m, const vec_t t, const vec_t f) { return _mm_blendv_ps(f, t, _mm_cmpge_ps(m, _mm_setzero_ps())); }
+    static inline vec_t blend_ne_zero(const vec_t m, const vec_t t, const vec_t f) { return _mm_blendv_ps(f, t, _mm_cmpneq_ps(m, _mm_setzero_ps())); }
+};
+
+ppl::common::RetCode fused_eltwise_fp32_sse(
+    const ppl::common::TensorShape **src_shape_list,
+    const float **src_list,
+    const int32_t num_src,
+    const fused_eltwise_node *nodes,
+    const int32_t num_nodes,
+    const ppl::common::TensorShape *dst_shape,
+    float *dst)
+{
+    return fused_eltwise_ndarray_fp32_common<fused_eltwise_vec_ops_fp32_sse>(
+        src_shape_list, src_list, num_src, nodes, num_nodes, dst_shape, dst);
+}
+
+}}}; // namespace ppl::kernel::x86
@@ -0,0 +1,134 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_FP32_GEMM_GEMM_BATCH_PTR_FP32_H_
+#define __ST_PPL_KERNEL_X86_FP32_GEMM_GEMM_BATCH_PTR_FP32_H_
+
+#include "ppl/kernel/x86/common/internal_include.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+inline int64_t gemm_batch_count(
+    const int64_t batch_dim_count,
+    const int64_t *batch_dims)
+{
+    int64_t batch = 1;
+    for (int64_t i = 0; i < batch_dim_count; ++i) {
+        batch *= batch_dims[i];
+    }
+    return batch;
+}
+
+// Resolve the matrices of the b-th gemm from pointer lists
+class gemm_batch_list_ptr_fp32 {
+public:
+    gemm_batch_list_ptr_fp32(
+        const float **A_list,
+        const float **B_list,
+        const float **bias_list,
+        const float **sum_list,
+        float **C_list)
+        : A_list_(A_list)
+        , B_list_(B_list)
+        , bias_list_(bias_list)
+        , sum_list_(sum_list)
+        , C_list_(C_list) {}
+
+    inline const float *A(const int64_t b) const { return A_list_[b]; }
+    inline const float *B(const int64_t b) const { return B_list_[b]; }
+    inline const float *bias(const int64_t b) const { return bias_list_ ? bias_list_[b] : nullptr; }
+    inline const float *sum(const int64_t b) const { return sum_list_ ? sum_list_[b] : nullptr; }
+    inline float *C(const int64_t b) const { return C_list_[b]; }
+
+private:
+    const float **A_list_;
+    const float **B_list_;
+    const float **bias_list_;
+    const float **sum_list_;
+    float **C_list_;
+};
+
+// Resolve the matrices of the b-th gemm from base pointers and per batch dimension strides.
+// b is the flattened row-major index over batch_dims, a zero stride broadcasts along that dimension
+// and a null stride array means the operand is shared by all gemms.
+// batch_dims and the stride arrays are borrowed, they must outlive the resolver.
+class gemm_batch_strided_ptr_fp32 {
+public:
+    gemm_batch_strided_ptr_fp32(
+        const float *A,
+        const float *B,
+        const float *bias,
+        const float *sum,
+        float *C,
+        const int64_t batch_dim_count,
+        const int64_t *batch_dims,
+        const int64_t *A_batch_strides,
+        const int64_t *B_batch_strides,
+        const int64_t *bias_batch_strides,
+        const int64_t *sum_batch_strides,
+        const int64_t *C_batch_strides)
+        : A_(A)
+        , B_(B)
+        , bias_(bias)
+        , sum_(sum)
+        , C_(C)
+        , batch_dim_count_(batch_dim_count)
+        , batch_dims_(batch_dims)
+        , A_batch_strides_(A_batch_strides)
+        , B_batch_strides_(B_batch_strides)
+        , bias_batch_strides_(bias_batch_strides)
+        , sum_batch_strides_(sum_batch_strides)
+        , C_batch_strides_(C_batch_strides) {}
+
+    inline const float *A(const int64_t b) const { return A_ + offset(b, A_batch_strides_); }
+    inline const float *B(const int64_t b) const { return B_ + offset(b, B_batch_strides_); }
+    inline const float *bias(const int64_t b) const { return bias_ ? bias_ + offset(b, bias_batch_strides_) : nullptr; }
+    inline const float *sum(const int64_t b) const { return sum_ ? sum_ + offset(b, sum_batch_strides_) : nullptr; }
+    inline float *C(const int64_t b) const { return C_ + offset(b, C_batch_strides_); }
+
+private:
+    // a div/mod per batch dimension, once per gemm task, is cheaper than
+    // building offset tables on every call
+    inline int64_t offset(const int64_t b, const int64_t *strides) const
+    {
+        if (!strides || b == 0) return 0;
+        int64_t ofs = 0;
+        int64_t idx = b;
+        for (int64_t i = batch_dim_count_ - 1; i >= 0 && idx > 0; --i) {
+            ofs += (idx % batch_dims_[i]) * strides[i];
+            idx /= batch_dims_[i];
+        }
+        return ofs;
+    }
+
+    const float *A_;
+    const float *B_;
+    const float *bias_;
+    const float *sum_;
+    float *C_;
+    const int64_t batch_dim_count_;
+    const int64_t *batch_dims_;
+    const int64_t *A_batch_strides_;
+    const int64_t *B_batch_strides_;
+    const int64_t *bias_batch_strides_;
+    const int64_t *sum_batch_strides_;
+    const int64_t *C_batch_strides_;
+};
+
+}}}; // namespace ppl::kernel::x86
+
+#endif
@@ -17,6 +17,7 @@
 
 #include "ppl/kernel/x86/common/internal_include.h"
 #include "ppl/kernel/x86/fp32/gemm.h"
+#include "ppl/kernel/x86/fp32/gemm/gemm_batch_ptr_fp32.h"
 
 namespace ppl { namespace kernel { namespace x86 {
 
@@ -130,11 +131,9 @@ ppl::common::RetCode gemm_fp32_ref(
     return ppl::common::RC_SUCCESS;
 }
 
-ppl::common::RetCode batch_gemm_fp32_ref(
-    const float **A_list,
-    const float **B_list,
-    const float **bias_list,
-    const float **sum_list,
+template <typename batch_ptr_t>
+static ppl::common::RetCode batch_gemm_operation_fp32_ref(
+    const batch_ptr_t &ptrs,
     const gemm_m_type_t typeA,
     const gemm_m_type_t typeB,
     const gemm_v_type_t typebias,
@@ -151,8 +150,7 @@ ppl::common::RetCode batch_gemm_fp32_ref(
     const float beta,
     const float beta_bias,
     const float beta_sum,
-    const gemm_post_t post,
-    float **C_list)
+    const gemm_post_t post)
 {
     if (typeA == gemm_m_type::PACKED) {
         return ppl::common::RC_UNSUPPORTED;
@@ -169,11 +167,11 @@ ppl::common::RetCode batch_gemm_fp32_ref(
         PRAGMA_OMP_PARALLEL_FOR()
 #endif
             for (int64_t n = 0; n < N; ++n) {
-                auto A = A_list[b];
-                auto B = B_list[b];
-                auto C = C_list[b];
-                auto sum = sum_list ? sum_list[b] : nullptr;
-                auto bias = bias_list ? bias_list[b] : nullptr;
+                auto A = ptrs.A(b);
+                auto B = ptrs.B(b);
+                auto C = ptrs.C(b);
+                auto sum = ptrs.sum(b);
+                auto bias = ptrs.bias(b);
                 float y = 0.0f;
                 if (alpha != 0.0f && typeA != gemm_m_type::EMPTY && typeB != gemm_m_type::EMPTY) {
                     if (!trans_A && !trans_B) { // MK, KN; NN
@@ -208,6 +206,80 @@ ppl::common::RetCode batch_gemm_fp32_ref(
     return ppl::common::RC_SUCCESS;
 }
 
+ppl::common::RetCode batch_gemm_fp32_ref(
+    const float **A_list,
+    const float **B_list,
+    const float **bias_list,
+    const float **sum_list,
+    const gemm_m_type_t typeA,
+    const gemm_m_type_t typeB,
+    const gemm_v_type_t typebias,
+    const gemm_m_type_t typesum,
+    const int64_t batch,
+    const int64_t M,
+    const int64_t N,
+    const int64_t K,
+    const int64_t lda,
+    const int64_t ldb,
+    const int64_t ldc,
+    const int64_t ldsum,
+    const float alpha,
+    const float beta,
+    const float beta_bias,
+    const float beta_sum,
+    const gemm_post_t post,
+    float **C_list)
+{
+    return batch_gemm_operation_fp32_ref(
+        gemm_batch_list_ptr_fp32(A_list, B_list, bias_list, sum_list, C_list),
+        typeA, typeB, typebias, typesum,
+        batch, M, N, K, lda, ldb, ldc, ldsum,
+        alpha, beta, beta_bias, beta_sum, post);
+}
+
+ppl::common::RetCode strided_batch_gemm_fp32_ref(
+    const float *A,
+    const float *B,
+    const float *bias,
+    const float *sum,
+    const gemm_m_type_t typeA,
+    const gemm_m_type_t typeB,
+    const gemm_v_type_t typebias,
+    const gemm_m_type_t typesum,
+    const int64_t batch_dim_count,
+    const int64_t *batch_dims,
+    const int64_t *A_batch_strides,
+    const int64_t *B_batch_strides,
+    const int64_t *bias_batch_strides,
+    const int64_t *sum_batch_strides,
+    const int64_t *C_batch_strides,
+    const int64_t M,
+    const int64_t N,
+    const int64_t K,
+    const int64_t lda,
+    const int64_t ldb,
+    const int64_t ldc,
+    const int64_t ldsum,
+    const float alpha,
+    const float beta,
+    const float beta_bias,
+    const float beta_sum,
+    const gemm_post_t post,
+    float *C)
+{
+    return batch_gemm_operation_fp32_ref(
+        gemm_batch_strided_ptr_fp32(
+            A, B, bias, sum, C,
+            batch_dim_count, batch_dims,
+            A_batch_strides, B_batch_strides,
+            bias_batch_strides, sum_batch_strides,
+            C_batch_strides),
+        typeA, typeB, typebias, typesum,
+        gemm_batch_count(batch_dim_count, batch_dims),
+        M, N, K, lda, ldb, ldc, ldsum,
+        alpha, beta, beta_bias, beta_sum, post);
+}
+
 uint64_t gemm_fp32_get_packed_b_bytes(
     const ppl::common::isa_t isa,
     const int64_t N,
@@ -367,4 +439,86 @@ ppl::common::RetCode batch_gemm_fp32(
             post, C_list);
 }
 
+
+ppl::common::RetCode strided_batch_gemm_fp32(
+    const ppl::common::isa_t isa,
+    const float *A,
+    const float *B,
+    const float *bias,
+    const float *sum,
+    const gemm_m_type_t typeA,
+    const gemm_m_type_t typeB,
+    const gemm_v_type_t typebias,
+    const gemm_m_type_t typesum,
+    const int64_t batch_dim_count,
+    const int64_t *batch_dims,
+    const int64_t *A_batch_strides,
+    const int64_t *B_batch_strides,
+    const int64_t *bias_batch_strides,
+    const int64_t *sum_batch_strides,
+    const int64_t *C_batch_strides,
+    const int64_t M,
+    const int64_t N,
+    const int64_t K,
+    const int64_t lda,
+    const int64_t ldb,
+    const int64_t ldc,
+    const int64_t ldsum,
+    const float alpha,
+    const float beta,
+    const float beta_bias,
+    const float beta_sum,
+    const gemm_post_t post,
+    float *C)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return strided_batch_gemm_fp32_avx512(
+            A, B, bias, sum,
+            typeA, typeB, typebias, typesum,
+            batch_dim_count, batch_dims,
+            A_batch_strides, B_batch_strides,
+            bias_batch_strides, sum_batch_strides,
+            C_batch_strides,
+            M, N, K, lda, ldb, ldc, ldsum,
+            alpha, beta, beta_bias, beta_sum,
+            post, C);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_FMA) {
+        return strided_batch_gemm_fp32_fma(
+            A, B, bias, sum,
+            typeA, typeB, typebias, typesum,
+            batch_dim_count, batch_dims,
+            A_batch_strides, B_batch_strides,
+            bias_batch_strides, sum_batch_strides,
+            C_batch_strides,
+            M, N, K, lda, ldb, ldc, ldsum,
+            alpha, beta, beta_bias, beta_sum,
+            post, C);
+    }
+    if (isa & ppl::common::ISA_X86_SSE) {
+        return strided_batch_gemm_fp32_sse(
+            A, B, bias, sum,
+            typeA, typeB, typebias, typesum,
+            batch_dim_count, batch_dims,
+            A_batch_strides, B_batch_strides,
+            bias_batch_strides, sum_batch_strides,
+            C_batch_strides,
+            M, N, K, lda, ldb, ldc, ldsum,
+            alpha, beta, beta_bias, beta_sum,
+            post, C);
+    }
+    return strided_batch_gemm_fp32_ref(
+            A, B, bias, sum,
+            typeA, typeB, typebias, typesum,
+            batch_dim_count, batch_dims,
+            A_batch_strides, B_batch_strides,
+            bias_batch_strides, sum_batch_strides,
+            C_batch_strides,
+            M, N, K, lda, ldb, ldc, ldsum,
+            alpha, beta, beta_bias, beta_sum,
+            post, C);
+}
+
 }}}; // namespace ppl::kernel::x86
@@ -21,6 +21,8 @@
 #include "ppl/kernel/x86/fp32/gemm/gemm_kernel_fp32_avx512.h"
 #include "ppl/kernel/x86/common/array_param_helper.h"
 #include "ppl/kernel/x86/fp32/gemm.h"
+#include "ppl/kernel/x86/fp32/gemm/gemm_batch_ptr_fp32.h"
+#include "ppl/kernel/x86/fp32/gemm/gemm_small_fp32.h"
 #include "ppl/common/generic_cpu_allocator.h"
 #include "ppl/kernel/x86/fp32/gemm/gemm_base_operation_fp32_avx.h"
 #include "ppl/kernel/x86/common/threading_tools.h"
@@ -78,8 +80,10 @@ ppl::common::RetCode gemm_packed_b_operation_fp32_avx512(
     // blocking
     int64_t k_blk = K;
     int64_t k_blk_max = K_L2_BLK_MAX;
-    if (M <= gemm_kernel_fp32_avx512::config::MAX_M_BLK) k_blk_max = K_L1_BLK_MAX_SMALL_M;
-    if ((flags & opt_flag::large_c) && (flags & opt_flag::multi_thread)) k_blk_max *= 2; // avoid write c too many times
+    if (!get_reproducible_mode()) { // M here is per thread, k blocking must not follow the thread partition in reproducible mode
+        if (M <= gemm_kernel_fp32_avx512::config::MAX_M_BLK) k_blk_max = K_L1_BLK_MAX_SMALL_M;
+        if ((flags & opt_flag::large_c) && (flags & opt_flag::multi_thread)) k_blk_max *= 2; // avoid write c too many times
+    }
     if (k_blk >= 2 * k_blk_max) k_blk = k_blk_max;
     else if (k_blk >= 1.5 * k_blk_max) k_blk = div_up(k_blk, 2);
 
@@ -662,7 +666,7 @@ ppl::common::RetCode gemm_shared_pack_b_threaded_operation_fp32_avx512(
 
     // blocking
     int64_t k_blk = K;
-    if (flags & opt_flag::large_c) { // avoid write c too many times
+    if ((flags & opt_flag::large_c) && !get_reproducible_mode()) { // avoid write c too many times
         if (k_blk >= 4 * K_L2_BLK_MAX) k_blk = 2 * K_L2_BLK_MAX;
         else if (k_blk >= 3 * K_L2_BLK_MAX) k_blk = div_up(k_blk, 2);
     } else {
@@ -880,6 +884,15 @@ ppl::common::RetCode gemm_fp32_avx512(
         return ppl::common::RC_UNSUPPORTED;
     }
 
+    if (gemm_small_fp32_check(typeA, M, N, K)) {
+        return gemm_small_fp32_avx512(
+            A, B, bias, sum,
+            typeA, typeB, typebias, typesum,
+            M, N, K, lda, ldb, ldc, ldsum,
+            alpha, beta, beta_bias, beta_sum,
+            post, C);
+    }
+
     const bool is_packed_b = typeB == gemm_m_type::PACKED;
     const int64_t n_div = is_packed_b ? gemm_kernel_fp32_avx512::config::MAX_N_BLK : gemm_kernel_fp32_avx512::config::N_REG_ELTS;
     
@@ -1025,11 +1038,9 @@ ppl::common::RetCode gemm_fp32_avx512(
     return ppl::common::RC_SUCCESS;
 }
 
-ppl::common::RetCode batch_gemm_fp32_avx512(
-    const float **A_list,
-    const float **B_list,
-    const float **bias_list,
-    const float **sum_list,
+template <typename batch_ptr_t>
+static ppl::common::RetCode batch_gemm_operation_fp32_avx512(
+    const batch_ptr_t &ptrs,
     const gemm_m_type_t typeA,
     const gemm_m_type_t typeB,
     const gemm_v_type_t typebias,
@@ -1046,55 +1057,33 @@ ppl::common::RetCode batch_gemm_fp32_avx512(
     const float beta,
     const float beta_bias,
     const float beta_sum,
-    const gemm_post_t post,
-    float **C_list)
+    const gemm_post_t post)
 {
-    if (batch == 1) {
-        return gemm_fp32_avx512(
-            *A_list, *B_list, bias_list ? *bias_list : nullptr, sum_list ? *sum_list : nullptr,
-            typeA, typeB, typebias, typesum,
-            M, N, K, lda, ldb ,ldc ,ldsum,
-            alpha, beta, beta_bias, beta_sum, post, *C_list);
-    }
-
-    if (M <= 0 || N <= 0 || K < 0) {
-        return ppl::common::RC_SUCCESS;
-    }
-
-    if (typeA == gemm_m_type::PACKED) {
-        return ppl::common::RC_UNSUPPORTED;
-    }
-
-    if (typesum != gemm_m_type::EMPTY && typesum != gemm_m_type::NOTRANS) {
-        return ppl::common::RC_UNSUPPORTED;
-    }
-
     const bool is_packed_b = typeB == gemm_m_type::PACKED;
     const int64_t n_div = is_packed_b ? gemm_kernel_fp32_avx512::config::MAX_N_BLK : gemm_kernel_fp32_avx512::config::N_REG_ELTS;
-    
-    if (!is_packed_b) {
-        if ((typeA == gemm_m_type::NOTRANS || lda == 1) && M == 1) {
-            return batch_gemv_fp32_fma(
-                A_list, B_list, bias_list, sum_list,
-                gemm_v_type::ROW_VEC, typeB, typebias, typesum,
-                batch, N, K, ldb,
-                alpha, beta, beta_bias, beta_sum, post, C_list);
-        }
 
-        if (N == 1 && ((typeB == gemm_m_type::NOTRANS && ldb == 1) || (typeB == gemm_m_type::TRANS && ldb == K)) && ldc == 1) {
-            auto l_typeA = typeA == gemm_m_type::NOTRANS ? gemm_m_type::TRANS : gemm_m_type::NOTRANS;
-            auto l_typebias = typebias;
-            if (typebias == gemm_v_type::ROW_VEC) l_typebias = gemm_v_type::COL_VEC;
-            if (typebias == gemm_v_type::COL_VEC) l_typebias = gemm_v_type::ROW_VEC;
-            return batch_gemv_fp32_fma(
-                B_list, A_list, bias_list, sum_list,
-                gemm_v_type::ROW_VEC, l_typeA, l_typebias, typesum,
-                batch, M, K, lda,
-                alpha, beta, beta_bias, beta_sum, post, C_list);
+    const int64_t num_threads = PPL_OMP_MAX_THREADS();
+
+    if (gemm_small_fp32_check(typeA, M, N, K)) {
+        std::vector<ppl::common::RetCode> thread_ret(num_threads, ppl::common::RC_SUCCESS);
+        PRAGMA_OMP_PARALLEL_FOR()
+        for (int64_t b = 0; b < batch; ++b) {
+            auto ret = gemm_small_fp32_avx512(
+                ptrs.A(b), ptrs.B(b), ptrs.bias(b), ptrs.sum(b),
+                typeA, typeB, typebias, typesum,
+                M, N, K, lda, ldb, ldc, ldsum,
+                alpha, beta, beta_bias, beta_sum,
+                post, ptrs.C(b));
+            if (ret != ppl::common::RC_SUCCESS) {
+                thread_ret[PPL_OMP_THREAD_ID()] = ret;
+            }
         }
+        for (int64_t t = 0; t < num_threads; ++t) {
+            if (thread_ret[t] != ppl::common::RC_SUCCESS) return thread_ret[t];
+        }
+        return ppl::common::RC_SUCCESS;
     }
 
-    const int64_t num_threads = PPL_OMP_MAX_THREADS();
     const uint64_t l3_size = ppl::common::GetCpuCacheL3() == 0 ? (num_threads * 2048 * 1024) : ppl::common::GetCpuCacheL3();
     opt_flag_t flags = 0;
 
@@ -1102,10 +1091,10 @@ ppl::common::RetCode batch_gemm_fp32_avx512(
         if (M * N * sizeof(float) > l3_size * 2) flags |= opt_flag::large_c;
         for (int64_t b = 0; b < batch; ++b) {
             auto ret = gemm_operation_fp32_avx512(
-                A_list[b], B_list[b], bias_list ? bias_list[b] : nullptr, sum_list ? sum_list[b] : nullptr,
+                ptrs.A(b), ptrs.B(b), ptrs.bias(b), ptrs.sum(b),
                 typeA, typeB, typebias, typesum,
                 M, N, K, lda, ldb ,ldc ,ldsum,
-                alpha, beta, beta_bias, beta_sum, post, flags, C_list[b]);
+                alpha, beta, beta_bias, beta_sum, post, flags, ptrs.C(b));
             if (ppl::common::RC_SUCCESS != ret) {
                 return ret;
             }
@@ -1116,19 +1105,21 @@ ppl::common::RetCode batch_gemm_fp32_avx512(
         flags |= opt_flag::multi_thread;
     }
 
+    // shared_packed_b syncs the m threads of one gemm on a single packed B, so it can not span batches.
+    // with a batch to feed every thread, each thread packs the B of its own gemm in the loop below instead
     bool use_shared_packed_b = false;
-    if (N >= N_THR_BLK_MIN * 2) {
+    if (N >= N_THR_BLK_MIN * 2 && batch < num_threads) {
         if (M >= num_threads * M_L3_BLK_MAX / 4) {
             use_shared_packed_b = is_packed_b ? false : true;
         }
     }
-    if (use_shared_packed_b) { // shared_packed_b do not support and do not need multi batch threading
+    if (use_shared_packed_b) {
         for (int64_t b = 0; b < batch; ++b) {
             auto ret = gemm_fp32_avx512(
-                A_list[b], B_list[b], bias_list ? bias_list[b] : nullptr, sum_list ? sum_list[b] : nullptr,
+                ptrs.A(b), ptrs.B(b), ptrs.bias(b), ptrs.sum(b),
                 typeA, typeB, typebias, typesum,
                 M, N, K, lda, ldb ,ldc ,ldsum,
-                alpha, beta, beta_bias, beta_sum, post, C_list[b]);
+                alpha, beta, beta_bias, beta_sum, post, ptrs.C(b));
             if (ppl::common::RC_SUCCESS != ret) {
                 return ret;
             }
@@ -1188,14 +1179,14 @@ ppl::common::RetCode batch_gemm_fp32_avx512(
         nb *= n_div;
         nb_eff = max<int64_t>(min(nb_eff * n_div, N - nb), 0);
 
-        const float *lA = A_list[b];
+        const float *lA = ptrs.A(b);
         if (typeA == gemm_m_type::NOTRANS) {
             lA += mb * lda;
         } else {
             lA += mb;
         }
 
-        const float *lB = B_list[b];
+        const float *lB = ptrs.B(b);
         if (typeB == gemm_m_type::PACKED) {
             lB += nb * K;
         } else if (typeB == gemm_m_type::NOTRANS) {
@@ -1204,19 +1195,19 @@ ppl::common::RetCode batch_gemm_fp32_avx512(
             lB += nb * ldb;
         }
 
-        const float *lbias = bias_list ? bias_list[b] : nullptr;
+        const float *lbias = ptrs.bias(b);
         if (typebias == gemm_v_type::COL_VEC) {
             lbias += mb;
         } else if (typebias == gemm_v_type::ROW_VEC) {
             lbias += nb;
         }
 
-        const float *lsum = sum_list ? sum_list[b] : nullptr;
+        const float *lsum = ptrs.sum(b);
         if (typesum == gemm_m_type::NOTRANS) {
             lsum += mb * ldsum + nb;
         }
 
-        float *lC = C_list[b] + mb * ldc + nb;
+        float *lC = ptrs.C(b) + mb * ldc + nb;
 
 
         auto ret = gemm_operation_fp32_avx512(
@@ -1236,4 +1227,174 @@ ppl::common::RetCode batch_gemm_fp32_avx512(
     return ppl::common::RC_SUCCESS;
 }
 
+ppl::common::RetCode batch_gemm_fp32_avx512(
+    const float **A_list,
+    const float **B_list,
+    const float **bias_list,
+    const float **sum_list,
+    const gemm_m_type_t typeA,
+    const gemm_m_type_t typeB,
+    const gemm_v_type_t typebias,
+    const gemm_m_type_t typesum,
+    const int64_t batch,
+    const int64_t M,
+    const int64_t N,
+    const int64_t K,
+    const int64_t lda,
+    const int64_t ldb,
+    const int64_t ldc,
+    const int64_t ldsum,
+    const float alpha,
+    const float beta,
+    const float beta_bias,
+    const float beta_sum,
+    const gemm_post_t post,
+    float **C_list)
+{
+    if (batch == 1) {
+        return gemm_fp32_avx512(
+            *A_list, *B_list, bias_list ? *bias_list : nullptr, sum_list ? *sum_list : nullptr,
+            typeA, typeB, typebias, typesum,
+            M, N, K, lda, ldb ,ldc ,ldsum,
+            alpha, beta, beta_bias, beta_sum, post, *C_list);
+    }
+
+    if (M <= 0 || N <= 0 || K < 0) {
+        return ppl::common::RC_SUCCESS;
+    }
+
+    if (typeA == gemm_m_type::PACKED) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+
+    if (typesum != gemm_m_type::EMPTY && typesum != gemm_m_type::NOTRANS) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+
+    const bool is_packed_b = typeB == gemm_m_type::PACKED;
+    
+    if (!is_packed_b) {
+        if ((typeA == gemm_m_type::NOTRANS || lda == 1) && M == 1) {
+            return batch_gemv_fp32_fma(
+                A_list, B_list, bias_list, sum_list,
+                gemm_v_type::ROW_VEC, typeB, typebias, typesum,
+                batch, N, K, ldb,
+                alpha, beta, beta_bias, beta_sum, post, C_list);
+        }
+
+        if (N == 1 && ((typeB == gemm_m_type::NOTRANS && ldb == 1) || (typeB == gemm_m_type::TRANS && ldb == K)) && ldc == 1) {
+            auto l_typeA = typeA == gemm_m_type::NOTRANS ? gemm_m_type::TRANS : gemm_m_type::NOTRANS;
+            auto l_typebias = typebias;
+            if (typebias == gemm_v_type::ROW_VEC) l_typebias = gemm_v_type::COL_VEC;
+            if (typebias == gemm_v_type::COL_VEC) l_typebias = gemm_v_type::ROW_VEC;
+            return batch_gemv_fp32_fma(
+                B_list, A_list, bias_list, sum_list,
+                gemm_v_type::ROW_VEC, l_typeA, l_typebias, typesum,
+                batch, M, K, lda,
+                alpha, beta, beta_bias, beta_sum, post, C_list);
+        }
+    }
+
+    return batch_gemm_operation_fp32_avx512(
+        gemm_batch_list_ptr_fp32(A_list, B_list, bias_list, sum_list, C_list),
+        typeA, typeB, typebias, typesum,
+        batch, M, N, K, lda, ldb, ldc, ldsum,
+        alpha, beta, beta_bias, beta_sum, post);
+}
+
+ppl::common::RetCode strided_batch_gemm_fp32_avx512(
+    const float *A,
+    const float *B,
+    const float *bias,
+    const float *sum,
+    const gemm_m_type_t typeA,
+    const gemm_m_type_t typeB,
+    const gemm_v_type_t typebias,
+    const gemm_m_type_t typesum,
+    const int64_t batch_dim_count,
+    const int64_t *batch_dims,
+    const int64_t *A_batch_strides,
+    const int64_t *B_batch_strides,
+    const int64_t *bias_batch_strides,
+    const int64_t *sum_batch_strides,
+    const int64_t *C_batch_strides,
+    const int64_t M,
+    const int64_t N,
+    const int64_t K,
+    const int64_t lda,
+    const int64_t ldb,
+    const int64_t ldc,
+    const int64_t ldsum,
+    const float alpha,
+    const float beta,
+    const float beta_bias,
+    const float beta_sum,
+    const gemm_post_t post,
+    float *C)
+{
+    const int64_t batch = gemm_batch_count(batch_dim_count, batch_dims);
+    if (batch <= 0 || M <= 0 || N <= 0 || K < 0) {
+        return ppl::common::RC_SUCCESS;
+    }
+
+    if (typeA == gemm_m_type::PACKED) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+
+    if (typesum != gemm_m_type::EMPTY && typesum != gemm_m_type::NOTRANS) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+
+    const gemm_batch_strided_ptr_fp32 ptrs(
+        A, B, bias, sum, C,
+        batch_dim_count, batch_dims,
+        A_batch_strides, B_batch_strides,
+        bias_batch_strides, sum_batch_strides,
+        C_batch_strides);
+
+    if (batch == 1) {
+        return gemm_fp32_avx512(
+            ptrs.A(0), ptrs.B(0), ptrs.bias(0), ptrs.sum(0),
+            typeA, typeB, typebias, typesum,
+            M, N, K, lda, ldb ,ldc ,ldsum,
+            alpha, beta, beta_bias, beta_sum, post, ptrs.C(0));
+    }
+
+    if (typeB != gemm_m_type::PACKED) {
+        if ((typeA == gemm_m_type::NOTRANS || lda == 1) && M == 1) {
+            return strided_batch_gemv_fp32_fma(
+                A, B, bias, sum,
+                gemm_v_type::ROW_VEC, typeB, typebias, typesum,
+                batch_dim_count, batch_dims,
+                A_batch_strides, B_batch_strides,
+                bias_batch_strides, sum_batch_strides,
+                C_batch_strides,
+                N, K, ldb,
+                alpha, beta, beta_bias, beta_sum, post, C);
+        }
+
+        if (N == 1 && ((typeB == gemm_m_type::NOTRANS && ldb == 1) || (typeB == gemm_m_type::TRANS && ldb == K)) && ldc == 1) {
+            auto l_typeA = typeA == gemm_m_type::NOTRANS ? gemm_m_type::TRANS : gemm_m_type::NOTRANS;
+            auto l_typebias = typebias;
+            if (typebias == gemm_v_type::ROW_VEC) l_typebias = gemm_v_type::COL_VEC;
+            if (typebias == gemm_v_type::COL_VEC) l_typebias = gemm_v_type::ROW_VEC;
+            return strided_batch_gemv_fp32_fma(
+                B, A, bias, sum,
+                gemm_v_type::ROW_VEC, l_typeA, l_typebias, typesum,
+                batch_dim_count, batch_dims,
+                B_batch_strides, A_batch_strides,
+                bias_batch_strides, sum_batch_strides,
+                C_batch_strides,
+                M, K, lda,
+                alpha, beta, beta_bias, beta_sum, post, C);
+        }
+    }
+
+    return batch_gemm_operation_fp32_avx512(
+        ptrs,
+        typeA, typeB, typebias, typesum,
+        batch, M, N, K, lda, ldb, ldc, ldsum,
+        alpha, beta, beta_bias, beta_sum, post);
+}
+
 }}}; // namespace ppl::kernel::x86
@@ -0,0 +1,256 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_FP32_GEMM_GEMM_SMALL_FP32_H_
+#define __ST_PPL_KERNEL_X86_FP32_GEMM_GEMM_SMALL_FP32_H_
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/fp32/gemm.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+// Below these sizes the whole problem fits in L1/L2 and the fork/join and
+// packing of the blocked driver cost more than the math itself.
+static const int64_t GEMM_SMALL_M_MAX = 64;
+static const int64_t GEMM_SMALL_N_MAX = 64;
+static const int64_t GEMM_SMALL_K_MAX = 64;
+
+inline bool gemm_small_fp32_check(
+    const gemm_m_type_t typeA,
+    const int64_t M,
+    const int64_t N,
+    const int64_t K)
+{
+    return typeA != gemm_m_type::PACKED &&
+        M <= GEMM_SMALL_M_MAX &&
+        N <= GEMM_SMALL_N_MAX &&
+        K <= GEMM_SMALL_K_MAX;
+}
+
+struct gemm_small_kernel_param_fp32 {
+    const float *A;
+    const float *B;
+    const float *bias;
+    const float *sum;
+    float *C;
+    int64_t K;
+    int64_t lda;
+    int64_t ldb;
+    int64_t ldc;
+    int64_t ldsum;
+    int64_t n_tail;
+    float alpha;
+    float beta;
+    float beta_bias;
+    float beta_sum;
+    gemm_v_type_t typebias;
+    gemm_m_type_t typesum;
+    gemm_post_t post;
+};
+
+// Column tail for isa without masked load/store, computes C[0:u_m, 0:n_eff]
+template <bool trans_a>
+inline void gemm_small_tail_kernel_fp32(
+    const gemm_small_kernel_param_fp32 &p,
+    const int64_t u_m,
+    const int64_t n_eff)
+{
+    for (int64_t i = 0; i < u_m; ++i) {
+        for (int64_t j = 0; j < n_eff; ++j) {
+            float y = 0.0f;
+            for (int64_t k = 0; k < p.K; ++k) {
+                const float a = trans_a ? p.A[k * p.lda + i] : p.A[i * p.lda + k];
+                y += a * p.B[k * p.ldb + j];
+            }
+            y *= p.alpha;
+            if (p.beta != 0.0f) y += p.beta * p.C[i * p.ldc + j];
+            if (p.typebias == gemm_v_type::ROW_VEC) y += p.beta_bias * p.bias[j];
+            if (p.typebias == gemm_v_type::COL_VEC) y += p.beta_bias * p.bias[i];
+            if (p.typebias == gemm_v_type::SCALAR) y += p.beta_bias * p.bias[0];
+            if (p.typesum == gemm_m_type::NOTRANS) y += p.beta_sum * p.sum[i * p.ldsum + j];
+            if (p.post & (gemm_post::RELU6 | gemm_post::RELU)) y = max(y, 0.0f);
+            if (p.post & gemm_post::RELU6) y = min(y, 6.0f);
+            p.C[i * p.ldc + j] = y;
+        }
+    }
+}
+
+// Shared tiling driver. ker_t provides MAX_M, MAX_N_REGS, N_REG_ELTS, PACKED_N_BLK,
+// PACKED_N_PAD and a table(trans_a, tail, u_m, u_n) returning the tile kernel.
+template <typename ker_t>
+ppl::common::RetCode gemm_small_fp32_driver(
+    const float *A,
+    const float *B,
+    const float *bias,
+    const float *sum,
+    const gemm_m_type_t typeA,
+    const gemm_m_type_t typeB,
+    const gemm_v_type_t typebias,
+    const gemm_m_type_t typesum,
+    const int64_t M,
+    const int64_t N,
+    const int64_t K,
+    const int64_t lda,
+    const int64_t ldb,
+    const int64_t ldc,
+    const int64_t ldsum,
+    const float alpha,
+    const float beta,
+    const float beta_bias,
+    const float beta_sum,
+    const gemm_post_t post,
+    float *C)
+{
+    if (M <= 0 || N <= 0) {
+        return ppl::common::RC_SUCCESS;
+    }
+    if (typeA == gemm_m_type::PACKED || (typesum != gemm_m_type::EMPTY && typesum != gemm_m_type::NOTRANS)) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+
+    const bool trans_a = typeA == gemm_m_type::TRANS;
+    const bool packed_b = typeB == gemm_m_type::PACKED;
+    const bool do_mul = alpha != 0.0f && K > 0 && typeA != gemm_m_type::EMPTY && typeB != gemm_m_type::EMPTY;
+
+    // transposed B is small enough to be turned into row-major on stack
+    float trans_b[GEMM_SMALL_K_MAX * GEMM_SMALL_N_MAX];
+    const float *l_B = B;
+    int64_t l_ldb = ldb;
+    if (do_mul && typeB == gemm_m_type::TRANS) {
+        for (int64_t k = 0; k < K; ++k) {
+            for (int64_t n = 0; n < N; ++n) {
+                trans_b[k * N + n] = B[n * ldb + k];
+            }
+        }
+        l_B = trans_b;
+        l_ldb = N;
+    }
+
+    gemm_small_kernel_param_fp32 p;
+    p.K = do_mul ? K : 0;
+    p.lda = lda;
+    p.ldc = ldc;
+    p.ldsum = ldsum;
+    p.alpha = alpha;
+    p.beta = beta;
+    p.beta_bias = beta_bias;
+    p.beta_sum = beta_sum;
+    p.typebias = typebias;
+    p.typesum = typesum;
+    p.post = post;
+
+    const int64_t n_blk = packed_b ? ker_t::PACKED_N_BLK : N;
+    const int64_t n_tile = ker_t::MAX_N_REGS * ker_t::N_REG_ELTS;
+    for (int64_t nb = 0; nb < N; nb += n_blk) {
+        const int64_t nb_eff = min(n_blk, N - nb);
+        const float *base_b = packed_b ? l_B + nb * K : l_B + nb;
+        p.ldb = packed_b ? min(ker_t::PACKED_N_BLK, round_up(nb_eff, ker_t::PACKED_N_PAD)) : l_ldb;
+        for (int64_t n = 0; n < nb_eff; n += n_tile) {
+            const int64_t n_eff = min(n_tile, nb_eff - n);
+            const int64_t u_n = div_up(n_eff, ker_t::N_REG_ELTS);
+            p.n_tail = n_eff % ker_t::N_REG_ELTS;
+            for (int64_t m = 0; m < M; m += ker_t::MAX_M) {
+                const int64_t u_m = min(ker_t::MAX_M, M - m);
+                p.A = A + (trans_a ? m : m * lda);
+                p.B = base_b + n;
+                p.C = C + m * ldc + nb + n;
+                p.sum = sum + m * ldsum + nb + n;
+                p.bias = bias;
+                if (typebias == gemm_v_type::ROW_VEC) p.bias += nb + n;
+                if (typebias == gemm_v_type::COL_VEC) p.bias += m;
+                ker_t::table(trans_a, p.n_tail != 0, u_m, u_n)(p);
+            }
+        }
+    }
+
+    return ppl::common::RC_SUCCESS;
+}
+
+ppl::common::RetCode gemm_small_fp32_sse(
+    const float *A,
+    const float *B,
+    const float *bias,
+    const float *sum,
+    const gemm_m_type_t typeA,
+    const gemm_m_type_t typeB,
+    const gemm_v_type_t typebias,
+    const gemm_m_type_t typesum,
+    const int64_t M,
+    const int64_t N,
+    const int64_t K,
+    const int64_t lda,
+    const int64_t ldb,
+    const int64_t ldc,
+    const int64_t ldsum,
+    const float alpha,
+    const float beta,
+    const float beta_bias,
+    const float beta_sum,
+    const gemm_post_t post,
+    float *C);
+
+ppl::common::RetCode gemm_small_fp32_fma(
+    const float *A,
+    const float *B,
+    const float *bias,
+    const float *sum,
+    const gemm_m_type_t typeA,
+    const gemm_m_type_t typeB,
+    const gemm_v_type_t typebias,
+    const gemm_m_type_t typesum,
+    const int64_t M,
+    const int64_t N,
+    const int64_t K,
+    const int64_t lda,
+    const int64_t ldb,
+    const int64_t ldc,
+    const int64_t ldsum,
+    const float alpha,
+    const float beta,
+    const float beta_bias,
+    const float beta_sum,
+    const gemm_post_t post,
+    float *C);
+
+#ifdef PPL_USE_X86_AVX512
+ppl::common::RetCode gemm_small_fp32_avx512(
+    const float *A,
+    const float *B,
+    const float *bias,
+    const float *sum,
+    const gemm_m_type_t typeA,
+    const gemm_m_type_t typeB,
+    const gemm_v_type_t typebias,
+    const gemm_m_type_t typesum,
+    const int64_t M,
+    const int64_t N,
+    const int64_t K,
+    const int64_t lda,
+    const int64_t ldb,
+    const int64_t ldc,
+    const int64_t ldsum,
+    const float alpha,
+    const float beta,
+    const float beta_bias,
+    const float beta_sum,
+    const gemm_post_t post,
+    float *C);
+#endif
+
+}}}; // namespace ppl::kernel::x86
+
+#endif
@@ -0,0 +1,166 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/fp32/gemm/gemm_kernel_fp32_avx512.h"
+#include "ppl/kernel/x86/fp32/gemm/gemm_small_fp32.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+template <bool trans_a, bool tail, int64_t u_m, int64_t u_n>
+static void gemm_small_kernel_fp32_avx512(const gemm_small_kernel_param_fp32 &p)
+{
+    const int64_t N_REG_ELTS = 16;
+    const __mmask16 mask = tail ? __mmask16((1 << p.n_tail) - 1) : __mmask16(0xffff);
+
+#define IS_TAIL_REG(J) (tail && (J) == u_n - 1)
+#define LOAD_REG(J, PTR) (IS_TAIL_REG(J) ? _mm512_maskz_loadu_ps(mask, (PTR)) : _mm512_loadu_ps((PTR)))
+
+    __m512 c[u_m][u_n];
+    for (int64_t i = 0; i < u_m; ++i) {
+        for (int64_t j = 0; j < u_n; ++j) {
+            c[i][j] = _mm512_setzero_ps();
+        }
+    }
+
+    const float *a_ptr = p.A;
+    const float *b_ptr = p.B;
+    const int64_t a_k_stride = trans_a ? p.lda : 1;
+    const int64_t a_m_stride = trans_a ? 1 : p.lda;
+    for (int64_t k = 0; k < p.K; ++k) {
+        __m512 b[u_n];
+        for (int64_t j = 0; j < u_n; ++j) {
+            b[j] = LOAD_REG(j, b_ptr + j * N_REG_ELTS);
+        }
+        for (int64_t i = 0; i < u_m; ++i) {
+            const __m512 a = _mm512_set1_ps(a_ptr[i * a_m_stride]);
+            for (int64_t j = 0; j < u_n; ++j) {
+                c[i][j] = _mm512_fmadd_ps(a, b[j], c[i][j]);
+            }
+        }
+        a_ptr += a_k_stride;
+        b_ptr += p.ldb;
+    }
+
+    const __m512 v_alpha = _mm512_set1_ps(p.alpha);
+    const __m512 v_beta = _mm512_set1_ps(p.beta);
+    const __m512 v_beta_bias = _mm512_set1_ps(p.beta_bias);
+    const __m512 v_beta_sum = _mm512_set1_ps(p.beta_sum);
+    const __m512 v_zero = _mm512_setzero_ps();
+    const __m512 v_six = _mm512_set1_ps(6.0f);
+    for (int64_t i = 0; i < u_m; ++i) {
+        float *c_ptr = p.C + i * p.ldc;
+        __m512 v_col_bias = v_zero;
+        if (p.typebias == gemm_v_type::COL_VEC) v_col_bias = _mm512_set1_ps(p.beta_bias * p.bias[i]);
+        if (p.typebias == gemm_v_type::SCALAR) v_col_bias = _mm512_set1_ps(p.beta_bias * p.bias[0]);
+        for (int64_t j = 0; j < u_n; ++j) {
+            __m512 y = _mm512_mul_ps(c[i][j], v_alpha);
+            if (p.beta != 0.0f) y = _mm512_fmadd_ps(v_beta, LOAD_REG(j, c_ptr + j * N_REG_ELTS), y);
+            if (p.typebias == gemm_v_type::ROW_VEC) y = _mm512_fmadd_ps(v_beta_bias, LOAD_REG(j, p.bias + j * N_REG_ELTS), y);
+            else y = _mm512_add_ps(y, v_col_bias);
+            if (p.typesum == gemm_m_type::NOTRANS) y = _mm512_fmadd_ps(v_beta_sum, LOAD_REG(j, p.sum + i * p.ldsum + j * N_REG_ELTS), y);
+            if (p.post & (gemm_post::RELU6 | gemm_post::RELU)) y = _mm512_max_ps(y, v_zero);
+            if (p.post & gemm_post::RELU6) y = _mm512_min_ps(y, v_six);
+            if (IS_TAIL_REG(j)) _mm512_mask_storeu_ps(c_ptr + j * N_REG_ELTS, mask, y);
+            else _mm512_storeu_ps(c_ptr + j * N_REG_ELTS, y);
+        }
+    }
+
+#undef LOAD_REG
+#undef IS_TAIL_REG
+}
+
+typedef void (*gemm_small_kernel_fp32_avx512_func_t)(const gemm_small_kernel_param_fp32 &);
+
+#define GEMM_SMALL_KERNEL_ROW(TRANS_A, TAIL, U_M) {\
+    gemm_small_kernel_fp32_avx512<TRANS_A, TAIL, U_M, 1>,\
+    gemm_small_kernel_fp32_avx512<TRANS_A, TAIL, U_M, 2>,\
+    gemm_small_kernel_fp32_avx512<TRANS_A, TAIL, U_M, 3>,\
+}
+
+#define GEMM_SMALL_KERNEL_TABLE(TRANS_A, TAIL) {\
+    GEMM_SMALL_KERNEL_ROW(TRANS_A, TAIL, 1),\
+    GEMM_SMALL_KERNEL_ROW(TRANS_A, TAIL, 2),\
+    GEMM_SMALL_KERNEL_ROW(TRANS_A, TAIL, 3),\
+    GEMM_SMALL_KERNEL_ROW(TRANS_A, TAIL, 4),\
+    GEMM_SMALL_KERNEL_ROW(TRANS_A, TAIL, 5),\
+    GEMM_SMALL_KERNEL_ROW(TRANS_A, TAIL, 6),\
+    GEMM_SMALL_KERNEL_ROW(TRANS_A, TAIL, 7),\
+    GEMM_SMALL_KERNEL_ROW(TRANS_A, TAIL, 8),\
+}
+
+static const gemm_small_kernel_fp32_avx512_func_t gemm_small_kernel_table_fp32_avx512[2][2][8][3] = {
+    {
+        GEMM_SMALL_KERNEL_TABLE(false, false),
+        GEMM_SMALL_KERNEL_TABLE(false, true),
+    },
+    {
+        GEMM_SMALL_KERNEL_TABLE(true, false),
+        GEMM_SMALL_KERNEL_TABLE(true, true),
+    },
+};
+
+#undef GEMM_SMALL_KERNEL_TABLE
+#undef GEMM_SMALL_KERNEL_ROW
+
+struct gemm_small_kernel_fp32_avx512_config {
+    static const int64_t MAX_M = 8;
+    static const int64_t MAX_N_REGS = 3;
+    static const int64_t N_REG_ELTS = 16;
+    static const int64_t PACKED_N_BLK = gemm_kernel_fp32_avx512::config::MAX_N_BLK;
+    static const int64_t PACKED_N_PAD = gemm_kernel_fp32_avx512::config::N_REG_ELTS;
+
+    static gemm_small_kernel_fp32_avx512_func_t table(const bool trans_a, const bool tail, const int64_t u_m, const int64_t u_n)
+    {
+        return gemm_small_kernel_table_fp32_avx512[trans_a][tail][u_m - 1][u_n - 1];
+    }
+};
+
+ppl::common::RetCode gemm_small_fp32_avx512(
+    const float *A,
+    const float *B,
+    const float *bias,
+    const float *sum,
+    const gemm_m_type_t typeA,
+    const gemm_m_type_t typeB,
+    const gemm_v_type_t typebias,
+    const gemm_m_type_t typesum,
+    const int64_t M,
+    const int64_t N,
+    const int64_t K,
+    const int64_t lda,
+    const int64_t ldb,
+    const int64_t ldc,
+    const int64_t ldsum,
+    const float alpha,
+    const float beta,
+    const float beta_bias,
+    const float beta_sum,
+    const gemm_post_t post,
+    float *C)
+{
+    return gemm_small_fp32_driver<gemm_small_kernel_fp32_avx512_config>(
+        A, B, bias, sum,
+        typeA, typeB, typebias, typesum,
+        M, N, K, lda, ldb, ldc, ldsum,
+        alpha, beta, beta_bias, beta_sum,
+        post, C);
+}
+
+}}}; // namespace ppl::kernel::x86
@@ -18,6 +18,7 @@
 #include "ppl/kernel/x86/common/internal_include.h"
 #include "ppl/kernel/x86/common/sse_tools.h"
 #include "ppl/kernel/x86/fp32/gemm.h"
+#include "ppl/kernel/x86/fp32/gemm/gemm_batch_ptr_fp32.h"
 
 namespace ppl { namespace kernel { namespace x86 {
 
@@ -578,11 +579,9 @@ ppl::common::RetCode gemv_fp32_sse(
     return ppl::common::RC_SUCCESS;
 }
 
-ppl::common::RetCode batch_gemv_fp32_sse(
-    const float **A_list,
-    const float **B_list,
-    const float **bias_list,
-    const float **sum_list,
+template <typename batch_ptr_t>
+static ppl::common::RetCode batch_gemv_operation_fp32_sse(
+    const batch_ptr_t &ptrs,
     const gemm_v_type_t typeA,
     const gemm_m_type_t typeB,
     const gemm_v_type_t typebias,
@@ -595,15 +594,14 @@ ppl::common::RetCode batch_gemv_fp32_sse(
     const float beta,
     const float beta_bias,
     const float beta_sum,
-    const gemm_post_t post,
-    float **C_list)
+    const gemm_post_t post)
 {
     if (batch == 1) {
         return gemv_fp32_sse(
-            *A_list, *B_list, bias_list ? *bias_list : nullptr, sum_list ? *sum_list : nullptr,
+            ptrs.A(0), ptrs.B(0), ptrs.bias(0), ptrs.sum(0),
             typeA, typeB, typebias, typesum,
             N, K, ldb,
-            alpha, beta, beta_bias, beta_sum, post, *C_list);
+            alpha, beta, beta_bias, beta_sum, post, ptrs.C(0));
     }
 
     if (typeA == gemm_v_type::COL_VEC || typeB == gemm_m_type::PACKED) {
@@ -619,10 +617,10 @@ ppl::common::RetCode batch_gemv_fp32_sse(
     if (num_threads == 1) {
         for (int64_t b = 0; b < batch; ++b) {
             auto ret = gemv_operation_fp32_sse(
-                A_list[b], B_list[b], bias_list ? bias_list[b] : nullptr, sum_list ? sum_list[b] : nullptr,
+                ptrs.A(b), ptrs.B(b), ptrs.bias(b), ptrs.sum(b),
                 typeA, typeB, typebias, typesum,
                 N, K, ldb,
-                alpha, beta, beta_bias, beta_sum, post, C_list[b]);
+                alpha, beta, beta_bias, beta_sum, post, ptrs.C(b));
             if (ppl::common::RC_SUCCESS != ret) {
                 return ret;
             }
@@ -642,25 +640,25 @@ ppl::common::RetCode batch_gemv_fp32_sse(
         const int64_t nb = nt * n_task_blk + (nt < n_task_tail ? nt : n_task_tail);
         const int64_t nb_eff = n_task_blk + (nt < n_task_tail ? 1 : 0);
 
-        const float *lA = A_list[b];
-        const float *lB = B_list[b];
+        const float *lA = ptrs.A(b);
+        const float *lB = ptrs.B(b);
         if (typeB == gemm_m_type::NOTRANS) {
             lB += nb;
         } else {
             lB += nb * ldb;
         }
 
-        const float *lbias = bias_list ? bias_list[b] : nullptr;
+        const float *lbias = ptrs.bias(b);
         if (typebias == gemm_v_type::ROW_VEC) {
             lbias += nb;
         }
 
-        const float *lsum = sum_list ? sum_list[b] : nullptr;
+        const float *lsum = ptrs.sum(b);
         if (typesum == gemm_m_type::NOTRANS) {
             lsum += nb;
         }
 
-        float *lC = C_list[b] + nb;
+        float *lC = ptrs.C(b) + nb;
 
         auto ret = gemv_operation_fp32_sse(
             lA, lB, lbias, lsum,
@@ -674,4 +672,73 @@ ppl::common::RetCode batch_gemv_fp32_sse(
     return ppl::common::RC_SUCCESS;
 }
 
+ppl::common::RetCode batch_gemv_fp32_sse(
+    const float **A_list,
+    const float **B_list,
+    const float **bias_list,
+    const float **sum_list,
+    const gemm_v_type_t typeA,
+    const gemm_m_type_t typeB,
+    const gemm_v_type_t typebias,
+    const gemm_m_type_t typesum,
+    const int64_t batch,
+    const int64_t N,
+    const int64_t K,
+    const int64_t ldb,
+    const float alpha,
+    const float beta,
+    const float beta_bias,
+    const float beta_sum,
+    const gemm_post_t post,
+    float **C_list)
+{
+    return batch_gemv_operation_fp32_sse(
+        gemm_batch_list_ptr_fp32(A_list, B_list, bias_list, sum_list, C_list),
+        typeA, typeB, typebias, typesum,
+        batch, N, K, ldb,
+        alpha, beta, beta_bias, beta_sum, post);
+}
+
+ppl::common::RetCode strided_batch_gemv_fp32_sse(
+    const float *A,
+    const float *B,
+    const float *bias,
+    const float *sum,
+    const gemm_v_type_t typeA,
+    const gemm_m_type_t typeB,
+    const gemm_v_type_t typebias,
+    const gemm_m_type_t typesum,
+    const int64_t batch_dim_count,
+    const int64_t *batch_dims,
+    const int64_t *A_batch_strides,
+    const int64_t *B_batch_strides,
+    const int64_t *bias_batch_strides,
+    const int64_t *sum_batch_strides,
+    const int64_t *C_batch_strides,
+    const int64_t N,
+    const int64_t K,
+    const int64_t ldb,
+    const float alpha,
+    const float beta,
+    const float beta_bias,
+    const float beta_sum,
+    const gemm_post_t post,
+    float *C)
+{
+    const int64_t batch = gemm_batch_count(batch_dim_count, batch_dims);
+    if (batch <= 0) {
+        return ppl::common::RC_SUCCESS;
+    }
+    return batch_gemv_operation_fp32_sse(
+        gemm_batch_strided_ptr_fp32(
+            A, B, bias, sum, C,
+            batch_dim_count, batch_dims,
+            A_batch_strides, B_batch_strides,
+            bias_batch_strides, sum_batch_strides,
+            C_batch_strides),
+        typeA, typeB, typebias, typesum,
+        batch, N, K, ldb,
+        alpha, beta, beta_bias, beta_sum, post);
+}
+
 }}}; // namespace ppl::kernel::x86
@@ -0,0 +1,101 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/kernel/x86/common/kernel_registry.h"
+#include "ppl/kernel/x86/fp32/grid_sample.h"
+#include "ppl/kernel/x86/fp32/grid_sample/grid_sample_fp32_common.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+template <int64_t CH_BLK>
+struct grid_sample_kernel_fp32_ref {
+    static const int64_t ch_blk = CH_BLK;
+
+    template <int64_t num_taps>
+    static inline void blend(const float *src, const int64_t *tap_offset, const float *tap_weight, float *dst)
+    {
+        float acc[CH_BLK] = {0};
+        for (int64_t t = 0; t < num_taps; ++t) {
+            const float *l_src = src + tap_offset[t];
+            const float w      = tap_weight[t];
+            for (int64_t c = 0; c < CH_BLK; ++c) {
+                acc[c] += l_src[c] * w;
+            }
+        }
+        for (int64_t c = 0; c < CH_BLK; ++c) {
+            dst[c] = acc[c];
+        }
+    }
+};
+
+ppl::common::RetCode grid_sample_ndarray_fp32(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *grid_shape,
+    const float *src,
+    const float *grid,
+    const int64_t mode,
+    const int64_t padding_mode,
+    const bool align_corners,
+    float *dst)
+{
+    return grid_sample_blocked_fp32_common<grid_sample_kernel_fp32_ref<1>>(
+        src_shape, grid_shape, src, grid, mode, padding_mode, align_corners, dst);
+}
+
+ppl::common::RetCode grid_sample_n16cx_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *grid_shape,
+    const float *src,
+    const float *grid,
+    const int64_t mode,
+    const int64_t padding_mode,
+    const bool align_corners,
+    float *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return grid_sample_n16cx_fp32_avx512(src_shape, grid_shape, src, grid, mode, padding_mode, align_corners, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_FMA) {
+        return grid_sample_n16cx_fp32_fma(src_shape, grid_shape, src, grid, mode, padding_mode, align_corners, dst);
+    }
+    return grid_sample_blocked_fp32_common<grid_sample_kernel_fp32_ref<16>>(
+        src_shape, grid_shape, src, grid, mode, padding_mode, align_corners, dst);
+}
+
+ppl::common::RetCode grid_sample_fp32(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *grid_shape,
+    const float *src,
+    const float *grid,
+    const int64_t mode,
+    const int64_t padding_mode,
+    const bool align_corners,
+    float *dst)
+{
+    PPL_X86_KERNEL_DISPATCH_SITE(site, "grid_sample_fp32");
+    const ppl::common::TensorShape *shapes[] = {src_shape, grid_shape};
+    const kernel_desc_t *kernel = resolve_kernel(&site, shapes, 2);
+    if (!kernel) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+    return reinterpret_cast<decltype(&grid_sample_ndarray_fp32)>(kernel->func)(src_shape, grid_shape, src, grid, mode, padding_mode, align_corners, dst);
+}
+
+}}}; // namespace ppl::kernel::x86
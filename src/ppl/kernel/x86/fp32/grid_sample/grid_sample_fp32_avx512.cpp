@@ -0,0 +1,54 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "ppl/kernel/x86/fp32/grid_sample.h"
+#include "ppl/kernel/x86/fp32/grid_sample/grid_sample_fp32_common.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+struct grid_sample_kernel_fp32_avx512 {
+    static const int64_t ch_blk = 16;
+
+    template <int64_t num_taps>
+    static inline void blend(const float *src, const int64_t *tap_offset, const float *tap_weight, float *dst)
+    {
+        __m512 acc = _mm512_setzero_ps();
+        for (int64_t t = 0; t < num_taps; ++t) {
+            const float *l_src = src + tap_offset[t];
+            acc = _mm512_fmadd_ps(_mm512_loadu_ps(l_src), _mm512_set1_ps(tap_weight[t]), acc);
+        }
+        _mm512_storeu_ps(dst, acc);
+    }
+};
+
+ppl::common::RetCode grid_sample_n16cx_fp32_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *grid_shape,
+    const float *src,
+    const float *grid,
+    const int64_t mode,
+    const int64_t padding_mode,
+    const bool align_corners,
+    float *dst)
+{
+    return grid_sample_blocked_fp32_common<grid_sample_kernel_fp32_avx512>(
+        src_shape, grid_shape, src, grid, mode, padding_mode, align_corners, dst);
+}
+
+}}}; // namespace ppl::kernel::x86
@@ -0,0 +1,222 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_FP32_GRID_SAMPLE_GRID_SAMPLE_FP32_COMMON_H_
+#define __ST_PPL_KERNEL_X86_FP32_GRID_SAMPLE_GRID_SAMPLE_FP32_COMMON_H_
+
+#include <cmath>
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/common/mmcv_gridsample/mmcv_gridsample_common.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+// Every output pixel is reduced to a list of (offset, weight) taps into one
+// channel plane, computed once and reused for all channels. Out of bound
+// taps under zeros padding get weight 0 and offset 0. ndarray is treated as
+// a blocked layout with a channel block of 1.
+
+template <int32_t mode>
+struct grid_sample_num_taps {
+    static const int64_t value = mode == NEAREST ? 1 : (mode == BILINEAR ? 4 : 16);
+};
+
+// pytorch bicubic convolution with A = -0.75
+inline void grid_sample_cubic_coeffs(const float t, float *coeffs)
+{
+    const float A  = -0.75f;
+    const float x0 = t + 1.0f;
+    const float x1 = t;
+    const float x2 = 1.0f - t;
+    const float x3 = 2.0f - t;
+    coeffs[0]      = ((A * x0 - 5.0f * A) * x0 + 8.0f * A) * x0 - 4.0f * A;
+    coeffs[1]      = ((A + 2.0f) * x1 - (A + 3.0f)) * x1 * x1 + 1.0f;
+    coeffs[2]      = ((A + 2.0f) * x2 - (A + 3.0f)) * x2 * x2 + 1.0f;
+    coeffs[3]      = ((A * x3 - 5.0f * A) * x3 + 8.0f * A) * x3 - 4.0f * A;
+}
+
+template <int32_t mode, grid_sampler_padding padding_mode, bool align_corners>
+inline void grid_sample_compute_taps(
+    const float x,
+    const float y,
+    const int64_t src_h,
+    const int64_t src_w,
+    const int64_t ch_blk,
+    int64_t *tap_offset,
+    float *tap_weight)
+{
+    if (mode == NEAREST) {
+        const int64_t ix = static_cast<int64_t>(std::nearbyint(grid_sampler_compute_source_index<float, align_corners, padding_mode>(x, src_w)));
+        const int64_t iy = static_cast<int64_t>(std::nearbyint(grid_sampler_compute_source_index<float, align_corners, padding_mode>(y, src_h)));
+        const bool in    = within_bounds_2d(iy, ix, src_h, src_w);
+        tap_offset[0]    = in ? (iy * src_w + ix) * ch_blk : 0;
+        tap_weight[0]    = in ? 1.0f : 0.0f;
+    } else if (mode == BILINEAR) {
+        const float ix   = grid_sampler_compute_source_index<float, align_corners, padding_mode>(x, src_w);
+        const float iy   = grid_sampler_compute_source_index<float, align_corners, padding_mode>(y, src_h);
+        const int64_t x0 = static_cast<int64_t>(std::floor(ix));
+        const int64_t y0 = static_cast<int64_t>(std::floor(iy));
+        const float x1_lambda = ix - x0;
+        const float y1_lambda = iy - y0;
+        const float x0_lambda = (x0 + 1) - ix;
+        const float y0_lambda = (y0 + 1) - iy;
+        const float wy[2] = {y0_lambda, y1_lambda};
+        const float wx[2] = {x0_lambda, x1_lambda};
+        for (int64_t j = 0; j < 2; ++j) {
+            for (int64_t i = 0; i < 2; ++i) {
+                const bool in          = within_bounds_2d(y0 + j, x0 + i, src_h, src_w);
+                tap_offset[j * 2 + i] = in ? ((y0 + j) * src_w + x0 + i) * ch_blk : 0;
+                tap_weight[j * 2 + i] = in ? wy[j] * wx[i] : 0.0f;
+            }
+        }
+    } else {
+        // taps are padded one by one, the interpolation point is not
+        const float ix   = grid_sampler_unnormalize<float, align_corners>(x, src_w);
+        const float iy   = grid_sampler_unnormalize<float, align_corners>(y, src_h);
+        const float fx   = std::floor(ix);
+        const float fy   = std::floor(iy);
+        float wx[4], wy[4];
+        grid_sample_cubic_coeffs(ix - fx, wx);
+        grid_sample_cubic_coeffs(iy - fy, wy);
+        for (int64_t j = 0; j < 4; ++j) {
+            const int64_t yy = static_cast<int64_t>(compute_coordinates<float, align_corners, padding_mode>(fy - 1 + j, src_h));
+            for (int64_t i = 0; i < 4; ++i) {
+                const int64_t xx       = static_cast<int64_t>(compute_coordinates<float, align_corners, padding_mode>(fx - 1 + i, src_w));
+                const bool in          = within_bounds_2d(yy, xx, src_h, src_w);
+                tap_offset[j * 4 + i] = in ? (yy * src_w + xx) * ch_blk : 0;
+                tap_weight[j * 4 + i] = in ? wy[j] * wx[i] : 0.0f;
+            }
+        }
+    }
+}
+
+template <typename kernel_t, int32_t mode, grid_sampler_padding padding_mode, bool align_corners>
+ppl::common::RetCode grid_sample_blocked_fp32_impl(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *grid_shape,
+    const float *src,
+    const float *grid,
+    float *dst)
+{
+    const int64_t ch_blk    = kernel_t::ch_blk;
+    const int64_t num_taps  = grid_sample_num_taps<mode>::value;
+    const int64_t s_blk     = 64;
+    const int64_t batch     = src_shape->GetDim(0);
+    const int64_t channels  = src_shape->GetDim(1);
+    const int64_t src_h     = src_shape->GetDim(2);
+    const int64_t src_w     = src_shape->GetDim(3);
+    const int64_t dst_h     = grid_shape->GetDim(1);
+    const int64_t dst_w     = grid_shape->GetDim(2);
+    const int64_t dst_space = dst_h * dst_w;
+    const int64_t num_cb    = div_up(channels, ch_blk);
+
+    // split channel blocks too when batch and pixels cannot fill the threads,
+    // taps are then computed once per chunk
+    const int64_t num_s_blks  = div_up(dst_space, s_blk);
+    const int64_t num_threads = PPL_OMP_MAX_THREADS();
+    const int64_t num_c_chks  = max<int64_t>(min(num_cb, div_up(num_threads, batch * num_s_blks)), 1);
+    const int64_t cb_per_chk  = div_up(num_cb, num_c_chks);
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t task = 0; task < batch * num_s_blks * num_c_chks; ++task) {
+        const int64_t cc     = task % num_c_chks;
+        const int64_t sb     = task / num_c_chks % num_s_blks;
+        const int64_t n      = task / num_c_chks / num_s_blks;
+        const int64_t s_beg  = sb * s_blk;
+        const int64_t s_eff  = min(dst_space - s_beg, s_blk);
+        const int64_t cb_beg = cc * cb_per_chk;
+        const int64_t cb_end = min(cb_beg + cb_per_chk, num_cb);
+
+        int64_t tap_offset[s_blk * num_taps];
+        float tap_weight[s_blk * num_taps];
+        const float *l_grid = grid + (n * dst_space + s_beg) * 2;
+        for (int64_t s = 0; s < s_eff; ++s) {
+            grid_sample_compute_taps<mode, padding_mode, align_corners>(
+                l_grid[s * 2 + 0], l_grid[s * 2 + 1], src_h, src_w, ch_blk,
+                tap_offset + s * num_taps, tap_weight + s * num_taps);
+        }
+
+        for (int64_t cb = cb_beg; cb < cb_end; ++cb) {
+            const float *l_src = src + (n * num_cb + cb) * src_h * src_w * ch_blk;
+            float *l_dst       = dst + ((n * num_cb + cb) * dst_space + s_beg) * ch_blk;
+            for (int64_t s = 0; s < s_eff; ++s) {
+                kernel_t::template blend<num_taps>(l_src, tap_offset + s * num_taps, tap_weight + s * num_taps, l_dst + s * ch_blk);
+            }
+        }
+    }
+
+    return ppl::common::RC_SUCCESS;
+}
+
+template <typename kernel_t, int32_t mode, grid_sampler_padding padding_mode>
+ppl::common::RetCode grid_sample_blocked_fp32_align(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *grid_shape,
+    const float *src,
+    const float *grid,
+    const bool align_corners,
+    float *dst)
+{
+    if (align_corners) {
+        return grid_sample_blocked_fp32_impl<kernel_t, mode, padding_mode, true>(src_shape, grid_shape, src, grid, dst);
+    }
+    return grid_sample_blocked_fp32_impl<kernel_t, mode, padding_mode, false>(src_shape, grid_shape, src, grid, dst);
+}
+
+template <typename kernel_t, int32_t mode>
+ppl::common::RetCode grid_sample_blocked_fp32_padding(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *grid_shape,
+    const float *src,
+    const float *grid,
+    const int64_t padding_mode,
+    const bool align_corners,
+    float *dst)
+{
+    switch (padding_mode) {
+        case ZEROS: return grid_sample_blocked_fp32_align<kernel_t, mode, ZEROS>(src_shape, grid_shape, src, grid, align_corners, dst);
+        case BORDER: return grid_sample_blocked_fp32_align<kernel_t, mode, BORDER>(src_shape, grid_shape, src, grid, align_corners, dst);
+        case REFLECTION: return grid_sample_blocked_fp32_align<kernel_t, mode, REFLECTION>(src_shape, grid_shape, src, grid, align_corners, dst);
+        default: return ppl::common::RC_UNSUPPORTED;
+    }
+}
+
+template <typename kernel_t>
+ppl::common::RetCode grid_sample_blocked_fp32_common(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *grid_shape,
+    const float *src,
+    const float *grid,
+    const int64_t mode,
+    const int64_t padding_mode,
+    const bool align_corners,
+    float *dst)
+{
+    if (src_shape->GetDimCount() != 4 || grid_shape->GetDimCount() != 4 || grid_shape->GetDim(3) != 2) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+    switch (mode) {
+        case BILINEAR: return grid_sample_blocked_fp32_padding<kernel_t, BILINEAR>(src_shape, grid_shape, src, grid, padding_mode, align_corners, dst);
+        case NEAREST: return grid_sample_blocked_fp32_padding<kernel_t, NEAREST>(src_shape, grid_shape, src, grid, padding_mode, align_corners, dst);
+        case BICUBIC: return grid_sample_blocked_fp32_padding<kernel_t, BICUBIC>(src_shape, grid_shape, src, grid, padding_mode, align_corners, dst);
+        default: return ppl::common::RC_UNSUPPORTED;
+    }
+}
+
+}}}; // namespace ppl::kernel::x86
+
+#endif
@@ -0,0 +1,98 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_FP32_IR_CONV2D_AVX512_IR_CONV2D_N16CX_GEMM_DIRECT_FP32_AVX512_H_
+#define __ST_PPL_KERNEL_X86_FP32_IR_CONV2D_AVX512_IR_CONV2D_N16CX_GEMM_DIRECT_FP32_AVX512_H_
+
+#include "ppl/kernel/x86/fp32/ir_conv2d.h"
+#include "ppl/kernel/x86/common/internal_include.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+/*
+
+    Key Point of Inverted Residual Conv:
+        The expanded feature map is never written out. For each tile of output rows,
+        a channel chunk of expanded rows and its depthwise output are kept in L2,
+        and the project conv accumulates the chunk into dst directly.
+        Origin data path:    L3 -> Expand -> L3 -> DW Conv -> L3 -> Project -> L3
+        Optimized data path: L3 -> Expand -> L2 -> DW Conv -> L2 -> Project -> L3
+
+*/
+
+class ir_conv2d_n16cx_gemm_direct_fp32_avx512_executor final : public ir_conv2d_fp32_executor {
+public:
+    ir_conv2d_n16cx_gemm_direct_fp32_avx512_executor(
+        conv2d_fp32_executor *expand_exec,
+        conv2d_fp32_executor *depthwise_exec,
+        conv2d_fp32_executor *project_exec)
+        : ir_conv2d_fp32_executor(expand_exec, depthwise_exec, project_exec) {}
+
+    uint64_t cal_temp_buffer_size() override;
+    ppl::common::RetCode prepare() override;
+    ppl::common::RetCode execute() override;
+
+private:
+    struct kernel_schedule_param {
+        // Preprocessed param
+        int64_t padded_ic;
+        int64_t padded_mid;
+        int64_t padded_oc;
+
+        // Kernel tunning
+        int64_t gd_ker_blk;
+        int64_t oc_ker_blk;
+        int64_t dw_ker_blk;
+        int64_t oh_l2_blk;
+        int64_t ex_ic_l2_blk;
+        int64_t mid_l2_blk;
+        int32_t use_nt_store;
+
+        uint64_t ex_buffer_len;
+        uint64_t dw_buffer_len;
+        uint64_t ex_temp_buffer_size;
+        uint64_t dw_temp_buffer_size;
+        uint64_t pj_temp_buffer_size;
+    } schedule_param_;
+
+    void init_preproc_param();
+    void cal_kernel_tunning_param();
+    ppl::common::RetCode fuse_execute();
+    ppl::common::RetCode separate_execute();
+
+    static int64_t cal_ic_l2_blk(const conv2d_param &param);
+};
+
+class ir_conv2d_n16cx_gemm_direct_fp32_avx512_manager final : public ir_conv2d_fp32_manager {
+public:
+    ir_conv2d_n16cx_gemm_direct_fp32_avx512_manager() {}
+    ir_conv2d_n16cx_gemm_direct_fp32_avx512_manager(
+        conv2d_fp32_manager *expand_mgr,
+        conv2d_fp32_manager *depthwise_mgr,
+        conv2d_fp32_manager *project_mgr)
+        : ir_conv2d_fp32_manager(expand_mgr, depthwise_mgr, project_mgr) {}
+    ir_conv2d_fp32_executor *gen_executor() override {
+        return new ir_conv2d_n16cx_gemm_direct_fp32_avx512_executor(
+            expand_conv2d_manager_->gen_executor(),
+            depthwise_conv2d_manager_->gen_executor(),
+            project_conv2d_manager_->gen_executor());
+    }
+};
+
+}}}; // namespace ppl::kernel::x86
+
+#endif
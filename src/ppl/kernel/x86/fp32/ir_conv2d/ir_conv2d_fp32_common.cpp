@@ -0,0 +1,165 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/kernel/x86/fp32/ir_conv2d.h"
+
+#include "ppl/kernel/x86/fp32/ir_conv2d/fma/ir_conv2d_n16cx_gemm_direct_fp32_fma.h"
+#include "ppl/kernel/x86/fp32/conv2d/fma/conv2d_n16cx_gemm_direct_fp32_fma.h"
+#include "ppl/kernel/x86/fp32/conv2d/fma/conv2d_n16cx_depthwise_fp32_fma.h"
+
+#ifdef PPL_USE_X86_AVX512
+#include "ppl/kernel/x86/fp32/ir_conv2d/avx512/ir_conv2d_n16cx_gemm_direct_fp32_avx512.h"
+#include "ppl/kernel/x86/fp32/conv2d/avx512/conv2d_n16cx_gemm_direct_fp32_avx512.h"
+#include "ppl/kernel/x86/fp32/conv2d/avx512/conv2d_n16cx_depthwise_fp32_avx512.h"
+#endif
+
+namespace ppl { namespace kernel { namespace x86 {
+
+ir_conv2d_fp32_algo_info ir_conv2d_algo_selector::select_algo(
+    const conv2d_algo_info &expand_algo,
+    const conv2d_algo_info &depthwise_algo,
+    const conv2d_algo_info &project_algo,
+    const conv2d_param &expand_param,
+    const conv2d_param &depthwise_param,
+    const conv2d_param &project_param)
+{
+    if (true // gemm_direct -> depthwise -> gemm_direct algo
+        && expand_algo.algo_type == ppl::kernel::x86::conv2d_algo::GEMM_DIRECT
+        && expand_algo.input_format == ppl::common::DATAFORMAT_N16CX
+        && expand_algo.output_format == ppl::common::DATAFORMAT_N16CX
+        && depthwise_algo.algo_type == ppl::kernel::x86::conv2d_algo::DEPTHWISE
+        && depthwise_algo.input_format == ppl::common::DATAFORMAT_N16CX
+        && depthwise_algo.output_format == ppl::common::DATAFORMAT_N16CX
+        && project_algo.algo_type == ppl::kernel::x86::conv2d_algo::GEMM_DIRECT
+        && project_algo.input_format == ppl::common::DATAFORMAT_N16CX
+        && project_algo.output_format == ppl::common::DATAFORMAT_N16CX)
+    {
+        const bool support_param = true
+            && !(expand_param.fuse_flag & ppl::kernel::x86::conv_fuse_flag::SUM)
+            && expand_param.sparse_level() == 1.0f
+            && expand_param.group == 1
+            && expand_param.is_pointwise()
+            && expand_param.stride_h == 1
+            && expand_param.stride_w == 1
+            && !(depthwise_param.fuse_flag & ppl::kernel::x86::conv_fuse_flag::SUM)
+            && depthwise_param.dilation_h == 1
+            && depthwise_param.dilation_w == 1
+            && project_param.sparse_level() == 1.0f
+            && project_param.group == 1
+            && project_param.is_pointwise()
+            && project_param.stride_h == 1
+            && project_param.stride_w == 1
+            && expand_param.num_output == depthwise_param.channels
+            && depthwise_param.num_output == project_param.channels;
+        if (!support_param) {
+            return {
+                ir_conv2d_fp32_algo::UNKNOWN,
+                ppl::common::ISA_UNKNOWN,
+                ppl::common::DATAFORMAT_UNKNOWN,
+                ppl::common::DATAFORMAT_UNKNOWN};
+        }
+
+        if (true
+            && expand_algo.isa == ppl::common::ISA_X86_FMA
+            && depthwise_algo.isa == ppl::common::ISA_X86_FMA
+            && project_algo.isa == ppl::common::ISA_X86_FMA) {
+            return {
+                ir_conv2d_fp32_algo::GEMM_DIRECT,
+                ppl::common::ISA_X86_FMA,
+                ppl::common::DATAFORMAT_N16CX,
+                ppl::common::DATAFORMAT_N16CX};
+        }
+
+#ifdef PPL_USE_X86_AVX512
+        if (true
+            && expand_algo.isa == ppl::common::ISA_X86_AVX512
+            && depthwise_algo.isa == ppl::common::ISA_X86_AVX512
+            && project_algo.isa == ppl::common::ISA_X86_AVX512) {
+            return {
+                ir_conv2d_fp32_algo::GEMM_DIRECT,
+                ppl::common::ISA_X86_AVX512,
+                ppl::common::DATAFORMAT_N16CX,
+                ppl::common::DATAFORMAT_N16CX};
+        }
+#endif
+    }
+
+    return {
+        ir_conv2d_fp32_algo::UNKNOWN,
+        ppl::common::ISA_UNKNOWN,
+        ppl::common::DATAFORMAT_UNKNOWN,
+        ppl::common::DATAFORMAT_UNKNOWN};
+}
+
+ir_conv2d_fp32_manager *ir_conv2d_algo_selector::gen_algo(
+    const conv2d_param &expand_param,
+    const conv2d_param &depthwise_param,
+    const conv2d_param &project_param,
+    const ir_conv2d_fp32_algo_info &algo_info,
+    ppl::common::Allocator *allocator)
+{
+    if (algo_info.algo_type == ir_conv2d_fp32_algo::GEMM_DIRECT &&
+        algo_info.isa == ppl::common::ISA_X86_FMA &&
+        algo_info.input_format == ppl::common::DATAFORMAT_N16CX &&
+        algo_info.output_format == ppl::common::DATAFORMAT_N16CX) {
+        return new ir_conv2d_n16cx_gemm_direct_fp32_fma_manager(
+            new conv2d_n16cx_gemm_direct_fp32_fma_manager(expand_param, allocator),
+            new conv2d_n16cx_depthwise_fp32_fma_manager(depthwise_param, allocator),
+            new conv2d_n16cx_gemm_direct_fp32_fma_manager(project_param, allocator));
+    }
+
+#ifdef PPL_USE_X86_AVX512
+    if (algo_info.algo_type == ir_conv2d_fp32_algo::GEMM_DIRECT &&
+        algo_info.isa == ppl::common::ISA_X86_AVX512 &&
+        algo_info.input_format == ppl::common::DATAFORMAT_N16CX &&
+        algo_info.output_format == ppl::common::DATAFORMAT_N16CX) {
+        return new ir_conv2d_n16cx_gemm_direct_fp32_avx512_manager(
+            new conv2d_n16cx_gemm_direct_fp32_avx512_manager(expand_param, allocator),
+            new conv2d_n16cx_depthwise_fp32_avx512_manager(depthwise_param, allocator),
+            new conv2d_n16cx_gemm_direct_fp32_avx512_manager(project_param, allocator));
+    }
+#endif
+
+    return nullptr;
+}
+
+ir_conv2d_fp32_manager *ir_conv2d_algo_selector::gen_algo(
+    const ir_conv2d_fp32_algo_info &algo_info,
+    conv2d_fp32_manager *expand_mgr,
+    conv2d_fp32_manager *depthwise_mgr,
+    conv2d_fp32_manager *project_mgr)
+{
+    if (algo_info.algo_type == ir_conv2d_fp32_algo::GEMM_DIRECT &&
+        algo_info.isa == ppl::common::ISA_X86_FMA &&
+        algo_info.input_format == ppl::common::DATAFORMAT_N16CX &&
+        algo_info.output_format == ppl::common::DATAFORMAT_N16CX) {
+        return new ir_conv2d_n16cx_gemm_direct_fp32_fma_manager(expand_mgr, depthwise_mgr, project_mgr);
+    }
+
+#ifdef PPL_USE_X86_AVX512
+    if (algo_info.algo_type == ir_conv2d_fp32_algo::GEMM_DIRECT &&
+        algo_info.isa == ppl::common::ISA_X86_AVX512 &&
+        algo_info.input_format == ppl::common::DATAFORMAT_N16CX &&
+        algo_info.output_format == ppl::common::DATAFORMAT_N16CX) {
+        return new ir_conv2d_n16cx_gemm_direct_fp32_avx512_manager(expand_mgr, depthwise_mgr, project_mgr);
+    }
+#endif
+
+    return nullptr;
+}
+
+}}};
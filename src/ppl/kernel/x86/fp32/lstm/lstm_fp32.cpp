@@ -19,6 +19,7 @@
 #include <string.h>
 
 #include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/common/kernel_registry.h"
 #include "ppl/kernel/x86/fp32/lstm.h"
 #include "ppl/kernel/x86/fp32/gemm.h"
 
@@ -86,4 +87,32 @@ ppl::common::RetCode lstm_fp32(
     return kernel::x86::lstm_fp32_sse(X_shape, X, W, R, P, bias, sequence_lens, initial_h, initial_c, direction, hidden_size, packed_W, packed_R, temp_buffer, Y, Y_h, Y_c);
 }
 
+ppl::common::RetCode lstm_fp32(
+    const ppl::common::TensorShape *X_shape,
+    const float *X,
+    const float **W,
+    const float **R,
+    const float *P,
+    const float *bias,
+    const int32_t *sequence_lens,
+    const float *initial_h,
+    const float *initial_c,
+    const rnn_direction_t direction,
+    const int64_t hidden_size,
+    void *temp_buffer,
+    float *Y,
+    float *Y_h,
+    float *Y_c)
+{
+    PPL_X86_KERNEL_DISPATCH_SITE(site, "lstm_fp32");
+    const ppl::common::TensorShape *shapes[] = {X_shape};
+    const kernel_desc_t *kernel = resolve_kernel(&site, shapes, 1);
+    if (!kernel) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+    return reinterpret_cast<decltype(&lstm_fp32_sse)>(kernel->func)(
+        X_shape, X, W, R, P, bias, sequence_lens, initial_h, initial_c, direction, hidden_size,
+        false, false, temp_buffer, Y, Y_h, Y_c);
+}
+
 }}}; // namespace ppl::kernel::x86
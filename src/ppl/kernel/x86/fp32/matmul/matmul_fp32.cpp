@@ -23,38 +23,6 @@
 
 namespace ppl { namespace kernel { namespace x86 {
 
-static void matmul_ndarray_fp32_mat_list_construct(
-    const float *A,
-    const float *B,
-    float *Y,
-    const int64_t *Y_dims,
-    const int64_t *A_strides,
-    const int64_t *B_strides,
-    const int64_t *Y_strides,
-    const int64_t dim_index,
-    const int64_t dim_count,
-    std::vector<const float *> &A_list,
-    std::vector<const float *> &B_list,
-    std::vector<float *> &Y_list)
-{
-    if (dim_index >= dim_count - 2) {
-        A_list.push_back(A);
-        B_list.push_back(B);
-        Y_list.push_back(Y);
-    } else {
-        const int64_t length = Y_dims[dim_index];
-        for (int64_t i = 0; i < length; i++) {
-            matmul_ndarray_fp32_mat_list_construct(
-                A + i * A_strides[dim_index],
-                B + i * B_strides[dim_index],
-                Y + i * Y_strides[dim_index],
-                Y_dims, A_strides, B_strides,
-                Y_strides, dim_index + 1,
-                dim_count, A_list, B_list, Y_list);
-        }
-    }
-}
-
 ppl::common::RetCode matmul_ndarray_fp32(
     const ppl::common::isa_t isa,
     const ppl::common::TensorShape *A_shape,
@@ -102,57 +70,39 @@ ppl::common::RetCode matmul_ndarray_fp32(
             gemm_post::NONE, Y);
     }
 
-    if (packedB) {
-        return ppl::common::RC_UNSUPPORTED;
-    }
-
-    int64_t batch_y = 1;
-    std::vector<int64_t> Y_dims(dim_count);
-    Y_dims[dim_count - 2] = M;
-    Y_dims[dim_count - 1] = N;
-    for (int64_t i = 0; i < dim_count - 2; ++i) {
-        Y_dims[i] = A_dims[i] == B_dims[i] ? A_dims[i] : A_dims[i] * B_dims[i];
-        batch_y *= Y_dims[i];
+    const int64_t batch_dim_count = dim_count - 2;
+    std::vector<int64_t> Y_batch_dims(batch_dim_count);
+    for (int64_t i = 0; i < batch_dim_count; ++i) {
+        Y_batch_dims[i] = A_dims[i] == B_dims[i] ? A_dims[i] : A_dims[i] * B_dims[i];
     }
 
-    std::vector<int64_t> A_strides(dim_count, 0);
-    std::vector<int64_t> B_strides(dim_count, 0);
-    std::vector<int64_t> Y_strides(dim_count, 0);
-    A_strides[dim_count - 1] = 1;
-    B_strides[dim_count - 1] = 1;
-    Y_strides[dim_count - 1] = 1;
-    for (int64_t i = dim_count - 2; i >= 0; i--) {
-        A_strides[i] = A_strides[i + 1] * A_dims[i + 1];
-        B_strides[i] = B_strides[i + 1] * B_dims[i + 1];
-        Y_strides[i] = Y_strides[i + 1] * Y_dims[i + 1];
+    // batch strides in elements, broadcast dimensions get zero stride
+    const int64_t B_mat_stride = packedB ?
+        int64_t(gemm_fp32_get_packed_b_bytes(isa, N, K) / sizeof(float)) : K * N;
+    std::vector<int64_t> A_batch_strides(batch_dim_count, 0);
+    std::vector<int64_t> B_batch_strides(batch_dim_count, 0);
+    std::vector<int64_t> Y_batch_strides(batch_dim_count, 0);
+    int64_t A_stride = M * K;
+    int64_t B_stride = B_mat_stride;
+    int64_t Y_stride = M * N;
+    for (int64_t i = batch_dim_count - 1; i >= 0; --i) {
+        A_batch_strides[i] = A_dims[i] == 1 ? 0 : A_stride;
+        B_batch_strides[i] = B_dims[i] == 1 ? 0 : B_stride;
+        Y_batch_strides[i] = Y_stride;
+        A_stride *= A_dims[i];
+        B_stride *= B_dims[i];
+        Y_stride *= Y_batch_dims[i];
     }
-    for (int64_t i = 0; i < dim_count - 2; i++) {
-        A_strides[i] = A_dims[i] == 1 ? 0 : A_strides[i];
-        B_strides[i] = B_dims[i] == 1 ? 0 : B_strides[i];
-    }
-
-    std::vector<const float*> A_list;
-    std::vector<const float*> B_list;
-    std::vector<float*>       Y_list;
-    A_list.reserve(batch_y);
-    B_list.reserve(batch_y);
-    Y_list.reserve(batch_y);
-
-    matmul_ndarray_fp32_mat_list_construct(
-        A, B, Y,
-        Y_dims.data(),
-        A_strides.data(),
-        B_strides.data(),
-        Y_strides.data(),
-        0, dim_count,
-        A_list, B_list, Y_list);
 
-    return batch_gemm_fp32(
-        isa, A_list.data(), B_list.data(), nullptr, nullptr,
-        gemm_m_type::NOTRANS, gemm_m_type::NOTRANS,
+    return strided_batch_gemm_fp32(
+        isa, A, B, nullptr, nullptr,
+        gemm_m_type::NOTRANS, packedB ? gemm_m_type::PACKED : gemm_m_type::NOTRANS,
         gemm_v_type::EMPTY, gemm_m_type::EMPTY,
-        batch_y, M, N, K, K, N, N, 0, 1.0f, 0.0f, 0.0f, 0.0f,
-        gemm_post::NONE, Y_list.data());
+        batch_dim_count, Y_batch_dims.data(),
+        A_batch_strides.data(), B_batch_strides.data(),
+        nullptr, nullptr, Y_batch_strides.data(),
+        M, N, K, K, N, N, 0, 1.0f, 0.0f, 0.0f, 0.0f,
+        gemm_post::NONE, Y);
 }
 
 }}}; // namespace ppl::kernel::x86
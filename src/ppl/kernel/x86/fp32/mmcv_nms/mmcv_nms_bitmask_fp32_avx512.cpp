@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "ppl/kernel/x86/fp32/mmcv_nms/mmcv_nms_bitmask_fp32_common.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+struct mmcv_nms_bitmask_kernel_fp32_avx512 {
+    static inline uint64_t iou_mask(const mmcv_nms_boxes_soa &b, const int64_t i, const int64_t col, const float iou_threshold, const float offset)
+    {
+        const __m512 v_x1     = _mm512_set1_ps(b.x1[i]);
+        const __m512 v_y1     = _mm512_set1_ps(b.y1[i]);
+        const __m512 v_x2     = _mm512_set1_ps(b.x2[i]);
+        const __m512 v_y2     = _mm512_set1_ps(b.y2[i]);
+        const __m512 v_area   = _mm512_set1_ps(b.area[i]);
+        const __m512 v_offset = _mm512_set1_ps(offset);
+        const __m512 v_thresh = _mm512_set1_ps(iou_threshold);
+        const __m512 v_zero   = _mm512_setzero_ps();
+
+        uint64_t bits = 0;
+        for (int64_t j = 0; j < 64; j += 16) {
+            const int64_t c = col + j;
+            __m512 v_w      = _mm512_sub_ps(_mm512_min_ps(v_x2, _mm512_loadu_ps(b.x2 + c)), _mm512_max_ps(v_x1, _mm512_loadu_ps(b.x1 + c)));
+            __m512 v_h      = _mm512_sub_ps(_mm512_min_ps(v_y2, _mm512_loadu_ps(b.y2 + c)), _mm512_max_ps(v_y1, _mm512_loadu_ps(b.y1 + c)));
+            v_w             = _mm512_max_ps(v_zero, _mm512_add_ps(v_w, v_offset));
+            v_h             = _mm512_max_ps(v_zero, _mm512_add_ps(v_h, v_offset));
+            const __m512 v_inter = _mm512_mul_ps(v_w, v_h);
+            const __m512 v_union = _mm512_sub_ps(_mm512_add_ps(_mm512_loadu_ps(b.area + c), v_area), v_inter);
+            __mmask16 v_mask     = _mm512_cmp_ps_mask(_mm512_div_ps(v_inter, v_union), v_thresh, _CMP_GE_OQ);
+            if (b.cls) {
+                v_mask = _mm512_mask_cmpeq_epi32_mask(v_mask, _mm512_loadu_si512(b.cls + c), _mm512_set1_epi32(b.cls[i]));
+            }
+            bits |= static_cast<uint64_t>(v_mask) << j;
+        }
+        return bits;
+    }
+};
+
+ppl::common::RetCode mmcv_nms_bitmask_ndarray_fp32_avx512(
+    const float *boxes,
+    const float *scores,
+    const int64_t *idxs,
+    const uint32_t num_boxes_in,
+    const float iou_threshold,
+    const int64_t offset,
+    int64_t *dst,
+    int64_t *num_boxes_out)
+{
+    return mmcv_nms_bitmask_ndarray_fp32_common<mmcv_nms_bitmask_kernel_fp32_avx512>(
+        boxes, scores, idxs, num_boxes_in, iou_threshold, offset, dst, num_boxes_out);
+}
+
+}}}; // namespace ppl::kernel::x86
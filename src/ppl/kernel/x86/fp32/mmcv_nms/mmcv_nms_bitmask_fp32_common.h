@@ -0,0 +1,157 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_FP32_MMCV_NMS_MMCV_NMS_BITMASK_FP32_COMMON_H_
+#define __ST_PPL_KERNEL_X86_FP32_MMCV_NMS_MMCV_NMS_BITMASK_FP32_COMMON_H_
+
+#include <vector>
+
+#include "ppl/kernel/x86/common/internal_include.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+// boxes in score order, split by coordinate and padded to 64
+struct mmcv_nms_boxes_soa {
+    const float *x1;
+    const float *y1;
+    const float *x2;
+    const float *y2;
+    const float *area;
+    const int32_t *cls; // null when all boxes are of one class
+};
+
+// Greedy nms as a bit matrix: bit j of row i is set when box j overlaps box
+// i over the threshold, within one class. Rows are built in panels of 512
+// boxes in parallel, rows already suppressed by earlier panels are skipped,
+// then a serial sweep over the panel ORs the rows of kept boxes together.
+// Only a panel of the matrix is alive at a time.
+template <typename kernel_t>
+ppl::common::RetCode mmcv_nms_bitmask_ndarray_fp32_common(
+    const float *boxes,
+    const float *scores,
+    const int64_t *idxs,
+    const uint32_t num_boxes_in,
+    const float iou_threshold,
+    const int64_t offset,
+    int64_t *dst,
+    int64_t *num_boxes_out)
+{
+    const int64_t n_boxes     = num_boxes_in;
+    const int64_t word_bits   = 64;
+    const int64_t panel_words = 8;
+    const int64_t num_words   = div_up(n_boxes, word_bits);
+    const int64_t pad_n       = num_words * word_bits;
+
+    *num_boxes_out = 0;
+    if (n_boxes == 0) {
+        return ppl::common::RC_SUCCESS;
+    }
+
+    std::vector<uint32_t> sorted_index(n_boxes);
+    argsort(scores, sorted_index.data(), n_boxes);
+
+    std::vector<float> soa(5 * pad_n, 0.0f);
+    std::vector<int32_t> cls(idxs ? pad_n : 0, -1);
+    float *x1   = soa.data() + 0 * pad_n;
+    float *y1   = soa.data() + 1 * pad_n;
+    float *x2   = soa.data() + 2 * pad_n;
+    float *y2   = soa.data() + 3 * pad_n;
+    float *area = soa.data() + 4 * pad_n;
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t i = 0; i < n_boxes; ++i) {
+        const float *box = boxes + sorted_index[i] * 4;
+        x1[i]            = box[0];
+        y1[i]            = box[1];
+        x2[i]            = box[2];
+        y2[i]            = box[3];
+        area[i]          = (box[2] - box[0] + offset) * (box[3] - box[1] + offset);
+        if (idxs) {
+            cls[i] = static_cast<int32_t>(idxs[sorted_index[i]]);
+        }
+    }
+    mmcv_nms_boxes_soa soa_boxes = {x1, y1, x2, y2, area, idxs ? cls.data() : nullptr};
+
+    std::vector<uint64_t> removed(num_words, 0);
+    std::vector<uint64_t> mask(panel_words * word_bits * num_words);
+    const float f_offset = static_cast<float>(offset);
+
+    for (int64_t pw = 0; pw < num_words; pw += panel_words) {
+        const int64_t pw_end  = min(pw + panel_words, num_words);
+        const int64_t row_beg = pw * word_bits;
+        const int64_t row_end = min(pw_end * word_bits, n_boxes);
+
+        bool all_removed = true;
+        for (int64_t w = pw; w < pw_end; ++w) {
+            const int64_t valid = min(n_boxes - w * word_bits, word_bits);
+            const uint64_t full = valid == word_bits ? ~0ULL : ((1ULL << valid) - 1);
+            all_removed         = all_removed && (removed[w] & full) == full;
+        }
+        if (all_removed) {
+            continue;
+        }
+
+        PRAGMA_OMP_PARALLEL_FOR_SCHEDULE(dynamic)
+        for (int64_t i = row_beg; i < row_end; ++i) {
+            if (removed[i / word_bits] & (1ULL << (i % word_bits))) {
+                continue;
+            }
+            uint64_t *l_mask = mask.data() + (i - row_beg) * num_words;
+            for (int64_t w = i / word_bits; w < num_words; ++w) {
+                l_mask[w] = kernel_t::iou_mask(soa_boxes, i, w * word_bits, iou_threshold, f_offset);
+            }
+        }
+
+        for (int64_t i = row_beg; i < row_end; ++i) {
+            if (removed[i / word_bits] & (1ULL << (i % word_bits))) {
+                continue;
+            }
+            dst[(*num_boxes_out)++] = sorted_index[i];
+            const uint64_t *l_mask  = mask.data() + (i - row_beg) * num_words;
+            for (int64_t w = i / word_bits; w < num_words; ++w) {
+                removed[w] |= l_mask[w];
+            }
+        }
+    }
+
+    return ppl::common::RC_SUCCESS;
+}
+
+ppl::common::RetCode mmcv_nms_bitmask_ndarray_fp32_fma(
+    const float *boxes,
+    const float *scores,
+    const int64_t *idxs,
+    const uint32_t num_boxes_in,
+    const float iou_threshold,
+    const int64_t offset,
+    int64_t *dst,
+    int64_t *num_boxes_out);
+
+#ifdef PPL_USE_X86_AVX512
+ppl::common::RetCode mmcv_nms_bitmask_ndarray_fp32_avx512(
+    const float *boxes,
+    const float *scores,
+    const int64_t *idxs,
+    const uint32_t num_boxes_in,
+    const float iou_threshold,
+    const int64_t offset,
+    int64_t *dst,
+    int64_t *num_boxes_out);
+#endif
+
+}}}; // namespace ppl::kernel::x86
+
+#endif
@@ -0,0 +1,70 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "ppl/kernel/x86/fp32/mmcv_nms/mmcv_nms_bitmask_fp32_common.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+struct mmcv_nms_bitmask_kernel_fp32_fma {
+    static inline uint64_t iou_mask(const mmcv_nms_boxes_soa &b, const int64_t i, const int64_t col, const float iou_threshold, const float offset)
+    {
+        const __m256 v_x1     = _mm256_set1_ps(b.x1[i]);
+        const __m256 v_y1     = _mm256_set1_ps(b.y1[i]);
+        const __m256 v_x2     = _mm256_set1_ps(b.x2[i]);
+        const __m256 v_y2     = _mm256_set1_ps(b.y2[i]);
+        const __m256 v_area   = _mm256_set1_ps(b.area[i]);
+        const __m256 v_offset = _mm256_set1_ps(offset);
+        const __m256 v_thresh = _mm256_set1_ps(iou_threshold);
+        const __m256 v_zero   = _mm256_setzero_ps();
+
+        uint64_t bits = 0;
+        for (int64_t j = 0; j < 64; j += 8) {
+            const int64_t c = col + j;
+            __m256 v_w      = _mm256_sub_ps(_mm256_min_ps(v_x2, _mm256_loadu_ps(b.x2 + c)), _mm256_max_ps(v_x1, _mm256_loadu_ps(b.x1 + c)));
+            __m256 v_h      = _mm256_sub_ps(_mm256_min_ps(v_y2, _mm256_loadu_ps(b.y2 + c)), _mm256_max_ps(v_y1, _mm256_loadu_ps(b.y1 + c)));
+            v_w             = _mm256_max_ps(v_zero, _mm256_add_ps(v_w, v_offset));
+            v_h             = _mm256_max_ps(v_zero, _mm256_add_ps(v_h, v_offset));
+            const __m256 v_inter = _mm256_mul_ps(v_w, v_h);
+            const __m256 v_union = _mm256_sub_ps(_mm256_add_ps(_mm256_loadu_ps(b.area + c), v_area), v_inter);
+            __m256 v_mask        = _mm256_cmp_ps(_mm256_div_ps(v_inter, v_union), v_thresh, _CMP_GE_OQ);
+            if (b.cls) {
+                const __m256i v_cls = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(b.cls + c)), _mm256_set1_epi32(b.cls[i]));
+                v_mask              = _mm256_and_ps(v_mask, _mm256_castsi256_ps(v_cls));
+            }
+            bits |= static_cast<uint64_t>(_mm256_movemask_ps(v_mask)) << j;
+        }
+        return bits;
+    }
+};
+
+ppl::common::RetCode mmcv_nms_bitmask_ndarray_fp32_fma(
+    const float *boxes,
+    const float *scores,
+    const int64_t *idxs,
+    const uint32_t num_boxes_in,
+    const float iou_threshold,
+    const int64_t offset,
+    int64_t *dst,
+    int64_t *num_boxes_out)
+{
+    return mmcv_nms_bitmask_ndarray_fp32_common<mmcv_nms_bitmask_kernel_fp32_fma>(
+        boxes, scores, idxs, num_boxes_in, iou_threshold, offset, dst, num_boxes_out);
+}
+
+}}}; // namespace ppl::kernel::x86
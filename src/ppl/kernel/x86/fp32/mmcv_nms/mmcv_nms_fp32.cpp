@@ -16,6 +16,8 @@
 // under the License.
 
 #include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/fp32/mmcv_nms.h"
+#include "ppl/kernel/x86/fp32/mmcv_nms/mmcv_nms_bitmask_fp32_common.h"
 
 #include <vector>
 #include <algorithm>
@@ -98,4 +100,78 @@ ppl::common::RetCode mmcv_nms_ndarray_fp32(
     return mmcv_nms_ndarray_fp32_naive(boxes, scores, num_boxes_in, iou_threshold, offset, dst, num_boxes_out);
 }
 
+struct mmcv_nms_bitmask_kernel_fp32_ref {
+    static inline uint64_t iou_mask(const mmcv_nms_boxes_soa &b, const int64_t i, const int64_t col, const float iou_threshold, const float offset)
+    {
+        uint64_t bits = 0;
+        for (int64_t j = 0; j < 64; ++j) {
+            const int64_t c = col + j;
+            if (b.cls && b.cls[c] != b.cls[i]) {
+                continue;
+            }
+            const float w     = max(0.f, min(b.x2[i], b.x2[c]) - max(b.x1[i], b.x1[c]) + offset);
+            const float h     = max(0.f, min(b.y2[i], b.y2[c]) - max(b.y1[i], b.y1[c]) + offset);
+            const float inter = w * h;
+            if (inter / (b.area[c] + b.area[i] - inter) >= iou_threshold) {
+                bits |= 1ULL << j;
+            }
+        }
+        return bits;
+    }
+};
+
+static ppl::common::RetCode mmcv_nms_bitmask_ndarray_fp32(
+        const ppl::common::isa_t isa,
+        const float *boxes,
+        const float *scores,
+        const int64_t *idxs,
+        const uint32_t num_boxes_in,
+        const float iou_threshold,
+        const int64_t offset,
+        int64_t *dst,
+        int64_t *num_boxes_out)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return mmcv_nms_bitmask_ndarray_fp32_avx512(boxes, scores, idxs, num_boxes_in, iou_threshold, offset, dst, num_boxes_out);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_FMA) {
+        return mmcv_nms_bitmask_ndarray_fp32_fma(boxes, scores, idxs, num_boxes_in, iou_threshold, offset, dst, num_boxes_out);
+    }
+    return mmcv_nms_bitmask_ndarray_fp32_common<mmcv_nms_bitmask_kernel_fp32_ref>(
+        boxes, scores, idxs, num_boxes_in, iou_threshold, offset, dst, num_boxes_out);
+}
+
+ppl::common::RetCode mmcv_nms_ndarray_fp32(
+        const ppl::common::isa_t isa,
+        const float *boxes,
+        const float *scores,
+        const uint32_t num_boxes_in,
+        const float iou_threshold,
+        const int64_t offset,
+        int64_t *dst,
+        int64_t *num_boxes_out)
+{
+    // scalar bit matrix has no early exit, the naive loop is faster there
+    if (!(isa & (ppl::common::ISA_X86_FMA | ppl::common::ISA_X86_AVX512))) {
+        return mmcv_nms_ndarray_fp32_naive(boxes, scores, num_boxes_in, iou_threshold, offset, dst, num_boxes_out);
+    }
+    return mmcv_nms_bitmask_ndarray_fp32(isa, boxes, scores, nullptr, num_boxes_in, iou_threshold, offset, dst, num_boxes_out);
+}
+
+ppl::common::RetCode mmcv_batched_nms_ndarray_fp32(
+        const ppl::common::isa_t isa,
+        const float *boxes,
+        const float *scores,
+        const int64_t *idxs,
+        const uint32_t num_boxes_in,
+        const float iou_threshold,
+        const int64_t offset,
+        int64_t *dst,
+        int64_t *num_boxes_out)
+{
+    return mmcv_nms_bitmask_ndarray_fp32(isa, boxes, scores, idxs, num_boxes_in, iou_threshold, offset, dst, num_boxes_out);
+}
+
 }}}; // namespace ppl::kernel::x86
@@ -0,0 +1,152 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <float.h>
+#include <math.h>
+#include <vector>
+
+#include "ppl/kernel/x86/fp32/mmcv_roialign.h"
+#include "ppl/kernel/x86/fp32/mmcv_roialign/mmcv_roialign_batched_n16cx_fp32_common.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+struct mmcv_roialign_batched_kernel_fp32_ref {
+    static inline void pool_avg(const float *src, const precalc_info *pc, const int64_t count, const float r_count, float *dst)
+    {
+        const int64_t c_blk = 16;
+        float acc[c_blk]    = {0};
+        for (int64_t i = 0; i < count; ++i) {
+            for (int64_t c = 0; c < c_blk; ++c) {
+                acc[c] += pc[i].w1 * src[pc[i].pos1 * c_blk + c] + pc[i].w2 * src[pc[i].pos2 * c_blk + c] +
+                          pc[i].w3 * src[pc[i].pos3 * c_blk + c] + pc[i].w4 * src[pc[i].pos4 * c_blk + c];
+            }
+        }
+        for (int64_t c = 0; c < c_blk; ++c) {
+            dst[c] = acc[c] * r_count;
+        }
+    }
+
+    static inline void pool_max(const float *src, const precalc_info *pc, const int64_t count, float *dst)
+    {
+        const int64_t c_blk = 16;
+        float acc[c_blk];
+        for (int64_t c = 0; c < c_blk; ++c) {
+            acc[c] = -FLT_MAX;
+        }
+        for (int64_t i = 0; i < count; ++i) {
+            for (int64_t c = 0; c < c_blk; ++c) {
+                acc[c] = max(acc[c], pc[i].w1 * src[pc[i].pos1 * c_blk + c] + pc[i].w2 * src[pc[i].pos2 * c_blk + c] +
+                                         pc[i].w3 * src[pc[i].pos3 * c_blk + c] + pc[i].w4 * src[pc[i].pos4 * c_blk + c]);
+            }
+        }
+        for (int64_t c = 0; c < c_blk; ++c) {
+            dst[c] = acc[c];
+        }
+    }
+};
+
+static ppl::common::RetCode mmcv_roialign_batched_n16cx_fp32(
+    const ppl::common::isa_t isa,
+    const int64_t num_levels,
+    const ppl::common::TensorShape **input_shapes,
+    const float **inputs,
+    const float *spatial_scales,
+    const ppl::common::TensorShape *rois_shape,
+    const ppl::common::TensorShape *output_shape,
+    const float *rois,
+    const int32_t *roi_levels,
+    const int64_t aligned,
+    const int64_t sampling_ratio,
+    const int32_t pool_mode,
+    const bool rotated,
+    const bool clockwise,
+    float *output)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return mmcv_roialign_batched_n16cx_fp32_avx512(
+            num_levels, input_shapes, inputs, spatial_scales, rois_shape, output_shape, rois,
+            roi_levels, aligned, sampling_ratio, pool_mode, rotated, clockwise, output);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_FMA) {
+        return mmcv_roialign_batched_n16cx_fp32_fma(
+            num_levels, input_shapes, inputs, spatial_scales, rois_shape, output_shape, rois,
+            roi_levels, aligned, sampling_ratio, pool_mode, rotated, clockwise, output);
+    }
+    return mmcv_roialign_batched_n16cx_fp32_common<mmcv_roialign_batched_kernel_fp32_ref>(
+        num_levels, input_shapes, inputs, spatial_scales, rois_shape, output_shape, rois,
+        roi_levels, aligned, sampling_ratio, pool_mode, rotated, clockwise, output);
+}
+
+ppl::common::RetCode mmcv_roialign_rotated_n16cx_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *input_shape,
+    const ppl::common::TensorShape *rois_shape,
+    const ppl::common::TensorShape *output_shape,
+    const float *input,
+    const float *rois,
+    const int64_t aligned,
+    const int64_t sampling_ratio,
+    const float spatial_scale,
+    const bool clockwise,
+    float *output)
+{
+    return mmcv_roialign_batched_n16cx_fp32(
+        isa, 1, &input_shape, &input, &spatial_scale, rois_shape, output_shape, rois,
+        nullptr, aligned, sampling_ratio, 1, true, clockwise, output);
+}
+
+ppl::common::RetCode mmcv_roialign_multilevel_n16cx_fp32(
+    const ppl::common::isa_t isa,
+    const int64_t num_levels,
+    const ppl::common::TensorShape **input_shapes,
+    const float **inputs,
+    const float *spatial_scales,
+    const ppl::common::TensorShape *rois_shape,
+    const ppl::common::TensorShape *output_shape,
+    const float *rois,
+    const int32_t *roi_levels,
+    const float finest_scale,
+    const int64_t aligned,
+    const int64_t sampling_ratio,
+    const int32_t pool_mode, // 0: max, 1: avg
+    float *output)
+{
+    if (num_levels <= 0) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    std::vector<int32_t> mapped_levels;
+    if (!roi_levels) {
+        const int64_t n_rois = rois_shape->GetDim(0);
+        mapped_levels.resize(n_rois);
+        for (int64_t n = 0; n < n_rois; ++n) {
+            const float *offset_rois = rois + n * 5;
+            const float scale        = sqrtf((offset_rois[3] - offset_rois[1]) * (offset_rois[4] - offset_rois[2]));
+            const int32_t level      = static_cast<int32_t>(floorf(log2f(scale / finest_scale + 1e-6f)));
+            mapped_levels[n]         = min<int32_t>(max<int32_t>(level, 0), num_levels - 1);
+        }
+        roi_levels = mapped_levels.data();
+    }
+
+    return mmcv_roialign_batched_n16cx_fp32(
+        isa, num_levels, input_shapes, inputs, spatial_scales, rois_shape, output_shape, rois,
+        roi_levels, aligned, sampling_ratio, pool_mode, false, false, output);
+}
+
+}}}; // namespace ppl::kernel::x86
@@ -0,0 +1,75 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "ppl/kernel/x86/fp32/mmcv_roialign/mmcv_roialign_batched_n16cx_fp32_common.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+struct mmcv_roialign_batched_kernel_fp32_avx512 {
+    static inline __m512 sample(const float *src, const precalc_info &pc)
+    {
+        const int64_t c_blk = 16;
+        __m512 v_val = _mm512_mul_ps(_mm512_set1_ps(pc.w1), _mm512_loadu_ps(src + pc.pos1 * c_blk));
+        v_val        = _mm512_fmadd_ps(_mm512_set1_ps(pc.w2), _mm512_loadu_ps(src + pc.pos2 * c_blk), v_val);
+        v_val        = _mm512_fmadd_ps(_mm512_set1_ps(pc.w3), _mm512_loadu_ps(src + pc.pos3 * c_blk), v_val);
+        v_val        = _mm512_fmadd_ps(_mm512_set1_ps(pc.w4), _mm512_loadu_ps(src + pc.pos4 * c_blk), v_val);
+        return v_val;
+    }
+
+    static inline void pool_avg(const float *src, const precalc_info *pc, const int64_t count, const float r_count, float *dst)
+    {
+        __m512 v_dst = _mm512_setzero_ps();
+        for (int64_t i = 0; i < count; ++i) {
+            v_dst = _mm512_add_ps(v_dst, sample(src, pc[i]));
+        }
+        _mm512_storeu_ps(dst, _mm512_mul_ps(v_dst, _mm512_set1_ps(r_count)));
+    }
+
+    static inline void pool_max(const float *src, const precalc_info *pc, const int64_t count, float *dst)
+    {
+        __m512 v_dst = _mm512_set1_ps(-FLT_MAX);
+        for (int64_t i = 0; i < count; ++i) {
+            v_dst = _mm512_max_ps(v_dst, sample(src, pc[i]));
+        }
+        _mm512_storeu_ps(dst, v_dst);
+    }
+};
+
+ppl::common::RetCode mmcv_roialign_batched_n16cx_fp32_avx512(
+    const int64_t num_levels,
+    const ppl::common::TensorShape **input_shapes,
+    const float **inputs,
+    const float *spatial_scales,
+    const ppl::common::TensorShape *rois_shape,
+    const ppl::common::TensorShape *output_shape,
+    const float *rois,
+    const int32_t *roi_levels,
+    const int64_t aligned,
+    const int64_t sampling_ratio,
+    const int32_t pool_mode,
+    const bool rotated,
+    const bool clockwise,
+    float *output)
+{
+    return mmcv_roialign_batched_n16cx_fp32_common<mmcv_roialign_batched_kernel_fp32_avx512>(
+        num_levels, input_shapes, inputs, spatial_scales, rois_shape, output_shape, rois,
+        roi_levels, aligned, sampling_ratio, pool_mode, rotated, clockwise, output);
+}
+
+}}}; // namespace ppl::kernel::x86
@@ -0,0 +1,304 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_FP32_MMCV_ROIALIGN_MMCV_ROIALIGN_BATCHED_N16CX_FP32_COMMON_H_
+#define __ST_PPL_KERNEL_X86_FP32_MMCV_ROIALIGN_MMCV_ROIALIGN_BATCHED_N16CX_FP32_COMMON_H_
+
+#include <float.h>
+#include <math.h>
+#include <vector>
+#include <algorithm>
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/common/mmcv_roialign/mmcv_roialign_common.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+// rotated rois are (batch, center_x, center_y, w, h, theta) and rotate the
+// sampling grid around the center, plain rois are (batch, x1, y1, x2, y2)
+static inline void mmcv_roialign_batched_pre_calc(
+    const int64_t height,
+    const int64_t width,
+    const int64_t pooled_height,
+    const int64_t pooled_width,
+    const int64_t roi_bin_grid_h,
+    const int64_t roi_bin_grid_w,
+    const float roi_start_h,
+    const float roi_start_w,
+    const float bin_size_h,
+    const float bin_size_w,
+    const bool rotated,
+    const float roi_center_h,
+    const float roi_center_w,
+    const float cos_theta,
+    const float sin_theta,
+    precalc_info *pre_calc)
+{
+    int64_t pre_calc_index = 0;
+    for (int64_t ph = 0; ph < pooled_height; ph++) {
+        for (int64_t pw = 0; pw < pooled_width; pw++) {
+            for (int64_t iy = 0; iy < roi_bin_grid_h; iy++) {
+                const float yy = roi_start_h + ph * bin_size_h +
+                                 static_cast<float>(iy + .5f) * bin_size_h / static_cast<float>(roi_bin_grid_h);
+                for (int64_t ix = 0; ix < roi_bin_grid_w; ix++) {
+                    const float xx = roi_start_w + pw * bin_size_w +
+                                     static_cast<float>(ix + .5f) * bin_size_w / static_cast<float>(roi_bin_grid_w);
+
+                    float y = yy;
+                    float x = xx;
+                    if (rotated) {
+                        y = yy * cos_theta - xx * sin_theta + roi_center_h;
+                        x = yy * sin_theta + xx * cos_theta + roi_center_w;
+                    }
+
+                    precalc_info &pc = pre_calc[pre_calc_index++];
+                    if (y < -1.0 || y > height || x < -1.0 || x > width) {
+                        pc.pos1 = pc.pos2 = pc.pos3 = pc.pos4 = 0;
+                        pc.w1 = pc.w2 = pc.w3 = pc.w4 = 0;
+                        continue;
+                    }
+
+                    y = max(y, 0.0f);
+                    x = max(x, 0.0f);
+
+                    int64_t y_low = static_cast<int64_t>(y);
+                    int64_t x_low = static_cast<int64_t>(x);
+                    int64_t y_high;
+                    int64_t x_high;
+
+                    if (y_low >= height - 1) {
+                        y_high = y_low = height - 1;
+                        y              = static_cast<float>(y_low);
+                    } else {
+                        y_high = y_low + 1;
+                    }
+
+                    if (x_low >= width - 1) {
+                        x_high = x_low = width - 1;
+                        x              = static_cast<float>(x_low);
+                    } else {
+                        x_high = x_low + 1;
+                    }
+
+                    const float ly = y - y_low;
+                    const float lx = x - x_low;
+                    const float hy = 1.0f - ly;
+                    const float hx = 1.0f - lx;
+
+                    pc.pos1 = y_low * width + x_low;
+                    pc.pos2 = y_low * width + x_high;
+                    pc.pos3 = y_high * width + x_low;
+                    pc.pos4 = y_high * width + x_high;
+                    pc.w1   = hy * hx;
+                    pc.w2   = hy * lx;
+                    pc.w3   = ly * hx;
+                    pc.w4   = ly * lx;
+                }
+            }
+        }
+    }
+}
+
+// Output is [num_rois, channels, pooled_h, pooled_w] in n16cx. Each task is
+// one roi and a chunk of channel blocks; sample positions and weights are
+// computed once per task and reused by every channel block in it. Tasks are
+// issued largest-first under dynamic scheduling, so a few huge rois do not
+// serialize behind a static partition. roi_levels selects the feature map
+// of every roi and may be null for a single level.
+template <typename kernel_t>
+ppl::common::RetCode mmcv_roialign_batched_n16cx_fp32_common(
+    const int64_t num_levels,
+    const ppl::common::TensorShape **input_shapes,
+    const float **inputs,
+    const float *spatial_scales,
+    const ppl::common::TensorShape *rois_shape,
+    const ppl::common::TensorShape *output_shape,
+    const float *rois,
+    const int32_t *roi_levels,
+    const int64_t aligned,
+    const int64_t sampling_ratio,
+    const int32_t pool_mode, // 0: max, 1: avg
+    const bool rotated,
+    const bool clockwise,
+    float *output)
+{
+    const int64_t c_blk         = 16;
+    const int64_t n_rois        = rois_shape->GetDim(0);
+    const int64_t roi_len       = rotated ? 6 : 5;
+    const int64_t channels      = output_shape->GetDim(1);
+    const int64_t pad_c         = round_up(channels, c_blk);
+    const int64_t num_cb        = pad_c / c_blk;
+    const int64_t pooled_height = output_shape->GetDim(2);
+    const int64_t pooled_width  = output_shape->GetDim(3);
+    const int64_t pooled_space  = pooled_height * pooled_width;
+
+    if (n_rois == 0) {
+        return ppl::common::RC_SUCCESS;
+    }
+    if (rois_shape->GetDim(1) != roi_len) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    for (int64_t l = 0; l < num_levels; ++l) {
+        if (input_shapes[l]->GetDim(1) != channels) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+    }
+
+    // roi size and sampling grid of every roi, also its cost for scheduling
+    // Do not use rounding; this implementation detail is critical
+    const float offset = aligned ? 0.5f : 0.0f;
+    std::vector<float> roi_w(n_rois), roi_h(n_rois);
+    std::vector<int64_t> grid_h(n_rois), grid_w(n_rois), roi_cost(n_rois);
+    for (int64_t n = 0; n < n_rois; ++n) {
+        const float *offset_rois = rois + n * roi_len;
+        const int64_t level      = roi_levels ? roi_levels[n] : 0;
+        if (level < 0 || level >= num_levels) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+        const int64_t batch_ind = static_cast<int64_t>(offset_rois[0]);
+        if (batch_ind < 0 || batch_ind >= input_shapes[level]->GetDim(0)) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+        const float scale = spatial_scales[level];
+        if (rotated) {
+            roi_w[n] = offset_rois[3] * scale;
+            roi_h[n] = offset_rois[4] * scale;
+        } else {
+            roi_w[n] = (offset_rois[3] * scale - offset) - (offset_rois[1] * scale - offset);
+            roi_h[n] = (offset_rois[4] * scale - offset) - (offset_rois[2] * scale - offset);
+        }
+        if (!aligned) { // for backward-compatibility only
+            roi_w[n] = max(roi_w[n], 1.0f);
+            roi_h[n] = max(roi_h[n], 1.0f);
+        }
+        // We use roi_bin_grid to sample the grid and mimic integral
+        grid_h[n]   = (sampling_ratio > 0) ? sampling_ratio : max<int64_t>(static_cast<int64_t>(ceilf(roi_h[n] / pooled_height)), 0);
+        grid_w[n]   = (sampling_ratio > 0) ? sampling_ratio : max<int64_t>(static_cast<int64_t>(ceilf(roi_w[n] / pooled_width)), 0);
+        roi_cost[n] = (grid_h[n] * grid_w[n] + 1) * pooled_space;
+    }
+
+    // split channels of a roi only when rois alone cannot balance the threads
+    const int64_t num_threads = PPL_OMP_MAX_THREADS();
+    const int64_t num_c_chks  = min(num_cb, max<int64_t>(div_up(4 * num_threads, n_rois), 1));
+    const int64_t cb_per_chk  = div_up(num_cb, num_c_chks);
+
+    std::vector<int64_t> roi_order(n_rois);
+    for (int64_t n = 0; n < n_rois; ++n) {
+        roi_order[n] = n;
+    }
+    std::stable_sort(roi_order.begin(), roi_order.end(), [&roi_cost](const int64_t a, const int64_t b) {
+        return roi_cost[a] > roi_cost[b];
+    });
+
+    PRAGMA_OMP_PARALLEL_FOR_SCHEDULE(dynamic)
+    for (int64_t task = 0; task < n_rois * num_c_chks; ++task) {
+        const int64_t n      = roi_order[task / num_c_chks];
+        const int64_t cb_beg = task % num_c_chks * cb_per_chk;
+        const int64_t cb_end = min(cb_beg + cb_per_chk, num_cb);
+        if (cb_beg >= cb_end) {
+            continue;
+        }
+
+        const int64_t level      = roi_levels ? roi_levels[n] : 0;
+        const int64_t height     = input_shapes[level]->GetDim(2);
+        const int64_t width      = input_shapes[level]->GetDim(3);
+        const float scale        = spatial_scales[level];
+        const float *offset_rois = rois + n * roi_len;
+        const int64_t batch_ind  = static_cast<int64_t>(offset_rois[0]);
+
+        const float roi_width  = roi_w[n];
+        const float roi_height = roi_h[n];
+        float roi_start_w, roi_start_h;
+        float roi_center_w = 0.0f, roi_center_h = 0.0f, cos_theta = 1.0f, sin_theta = 0.0f;
+        if (rotated) {
+            roi_center_w      = offset_rois[1] * scale - offset;
+            roi_center_h      = offset_rois[2] * scale - offset;
+            roi_start_w       = -roi_width / 2.0f;
+            roi_start_h       = -roi_height / 2.0f;
+            const float theta = clockwise ? -offset_rois[5] : offset_rois[5];
+            cos_theta         = cosf(theta);
+            sin_theta         = sinf(theta);
+        } else {
+            roi_start_w = offset_rois[1] * scale - offset;
+            roi_start_h = offset_rois[2] * scale - offset;
+        }
+        const float bin_size_h = roi_height / static_cast<float>(pooled_height);
+        const float bin_size_w = roi_width / static_cast<float>(pooled_width);
+
+        const int64_t count = grid_h[n] * grid_w[n];
+        // When the grid is empty, output zeros == 0/1, instead of NaN.
+        const float r_count = 1.0f / max<int64_t>(count, 1);
+
+        std::vector<precalc_info> pre_calc(count * pooled_space);
+        mmcv_roialign_batched_pre_calc(
+            height, width, pooled_height, pooled_width, grid_h[n], grid_w[n],
+            roi_start_h, roi_start_w, bin_size_h, bin_size_w,
+            rotated, roi_center_h, roi_center_w, cos_theta, sin_theta, pre_calc.data());
+
+        for (int64_t cb = cb_beg; cb < cb_end; ++cb) {
+            const float *l_src = inputs[level] + ((batch_ind * num_cb + cb) * height * width) * c_blk;
+            float *l_dst       = output + ((n * num_cb + cb) * pooled_space) * c_blk;
+            for (int64_t s = 0; s < pooled_space; ++s) {
+                if (pool_mode == 0) {
+                    kernel_t::pool_max(l_src, pre_calc.data() + s * count, count, l_dst + s * c_blk);
+                } else {
+                    kernel_t::pool_avg(l_src, pre_calc.data() + s * count, count, r_count, l_dst + s * c_blk);
+                }
+            }
+        }
+    }
+
+    return ppl::common::RC_SUCCESS;
+}
+
+ppl::common::RetCode mmcv_roialign_batched_n16cx_fp32_fma(
+    const int64_t num_levels,
+    const ppl::common::TensorShape **input_shapes,
+    const float **inputs,
+    const float *spatial_scales,
+    const ppl::common::TensorShape *rois_shape,
+    const ppl::common::TensorShape *output_shape,
+    const float *rois,
+    const int32_t *roi_levels,
+    const int64_t aligned,
+    const int64_t sampling_ratio,
+    const int32_t pool_mode,
+    const bool rotated,
+    const bool clockwise,
+    float *output);
+
+#ifdef PPL_USE_X86_AVX512
+ppl::common::RetCode mmcv_roialign_batched_n16cx_fp32_avx512(
+    const int64_t num_levels,
+    const ppl::common::TensorShape **input_shapes,
+    const float **inputs,
+    const float *spatial_scales,
+    const ppl::common::TensorShape *rois_shape,
+    const ppl::common::TensorShape *output_shape,
+    const float *rois,
+    const int32_t *roi_levels,
+    const int64_t aligned,
+    const int64_t sampling_ratio,
+    const int32_t pool_mode,
+    const bool rotated,
+    const bool clockwise,
+    float *output);
+#endif
+
+}}}; // namespace ppl::kernel::x86
+
+#endif
@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "ppl/kernel/x86/fp32/mmcv_roialign/mmcv_roialign_batched_n16cx_fp32_common.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+struct mmcv_roialign_batched_kernel_fp32_fma {
+    static inline void sample(const float *src, const precalc_info &pc, __m256 &v_val0, __m256 &v_val1)
+    {
+        const int64_t c_blk = 16;
+        const __m256 v_w1   = _mm256_set1_ps(pc.w1);
+        const __m256 v_w2   = _mm256_set1_ps(pc.w2);
+        const __m256 v_w3   = _mm256_set1_ps(pc.w3);
+        const __m256 v_w4   = _mm256_set1_ps(pc.w4);
+        v_val0 = _mm256_mul_ps(v_w1, _mm256_loadu_ps(src + pc.pos1 * c_blk + 0));
+        v_val1 = _mm256_mul_ps(v_w1, _mm256_loadu_ps(src + pc.pos1 * c_blk + 8));
+        v_val0 = _mm256_fmadd_ps(v_w2, _mm256_loadu_ps(src + pc.pos2 * c_blk + 0), v_val0);
+        v_val1 = _mm256_fmadd_ps(v_w2, _mm256_loadu_ps(src + pc.pos2 * c_blk + 8), v_val1);
+        v_val0 = _mm256_fmadd_ps(v_w3, _mm256_loadu_ps(src + pc.pos3 * c_blk + 0), v_val0);
+        v_val1 = _mm256_fmadd_ps(v_w3, _mm256_loadu_ps(src + pc.pos3 * c_blk + 8), v_val1);
+        v_val0 = _mm256_fmadd_ps(v_w4, _mm256_loadu_ps(src + pc.pos4 * c_blk + 0), v_val0);
+        v_val1 = _mm256_fmadd_ps(v_w4, _mm256_loadu_ps(src + pc.pos4 * c_blk + 8), v_val1);
+    }
+
+    static inline void pool_avg(const float *src, const precalc_info *pc, const int64_t count, const float r_count, float *dst)
+    {
+        __m256 v_dst0 = _mm256_setzero_ps();
+        __m256 v_dst1 = _mm256_setzero_ps();
+        for (int64_t i = 0; i < count; ++i) {
+            __m256 v_val0, v_val1;
+            sample(src, pc[i], v_val0, v_val1);
+            v_dst0 = _mm256_add_ps(v_dst0, v_val0);
+            v_dst1 = _mm256_add_ps(v_dst1, v_val1);
+        }
+        const __m256 v_rcount = _mm256_set1_ps(r_count);
+        _mm256_storeu_ps(dst + 0, _mm256_mul_ps(v_dst0, v_rcount));
+        _mm256_storeu_ps(dst + 8, _mm256_mul_ps(v_dst1, v_rcount));
+    }
+
+    static inline void pool_max(const float *src, const precalc_info *pc, const int64_t count, float *dst)
+    {
+        __m256 v_dst0 = _mm256_set1_ps(-FLT_MAX);
+        __m256 v_dst1 = _mm256_set1_ps(-FLT_MAX);
+        for (int64_t i = 0; i < count; ++i) {
+            __m256 v_val0, v_val1;
+            sample(src, pc[i], v_val0, v_val1);
+            v_dst0 = _mm256_max_ps(v_dst0, v_val0);
+            v_dst1 = _mm256_max_ps(v_dst1, v_val1);
+        }
+        _mm256_storeu_ps(dst + 0, v_dst0);
+        _mm256_storeu_ps(dst + 8, v_dst1);
+    }
+};
+
+ppl::common::RetCode mmcv_roialign_batched_n16cx_fp32_fma(
+    const int64_t num_levels,
+    const ppl::common::TensorShape **input_shapes,
+    const float **inputs,
+    const float *spatial_scales,
+    const ppl::common::TensorShape *rois_shape,
+    const ppl::common::TensorShape *output_shape,
+    const float *rois,
+    const int32_t *roi_levels,
+    const int64_t aligned,
+    const int64_t sampling_ratio,
+    const int32_t pool_mode,
+    const bool rotated,
+    const bool clockwise,
+    float *output)
+{
+    return mmcv_roialign_batched_n16cx_fp32_common<mmcv_roialign_batched_kernel_fp32_fma>(
+        num_levels, input_shapes, inputs, spatial_scales, rois_shape, output_shape, rois,
+        roi_levels, aligned, sampling_ratio, pool_mode, rotated, clockwise, output);
+}
+
+}}}; // namespace ppl::kernel::x86
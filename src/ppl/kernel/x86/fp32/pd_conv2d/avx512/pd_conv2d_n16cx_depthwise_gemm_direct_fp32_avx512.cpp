@@ -0,0 +1,386 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <string.h>
+#include <vector>
+
+#include "ppl/kernel/x86/common/avx_tools.h"
+#include "ppl/kernel/x86/fp32/conv2d/avx512/conv2d_n16cx_gemm_direct_fp32_avx512.h"
+#include "ppl/kernel/x86/fp32/conv2d/avx512/conv2d_n16cx_gemm_direct_kernel_fp32_avx512.h"
+#include "ppl/kernel/x86/fp32/pd_conv2d/avx512/pd_conv2d_n16cx_depthwise_gemm_direct_fp32_avx512.h"
+#include "ppl/kernel/x86/fp32/pd_conv2d/avx512/pd_conv2d_n16cx_depthwise_kernel_fp32_avx512.h"
+#include "ppl/kernel/x86/common/array_param_helper.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+static const int64_t ASSUME_L2_BYTES = 256 * 1024;
+static const int64_t ASSUME_L3_BYTES = 2048 * 1024;
+static const float L2_RATIO = 0.251f;
+static const float L3_RATIO = 0.501f;
+
+static const int64_t IC_DATA_BLK = conv2d_n16cx_gemm_direct_kernel_fp32_avx512::config::IC_DATA_BLK;
+static const int64_t OC_DATA_BLK = conv2d_n16cx_gemm_direct_kernel_fp32_avx512::config::OC_DATA_BLK;
+static const int64_t CH_DATA_BLK = pd_conv2d_n16cx_depthwise_kernel_fp32_avx512::config::CH_DATA_BLK;
+
+static const int64_t OH_L2_BLK_MIN = 1;
+
+int64_t pd_conv2d_n16cx_depthwise_gemm_direct_fp32_avx512_executor::cal_ic_l2_blk(const conv2d_param &param)
+{
+    return conv2d_n16cx_gemm_direct_fp32_avx512_executor::cal_ic_l2_blk(param);
+}
+
+void pd_conv2d_n16cx_depthwise_gemm_direct_fp32_avx512_executor::init_preproc_param()
+{
+    auto dw_param = depthwise_conv2d_executor_->conv_param();
+    auto gd_param = conv2d_executor_->conv_param();
+    schedule_param_.padded_ch  = round_up(dw_param->channels, CH_DATA_BLK);
+    schedule_param_.oc_per_grp = gd_param->num_output / gd_param->group;
+    schedule_param_.padded_oc  = round_up(schedule_param_.oc_per_grp, OC_DATA_BLK);
+    schedule_param_.gd_ker_blk = conv2d_n16cx_gemm_direct_kernel_fp32_avx512::config::MAX_S_BLK;
+    schedule_param_.oc_ker_blk = conv2d_n16cx_gemm_direct_kernel_fp32_avx512::config::MAX_OC_BLK;
+    schedule_param_.dw_ker_blk = pd_conv2d_n16cx_depthwise_kernel_fp32_avx512::config::MAX_W_BLK;
+
+    inter_shape_.Reshape(dst_shape_->GetDims(), dst_shape_->GetDimCount());
+    inter_shape_.SetDim(1, dw_param->num_output);
+    inter_shape_.SetDataType(ppl::common::DATATYPE_FLOAT32);
+    inter_shape_.SetDataFormat(ppl::common::DATAFORMAT_N16CX);
+
+    depthwise_conv2d_executor_->set_src_shape(src_shape_);
+    depthwise_conv2d_executor_->set_dst_shape(&inter_shape_);
+    conv2d_executor_->set_src_shape(&inter_shape_);
+    conv2d_executor_->set_dst_shape(dst_shape_);
+    conv2d_executor_->set_sum_src_shape(sum_src_shape_);
+}
+
+void pd_conv2d_n16cx_depthwise_gemm_direct_fp32_avx512_executor::cal_kernel_tunning_param()
+{
+    const conv2d_param &gd_p = *conv2d_executor_->conv_param();
+    const conv2d_param &dw_p = *depthwise_conv2d_executor_->conv_param();
+    kernel_schedule_param &sp = schedule_param_;
+
+    const int64_t num_thread = PPL_OMP_MAX_THREADS();
+    const int64_t batch      = src_shape_->GetDim(0);
+    const int64_t src_h      = src_shape_->GetDim(2);
+    const int64_t src_w      = src_shape_->GetDim(3);
+    const int64_t dst_h      = dst_shape_->GetDim(2);
+    const int64_t dst_w      = dst_shape_->GetDim(3);
+
+    const float l2_cap_per_core = (ppl::common::GetCpuCacheL2() == 0 ? ASSUME_L2_BYTES : ppl::common::GetCpuCacheL2()) * L2_RATIO / sizeof(float);
+    const float l3_cap_all_core = (ppl::common::GetCpuCacheL3() == 0 ? (ASSUME_L3_BYTES * num_thread) : ppl::common::GetCpuCacheL3()) * L3_RATIO / sizeof(float);
+
+    sp.ic_l2_blk = cal_ic_l2_blk(gd_p);
+    sp.ic_l2_cnt = div_up(sp.padded_ch, sp.ic_l2_blk);
+
+    // rows of all channels of depthwise output should stay in L2
+    const int64_t inter_row_len = sp.padded_ch * dst_w;
+    sp.oh_l2_blk = min<int64_t>(max<int64_t>(int64_t(l2_cap_per_core / inter_row_len), OH_L2_BLK_MIN), dst_h);
+
+    const int64_t oh_thread = div_up(num_thread, batch);
+    if (oh_thread > 1) {
+        sp.oh_l2_blk = min(sp.oh_l2_blk, max<int64_t>(dst_h / oh_thread, OH_L2_BLK_MIN));
+    }
+    while (true
+        && batch * div_up(dst_h, sp.oh_l2_blk) < num_thread * 4
+        && (batch * div_up(dst_h, sp.oh_l2_blk)) % num_thread != 0
+        && sp.oh_l2_blk > OH_L2_BLK_MIN) {
+        if (dst_h / sp.oh_l2_blk <= 2) {
+            sp.oh_l2_blk /= 2;
+        } else {
+            sp.oh_l2_blk -= 1;
+        }
+    }
+
+    const int64_t pad_rows = (sp.oh_l2_blk - 1) * dw_p.stride_h + dw_p.kernel_h;
+    sp.pad_buffer_len   = round_up(pad_rows * (src_w + 2 * dw_p.pad_w) * CH_DATA_BLK, PPL_X86_CACHELINE_BYTES() / sizeof(float));
+    sp.inter_buffer_len = round_up(sp.oh_l2_blk * inter_row_len, PPL_X86_CACHELINE_BYTES() / sizeof(float));
+
+    sp.use_nt_store = 0;
+    if (batch * gd_p.group * sp.padded_oc * dst_h * dst_w > l3_cap_all_core * 3) {
+        sp.use_nt_store = 1;
+    }
+
+    const int64_t feature_map_len = batch * (sp.padded_ch * src_h * src_w + sp.padded_oc * dst_h * dst_w);
+    const bool large_inter_cost = inter_row_len > (l2_cap_per_core / L2_RATIO); // even one row oversized
+    const bool small_feature_map = feature_map_len < (l2_cap_per_core * num_thread * 2); // data already in L2
+    if (large_inter_cost || small_feature_map) {
+        mode_ = pd_conv2d_fp32_mode::SEPARATE;
+    } else {
+        mode_ = pd_conv2d_fp32_mode::FUSE;
+    }
+}
+
+uint64_t pd_conv2d_n16cx_depthwise_gemm_direct_fp32_avx512_executor::cal_temp_buffer_size()
+{
+    if (mode_ == pd_conv2d_fp32_mode::SEPARATE) {
+        schedule_param_.gd_temp_buffer_size = round_up(conv2d_executor_->cal_temp_buffer_size(), PPL_X86_CACHELINE_BYTES());
+        schedule_param_.dw_temp_buffer_size = round_up(depthwise_conv2d_executor_->cal_temp_buffer_size(), PPL_X86_CACHELINE_BYTES());
+        return schedule_param_.gd_temp_buffer_size + schedule_param_.dw_temp_buffer_size + inter_shape_.CalcBytesIncludingPadding();
+    } else {
+        return (schedule_param_.pad_buffer_len + schedule_param_.inter_buffer_len) * sizeof(float) * PPL_OMP_MAX_THREADS();
+    }
+}
+
+ppl::common::RetCode pd_conv2d_n16cx_depthwise_gemm_direct_fp32_avx512_executor::prepare()
+{
+    bool gd_prepare_ready = conv2d_executor_ && conv2d_executor_->conv_param();
+    bool dw_prepare_ready = depthwise_conv2d_executor_ && depthwise_conv2d_executor_->conv_param();
+    if (!gd_prepare_ready || !dw_prepare_ready || !src_shape_ || !dst_shape_) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    if ((conv2d_executor_->conv_param()->fuse_flag & conv_fuse_flag::SUM) && !sum_src_shape_) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    init_preproc_param();
+    cal_kernel_tunning_param();
+
+    if (mode_ == pd_conv2d_fp32_mode::SEPARATE) {
+        auto ret = depthwise_conv2d_executor_->prepare();
+        if (ppl::common::RC_SUCCESS != ret) {
+            return ret;
+        }
+        ret = conv2d_executor_->prepare();
+        if (ppl::common::RC_SUCCESS != ret) {
+            return ret;
+        }
+    }
+
+    return ppl::common::RC_SUCCESS;
+}
+
+ppl::common::RetCode pd_conv2d_n16cx_depthwise_gemm_direct_fp32_avx512_executor::execute() {
+    if (mode_ == pd_conv2d_fp32_mode::SEPARATE) {
+        return separate_execute();
+    }
+    if (mode_ == pd_conv2d_fp32_mode::FUSE) {
+        return fuse_execute();
+    }
+    return ppl::common::RC_INVALID_VALUE;
+}
+
+ppl::common::RetCode pd_conv2d_n16cx_depthwise_gemm_direct_fp32_avx512_executor::separate_execute()
+{
+    if (!conv2d_executor_ || !depthwise_conv2d_executor_ || !src_ || !dst_ || !temp_buffer_) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    uint8_t *gd_temp_buffer = (uint8_t *)temp_buffer_;
+    uint8_t *dw_temp_buffer = gd_temp_buffer + schedule_param_.gd_temp_buffer_size;
+    float *inter_buffer     = (float*)(dw_temp_buffer + schedule_param_.dw_temp_buffer_size);
+    depthwise_conv2d_executor_->set_src(src_);
+    depthwise_conv2d_executor_->set_dst(inter_buffer);
+    depthwise_conv2d_executor_->set_temp_buffer(dw_temp_buffer);
+    conv2d_executor_->set_src(inter_buffer);
+    conv2d_executor_->set_dst(dst_);
+    conv2d_executor_->set_sum_src(sum_src_);
+    conv2d_executor_->set_temp_buffer(gd_temp_buffer);
+
+    auto ret = depthwise_conv2d_executor_->execute();
+    if (ppl::common::RC_SUCCESS != ret) {
+        return ret;
+    }
+    ret = conv2d_executor_->execute();
+    return ret;
+}
+
+ppl::common::RetCode pd_conv2d_n16cx_depthwise_gemm_direct_fp32_avx512_executor::fuse_execute()
+{
+    bool gd_execute_ready = conv2d_executor_ && conv2d_executor_->conv_param() && conv2d_executor_->cvt_filter() && conv2d_executor_->cvt_bias();
+    bool dw_execute_ready = depthwise_conv2d_executor_ && depthwise_conv2d_executor_->conv_param() && depthwise_conv2d_executor_->cvt_filter() && depthwise_conv2d_executor_->cvt_bias();
+    if (!gd_execute_ready || !dw_execute_ready || !src_ || !dst_ || !temp_buffer_) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    auto gd_e = conv2d_executor_;
+    auto dw_e = depthwise_conv2d_executor_;
+    const conv2d_param &gd_p = *gd_e->conv_param();
+    const conv2d_param &dw_p = *dw_e->conv_param();
+    const kernel_schedule_param &sp = schedule_param_;
+
+    const bool gd_with_sum   = gd_p.fuse_flag & conv_fuse_flag::SUM;
+    const bool gd_with_relu  = gd_p.fuse_flag & conv_fuse_flag::RELU;
+    const bool gd_with_relu6 = gd_p.fuse_flag & conv_fuse_flag::RELU6;
+    const bool dw_with_relu  = dw_p.fuse_flag & conv_fuse_flag::RELU;
+    const bool dw_with_relu6 = dw_p.fuse_flag & conv_fuse_flag::RELU6;
+
+    if (gd_with_sum && !sum_src_) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    const int64_t batch         = src_shape_->GetDim(0);
+    const int64_t src_h         = src_shape_->GetDim(2);
+    const int64_t src_w         = src_shape_->GetDim(3);
+    const int64_t dst_h         = dst_shape_->GetDim(2);
+    const int64_t dst_w         = dst_shape_->GetDim(3);
+
+    const int64_t src_b_stride      = round_up(src_shape_->GetDim(1), CH_DATA_BLK) * src_h * src_w;
+    const int64_t src_h_stride      = src_w * CH_DATA_BLK;
+    const int64_t pad_h_stride      = (src_w + 2 * dw_p.pad_w) * CH_DATA_BLK;
+    const int64_t dw_flt_chb_stride = dw_p.kernel_h * dw_p.kernel_w * CH_DATA_BLK;
+    const int64_t dst_b_stride      = round_up(dst_shape_->GetDim(1), OC_DATA_BLK) * dst_h * dst_w;
+    const int64_t dst_h_stride      = dst_w * OC_DATA_BLK;
+    const int64_t dst_ocb_stride    = dst_h * dst_w * OC_DATA_BLK;
+    const int64_t gd_flt_ocb_stride = sp.ic_l2_blk * OC_DATA_BLK;
+
+    int64_t sum_src_b_stride = 0;
+    if (gd_with_sum) {
+        sum_src_b_stride = round_up(sum_src_shape_->GetDim(1), OC_DATA_BLK) * dst_h * dst_w;
+    }
+
+    int64_t dw_ker_flags = 0;
+    if (dw_with_relu)  dw_ker_flags |= pd_conv2d_n16cx_depthwise_kernel_fp32_avx512::flag::RELU;
+    if (dw_with_relu6) dw_ker_flags |= pd_conv2d_n16cx_depthwise_kernel_fp32_avx512::flag::RELU6;
+
+    const int64_t spec_stride_w_sel = dw_p.stride_w < 3 ? dw_p.stride_w : 0;
+    const int64_t ow_body = round(dst_w, sp.dw_ker_blk);
+    const int64_t ow_tail = dst_w - ow_body;
+
+#ifdef PPL_USE_X86_OMP_COLLAPSE
+    PRAGMA_OMP_PARALLEL_FOR_COLLAPSE(2)
+#endif
+    for (int64_t b = 0; b < batch; ++b) {
+#ifndef PPL_USE_X86_OMP_COLLAPSE
+        PRAGMA_OMP_PARALLEL_FOR()
+#endif
+        for (int64_t ohl2 = 0; ohl2 < dst_h; ohl2 += sp.oh_l2_blk) {
+            const int64_t ohl2_eff = min(dst_h - ohl2, sp.oh_l2_blk);
+            const int64_t ih_start = max<int64_t>(ohl2 * dw_p.stride_h - dw_p.pad_h, 0);
+            const int64_t ih_end   = min<int64_t>((ohl2 + ohl2_eff - 1) * dw_p.stride_h - dw_p.pad_h + dw_p.kernel_h, src_h);
+            const int64_t space    = ohl2_eff * dst_w;
+
+            float *pad_buffer   = (float*)temp_buffer_ + (sp.pad_buffer_len + sp.inter_buffer_len) * PPL_OMP_THREAD_ID();
+            float *inter_buffer = pad_buffer + sp.pad_buffer_len;
+
+            { // dw session
+                std::vector<float*> dw_src_ptr_kh_list(dw_p.kernel_h, nullptr);
+                int64_t dw_ker_param[pd_conv2d_n16cx_depthwise_kernel_fp32_avx512::param_def::LENGTH];
+                array_param_helper dw_ker_p(dw_ker_param);
+                pd_conv2d_n16cx_depthwise_kernel_fp32_avx512 dw_ker(dw_ker_param);
+
+                dw_ker_p.pick<int64_t>(pd_conv2d_n16cx_depthwise_kernel_fp32_avx512::param_def::KW_IDX)            = dw_p.kernel_w;
+                dw_ker_p.pick<int64_t>(pd_conv2d_n16cx_depthwise_kernel_fp32_avx512::param_def::SRC_SW_STRIDE_IDX) = dw_p.stride_w * CH_DATA_BLK;
+                dw_ker_p.pick<int64_t>(pd_conv2d_n16cx_depthwise_kernel_fp32_avx512::param_def::FLAGS_IDX)         = dw_ker_flags;
+
+                for (int64_t c = 0; c < sp.padded_ch; c += CH_DATA_BLK) {
+                    const float *base_src = src_ + b * src_b_stride + c * src_h * src_w + ih_start * src_h_stride;
+                    float *l_pad = pad_buffer;
+                    for (int64_t ih = ih_start; ih < ih_end; ++ih) {
+                        memset32_avx(l_pad, 0, dw_p.pad_w * CH_DATA_BLK);
+                        l_pad += dw_p.pad_w * CH_DATA_BLK;
+                        memcpy32_avx(l_pad, base_src, src_h_stride);
+                        l_pad += src_h_stride;
+                        memset32_avx(l_pad, 0, dw_p.pad_w * CH_DATA_BLK);
+                        l_pad += dw_p.pad_w * CH_DATA_BLK;
+                        base_src += src_h_stride;
+                    }
+
+                    dw_ker_p.pick<const float*>(pd_conv2d_n16cx_depthwise_kernel_fp32_avx512::param_def::FLT_PTR_IDX)  = dw_e->cvt_filter() + c / CH_DATA_BLK * dw_flt_chb_stride;
+                    dw_ker_p.pick<const float*>(pd_conv2d_n16cx_depthwise_kernel_fp32_avx512::param_def::BIAS_PTR_IDX) = dw_e->cvt_bias() + c;
+                    float *base_inter = inter_buffer + c * space;
+                    for (int64_t oh = ohl2; oh < ohl2 + ohl2_eff; ++oh) {
+                        const int64_t ih_offset   = oh * dw_p.stride_h - dw_p.pad_h;
+                        const int64_t dw_kh_start = min<int64_t>(max<int64_t>(0 - ih_offset, 0), dw_p.kernel_h - 1);
+                        const int64_t dw_kh_end   = max<int64_t>(min<int64_t>(src_h - ih_offset, dw_p.kernel_h), 0);
+                        for (int64_t kh = dw_kh_start; kh < dw_kh_end; ++kh) {
+                            dw_src_ptr_kh_list[kh] = pad_buffer + (ih_offset + kh - ih_start) * pad_h_stride;
+                        }
+                        dw_ker_p.pick<float**>(pd_conv2d_n16cx_depthwise_kernel_fp32_avx512::param_def::SRC_PTR_KH_LIST_IDX) = dw_src_ptr_kh_list.data();
+                        dw_ker_p.pick<float*>(pd_conv2d_n16cx_depthwise_kernel_fp32_avx512::param_def::DST_PTR_IDX)          = base_inter + (oh - ohl2) * dst_w * CH_DATA_BLK;
+                        dw_ker_p.pick<int64_t>(pd_conv2d_n16cx_depthwise_kernel_fp32_avx512::param_def::KH_START_IDX)        = dw_kh_start;
+                        dw_ker_p.pick<int64_t>(pd_conv2d_n16cx_depthwise_kernel_fp32_avx512::param_def::KH_END_IDX)          = dw_kh_end;
+                        if (ow_body) {
+                            dw_ker_p.pick<int64_t>(pd_conv2d_n16cx_depthwise_kernel_fp32_avx512::param_def::DST_WIDTH_IDX) = ow_body;
+                            dw_ker.execute(0, spec_stride_w_sel, sp.dw_ker_blk);
+                        }
+                        if (ow_tail) {
+                            dw_ker_p.pick<int64_t>(pd_conv2d_n16cx_depthwise_kernel_fp32_avx512::param_def::DST_WIDTH_IDX) = ow_tail;
+                            dw_ker.execute(0, spec_stride_w_sel, ow_tail);
+                        }
+                    }
+                }
+            }
+
+            { // gd session
+                int64_t gd_ker_param[conv2d_n16cx_gemm_direct_kernel_fp32_avx512::param_def::LENGTH];
+                array_param_helper gd_ker_p(gd_ker_param);
+                conv2d_n16cx_gemm_direct_kernel_fp32_avx512 gd_ker(gd_ker_param);
+
+                const int64_t s_body = round(space, sp.gd_ker_blk);
+                const int64_t s_tail = space - s_body;
+
+                gd_ker_p.pick<int64_t>(conv2d_n16cx_gemm_direct_kernel_fp32_avx512::param_def::SRC_ICB_STRIDE_IDX) = space * IC_DATA_BLK;
+                gd_ker_p.pick<int64_t>(conv2d_n16cx_gemm_direct_kernel_fp32_avx512::param_def::HIS_OCB_STRIDE_IDX) = dst_ocb_stride;
+                gd_ker_p.pick<int64_t>(conv2d_n16cx_gemm_direct_kernel_fp32_avx512::param_def::DST_OCB_STRIDE_IDX) = dst_ocb_stride;
+                gd_ker_p.pick<int64_t>(conv2d_n16cx_gemm_direct_kernel_fp32_avx512::param_def::FLT_OCB_STRIDE_IDX) = gd_flt_ocb_stride;
+                for (int64_t oc = 0; oc < sp.padded_oc; oc += sp.oc_ker_blk) {
+                    const int64_t oc_reg = div_up(min(sp.padded_oc - oc, sp.oc_ker_blk), OC_DATA_BLK);
+                    float *l_dst = dst_ + b * dst_b_stride + oc * dst_h * dst_w + ohl2 * dst_h_stride;
+                    for (int64_t icl2 = 0; icl2 < sp.padded_ch; icl2 += sp.ic_l2_blk) {
+                        const int64_t icl2_eff = min(gd_p.channels - icl2, sp.ic_l2_blk);
+                        const bool is_first_ic = icl2 == 0;
+                        const bool is_last_ic  = (icl2 + sp.ic_l2_blk >= gd_p.channels);
+                        const float *l_his     = l_dst;
+                        int64_t gd_ker_flags   = 0;
+
+                        if (is_first_ic) {
+                            if (gd_with_sum) {
+                                l_his = sum_src_ + b * sum_src_b_stride + oc * dst_h * dst_w + ohl2 * dst_h_stride;
+                                gd_ker_flags |= conv2d_n16cx_gemm_direct_kernel_fp32_avx512::flag::ADD_BIAS;
+                            } else {
+                                gd_ker_flags |= conv2d_n16cx_gemm_direct_kernel_fp32_avx512::flag::LOAD_BIAS;
+                            }
+                        }
+                        if (is_last_ic) {
+                            if (gd_with_relu) gd_ker_flags |= conv2d_n16cx_gemm_direct_kernel_fp32_avx512::flag::RELU;
+                            if (gd_with_relu6) gd_ker_flags |= conv2d_n16cx_gemm_direct_kernel_fp32_avx512::flag::RELU6;
+                        }
+                        const int64_t nt_store_sel = is_last_ic ? sp.use_nt_store : 0;
+                        const float *l_src = inter_buffer + icl2 * space;
+
+                        gd_ker_p.pick<int64_t>(conv2d_n16cx_gemm_direct_kernel_fp32_avx512::param_def::CHANNELS_IDX)      = icl2_eff;
+                        gd_ker_p.pick<int64_t>(conv2d_n16cx_gemm_direct_kernel_fp32_avx512::param_def::FLAGS_IDX)         = gd_ker_flags;
+                        gd_ker_p.pick<const float*>(conv2d_n16cx_gemm_direct_kernel_fp32_avx512::param_def::FLT_PTR_IDX)  = gd_e->cvt_filter() + icl2 * sp.padded_oc + oc * sp.ic_l2_blk;
+                        gd_ker_p.pick<const float*>(conv2d_n16cx_gemm_direct_kernel_fp32_avx512::param_def::BIAS_PTR_IDX) = gd_e->cvt_bias() + oc;
+                        if (s_body) {
+                            gd_ker_p.pick<const float*>(conv2d_n16cx_gemm_direct_kernel_fp32_avx512::param_def::SRC_PTR_IDX) = l_src;
+                            gd_ker_p.pick<const float*>(conv2d_n16cx_gemm_direct_kernel_fp32_avx512::param_def::HIS_PTR_IDX) = l_his;
+                            gd_ker_p.pick<float*>(conv2d_n16cx_gemm_direct_kernel_fp32_avx512::param_def::DST_PTR_IDX)       = l_dst;
+                            gd_ker_p.pick<int64_t>(conv2d_n16cx_gemm_direct_kernel_fp32_avx512::param_def::SPACE_IDX)        = s_body;
+                            gd_ker.execute(nt_store_sel, oc_reg, sp.gd_ker_blk);
+                        }
+                        if (s_tail) {
+                            gd_ker_p.pick<const float*>(conv2d_n16cx_gemm_direct_kernel_fp32_avx512::param_def::SRC_PTR_IDX) = l_src + s_body * IC_DATA_BLK;
+                            gd_ker_p.pick<const float*>(conv2d_n16cx_gemm_direct_kernel_fp32_avx512::param_def::HIS_PTR_IDX) = l_his + s_body * OC_DATA_BLK;
+                            gd_ker_p.pick<float*>(conv2d_n16cx_gemm_direct_kernel_fp32_avx512::param_def::DST_PTR_IDX)       = l_dst + s_body * OC_DATA_BLK;
+                            gd_ker_p.pick<int64_t>(conv2d_n16cx_gemm_direct_kernel_fp32_avx512::param_def::SPACE_IDX)        = s_tail;
+                            gd_ker.execute(nt_store_sel, oc_reg, s_tail);
+                        }
+                    }
+                }
+            }
+        }
+    }
+    if (sp.use_nt_store) {
+        PRAGMA_OMP_PARALLEL()
+        {
+            _mm_sfence();
+        }
+    }
+
+    return ppl::common::RC_SUCCESS;
+}
+
+}}}; // namespace ppl::kernel::x86
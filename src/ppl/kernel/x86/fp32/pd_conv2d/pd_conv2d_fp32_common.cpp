@@ -19,13 +19,18 @@
 
 #include "ppl/kernel/x86/fp32/pd_conv2d/fma/pd_conv2d_n16cx_gemm_direct_fp32_fma.h"
 #include "ppl/kernel/x86/fp32/pd_conv2d/fma/pd_conv2d_n16cx_direct_ndarray_fp32_fma.h"
+#include "ppl/kernel/x86/fp32/pd_conv2d/fma/pd_conv2d_n16cx_depthwise_gemm_direct_fp32_fma.h"
 #include "ppl/kernel/x86/fp32/conv2d/fma/conv2d_n16cx_gemm_direct_fp32_fma.h"
 #include "ppl/kernel/x86/fp32/conv2d/fma/conv2d_n16cx_direct_ndarray_fp32_fma.h"
 #include "ppl/kernel/x86/fp32/conv2d/fma/conv2d_n16cx_depthwise_fp32_fma.h"
+#include "ppl/kernel/x86/fp32/pd_conv2d/sse/pd_conv2d_n8cx_depthwise_gemm_direct_fp32_sse.h"
+#include "ppl/kernel/x86/fp32/conv2d/sse/conv2d_n8cx_gemm_direct_fp32_sse.h"
+#include "ppl/kernel/x86/fp32/conv2d/sse/conv2d_n8cx_depthwise_fp32_sse.h"
 
 #ifdef PPL_USE_X86_AVX512
 #include "ppl/kernel/x86/fp32/pd_conv2d/avx512/pd_conv2d_n16cx_gemm_direct_fp32_avx512.h"
 #include "ppl/kernel/x86/fp32/pd_conv2d/avx512/pd_conv2d_n16cx_direct_ndarray_fp32_avx512.h"
+#include "ppl/kernel/x86/fp32/pd_conv2d/avx512/pd_conv2d_n16cx_depthwise_gemm_direct_fp32_avx512.h"
 #include "ppl/kernel/x86/fp32/conv2d/avx512/conv2d_n16cx_gemm_direct_fp32_avx512.h"
 #include "ppl/kernel/x86/fp32/conv2d/avx512/conv2d_n16cx_direct_ndarray_fp32_avx512.h"
 #include "ppl/kernel/x86/fp32/conv2d/avx512/conv2d_n16cx_depthwise_fp32_avx512.h"
@@ -125,6 +130,88 @@ pd_conv2d_fp32_algo_info pd_conv2d_algo_selector::select_algo(
 #endif
     }
 
+    if (true // depthwise_gemm_direct algo
+        && algo.algo_type == ppl::kernel::x86::conv2d_algo::DEPTHWISE
+        && algo.input_format == ppl::common::DATAFORMAT_N16CX
+        && algo.output_format == ppl::common::DATAFORMAT_N16CX
+        && post_algo.algo_type == ppl::kernel::x86::conv2d_algo::GEMM_DIRECT
+        && post_algo.input_format == ppl::common::DATAFORMAT_N16CX
+        && post_algo.output_format == ppl::common::DATAFORMAT_N16CX)
+    {
+        if (algo.isa == ppl::common::ISA_X86_FMA && post_algo.isa == ppl::common::ISA_X86_FMA) {
+            if (true // depthwise_gemm_direct support param
+                && !(param.fuse_flag & ppl::kernel::x86::conv_fuse_flag::SUM)
+                && param.dilation_h == 1
+                && param.dilation_w == 1
+                && post_param.sparse_level() == 1.0f
+                && post_param.group == 1
+                && post_param.is_pointwise()
+                && post_param.stride_h == 1
+                && post_param.stride_w == 1
+                && param.num_output == post_param.channels) {
+                return {
+                    pd_conv2d_fp32_algo::DEPTHWISE_GEMM_DIRECT,
+                    ppl::common::ISA_X86_FMA,
+                    ppl::common::DATAFORMAT_N16CX,
+                    ppl::common::DATAFORMAT_N16CX};
+            }
+        }
+
+#ifdef PPL_USE_X86_AVX512
+        if (algo.isa == ppl::common::ISA_X86_AVX512 && post_algo.isa == ppl::common::ISA_X86_AVX512) {
+            if (true // depthwise_gemm_direct support param
+                && !(param.fuse_flag & ppl::kernel::x86::conv_fuse_flag::SUM)
+                && param.dilation_h == 1
+                && param.dilation_w == 1
+                && post_param.sparse_level() == 1.0f
+                && post_param.group == 1
+                && post_param.is_pointwise()
+                && post_param.stride_h == 1
+                && post_param.stride_w == 1
+                && param.num_output == post_param.channels) {
+                return {
+                    pd_conv2d_fp32_algo::DEPTHWISE_GEMM_DIRECT,
+                    ppl::common::ISA_X86_AVX512,
+                    ppl::common::DATAFORMAT_N16CX,
+                    ppl::common::DATAFORMAT_N16CX};
+            }
+        }
+#endif
+    }
+
+    // the sse conv2d selector returns ndarray algos only, a depthwise conv
+    // followed by a 1x1 conv is fused into the n8cx kernels regardless of
+    // what was picked for each conv alone
+    if (true // depthwise_gemm_direct algo
+        && algo.algo_type == ppl::kernel::x86::conv2d_algo::DEPTHWISE
+        && algo.isa == ppl::common::ISA_X86_SSE
+        && post_algo.isa == ppl::common::ISA_X86_SSE)
+    {
+        auto dw_mgr    = new conv2d_n8cx_depthwise_fp32_sse_manager(param, nullptr);
+        auto gd_mgr    = new conv2d_n8cx_gemm_direct_fp32_sse_manager(post_param, nullptr);
+        bool supported = dw_mgr->is_supported() && gd_mgr->is_supported();
+        delete dw_mgr;
+        delete gd_mgr;
+        if (supported) {
+            if (true // depthwise_gemm_direct support param
+                && !(param.fuse_flag & ppl::kernel::x86::conv_fuse_flag::SUM)
+                && param.dilation_h == 1
+                && param.dilation_w == 1
+                && post_param.sparse_level() == 1.0f
+                && post_param.group == 1
+                && post_param.is_pointwise()
+                && post_param.stride_h == 1
+                && post_param.stride_w == 1
+                && param.num_output == post_param.channels) {
+                return {
+                    pd_conv2d_fp32_algo::DEPTHWISE_GEMM_DIRECT,
+                    ppl::common::ISA_X86_SSE,
+                    ppl::common::DATAFORMAT_N8CX,
+                    ppl::common::DATAFORMAT_N8CX};
+            }
+        }
+    }
+
     return {
         pd_conv2d_fp32_algo::UNKNOWN,
         ppl::common::ISA_UNKNOWN,
@@ -154,6 +241,22 @@ pd_conv2d_fp32_manager *pd_conv2d_algo_selector::gen_algo(
             new conv2d_n16cx_direct_ndarray_fp32_fma_manager(param, allocator),
             new conv2d_n16cx_depthwise_fp32_fma_manager(depthwise_param, allocator));
     }
+    if (algo_info.algo_type == pd_conv2d_fp32_algo::DEPTHWISE_GEMM_DIRECT &&
+        algo_info.isa == ppl::common::ISA_X86_FMA &&
+        algo_info.input_format == ppl::common::DATAFORMAT_N16CX &&
+        algo_info.output_format == ppl::common::DATAFORMAT_N16CX) {
+        return new pd_conv2d_n16cx_depthwise_gemm_direct_fp32_fma_manager(
+            new conv2d_n16cx_gemm_direct_fp32_fma_manager(param, allocator),
+            new conv2d_n16cx_depthwise_fp32_fma_manager(depthwise_param, allocator));
+    }
+    if (algo_info.algo_type == pd_conv2d_fp32_algo::DEPTHWISE_GEMM_DIRECT &&
+        algo_info.isa == ppl::common::ISA_X86_SSE &&
+        algo_info.input_format == ppl::common::DATAFORMAT_N8CX &&
+        algo_info.output_format == ppl::common::DATAFORMAT_N8CX) {
+        return new pd_conv2d_n8cx_depthwise_gemm_direct_fp32_sse_manager(
+            new conv2d_n8cx_gemm_direct_fp32_sse_manager(param, allocator),
+            new conv2d_n8cx_depthwise_fp32_sse_manager(depthwise_param, allocator));
+    }
 
 #ifdef PPL_USE_X86_AVX512
     if (algo_info.algo_type == pd_conv2d_fp32_algo::GEMM_DIRECT &&
@@ -172,6 +275,14 @@ pd_conv2d_fp32_manager *pd_conv2d_algo_selector::gen_algo(
             new conv2d_n16cx_direct_ndarray_fp32_avx512_manager(param, allocator),
             new conv2d_n16cx_depthwise_fp32_avx512_manager(depthwise_param, allocator));
     }
+    if (algo_info.algo_type == pd_conv2d_fp32_algo::DEPTHWISE_GEMM_DIRECT &&
+        algo_info.isa == ppl::common::ISA_X86_AVX512 &&
+        algo_info.input_format == ppl::common::DATAFORMAT_N16CX &&
+        algo_info.output_format == ppl::common::DATAFORMAT_N16CX) {
+        return new pd_conv2d_n16cx_depthwise_gemm_direct_fp32_avx512_manager(
+            new conv2d_n16cx_gemm_direct_fp32_avx512_manager(param, allocator),
+            new conv2d_n16cx_depthwise_fp32_avx512_manager(depthwise_param, allocator));
+    }
 #endif
 
     return nullptr;
@@ -194,6 +305,18 @@ pd_conv2d_fp32_manager *pd_conv2d_algo_selector::gen_algo(
         algo_info.output_format == ppl::common::DATAFORMAT_N16CX) {
         return new pd_conv2d_n16cx_direct_ndarray_fp32_fma_manager(mgr, depthwise_mgr);
     }
+    if (algo_info.algo_type == pd_conv2d_fp32_algo::DEPTHWISE_GEMM_DIRECT &&
+        algo_info.isa == ppl::common::ISA_X86_FMA &&
+        algo_info.input_format == ppl::common::DATAFORMAT_N16CX &&
+        algo_info.output_format == ppl::common::DATAFORMAT_N16CX) {
+        return new pd_conv2d_n16cx_depthwise_gemm_direct_fp32_fma_manager(mgr, depthwise_mgr);
+    }
+    if (algo_info.algo_type == pd_conv2d_fp32_algo::DEPTHWISE_GEMM_DIRECT &&
+        algo_info.isa == ppl::common::ISA_X86_SSE &&
+        algo_info.input_format == ppl::common::DATAFORMAT_N8CX &&
+        algo_info.output_format == ppl::common::DATAFORMAT_N8CX) {
+        return new pd_conv2d_n8cx_depthwise_gemm_direct_fp32_sse_manager(mgr, depthwise_mgr);
+    }
 
 #ifdef PPL_USE_X86_AVX512
     if (algo_info.algo_type == pd_conv2d_fp32_algo::GEMM_DIRECT &&
@@ -208,6 +331,12 @@ pd_conv2d_fp32_manager *pd_conv2d_algo_selector::gen_algo(
         algo_info.output_format == ppl::common::DATAFORMAT_N16CX) {
         return new pd_conv2d_n16cx_direct_ndarray_fp32_avx512_manager(mgr, depthwise_mgr);
     }
+    if (algo_info.algo_type == pd_conv2d_fp32_algo::DEPTHWISE_GEMM_DIRECT &&
+        algo_info.isa == ppl::common::ISA_X86_AVX512 &&
+        algo_info.input_format == ppl::common::DATAFORMAT_N16CX &&
+        algo_info.output_format == ppl::common::DATAFORMAT_N16CX) {
+        return new pd_conv2d_n16cx_depthwise_gemm_direct_fp32_avx512_manager(mgr, depthwise_mgr);
+    }
 #endif
 
     return nullptr;
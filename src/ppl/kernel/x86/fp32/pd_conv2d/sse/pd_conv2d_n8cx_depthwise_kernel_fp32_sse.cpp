@@ -0,0 +1,276 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <nmmintrin.h>
+
+#include "ppl/kernel/x86/fp32/pd_conv2d/sse/pd_conv2d_n8cx_depthwise_kernel_fp32_sse.h"
+#include "ppl/kernel/x86/common/array_param_helper.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+template <bool nt_store, int32_t spec_stride_w, int32_t u_w>
+void pd_conv2d_n8cx_depthwise_fp32_sse_blk1x6_kernel(int64_t *param)
+{
+#define KW_COMPUTE_STEP() do {\
+    xmm12 = _mm_loadu_ps(flt + 0 * CH_REG_ELTS);\
+    xmm13 = _mm_loadu_ps(flt + 1 * CH_REG_ELTS);\
+    if (u_w > 0) {\
+        xmm14 = _mm_mul_ps(_mm_loadu_ps(src + 0 * src_sw_stride + 0 * CH_REG_ELTS), xmm12);\
+        xmm15 = _mm_mul_ps(_mm_loadu_ps(src + 0 * src_sw_stride + 1 * CH_REG_ELTS), xmm13);\
+        xmm0 = _mm_add_ps(xmm0, xmm14);\
+        xmm1 = _mm_add_ps(xmm1, xmm15);\
+    }\
+    if (u_w > 1) {\
+        xmm14 = _mm_mul_ps(_mm_loadu_ps(src + 1 * src_sw_stride + 0 * CH_REG_ELTS), xmm12);\
+        xmm15 = _mm_mul_ps(_mm_loadu_ps(src + 1 * src_sw_stride + 1 * CH_REG_ELTS), xmm13);\
+        xmm2 = _mm_add_ps(xmm2, xmm14);\
+        xmm3 = _mm_add_ps(xmm3, xmm15);\
+    }\
+    if (u_w > 2) {\
+        xmm14 = _mm_mul_ps(_mm_loadu_ps(src + 2 * src_sw_stride + 0 * CH_REG_ELTS), xmm12);\
+        xmm15 = _mm_mul_ps(_mm_loadu_ps(src + 2 * src_sw_stride + 1 * CH_REG_ELTS), xmm13);\
+        xmm4 = _mm_add_ps(xmm4, xmm14);\
+        xmm5 = _mm_add_ps(xmm5, xmm15);\
+    }\
+    if (u_w > 3) {\
+        xmm14 = _mm_mul_ps(_mm_loadu_ps(src + 3 * src_sw_stride + 0 * CH_REG_ELTS), xmm12);\
+        xmm15 = _mm_mul_ps(_mm_loadu_ps(src + 3 * src_sw_stride + 1 * CH_REG_ELTS), xmm13);\
+        xmm6 = _mm_add_ps(xmm6, xmm14);\
+        xmm7 = _mm_add_ps(xmm7, xmm15);\
+    }\
+    if (u_w > 4) {\
+        xmm14 = _mm_mul_ps(_mm_loadu_ps(src + 4 * src_sw_stride + 0 * CH_REG_ELTS), xmm12);\
+        xmm15 = _mm_mul_ps(_mm_loadu_ps(src + 4 * src_sw_stride + 1 * CH_REG_ELTS), xmm13);\
+        xmm8 = _mm_add_ps(xmm8, xmm14);\
+        xmm9 = _mm_add_ps(xmm9, xmm15);\
+    }\
+    if (u_w > 5) {\
+        xmm14 = _mm_mul_ps(_mm_loadu_ps(src + 5 * src_sw_stride + 0 * CH_REG_ELTS), xmm12);\
+        xmm15 = _mm_mul_ps(_mm_loadu_ps(src + 5 * src_sw_stride + 1 * CH_REG_ELTS), xmm13);\
+        xmm10 = _mm_add_ps(xmm10, xmm14);\
+        xmm11 = _mm_add_ps(xmm11, xmm15);\
+    }\
+    flt += CH_DATA_BLK;\
+    src += CH_DATA_BLK;\
+} while (0)
+
+    __m128 xmm0, xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7;
+    __m128 xmm8, xmm9, xmm10, xmm11, xmm12, xmm13, xmm14, xmm15;
+
+    const int64_t CH_DATA_BLK = pd_conv2d_n8cx_depthwise_kernel_fp32_sse::config::CH_DATA_BLK;
+    const int64_t CH_REG_ELTS = pd_conv2d_n8cx_depthwise_kernel_fp32_sse::config::CH_REG_ELTS;
+
+    array_param_helper ker_p(param);
+
+    const int64_t src_sw_stride = spec_stride_w ? spec_stride_w * CH_DATA_BLK : 
+                                  ker_p.pick<const int64_t>(pd_conv2d_n8cx_depthwise_kernel_fp32_sse::param_def::SRC_SW_STRIDE_IDX);
+    const int64_t kernel_flags  = ker_p.pick<const int64_t>(pd_conv2d_n8cx_depthwise_kernel_fp32_sse::param_def::FLAGS_IDX);
+    const int64_t kernel_w      = ker_p.pick<const int64_t>(pd_conv2d_n8cx_depthwise_kernel_fp32_sse::param_def::KW_IDX);
+
+    const int64_t kh_start = ker_p.pick<const int64_t>(pd_conv2d_n8cx_depthwise_kernel_fp32_sse::param_def::KH_START_IDX);
+    const int64_t kh_end   = ker_p.pick<const int64_t>(pd_conv2d_n8cx_depthwise_kernel_fp32_sse::param_def::KH_END_IDX);
+
+    const int64_t src_uw_stride = u_w * src_sw_stride;
+    const int64_t flt_offset    = kh_start * kernel_w * CH_DATA_BLK;
+
+    const float **src_kh_list = ker_p.pick<const float**>(pd_conv2d_n8cx_depthwise_kernel_fp32_sse::param_def::SRC_PTR_KH_LIST_IDX);
+    float *dst                = ker_p.pick<float*>(pd_conv2d_n8cx_depthwise_kernel_fp32_sse::param_def::DST_PTR_IDX);
+    int64_t dst_w             = ker_p.pick<const int64_t>(pd_conv2d_n8cx_depthwise_kernel_fp32_sse::param_def::DST_WIDTH_IDX);
+    do {
+        const float* bias = ker_p.pick<const float*>(pd_conv2d_n8cx_depthwise_kernel_fp32_sse::param_def::BIAS_PTR_IDX);
+        if (u_w > 0)  {
+            xmm0 = _mm_loadu_ps(bias + 0 * CH_REG_ELTS);
+            xmm1 = _mm_loadu_ps(bias + 1 * CH_REG_ELTS);
+        }
+        if (u_w > 1)  {
+            xmm2 = xmm0;
+            xmm3 = xmm1;
+        }
+        if (u_w > 2)  {
+            xmm4 = xmm0;
+            xmm5 = xmm1;
+        }
+        if (u_w > 3)  {
+            xmm6 = xmm0;
+            xmm7 = xmm1;
+        }
+        if (u_w > 4)  {
+            xmm8 = xmm0;
+            xmm9 = xmm1;
+        }
+        if (u_w > 5)  {
+            xmm10 = xmm0;
+            xmm11 = xmm1;
+        }
+
+        const float *flt = ker_p.pick<const float*>(pd_conv2d_n8cx_depthwise_kernel_fp32_sse::param_def::FLT_PTR_IDX) + flt_offset;
+        if (kernel_w == 3) {
+            for (int32_t kh = kh_start; kh < kh_end; ++kh) {
+                const float *src = src_kh_list[kh];
+                src_kh_list[kh] = src + src_uw_stride;
+                KW_COMPUTE_STEP();
+                KW_COMPUTE_STEP();
+                KW_COMPUTE_STEP();
+            }
+        } else {
+            for (int32_t kh = kh_start; kh < kh_end; ++kh) {
+                const float *src = src_kh_list[kh];
+                src_kh_list[kh] = src + src_uw_stride;
+                for (int32_t kw = 0; kw < kernel_w; ++kw) {
+                    KW_COMPUTE_STEP();
+                }
+            }
+        }
+
+        if (kernel_flags & (pd_conv2d_n8cx_depthwise_kernel_fp32_sse::flag::RELU | pd_conv2d_n8cx_depthwise_kernel_fp32_sse::flag::RELU6)) {
+            xmm14 = _mm_setzero_ps();
+            if (u_w > 0) {
+                xmm0 = _mm_max_ps(xmm0, xmm14);
+                xmm1 = _mm_max_ps(xmm1, xmm14);
+            }
+            if (u_w > 1) {
+                xmm2 = _mm_max_ps(xmm2, xmm14);
+                xmm3 = _mm_max_ps(xmm3, xmm14);
+            }
+            if (u_w > 2) {
+                xmm4 = _mm_max_ps(xmm4, xmm14);
+                xmm5 = _mm_max_ps(xmm5, xmm14);
+            }
+            if (u_w > 3) {
+                xmm6 = _mm_max_ps(xmm6, xmm14);
+                xmm7 = _mm_max_ps(xmm7, xmm14);
+            }
+            if (u_w > 4) {
+                xmm8 = _mm_max_ps(xmm8, xmm14);
+                xmm9 = _mm_max_ps(xmm9, xmm14);
+            }
+            if (u_w > 5) {
+                xmm10 = _mm_max_ps(xmm10, xmm14);
+                xmm11 = _mm_max_ps(xmm11, xmm14);
+            }
+        }
+        if (kernel_flags & pd_conv2d_n8cx_depthwise_kernel_fp32_sse::flag::RELU6) {
+            xmm15 = _mm_set1_ps(6.0f);
+            if (u_w > 0) {
+                xmm0 = _mm_min_ps(xmm0, xmm15);
+                xmm1 = _mm_min_ps(xmm1, xmm15);
+            }
+            if (u_w > 1) {
+                xmm2 = _mm_min_ps(xmm2, xmm15);
+                xmm3 = _mm_min_ps(xmm3, xmm15);
+            }
+            if (u_w > 2) {
+                xmm4 = _mm_min_ps(xmm4, xmm15);
+                xmm5 = _mm_min_ps(xmm5, xmm15);
+            }
+            if (u_w > 3) {
+                xmm6 = _mm_min_ps(xmm6, xmm15);
+                xmm7 = _mm_min_ps(xmm7, xmm15);
+            }
+            if (u_w > 4) {
+                xmm8 = _mm_min_ps(xmm8, xmm15);
+                xmm9 = _mm_min_ps(xmm9, xmm15);
+            }
+            if (u_w > 5) {
+                xmm10 = _mm_min_ps(xmm10, xmm15);
+                xmm11 = _mm_min_ps(xmm11, xmm15);
+            }
+        }
+        if (nt_store) {
+            if (u_w > 0) {
+                _mm_stream_ps(dst + 0 * CH_DATA_BLK + 0 * CH_REG_ELTS, xmm0);
+                _mm_stream_ps(dst + 0 * CH_DATA_BLK + 1 * CH_REG_ELTS, xmm1);
+            }
+            if (u_w > 1) {
+                _mm_stream_ps(dst + 1 * CH_DATA_BLK + 0 * CH_REG_ELTS, xmm2);
+                _mm_stream_ps(dst + 1 * CH_DATA_BLK + 1 * CH_REG_ELTS, xmm3);
+            }
+            if (u_w > 2) {
+                _mm_stream_ps(dst + 2 * CH_DATA_BLK + 0 * CH_REG_ELTS, xmm4);
+                _mm_stream_ps(dst + 2 * CH_DATA_BLK + 1 * CH_REG_ELTS, xmm5);
+            }
+            if (u_w > 3) {
+                _mm_stream_ps(dst + 3 * CH_DATA_BLK + 0 * CH_REG_ELTS, xmm6);
+                _mm_stream_ps(dst + 3 * CH_DATA_BLK + 1 * CH_REG_ELTS, xmm7);
+            }
+            if (u_w > 4) {
+                _mm_stream_ps(dst + 4 * CH_DATA_BLK + 0 * CH_REG_ELTS, xmm8);
+                _mm_stream_ps(dst + 4 * CH_DATA_BLK + 1 * CH_REG_ELTS, xmm9);
+            }
+            if (u_w > 5) {
+                _mm_stream_ps(dst + 5 * CH_DATA_BLK + 0 * CH_REG_ELTS, xmm10);
+                _mm_stream_ps(dst + 5 * CH_DATA_BLK + 1 * CH_REG_ELTS, xmm11);
+            }
+        } else {
+            if (u_w > 0) {
+                _mm_storeu_ps(dst + 0 * CH_DATA_BLK + 0 * CH_REG_ELTS, xmm0);
+                _mm_storeu_ps(dst + 0 * CH_DATA_BLK + 1 * CH_REG_ELTS, xmm1);
+            }
+            if (u_w > 1) {
+                _mm_storeu_ps(dst + 1 * CH_DATA_BLK + 0 * CH_REG_ELTS, xmm2);
+                _mm_storeu_ps(dst + 1 * CH_DATA_BLK + 1 * CH_REG_ELTS, xmm3);
+            }
+            if (u_w > 2) {
+                _mm_storeu_ps(dst + 2 * CH_DATA_BLK + 0 * CH_REG_ELTS, xmm4);
+                _mm_storeu_ps(dst + 2 * CH_DATA_BLK + 1 * CH_REG_ELTS, xmm5);
+            }
+            if (u_w > 3) {
+                _mm_storeu_ps(dst + 3 * CH_DATA_BLK + 0 * CH_REG_ELTS, xmm6);
+                _mm_storeu_ps(dst + 3 * CH_DATA_BLK + 1 * CH_REG_ELTS, xmm7);
+            }
+            if (u_w > 4) {
+                _mm_storeu_ps(dst + 4 * CH_DATA_BLK + 0 * CH_REG_ELTS, xmm8);
+                _mm_storeu_ps(dst + 4 * CH_DATA_BLK + 1 * CH_REG_ELTS, xmm9);
+            }
+            if (u_w > 5) {
+                _mm_storeu_ps(dst + 5 * CH_DATA_BLK + 0 * CH_REG_ELTS, xmm10);
+                _mm_storeu_ps(dst + 5 * CH_DATA_BLK + 1 * CH_REG_ELTS, xmm11);
+            }
+        }
+        dst += u_w * CH_DATA_BLK;
+        dst_w -= u_w;
+    } while (dst_w > 0);
+    ker_p.pick<float*>(pd_conv2d_n8cx_depthwise_kernel_fp32_sse::param_def::DST_PTR_IDX) = dst;
+#undef KW_COMPUTE_STEP
+}
+
+#define PD_CONV2D_DW_KERNEL_TABLE_BLK(NT_STORE, STRIDE_W) \
+{\
+    pd_conv2d_n8cx_depthwise_fp32_sse_blk1x6_kernel<NT_STORE, STRIDE_W, 1>,\
+    pd_conv2d_n8cx_depthwise_fp32_sse_blk1x6_kernel<NT_STORE, STRIDE_W, 2>,\
+    pd_conv2d_n8cx_depthwise_fp32_sse_blk1x6_kernel<NT_STORE, STRIDE_W, 3>,\
+    pd_conv2d_n8cx_depthwise_fp32_sse_blk1x6_kernel<NT_STORE, STRIDE_W, 4>,\
+    pd_conv2d_n8cx_depthwise_fp32_sse_blk1x6_kernel<NT_STORE, STRIDE_W, 5>,\
+    pd_conv2d_n8cx_depthwise_fp32_sse_blk1x6_kernel<NT_STORE, STRIDE_W, 6>,\
+}
+
+const pd_conv2d_n8cx_depthwise_kernel_fp32_sse::func_t
+    pd_conv2d_n8cx_depthwise_kernel_fp32_sse::table_[config::NT_STORE_OPT][config::SPEC_STRIDE_W_OPT][config::MAX_W_REGS] =
+{
+    {
+        PD_CONV2D_DW_KERNEL_TABLE_BLK(false, 0),
+        PD_CONV2D_DW_KERNEL_TABLE_BLK(false, 1),
+        PD_CONV2D_DW_KERNEL_TABLE_BLK(false, 2),
+    },
+    {
+        PD_CONV2D_DW_KERNEL_TABLE_BLK(true, 0),
+        PD_CONV2D_DW_KERNEL_TABLE_BLK(true, 1),
+        PD_CONV2D_DW_KERNEL_TABLE_BLK(true, 2),
+    },
+};
+
+}}};
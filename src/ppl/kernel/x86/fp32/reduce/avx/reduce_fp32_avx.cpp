@@ -33,6 +33,15 @@ ppl::common::RetCode reduce_fp32_avx(
     float *dst)
 {
     if (src_shape->CalcElementsExcludingPadding() == dst_shape->CalcElementsExcludingPadding()) { // no actual reduce happened, just copy
+        if (_op == REDUCE_L1 || _op == REDUCE_L2 || _op == REDUCE_SUM_SQUARE) { // except for element-wise transform
+            const int64_t len = src_shape->CalcElementsIncludingPadding();
+            PRAGMA_OMP_PARALLEL_FOR()
+            for (int64_t i = 0; i < len; i++) {
+                dst[i] = reduce_scalar_map_fp32<_op>(src[i]);
+            }
+            reduce_postprocess_fp32_avx<_op>(dst, len, 1.0f);
+            return ppl::common::RC_SUCCESS;
+        }
         memcpy(dst, src, src_shape->CalcBytesIncludingPadding());
         return ppl::common::RC_SUCCESS;
     }
@@ -56,6 +65,11 @@ ppl::common::RetCode reduce_fp32_avx(
     }
 
     if (src_shape->GetDataFormat() == ppl::common::DATAFORMAT_NDARRAY) {
+        const reduce_split_plan_t split_plan = reduce_select_split_plan(
+            src_shape->GetDims(), src_shape->GetDimCount(), real_axes, num_axes, PPL_OMP_MAX_THREADS());
+        if (split_plan.num_chunks > 1) { // too few outputs to feed all threads, split the reduced axis instead
+            return reduce_ndarray_split_fp32_avx<_op>(src_shape, src, &split_plan, dst);
+        }
         if (continous_reduce_axis) { // continous_reduce_axis, use special optimized code
             return reduce_single_axis_ndarray_fp32_avx<_op>(src_shape, dst_shape, src, real_axes, num_axes, dst);
         } else {
@@ -112,4 +126,48 @@ ppl::common::RetCode reduce_sum_fp32_avx(
     return reduce_fp32_avx<REDUCE_SUM>(src_shape, dst_shape, src, axes, num_axes, dst);
 }
 
+ppl::common::RetCode reduce_prod_fp32_avx(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst)
+{
+    return reduce_fp32_avx<REDUCE_PROD>(src_shape, dst_shape, src, axes, num_axes, dst);
+}
+
+ppl::common::RetCode reduce_l1_fp32_avx(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst)
+{
+    return reduce_fp32_avx<REDUCE_L1>(src_shape, dst_shape, src, axes, num_axes, dst);
+}
+
+ppl::common::RetCode reduce_l2_fp32_avx(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst)
+{
+    return reduce_fp32_avx<REDUCE_L2>(src_shape, dst_shape, src, axes, num_axes, dst);
+}
+
+ppl::common::RetCode reduce_sum_square_fp32_avx(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst)
+{
+    return reduce_fp32_avx<REDUCE_SUM_SQUARE>(src_shape, dst_shape, src, axes, num_axes, dst);
+}
+
 }}}; // namespace ppl::kernel::x86
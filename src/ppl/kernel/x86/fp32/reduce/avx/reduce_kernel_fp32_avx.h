@@ -20,6 +20,7 @@
 
 #include <string.h>
 #include <float.h>
+#include <math.h>
 #include <immintrin.h>
 
 #include "ppl/kernel/x86/common/internal_include.h"
@@ -45,6 +46,12 @@ inline float reduce_init_val_fp32<REDUCE_MIN>(void)
     return FLT_MAX;
 }
 
+template <>
+inline float reduce_init_val_fp32<REDUCE_PROD>(void)
+{
+    return 1.0f;
+}
+
 template <reduce_op_type_t _op>
 static void reduce_preprocess_fp32_avx(
     float *dst,
@@ -96,6 +103,54 @@ inline float reduce_scalar_kernel_fp32<REDUCE_SUM>(float a, float r)
     return a + r;
 }
 
+template <>
+inline float reduce_scalar_kernel_fp32<REDUCE_PROD>(float a, float r)
+{
+    return a * r;
+}
+
+template <>
+inline float reduce_scalar_kernel_fp32<REDUCE_L1>(float a, float r)
+{
+    return a + r;
+}
+
+template <>
+inline float reduce_scalar_kernel_fp32<REDUCE_L2>(float a, float r)
+{
+    return a + r;
+}
+
+template <>
+inline float reduce_scalar_kernel_fp32<REDUCE_SUM_SQUARE>(float a, float r)
+{
+    return a + r;
+}
+
+template <reduce_op_type_t _op>
+inline float reduce_scalar_map_fp32(float a)
+{
+    return a;
+}
+
+template <>
+inline float reduce_scalar_map_fp32<REDUCE_L1>(float a)
+{
+    return fabsf(a);
+}
+
+template <>
+inline float reduce_scalar_map_fp32<REDUCE_L2>(float a)
+{
+    return a * a;
+}
+
+template <>
+inline float reduce_scalar_map_fp32<REDUCE_SUM_SQUARE>(float a)
+{
+    return a * a;
+}
+
 template <reduce_op_type_t _op>
 inline __m256 reduce_vector_kernel_fp32_avx(__m256 a, __m256 r);
 
@@ -123,6 +178,54 @@ inline __m256 reduce_vector_kernel_fp32_avx<REDUCE_SUM>(__m256 a, __m256 r)
     return _mm256_add_ps(a, r);
 }
 
+template <>
+inline __m256 reduce_vector_kernel_fp32_avx<REDUCE_PROD>(__m256 a, __m256 r)
+{
+    return _mm256_mul_ps(a, r);
+}
+
+template <>
+inline __m256 reduce_vector_kernel_fp32_avx<REDUCE_L1>(__m256 a, __m256 r)
+{
+    return _mm256_add_ps(a, r);
+}
+
+template <>
+inline __m256 reduce_vector_kernel_fp32_avx<REDUCE_L2>(__m256 a, __m256 r)
+{
+    return _mm256_add_ps(a, r);
+}
+
+template <>
+inline __m256 reduce_vector_kernel_fp32_avx<REDUCE_SUM_SQUARE>(__m256 a, __m256 r)
+{
+    return _mm256_add_ps(a, r);
+}
+
+template <reduce_op_type_t _op>
+inline __m256 reduce_vector_map_fp32_avx(__m256 a)
+{
+    return a;
+}
+
+template <>
+inline __m256 reduce_vector_map_fp32_avx<REDUCE_L1>(__m256 a)
+{
+    return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a);
+}
+
+template <>
+inline __m256 reduce_vector_map_fp32_avx<REDUCE_L2>(__m256 a)
+{
+    return _mm256_mul_ps(a, a);
+}
+
+template <>
+inline __m256 reduce_vector_map_fp32_avx<REDUCE_SUM_SQUARE>(__m256 a)
+{
+    return _mm256_mul_ps(a, a);
+}
+
 template <reduce_op_type_t _op>
 inline float reduce_vector_all_lanes_kernel_fp32_avx(__m256 v)
 {
@@ -173,6 +276,23 @@ static void reduce_postprocess_fp32_avx(
             dst[i] *= rdiv;
         }
     }
+
+    if (_op == REDUCE_L2) {
+        const int64_t simd_w      = 8;
+        const int64_t unroll_len  = simd_w * 4;
+        const int64_t unroll_body = round(len, unroll_len);
+
+        PRAGMA_OMP_PARALLEL_FOR()
+        for (int64_t i = 0; i < unroll_body; i += unroll_len) {
+            _mm256_storeu_ps(dst + i + simd_w * 0, _mm256_sqrt_ps(_mm256_loadu_ps(dst + i + simd_w * 0)));
+            _mm256_storeu_ps(dst + i + simd_w * 1, _mm256_sqrt_ps(_mm256_loadu_ps(dst + i + simd_w * 1)));
+            _mm256_storeu_ps(dst + i + simd_w * 2, _mm256_sqrt_ps(_mm256_loadu_ps(dst + i + simd_w * 2)));
+            _mm256_storeu_ps(dst + i + simd_w * 3, _mm256_sqrt_ps(_mm256_loadu_ps(dst + i + simd_w * 3)));
+        }
+        for (int64_t i = unroll_body; i < len; i++) {
+            dst[i] = sqrtf(dst[i]);
+        }
+    }
 }
 
 }}}; // namespace ppl::kernel::x86
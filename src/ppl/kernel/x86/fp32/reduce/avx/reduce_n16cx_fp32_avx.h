@@ -37,10 +37,10 @@ void reduce_n16cx_lastdim_no_reduce_fp32_avx(
 
     int64_t i = 0;
     for (; i + unroll_len <= width; i += unroll_len) {
-        __m256 v_src_0 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 0);
-        __m256 v_src_1 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 1);
-        __m256 v_src_2 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 2);
-        __m256 v_src_3 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 3);
+        __m256 v_src_0 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 0));
+        __m256 v_src_1 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 1));
+        __m256 v_src_2 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 2));
+        __m256 v_src_3 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 3));
 
         __m256 v_dst_0 = _mm256_loadu_ps(dst + i * C_BLK() + simd_w * 0);
         __m256 v_dst_1 = _mm256_loadu_ps(dst + i * C_BLK() + simd_w * 1);
@@ -58,8 +58,8 @@ void reduce_n16cx_lastdim_no_reduce_fp32_avx(
         _mm256_storeu_ps(dst + i * C_BLK() + simd_w * 3, v_dst_3);
     }
     for (; i < width; i++) {
-        __m256 v_src_0 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 0);
-        __m256 v_src_1 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 1);
+        __m256 v_src_0 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 0));
+        __m256 v_src_1 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 1));
 
         __m256 v_dst_0 = _mm256_loadu_ps(dst + i * C_BLK() + simd_w * 0);
         __m256 v_dst_1 = _mm256_loadu_ps(dst + i * C_BLK() + simd_w * 1);
@@ -88,10 +88,10 @@ void reduce_n16cx_lastdim_reduce_w_fp32_avx(
 
     int64_t i = 0;
     for (; i + unroll_len <= width; i += unroll_len) {
-        __m256 v_src_0 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 0);
-        __m256 v_src_1 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 1);
-        __m256 v_src_2 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 2);
-        __m256 v_src_3 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 3);
+        __m256 v_src_0 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 0));
+        __m256 v_src_1 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 1));
+        __m256 v_src_2 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 2));
+        __m256 v_src_3 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 3));
 
         v_reduce_val_0 = reduce_vector_kernel_fp32_avx<_op>(v_src_0, v_reduce_val_0);
         v_reduce_val_1 = reduce_vector_kernel_fp32_avx<_op>(v_src_1, v_reduce_val_1);
@@ -99,8 +99,8 @@ void reduce_n16cx_lastdim_reduce_w_fp32_avx(
         v_reduce_val_3 = reduce_vector_kernel_fp32_avx<_op>(v_src_3, v_reduce_val_3);
     }
     for (; i < width; i++) {
-        __m256 v_src_0 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 0);
-        __m256 v_src_1 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 1);
+        __m256 v_src_0 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 0));
+        __m256 v_src_1 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 1));
 
         v_reduce_val_0 = reduce_vector_kernel_fp32_avx<_op>(v_src_0, v_reduce_val_0);
         v_reduce_val_1 = reduce_vector_kernel_fp32_avx<_op>(v_src_1, v_reduce_val_1);
@@ -142,10 +142,10 @@ void reduce_n16cx_lastdim_reduce_c_fp32_avx(
     if (remain_c >= C_BLK()) {
         int64_t i = 0;
         for (; i + unroll_len <= width; i += unroll_len) {
-            __m256 v_src_0 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 0);
-            __m256 v_src_1 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 1);
-            __m256 v_src_2 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 2);
-            __m256 v_src_3 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 3);
+            __m256 v_src_0 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 0));
+            __m256 v_src_1 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 1));
+            __m256 v_src_2 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 2));
+            __m256 v_src_3 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 3));
 
             v_src_0            = reduce_vector_kernel_fp32_avx<_op>(v_src_0, v_src_1);
             v_src_2            = reduce_vector_kernel_fp32_avx<_op>(v_src_2, v_src_3);
@@ -156,8 +156,8 @@ void reduce_n16cx_lastdim_reduce_c_fp32_avx(
             dst[(i + 1) * C_BLK()] = reduce_scalar_kernel_fp32<_op>(dst[(i + 1) * C_BLK()], reduce_val_2);
         }
         for (; i < width; i++) {
-            __m256 v_src_0 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 0);
-            __m256 v_src_1 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 1);
+            __m256 v_src_0 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 0));
+            __m256 v_src_1 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 1));
 
             v_src_0            = reduce_vector_kernel_fp32_avx<_op>(v_src_0, v_src_1);
             float reduce_val_0 = reduce_vector_all_lanes_kernel_fp32_avx<_op>(v_src_0);
@@ -176,10 +176,10 @@ void reduce_n16cx_lastdim_reduce_c_fp32_avx(
 
         int64_t i = 0;
         for (; i + unroll_len <= width; i += unroll_len) {
-            __m256 v_src_0 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 0);
-            __m256 v_src_1 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 1);
-            __m256 v_src_2 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 2);
-            __m256 v_src_3 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 3);
+            __m256 v_src_0 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 0));
+            __m256 v_src_1 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 1));
+            __m256 v_src_2 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 2));
+            __m256 v_src_3 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 3));
 
             v_src_0 = _mm256_or_ps(_mm256_and_ps(v_src_0, v_mask_0), v_fill_0);
             v_src_1 = _mm256_or_ps(_mm256_and_ps(v_src_1, v_mask_1), v_fill_1);
@@ -195,8 +195,8 @@ void reduce_n16cx_lastdim_reduce_c_fp32_avx(
             dst[(i + 1) * C_BLK()] = reduce_scalar_kernel_fp32<_op>(dst[(i + 1) * C_BLK()], reduce_val_2);
         }
         for (; i < width; i++) {
-            __m256 v_src_0 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 0);
-            __m256 v_src_1 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 1);
+            __m256 v_src_0 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 0));
+            __m256 v_src_1 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 1));
 
             v_src_0 = _mm256_or_ps(_mm256_and_ps(v_src_0, v_mask_0), v_fill_0);
             v_src_1 = _mm256_or_ps(_mm256_and_ps(v_src_1, v_mask_1), v_fill_1);
@@ -223,10 +223,10 @@ void reduce_n16cx_lastdim_reduce_cw_fp32_avx(
 
         int64_t i = 0;
         for (; i + unroll_len <= width; i += unroll_len) {
-            __m256 v_src_0 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 0);
-            __m256 v_src_1 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 1);
-            __m256 v_src_2 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 2);
-            __m256 v_src_3 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 3);
+            __m256 v_src_0 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 0));
+            __m256 v_src_1 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 1));
+            __m256 v_src_2 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 2));
+            __m256 v_src_3 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 3));
 
             v_src_0 = reduce_vector_kernel_fp32_avx<_op>(v_src_0, v_src_1);
             v_src_2 = reduce_vector_kernel_fp32_avx<_op>(v_src_2, v_src_3);
@@ -235,8 +235,8 @@ void reduce_n16cx_lastdim_reduce_cw_fp32_avx(
             v_reduce_val = reduce_vector_kernel_fp32_avx<_op>(v_src_0, v_reduce_val);
         }
         for (; i < width; i++) {
-            __m256 v_src_0 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 0);
-            __m256 v_src_1 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 1);
+            __m256 v_src_0 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 0));
+            __m256 v_src_1 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 1));
 
             v_src_0 = reduce_vector_kernel_fp32_avx<_op>(v_src_0, v_src_1);
 
@@ -258,10 +258,10 @@ void reduce_n16cx_lastdim_reduce_cw_fp32_avx(
 
         int64_t i = 0;
         for (; i + unroll_len <= width; i += unroll_len) {
-            __m256 v_src_0 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 0);
-            __m256 v_src_1 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 1);
-            __m256 v_src_2 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 2);
-            __m256 v_src_3 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 3);
+            __m256 v_src_0 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 0));
+            __m256 v_src_1 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 1));
+            __m256 v_src_2 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 2));
+            __m256 v_src_3 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 3));
 
             v_src_0 = _mm256_or_ps(_mm256_and_ps(v_src_0, v_mask_0), v_fill_0);
             v_src_1 = _mm256_or_ps(_mm256_and_ps(v_src_1, v_mask_1), v_fill_1);
@@ -275,8 +275,8 @@ void reduce_n16cx_lastdim_reduce_cw_fp32_avx(
             v_reduce_val = reduce_vector_kernel_fp32_avx<_op>(v_src_0, v_reduce_val);
         }
         for (; i < width; i++) {
-            __m256 v_src_0 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 0);
-            __m256 v_src_1 = _mm256_loadu_ps(src + i * C_BLK() + simd_w * 1);
+            __m256 v_src_0 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 0));
+            __m256 v_src_1 = reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(src + i * C_BLK() + simd_w * 1));
 
             v_src_0 = _mm256_or_ps(_mm256_and_ps(v_src_0, v_mask_0), v_fill_0);
             v_src_1 = _mm256_or_ps(_mm256_and_ps(v_src_1, v_mask_1), v_fill_1);
@@ -21,43 +21,24 @@
 #include <immintrin.h>
 #include <float.h>
 
-#include "ppl/kernel/x86/common/internal_include.h"
-#include "ppl/kernel/x86/common/reduce/reduce_common.h"
+#include "ppl/kernel/x86/fp32/reduce/avx/reduce_kernel_fp32_avx.h"
 
-#define _MM256_ROP_PS(DST, A, B)                       \
-    do {                                               \
-        if (_op == REDUCE_MAX) {                       \
-            DST = _mm256_max_ps(A, B);                 \
-        }                                              \
-        if (_op == REDUCE_MIN) {                       \
-            DST = _mm256_min_ps(A, B);                 \
-        }                                              \
-        if (_op == REDUCE_SUM || _op == REDUCE_MEAN) { \
-            DST = _mm256_add_ps(A, B);                 \
-        }                                              \
+#define _MM256_ROP_PS(DST, A, B)                        \
+    do {                                                \
+        DST = reduce_vector_kernel_fp32_avx<_op>(A, B); \
     } while (0)
 
-#define ROP_ADD(A, B) (A) + (B)
-
-#define ROP(DST, A, B)                                 \
-    do {                                               \
-        if (_op == REDUCE_MAX) {                       \
-            DST = max(A, B);                           \
-        }                                              \
-        if (_op == REDUCE_MIN) {                       \
-            DST = min(A, B);                           \
-        }                                              \
-        if (_op == REDUCE_SUM || _op == REDUCE_MEAN) { \
-            DST = ROP_ADD(A, B);                       \
-        }                                              \
+#define ROP(DST, A, B)                              \
+    do {                                            \
+        DST = reduce_scalar_kernel_fp32<_op>(A, B); \
     } while (0)
 
-#define REDUCE_LOOP(R)                                                                           \
-    do {                                                                                         \
-        _MM256_ROP_PS(mm_res0, _mm256_loadu_ps(base_src + (R)*inner_dim + 0 * simd_w), mm_res0); \
-        _MM256_ROP_PS(mm_res1, _mm256_loadu_ps(base_src + (R)*inner_dim + 1 * simd_w), mm_res1); \
-        _MM256_ROP_PS(mm_res2, _mm256_loadu_ps(base_src + (R)*inner_dim + 2 * simd_w), mm_res2); \
-        _MM256_ROP_PS(mm_res3, _mm256_loadu_ps(base_src + (R)*inner_dim + 3 * simd_w), mm_res3); \
+#define REDUCE_LOOP(R)                                                                                                            \
+    do {                                                                                                                          \
+        _MM256_ROP_PS(mm_res0, reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(base_src + (R)*inner_dim + 0 * simd_w)), mm_res0); \
+        _MM256_ROP_PS(mm_res1, reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(base_src + (R)*inner_dim + 1 * simd_w)), mm_res1); \
+        _MM256_ROP_PS(mm_res2, reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(base_src + (R)*inner_dim + 2 * simd_w)), mm_res2); \
+        _MM256_ROP_PS(mm_res3, reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(base_src + (R)*inner_dim + 3 * simd_w)), mm_res3); \
     } while (0)
 
 namespace ppl { namespace kernel { namespace x86 {
@@ -90,13 +71,7 @@ ppl::common::RetCode reduce_single_axis_ndarray_fp32_avx(
     const int64_t unroll_inner  = 4 * simd_w;
     const int64_t reduce_body   = round(reduce_dim, unroll_reduce);
     const int64_t reduce_tail   = reduce_dim - reduce_body;
-    float init_val              = 0.0f;
-    if (_op == REDUCE_MAX) {
-        init_val = -FLT_MAX;
-    }
-    if (_op == REDUCE_MIN) {
-        init_val = FLT_MAX;
-    }
+    const float init_val        = reduce_init_val_fp32<_op>();
 
 #ifdef PPL_USE_X86_OMP_COLLAPSE
     PRAGMA_OMP_PARALLEL_FOR_COLLAPSE(2)
@@ -136,6 +111,12 @@ ppl::common::RetCode reduce_single_axis_ndarray_fp32_avx(
                     mm_res2      = _mm256_mul_ps(mm_res2, mm_rr);
                     mm_res3      = _mm256_mul_ps(mm_res3, mm_rr);
                 }
+                if (_op == REDUCE_L2) {
+                    mm_res0 = _mm256_sqrt_ps(mm_res0);
+                    mm_res1 = _mm256_sqrt_ps(mm_res1);
+                    mm_res2 = _mm256_sqrt_ps(mm_res2);
+                    mm_res3 = _mm256_sqrt_ps(mm_res3);
+                }
                 _mm256_storeu_ps(base_dst + 0 * simd_w, mm_res0);
                 _mm256_storeu_ps(base_dst + 1 * simd_w, mm_res1);
                 _mm256_storeu_ps(base_dst + 2 * simd_w, mm_res2);
@@ -147,7 +128,7 @@ ppl::common::RetCode reduce_single_axis_ndarray_fp32_avx(
                     float res[8];
                     mm_res0 = _mm256_set1_ps(init_val);
                     for (int64_t r = 0; r < reduce_body; r += unroll_reduce) {
-                        _MM256_ROP_PS(mm_res0, _mm256_loadu_ps(base_src + r), mm_res0);
+                        _MM256_ROP_PS(mm_res0, reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(base_src + r)), mm_res0);
                     }
                     _mm256_storeu_ps(res, mm_res0);
 
@@ -162,12 +143,15 @@ ppl::common::RetCode reduce_single_axis_ndarray_fp32_avx(
                 }
                 if (reduce_tail) {
                     for (int64_t r = reduce_body; r < reduce_dim; ++r) {
-                        ROP(res_val, res_val, base_src[r]);
+                        ROP(res_val, res_val, reduce_scalar_map_fp32<_op>(base_src[r]));
                     }
                 }
                 if (_op == REDUCE_MEAN) {
                     res_val /= reduce_dim;
                 }
+                if (_op == REDUCE_L2) {
+                    res_val = sqrtf(res_val);
+                }
                 base_dst[0] = res_val;
             } else {
                 uint32_t mask[8] = {
@@ -191,12 +175,10 @@ ppl::common::RetCode reduce_single_axis_ndarray_fp32_avx(
                     mm_res2 = _mm256_set1_ps(init_val);
                     mm_res3 = _mm256_set1_ps(init_val);
                     for (int64_t r = 0; r < reduce_dim; ++r) {
-                        if (_op == REDUCE_MAX) {
-                            _MM256_ROP_PS(mm_res0, _mm256_loadu_ps(base_src + 0 * inner_dim + 0 * simd_w), mm_res0);
-                            _MM256_ROP_PS(mm_res1, _mm256_loadu_ps(base_src + 0 * inner_dim + 1 * simd_w), mm_res1);
-                            _MM256_ROP_PS(mm_res2, _mm256_loadu_ps(base_src + 0 * inner_dim + 2 * simd_w), mm_res2);
-                            _MM256_ROP_PS(mm_res3, _mm256_maskload_ps(base_src + 0 * inner_dim + 3 * simd_w, mm_mask), mm_res3);
-                        }
+                        _MM256_ROP_PS(mm_res0, reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(base_src + 0 * inner_dim + 0 * simd_w)), mm_res0);
+                        _MM256_ROP_PS(mm_res1, reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(base_src + 0 * inner_dim + 1 * simd_w)), mm_res1);
+                        _MM256_ROP_PS(mm_res2, reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(base_src + 0 * inner_dim + 2 * simd_w)), mm_res2);
+                        _MM256_ROP_PS(mm_res3, reduce_vector_map_fp32_avx<_op>(_mm256_maskload_ps(base_src + 0 * inner_dim + 3 * simd_w, mm_mask)), mm_res3);
                         base_src += inner_dim;
                     }
                     if (_op == REDUCE_MEAN) {
@@ -206,6 +188,12 @@ ppl::common::RetCode reduce_single_axis_ndarray_fp32_avx(
                         mm_res2      = _mm256_mul_ps(mm_res2, mm_rr);
                         mm_res3      = _mm256_mul_ps(mm_res3, mm_rr);
                     }
+                    if (_op == REDUCE_L2) {
+                        mm_res0 = _mm256_sqrt_ps(mm_res0);
+                        mm_res1 = _mm256_sqrt_ps(mm_res1);
+                        mm_res2 = _mm256_sqrt_ps(mm_res2);
+                        mm_res3 = _mm256_sqrt_ps(mm_res3);
+                    }
                     _mm256_storeu_ps(base_dst + 0 * simd_w, mm_res0);
                     _mm256_storeu_ps(base_dst + 1 * simd_w, mm_res1);
                     _mm256_storeu_ps(base_dst + 2 * simd_w, mm_res2);
@@ -216,9 +204,9 @@ ppl::common::RetCode reduce_single_axis_ndarray_fp32_avx(
                     mm_res1 = _mm256_set1_ps(init_val);
                     mm_res2 = _mm256_set1_ps(init_val);
                     for (int64_t r = 0; r < reduce_dim; ++r) {
-                        _MM256_ROP_PS(mm_res0, _mm256_loadu_ps(base_src + 0 * inner_dim + 0 * simd_w), mm_res0);
-                        _MM256_ROP_PS(mm_res1, _mm256_loadu_ps(base_src + 0 * inner_dim + 1 * simd_w), mm_res1);
-                        _MM256_ROP_PS(mm_res2, _mm256_maskload_ps(base_src + 0 * inner_dim + 2 * simd_w, mm_mask), mm_res2);
+                        _MM256_ROP_PS(mm_res0, reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(base_src + 0 * inner_dim + 0 * simd_w)), mm_res0);
+                        _MM256_ROP_PS(mm_res1, reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(base_src + 0 * inner_dim + 1 * simd_w)), mm_res1);
+                        _MM256_ROP_PS(mm_res2, reduce_vector_map_fp32_avx<_op>(_mm256_maskload_ps(base_src + 0 * inner_dim + 2 * simd_w, mm_mask)), mm_res2);
                         base_src += inner_dim;
                     }
                     if (_op == REDUCE_MEAN) {
@@ -227,6 +215,11 @@ ppl::common::RetCode reduce_single_axis_ndarray_fp32_avx(
                         mm_res1      = _mm256_mul_ps(mm_res1, mm_rr);
                         mm_res2      = _mm256_mul_ps(mm_res2, mm_rr);
                     }
+                    if (_op == REDUCE_L2) {
+                        mm_res0 = _mm256_sqrt_ps(mm_res0);
+                        mm_res1 = _mm256_sqrt_ps(mm_res1);
+                        mm_res2 = _mm256_sqrt_ps(mm_res2);
+                    }
                     _mm256_storeu_ps(base_dst + 0 * simd_w, mm_res0);
                     _mm256_storeu_ps(base_dst + 1 * simd_w, mm_res1);
                     _mm256_maskstore_ps(base_dst + 2 * simd_w, mm_mask, mm_res2);
@@ -235,8 +228,8 @@ ppl::common::RetCode reduce_single_axis_ndarray_fp32_avx(
                     mm_res0 = _mm256_set1_ps(init_val);
                     mm_res1 = _mm256_set1_ps(init_val);
                     for (int64_t r = 0; r < reduce_dim; ++r) {
-                        _MM256_ROP_PS(mm_res0, _mm256_loadu_ps(base_src + 0 * inner_dim + 0 * simd_w), mm_res0);
-                        _MM256_ROP_PS(mm_res1, _mm256_maskload_ps(base_src + 0 * inner_dim + 1 * simd_w, mm_mask), mm_res1);
+                        _MM256_ROP_PS(mm_res0, reduce_vector_map_fp32_avx<_op>(_mm256_loadu_ps(base_src + 0 * inner_dim + 0 * simd_w)), mm_res0);
+                        _MM256_ROP_PS(mm_res1, reduce_vector_map_fp32_avx<_op>(_mm256_maskload_ps(base_src + 0 * inner_dim + 1 * simd_w, mm_mask)), mm_res1);
                         base_src += inner_dim;
                     }
                     if (_op == REDUCE_MEAN) {
@@ -244,19 +237,26 @@ ppl::common::RetCode reduce_single_axis_ndarray_fp32_avx(
                         mm_res0      = _mm256_mul_ps(mm_res0, mm_rr);
                         mm_res1      = _mm256_mul_ps(mm_res1, mm_rr);
                     }
+                    if (_op == REDUCE_L2) {
+                        mm_res0 = _mm256_sqrt_ps(mm_res0);
+                        mm_res1 = _mm256_sqrt_ps(mm_res1);
+                    }
                     _mm256_storeu_ps(base_dst + 0 * simd_w, mm_res0);
                     _mm256_maskstore_ps(base_dst + 1 * simd_w, mm_mask, mm_res1);
                 } else {
                     __m256 mm_res0;
                     mm_res0 = _mm256_set1_ps(init_val);
                     for (int64_t r = 0; r < reduce_dim; ++r) {
-                        _MM256_ROP_PS(mm_res0, _mm256_maskload_ps(base_src + 0 * inner_dim + 0 * simd_w, mm_mask), mm_res0);
+                        _MM256_ROP_PS(mm_res0, reduce_vector_map_fp32_avx<_op>(_mm256_maskload_ps(base_src + 0 * inner_dim + 0 * simd_w, mm_mask)), mm_res0);
                         base_src += inner_dim;
                     }
                     if (_op == REDUCE_MEAN) {
                         __m256 mm_rr = _mm256_set1_ps(1.0f / reduce_dim);
                         mm_res0      = _mm256_mul_ps(mm_res0, mm_rr);
                     }
+                    if (_op == REDUCE_L2) {
+                        mm_res0 = _mm256_sqrt_ps(mm_res0);
+                    }
                     _mm256_maskstore_ps(base_dst + 0 * simd_w, mm_mask, mm_res0);
                 }
             }
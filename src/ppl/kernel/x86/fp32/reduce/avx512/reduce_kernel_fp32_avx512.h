@@ -0,0 +1,342 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_FP32_REDUCE_AVX512_REDUCE_KERNEL_FP32_AVX512_H_
+#define __ST_PPL_KERNEL_X86_FP32_REDUCE_AVX512_REDUCE_KERNEL_FP32_AVX512_H_
+
+#include <string.h>
+#include <float.h>
+#include <math.h>
+#include <immintrin.h>
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/common/reduce/reduce_common.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+template <reduce_op_type_t _op>
+inline float reduce_init_val_fp32(void)
+{
+    return 0;
+}
+
+template <>
+inline float reduce_init_val_fp32<REDUCE_MAX>(void)
+{
+    return -FLT_MAX;
+}
+
+template <>
+inline float reduce_init_val_fp32<REDUCE_MIN>(void)
+{
+    return FLT_MAX;
+}
+
+template <>
+inline float reduce_init_val_fp32<REDUCE_PROD>(void)
+{
+    return 1.0f;
+}
+
+inline __mmask16 reduce_tail_mask_fp32_avx512(const int64_t len)
+{
+    return len >= 16 ? (__mmask16)0xffff : (len <= 0 ? (__mmask16)0 : (__mmask16)((1 << len) - 1));
+}
+
+template <reduce_op_type_t _op>
+static void reduce_preprocess_fp32_avx512(
+    float *dst,
+    int64_t len)
+{
+    const __m512 v_init_val = _mm512_set1_ps(reduce_init_val_fp32<_op>());
+
+    const int64_t simd_w      = 16;
+    const int64_t unroll_len  = simd_w * 4;
+    const int64_t unroll_body = round(len, unroll_len);
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t i = 0; i < unroll_body; i += unroll_len) {
+        _mm512_storeu_ps(dst + i + simd_w * 0, v_init_val);
+        _mm512_storeu_ps(dst + i + simd_w * 1, v_init_val);
+        _mm512_storeu_ps(dst + i + simd_w * 2, v_init_val);
+        _mm512_storeu_ps(dst + i + simd_w * 3, v_init_val);
+    }
+    for (int64_t i = unroll_body; i < len; i += simd_w) {
+        _mm512_mask_storeu_ps(dst + i, reduce_tail_mask_fp32_avx512(len - i), v_init_val);
+    }
+}
+
+template <reduce_op_type_t _op>
+inline float reduce_scalar_kernel_fp32(float a, float r);
+
+template <>
+inline float reduce_scalar_kernel_fp32<REDUCE_MEAN>(float a, float r)
+{
+    return a + r;
+}
+
+template <>
+inline float reduce_scalar_kernel_fp32<REDUCE_MAX>(float a, float r)
+{
+    return a > r ? a : r;
+}
+
+template <>
+inline float reduce_scalar_kernel_fp32<REDUCE_MIN>(float a, float r)
+{
+    return a < r ? a : r;
+}
+
+template <>
+inline float reduce_scalar_kernel_fp32<REDUCE_SUM>(float a, float r)
+{
+    return a + r;
+}
+
+template <>
+inline float reduce_scalar_kernel_fp32<REDUCE_PROD>(float a, float r)
+{
+    return a * r;
+}
+
+template <>
+inline float reduce_scalar_kernel_fp32<REDUCE_L1>(float a, float r)
+{
+    return a + r;
+}
+
+template <>
+inline float reduce_scalar_kernel_fp32<REDUCE_L2>(float a, float r)
+{
+    return a + r;
+}
+
+template <>
+inline float reduce_scalar_kernel_fp32<REDUCE_SUM_SQUARE>(float a, float r)
+{
+    return a + r;
+}
+
+template <reduce_op_type_t _op>
+inline float reduce_scalar_map_fp32(float a)
+{
+    return a;
+}
+
+template <>
+inline float reduce_scalar_map_fp32<REDUCE_L1>(float a)
+{
+    return fabsf(a);
+}
+
+template <>
+inline float reduce_scalar_map_fp32<REDUCE_L2>(float a)
+{
+    return a * a;
+}
+
+template <>
+inline float reduce_scalar_map_fp32<REDUCE_SUM_SQUARE>(float a)
+{
+    return a * a;
+}
+
+template <reduce_op_type_t _op>
+inline __m512 reduce_vector_kernel_fp32_avx512(__m512 a, __m512 r);
+
+template <>
+inline __m512 reduce_vector_kernel_fp32_avx512<REDUCE_MEAN>(__m512 a, __m512 r)
+{
+    return _mm512_add_ps(a, r);
+}
+
+template <>
+inline __m512 reduce_vector_kernel_fp32_avx512<REDUCE_MAX>(__m512 a, __m512 r)
+{
+    return _mm512_max_ps(a, r);
+}
+
+template <>
+inline __m512 reduce_vector_kernel_fp32_avx512<REDUCE_MIN>(__m512 a, __m512 r)
+{
+    return _mm512_min_ps(a, r);
+}
+
+template <>
+inline __m512 reduce_vector_kernel_fp32_avx512<REDUCE_SUM>(__m512 a, __m512 r)
+{
+    return _mm512_add_ps(a, r);
+}
+
+template <>
+inline __m512 reduce_vector_kernel_fp32_avx512<REDUCE_PROD>(__m512 a, __m512 r)
+{
+    return _mm512_mul_ps(a, r);
+}
+
+template <>
+inline __m512 reduce_vector_kernel_fp32_avx512<REDUCE_L1>(__m512 a, __m512 r)
+{
+    return _mm512_add_ps(a, r);
+}
+
+template <>
+inline __m512 reduce_vector_kernel_fp32_avx512<REDUCE_L2>(__m512 a, __m512 r)
+{
+    return _mm512_add_ps(a, r);
+}
+
+template <>
+inline __m512 reduce_vector_kernel_fp32_avx512<REDUCE_SUM_SQUARE>(__m512 a, __m512 r)
+{
+    return _mm512_add_ps(a, r);
+}
+
+template <reduce_op_type_t _op>
+inline __m512 reduce_vector_map_fp32_avx512(__m512 a)
+{
+    return a;
+}
+
+template <>
+inline __m512 reduce_vector_map_fp32_avx512<REDUCE_L1>(__m512 a)
+{
+    return _mm512_castsi512_ps(_mm512_and_epi32(_mm512_castps_si512(a), _mm512_set1_epi32(0x7fffffff)));
+}
+
+template <>
+inline __m512 reduce_vector_map_fp32_avx512<REDUCE_L2>(__m512 a)
+{
+    return _mm512_mul_ps(a, a);
+}
+
+template <>
+inline __m512 reduce_vector_map_fp32_avx512<REDUCE_SUM_SQUARE>(__m512 a)
+{
+    return _mm512_mul_ps(a, a);
+}
+
+template <reduce_op_type_t _op>
+inline float reduce_vector_all_lanes_kernel_fp32_avx512(__m512 v);
+
+template <>
+inline float reduce_vector_all_lanes_kernel_fp32_avx512<REDUCE_MEAN>(__m512 v)
+{
+    return _mm512_reduce_add_ps(v);
+}
+
+template <>
+inline float reduce_vector_all_lanes_kernel_fp32_avx512<REDUCE_MAX>(__m512 v)
+{
+    return _mm512_reduce_max_ps(v);
+}
+
+template <>
+inline float reduce_vector_all_lanes_kernel_fp32_avx512<REDUCE_MIN>(__m512 v)
+{
+    return _mm512_reduce_min_ps(v);
+}
+
+template <>
+inline float reduce_vector_all_lanes_kernel_fp32_avx512<REDUCE_SUM>(__m512 v)
+{
+    return _mm512_reduce_add_ps(v);
+}
+
+template <>
+inline float reduce_vector_all_lanes_kernel_fp32_avx512<REDUCE_PROD>(__m512 v)
+{
+    return _mm512_reduce_mul_ps(v);
+}
+
+template <>
+inline float reduce_vector_all_lanes_kernel_fp32_avx512<REDUCE_L1>(__m512 v)
+{
+    return _mm512_reduce_add_ps(v);
+}
+
+template <>
+inline float reduce_vector_all_lanes_kernel_fp32_avx512<REDUCE_L2>(__m512 v)
+{
+    return _mm512_reduce_add_ps(v);
+}
+
+template <>
+inline float reduce_vector_all_lanes_kernel_fp32_avx512<REDUCE_SUM_SQUARE>(__m512 v)
+{
+    return _mm512_reduce_add_ps(v);
+}
+
+template <reduce_op_type_t _op>
+static void reduce_postprocess_fp32_avx512(
+    float *dst,
+    int64_t len,
+    float div)
+{
+    if (_op == REDUCE_MEAN) {
+        const float rdiv    = 1.0f / div;
+        const __m512 v_rdiv = _mm512_set1_ps(rdiv);
+
+        const int64_t simd_w      = 16;
+        const int64_t unroll_len  = simd_w * 4;
+        const int64_t unroll_body = round(len, unroll_len);
+
+        PRAGMA_OMP_PARALLEL_FOR()
+        for (int64_t i = 0; i < unroll_body; i += unroll_len) {
+            __m512 v_dst_0 = _mm512_loadu_ps(dst + i + simd_w * 0);
+            __m512 v_dst_1 = _mm512_loadu_ps(dst + i + simd_w * 1);
+            __m512 v_dst_2 = _mm512_loadu_ps(dst + i + simd_w * 2);
+            __m512 v_dst_3 = _mm512_loadu_ps(dst + i + simd_w * 3);
+
+            v_dst_0 = _mm512_mul_ps(v_dst_0, v_rdiv);
+            v_dst_1 = _mm512_mul_ps(v_dst_1, v_rdiv);
+            v_dst_2 = _mm512_mul_ps(v_dst_2, v_rdiv);
+            v_dst_3 = _mm512_mul_ps(v_dst_3, v_rdiv);
+
+            _mm512_storeu_ps(dst + i + simd_w * 0, v_dst_0);
+            _mm512_storeu_ps(dst + i + simd_w * 1, v_dst_1);
+            _mm512_storeu_ps(dst + i + simd_w * 2, v_dst_2);
+            _mm512_storeu_ps(dst + i + simd_w * 3, v_dst_3);
+        }
+        for (int64_t i = unroll_body; i < len; i += simd_w) {
+            const __mmask16 mask = reduce_tail_mask_fp32_avx512(len - i);
+            _mm512_mask_storeu_ps(dst + i, mask, _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, dst + i), v_rdiv));
+        }
+    }
+
+    if (_op == REDUCE_L2) {
+        const int64_t simd_w      = 16;
+        const int64_t unroll_len  = simd_w * 4;
+        const int64_t unroll_body = round(len, unroll_len);
+
+        PRAGMA_OMP_PARALLEL_FOR()
+        for (int64_t i = 0; i < unroll_body; i += unroll_len) {
+            _mm512_storeu_ps(dst + i + simd_w * 0, _mm512_sqrt_ps(_mm512_loadu_ps(dst + i + simd_w * 0)));
+            _mm512_storeu_ps(dst + i + simd_w * 1, _mm512_sqrt_ps(_mm512_loadu_ps(dst + i + simd_w * 1)));
+            _mm512_storeu_ps(dst + i + simd_w * 2, _mm512_sqrt_ps(_mm512_loadu_ps(dst + i + simd_w * 2)));
+            _mm512_storeu_ps(dst + i + simd_w * 3, _mm512_sqrt_ps(_mm512_loadu_ps(dst + i + simd_w * 3)));
+        }
+        for (int64_t i = unroll_body; i < len; i += simd_w) {
+            const __mmask16 mask = reduce_tail_mask_fp32_avx512(len - i);
+            _mm512_mask_storeu_ps(dst + i, mask, _mm512_sqrt_ps(_mm512_maskz_loadu_ps(mask, dst + i)));
+        }
+    }
+}
+
+}}}; // namespace ppl::kernel::x86
+
+#endif // !__ST_PPL_KERNEL_X86_FP32_REDUCE_AVX512_REDUCE_KERNEL_FP32_AVX512_H_
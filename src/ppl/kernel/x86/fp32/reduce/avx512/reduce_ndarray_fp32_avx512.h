@@ -0,0 +1,355 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_FP32_REDUCE_AVX512_REDUCE_NDARRAY_FP32_AVX512_H_
+#define __ST_PPL_KERNEL_X86_FP32_REDUCE_AVX512_REDUCE_NDARRAY_FP32_AVX512_H_
+
+#include <string.h>
+
+#include "ppl/kernel/x86/fp32/reduce/avx512/reduce_kernel_fp32_avx512.h"
+#include "ppl/kernel/x86/common/threading_tools.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+template <reduce_op_type_t _op>
+static void reduce_ndarray_lastdim_no_reduce_fp32_avx512(
+    const float *src,
+    const int64_t width,
+    float *dst)
+{
+    const int64_t simd_w     = 16;
+    const int64_t unroll_len = simd_w * 4;
+
+    int64_t i = 0;
+    for (; i + unroll_len <= width; i += unroll_len) {
+        __m512 v_src_0 = reduce_vector_map_fp32_avx512<_op>(_mm512_loadu_ps(src + i + simd_w * 0));
+        __m512 v_src_1 = reduce_vector_map_fp32_avx512<_op>(_mm512_loadu_ps(src + i + simd_w * 1));
+        __m512 v_src_2 = reduce_vector_map_fp32_avx512<_op>(_mm512_loadu_ps(src + i + simd_w * 2));
+        __m512 v_src_3 = reduce_vector_map_fp32_avx512<_op>(_mm512_loadu_ps(src + i + simd_w * 3));
+
+        __m512 v_dst_0 = _mm512_loadu_ps(dst + i + simd_w * 0);
+        __m512 v_dst_1 = _mm512_loadu_ps(dst + i + simd_w * 1);
+        __m512 v_dst_2 = _mm512_loadu_ps(dst + i + simd_w * 2);
+        __m512 v_dst_3 = _mm512_loadu_ps(dst + i + simd_w * 3);
+
+        v_dst_0 = reduce_vector_kernel_fp32_avx512<_op>(v_src_0, v_dst_0);
+        v_dst_1 = reduce_vector_kernel_fp32_avx512<_op>(v_src_1, v_dst_1);
+        v_dst_2 = reduce_vector_kernel_fp32_avx512<_op>(v_src_2, v_dst_2);
+        v_dst_3 = reduce_vector_kernel_fp32_avx512<_op>(v_src_3, v_dst_3);
+
+        _mm512_storeu_ps(dst + i + simd_w * 0, v_dst_0);
+        _mm512_storeu_ps(dst + i + simd_w * 1, v_dst_1);
+        _mm512_storeu_ps(dst + i + simd_w * 2, v_dst_2);
+        _mm512_storeu_ps(dst + i + simd_w * 3, v_dst_3);
+    }
+    for (; i < width; i += simd_w) {
+        const __mmask16 mask = reduce_tail_mask_fp32_avx512(width - i);
+        __m512 v_src = reduce_vector_map_fp32_avx512<_op>(_mm512_maskz_loadu_ps(mask, src + i));
+        __m512 v_dst = _mm512_maskz_loadu_ps(mask, dst + i);
+        _mm512_mask_storeu_ps(dst + i, mask, reduce_vector_kernel_fp32_avx512<_op>(v_src, v_dst));
+    }
+}
+
+template <reduce_op_type_t _op>
+static void reduce_ndarray_lastdim_reduce_fp32_avx512(
+    const float *src,
+    const int64_t width,
+    float *dst)
+{
+    const float init_val    = reduce_init_val_fp32<_op>();
+    const __m512 v_srcit_val = _mm512_set1_ps(init_val);
+
+    const int64_t simd_w     = 16;
+    const int64_t unroll_len = simd_w * 4;
+    float reduce_val;
+    __m512 v_reduce_val_0     = v_srcit_val;
+    __m512 v_reduce_val_1     = v_srcit_val;
+    __m512 v_reduce_val_2     = v_srcit_val;
+    __m512 v_reduce_val_3     = v_srcit_val;
+
+    int64_t i = 0;
+    for (; i + unroll_len <= width; i += unroll_len) {
+        __m512 v_src_0 = reduce_vector_map_fp32_avx512<_op>(_mm512_loadu_ps(src + i + simd_w * 0));
+        __m512 v_src_1 = reduce_vector_map_fp32_avx512<_op>(_mm512_loadu_ps(src + i + simd_w * 1));
+        __m512 v_src_2 = reduce_vector_map_fp32_avx512<_op>(_mm512_loadu_ps(src + i + simd_w * 2));
+        __m512 v_src_3 = reduce_vector_map_fp32_avx512<_op>(_mm512_loadu_ps(src + i + simd_w * 3));
+
+        v_reduce_val_0 = reduce_vector_kernel_fp32_avx512<_op>(v_src_0, v_reduce_val_0);
+        v_reduce_val_1 = reduce_vector_kernel_fp32_avx512<_op>(v_src_1, v_reduce_val_1);
+        v_reduce_val_2 = reduce_vector_kernel_fp32_avx512<_op>(v_src_2, v_reduce_val_2);
+        v_reduce_val_3 = reduce_vector_kernel_fp32_avx512<_op>(v_src_3, v_reduce_val_3);
+    }
+    for (; i < width; i += simd_w) {
+        const __mmask16 mask = reduce_tail_mask_fp32_avx512(width - i);
+        v_reduce_val_0 = reduce_vector_kernel_fp32_avx512<_op>(reduce_vector_map_fp32_avx512<_op>(_mm512_mask_loadu_ps(v_srcit_val, mask, src + i)), v_reduce_val_0);
+    }
+
+    v_reduce_val_0 = reduce_vector_kernel_fp32_avx512<_op>(v_reduce_val_0, v_reduce_val_1);
+    v_reduce_val_2 = reduce_vector_kernel_fp32_avx512<_op>(v_reduce_val_2, v_reduce_val_3);
+    v_reduce_val_0 = reduce_vector_kernel_fp32_avx512<_op>(v_reduce_val_0, v_reduce_val_2);
+    reduce_val     = reduce_vector_all_lanes_kernel_fp32_avx512<_op>(v_reduce_val_0);
+    dst[0] = reduce_scalar_kernel_fp32<_op>(dst[0], reduce_val);
+}
+
+template <reduce_op_type_t _op>
+static void reduce_ndarray_recursive_fp32_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int64_t dim_idx,
+    const int64_t *inc_src,
+    const int64_t *inc_dst,
+    const single_parallel_loop_config_t *pc,
+    float *dst)
+{
+    const int64_t len = src_shape->GetDim(dim_idx);
+    if (dim_idx == src_shape->GetDimCount() - 1) { // last dim
+        if (src_shape->GetDim(dim_idx) == dst_shape->GetDim(dim_idx)) {
+            reduce_ndarray_lastdim_no_reduce_fp32_avx512<_op>(src, src_shape->GetDim(dim_idx), dst);
+        } else { // reduce on last dim_idx
+            reduce_ndarray_lastdim_reduce_fp32_avx512<_op>(src, src_shape->GetDim(dim_idx), dst);
+        }
+    } else {
+        if (pc->depth_of_loop == dim_idx && pc->num_threads > 1) {  // parallel on this dim
+            PRAGMA_OMP_PARALLEL_FOR()
+            for (int64_t t = 0; t < pc->num_threads; t++) {
+                const int64_t len_per_thread = div_up(len, pc->num_threads);
+                const int64_t start_idx = t * len_per_thread;
+                const int64_t end_idx = min(start_idx + len_per_thread, len);
+                for (int64_t i = start_idx; i < end_idx; i++) {
+                    const float *p_src = src + i * inc_src[dim_idx];
+                    float *p_dst       = dst + i * inc_dst[dim_idx];
+                    reduce_ndarray_recursive_fp32_avx512<_op>(src_shape, dst_shape, p_src, dim_idx + 1, inc_src, inc_dst, pc, p_dst);
+                }
+            }
+        } else {
+            for (int64_t i = 0; i < len; i++) {
+                const float *p_src = src + i * inc_src[dim_idx];
+                float *p_dst       = dst + i * inc_dst[dim_idx];
+                reduce_ndarray_recursive_fp32_avx512<_op>(src_shape, dst_shape, p_src, dim_idx + 1, inc_src, inc_dst, pc, p_dst);
+            }
+        }
+    }
+}
+
+template <reduce_op_type_t _op>
+ppl::common::RetCode reduce_ndarray_fp32_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst)
+{
+    if (src_shape->GetDimCount() > PPL_X86_TENSOR_MAX_DIMS()) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+
+    // pad 1 to dst shape to keepdims
+    ppl::common::TensorShape padded_dst_shape = *src_shape;
+    for (int64_t i = 0; i < num_axes; i++) {
+        padded_dst_shape.SetDim(axes[i], 1);
+    }
+
+    // pre process
+    reduce_preprocess_fp32_avx512<_op>(dst, padded_dst_shape.CalcElementsIncludingPadding());
+
+    // prepare incs
+    const int64_t dim_count  = padded_dst_shape.GetDimCount();
+    int64_t inc_src[PPL_X86_TENSOR_MAX_DIMS()] = {0};
+    int64_t inc_dst[PPL_X86_TENSOR_MAX_DIMS()] = {0};
+    int64_t stride_src  = 1;
+    int64_t stride_dst = 1;
+
+    for (int64_t i = dim_count - 1; i >= 0; i--) {
+        inc_src[i]  = src_shape->GetDim(i) == 1 ? 0 : stride_src;
+        inc_dst[i] = padded_dst_shape.GetDim(i) == 1 ? 0 : stride_dst;
+
+        stride_src *= src_shape->GetDim(i);
+        stride_dst *= padded_dst_shape.GetDim(i);
+    }
+
+    // calc parallel config
+    const int64_t task_len = 32;
+    std::vector<int64_t> loop_iter(src_shape->GetDims(), src_shape->GetDims() + dim_count);
+    loop_iter[dim_count - 1] = div_up(loop_iter[dim_count - 1], task_len);
+    std::vector<bool> forbid_mask(dim_count, false);
+    for (int64_t i = 0; i < num_axes; i++) { // reduce dims cannot parallel
+        forbid_mask[axes[i]] = true;
+    }
+    forbid_mask[dim_count - 1]    = true; // last dim will not use omp because have much overhead when reduce on all before dims, or have error when reduce on last dim
+    const bool reduce_on_last_dim = src_shape->GetDim(dim_count - 1) != padded_dst_shape.GetDim(dim_count - 1);
+
+    auto pc = select_single_parallel_loop_with_mask(
+        loop_iter,
+        forbid_mask,
+        ppl::common::ISA_X86_AVX512,
+        reduce_on_last_dim ? task_len * sizeof(float) : 2 * task_len * sizeof(float),
+        reduce_on_last_dim ? 0 : task_len * sizeof(float),
+        task_len * sizeof(float),
+        1);
+
+    // reduce
+    reduce_ndarray_recursive_fp32_avx512<_op>(src_shape, &padded_dst_shape, src, 0, inc_src, inc_dst, &pc, dst);
+
+    // post process
+    int64_t reduce_factor = 1;
+    for (int64_t i = 0; i < dim_count; i++) {
+        reduce_factor *= src_shape->GetDim(i) / padded_dst_shape.GetDim(i);
+    }
+    reduce_postprocess_fp32_avx512<_op>(dst, padded_dst_shape.CalcElementsIncludingPadding(), reduce_factor);
+
+    return ppl::common::RC_SUCCESS;
+}
+
+template <reduce_op_type_t _op>
+ppl::common::RetCode reduce_ndarray_split_fp32_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const float *src,
+    const reduce_split_plan_t *plan,
+    float *dst)
+{
+    // work on the collapsed shape, padding 1 to dst shape to keepdims
+    ppl::common::TensorShape split_shape = *src_shape;
+    split_shape.Reshape(plan->dims, plan->dim_count);
+    ppl::common::TensorShape padded_dst_shape = split_shape;
+    for (int64_t i = 0; i < plan->num_axes; i++) {
+        padded_dst_shape.SetDim(plan->axes[i], 1);
+    }
+    const int64_t dst_len = padded_dst_shape.CalcElementsIncludingPadding();
+
+    float *partials = (float *)ppl::common::AlignedAlloc(plan->num_chunks * dst_len * sizeof(float), PPL_X86_CACHELINE_BYTES());
+    if (partials == nullptr) {
+        return ppl::common::RC_OUT_OF_MEMORY;
+    }
+
+    // pre process
+    reduce_preprocess_fp32_avx512<_op>(partials, plan->num_chunks * dst_len);
+
+    // prepare incs
+    const int64_t dim_count = plan->dim_count;
+    int64_t inc_src[PPL_X86_TENSOR_MAX_DIMS()] = {0};
+    int64_t inc_dst[PPL_X86_TENSOR_MAX_DIMS()] = {0};
+    int64_t stride_src = 1;
+    int64_t stride_dst = 1;
+
+    for (int64_t i = dim_count - 1; i >= 0; i--) {
+        inc_src[i] = split_shape.GetDim(i) == 1 ? 0 : stride_src;
+        inc_dst[i] = padded_dst_shape.GetDim(i) == 1 ? 0 : stride_dst;
+
+        stride_src *= split_shape.GetDim(i);
+        stride_dst *= padded_dst_shape.GetDim(i);
+    }
+
+    // rows shorter than one unrolled step are folded: unroll_rows rows are
+    // reduced as one flat strip, then the strip is folded back to inner_len
+    const int64_t simd_w      = 16;
+    const int64_t unroll_rows = 4 * simd_w;
+    const int64_t split_axis  = plan->split_axis;
+    const int64_t split_len   = split_shape.GetDim(split_axis);
+    const int64_t inner_len   = split_shape.GetDim(dim_count - 1);
+    const bool fold_rows      = split_axis == dim_count - 2 && inner_len < unroll_rows;
+
+    // reduce every (outer, chunk) into its own partial, nothing is shared between tasks
+    const single_parallel_loop_config_t serial_pc = {-1, 1};
+    const int64_t num_tasks = plan->outer_len * plan->num_chunks;
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t t = 0; t < num_tasks; ++t) {
+        const int64_t o = t / plan->num_chunks;
+        const int64_t c = t % plan->num_chunks;
+
+        int64_t src_offset = 0;
+        int64_t dst_offset = 0;
+        int64_t outer_idx  = o;
+        for (int64_t i = split_axis - 1; i >= 0; --i) {
+            const int64_t idx = outer_idx % split_shape.GetDim(i);
+            outer_idx /= split_shape.GetDim(i);
+            src_offset += idx * inc_src[i];
+            dst_offset += idx * inc_dst[i];
+        }
+
+        const int64_t r_start = c * plan->chunk_len;
+        const int64_t r_end   = min(r_start + plan->chunk_len, split_len);
+        float *p_dst          = partials + c * dst_len + dst_offset;
+        if (split_axis == dim_count - 1) {
+            reduce_ndarray_lastdim_reduce_fp32_avx512<_op>(src + src_offset + r_start, r_end - r_start, p_dst);
+        } else if (fold_rows) {
+            const int64_t fold_len = unroll_rows * inner_len;
+            float fold_buf[unroll_rows * unroll_rows];
+            for (int64_t i = 0; i < fold_len; ++i) {
+                fold_buf[i] = reduce_init_val_fp32<_op>();
+            }
+            const float *p_src = src + src_offset + r_start * inner_len;
+            int64_t r          = r_start;
+            for (; r + unroll_rows <= r_end; r += unroll_rows) {
+                reduce_ndarray_lastdim_no_reduce_fp32_avx512<_op>(p_src, fold_len, fold_buf);
+                p_src += fold_len;
+            }
+            for (; r < r_end; ++r) {
+                reduce_ndarray_lastdim_no_reduce_fp32_avx512<_op>(p_src, inner_len, p_dst);
+                p_src += inner_len;
+            }
+            for (int64_t g = 0; g < unroll_rows; ++g) {
+                for (int64_t i = 0; i < inner_len; ++i) {
+                    p_dst[i] = reduce_scalar_kernel_fp32<_op>(fold_buf[g * inner_len + i], p_dst[i]);
+                }
+            }
+        } else {
+            for (int64_t r = r_start; r < r_end; ++r) {
+                const float *p_src = src + src_offset + r * inc_src[split_axis];
+                reduce_ndarray_recursive_fp32_avx512<_op>(&split_shape, &padded_dst_shape, p_src, split_axis + 1, inc_src, inc_dst, &serial_pc, p_dst);
+            }
+        }
+    }
+
+    // combine partials pairwise in place, the tree only depends on num_chunks
+    const int64_t dst_body = round(dst_len, simd_w);
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t i = 0; i < dst_body; i += simd_w) {
+        for (int64_t stride = 1; stride < plan->num_chunks; stride *= 2) {
+            for (int64_t c = 0; c + stride < plan->num_chunks; c += 2 * stride) {
+                float *p_l = partials + c * dst_len + i;
+                float *p_r = partials + (c + stride) * dst_len + i;
+                _mm512_storeu_ps(p_l, reduce_vector_kernel_fp32_avx512<_op>(_mm512_loadu_ps(p_r), _mm512_loadu_ps(p_l)));
+            }
+        }
+        _mm512_storeu_ps(dst + i, _mm512_loadu_ps(partials + i));
+    }
+    for (int64_t i = dst_body; i < dst_len; ++i) {
+        for (int64_t stride = 1; stride < plan->num_chunks; stride *= 2) {
+            for (int64_t c = 0; c + stride < plan->num_chunks; c += 2 * stride) {
+                float *p_l = partials + c * dst_len + i;
+                p_l[0]     = reduce_scalar_kernel_fp32<_op>(p_l[stride * dst_len], p_l[0]);
+            }
+        }
+        dst[i] = partials[i];
+    }
+    ppl::common::AlignedFree(partials);
+
+    // post process
+    int64_t reduce_factor = 1;
+    for (int64_t i = 0; i < plan->num_axes; i++) {
+        reduce_factor *= split_shape.GetDim(plan->axes[i]);
+    }
+    reduce_postprocess_fp32_avx512<_op>(dst, dst_len, reduce_factor);
+
+    return ppl::common::RC_SUCCESS;
+}
+
+}}}; // namespace ppl::kernel::x86
+
+#endif // !__ST_PPL_KERNEL_X86_FP32_REDUCE_AVX512_REDUCE_NDARRAY_FP32_AVX512_H_
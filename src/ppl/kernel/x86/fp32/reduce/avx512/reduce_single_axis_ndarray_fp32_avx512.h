@@ -0,0 +1,161 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_FP32_REDUCE_AVX512_REDUCE_SINGLE_AXIS_NDARRAY_FP32_AVX512_H_
+#define __ST_PPL_KERNEL_X86_FP32_REDUCE_AVX512_REDUCE_SINGLE_AXIS_NDARRAY_FP32_AVX512_H_
+
+#include "ppl/kernel/x86/fp32/reduce/avx512/reduce_kernel_fp32_avx512.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+template <reduce_op_type_t _op>
+ppl::common::RetCode reduce_single_axis_ndarray_fp32_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst)
+{
+    int64_t outer_dim       = 1;
+    int64_t reduce_dim      = 1;
+    int64_t inner_dim       = 1;
+    const int64_t dim_count = src_shape->GetDimCount();
+    for (int64_t i = 0; i < dim_count; i++) {
+        if (i < axes[0]) {
+            outer_dim *= src_shape->GetDim(i);
+        } else if (i > axes[num_axes - 1]) {
+            inner_dim *= src_shape->GetDim(i);
+        } else {
+            reduce_dim *= src_shape->GetDim(i);
+        }
+    }
+
+    const int64_t simd_w        = 16;
+    const int64_t unroll_reduce = 4;
+    const int64_t unroll_inner  = 4 * simd_w;
+    const __m512 v_init_val     = _mm512_set1_ps(reduce_init_val_fp32<_op>());
+    const __m512 v_rdiv         = _mm512_set1_ps(1.0f / reduce_dim);
+
+#ifdef PPL_USE_X86_OMP_COLLAPSE
+    PRAGMA_OMP_PARALLEL_FOR_COLLAPSE(2)
+#else
+    PRAGMA_OMP_PARALLEL_FOR()
+#endif
+    for (int64_t o = 0; o < outer_dim; ++o) {
+        for (int64_t i = 0; i < inner_dim; i += unroll_inner) {
+            const int64_t inner_eff = min<int64_t>(inner_dim - i, unroll_inner);
+            const float *base_src   = src + o * reduce_dim * inner_dim + i;
+            float *base_dst         = dst + o * inner_dim + i;
+            if (inner_eff == unroll_inner) {
+                __m512 v_res_0 = v_init_val;
+                __m512 v_res_1 = v_init_val;
+                __m512 v_res_2 = v_init_val;
+                __m512 v_res_3 = v_init_val;
+                for (int64_t r = 0; r < reduce_dim; ++r) {
+                    v_res_0 = reduce_vector_kernel_fp32_avx512<_op>(reduce_vector_map_fp32_avx512<_op>(_mm512_loadu_ps(base_src + 0 * simd_w)), v_res_0);
+                    v_res_1 = reduce_vector_kernel_fp32_avx512<_op>(reduce_vector_map_fp32_avx512<_op>(_mm512_loadu_ps(base_src + 1 * simd_w)), v_res_1);
+                    v_res_2 = reduce_vector_kernel_fp32_avx512<_op>(reduce_vector_map_fp32_avx512<_op>(_mm512_loadu_ps(base_src + 2 * simd_w)), v_res_2);
+                    v_res_3 = reduce_vector_kernel_fp32_avx512<_op>(reduce_vector_map_fp32_avx512<_op>(_mm512_loadu_ps(base_src + 3 * simd_w)), v_res_3);
+                    base_src += inner_dim;
+                }
+                if (_op == REDUCE_MEAN) {
+                    v_res_0 = _mm512_mul_ps(v_res_0, v_rdiv);
+                    v_res_1 = _mm512_mul_ps(v_res_1, v_rdiv);
+                    v_res_2 = _mm512_mul_ps(v_res_2, v_rdiv);
+                    v_res_3 = _mm512_mul_ps(v_res_3, v_rdiv);
+                }
+                if (_op == REDUCE_L2) {
+                    v_res_0 = _mm512_sqrt_ps(v_res_0);
+                    v_res_1 = _mm512_sqrt_ps(v_res_1);
+                    v_res_2 = _mm512_sqrt_ps(v_res_2);
+                    v_res_3 = _mm512_sqrt_ps(v_res_3);
+                }
+                _mm512_storeu_ps(base_dst + 0 * simd_w, v_res_0);
+                _mm512_storeu_ps(base_dst + 1 * simd_w, v_res_1);
+                _mm512_storeu_ps(base_dst + 2 * simd_w, v_res_2);
+                _mm512_storeu_ps(base_dst + 3 * simd_w, v_res_3);
+            } else if (inner_dim == 1) {
+                __m512 v_res_0 = v_init_val;
+                __m512 v_res_1 = v_init_val;
+                __m512 v_res_2 = v_init_val;
+                __m512 v_res_3 = v_init_val;
+                int64_t r = 0;
+                for (; r + unroll_reduce * simd_w <= reduce_dim; r += unroll_reduce * simd_w) {
+                    v_res_0 = reduce_vector_kernel_fp32_avx512<_op>(reduce_vector_map_fp32_avx512<_op>(_mm512_loadu_ps(base_src + r + 0 * simd_w)), v_res_0);
+                    v_res_1 = reduce_vector_kernel_fp32_avx512<_op>(reduce_vector_map_fp32_avx512<_op>(_mm512_loadu_ps(base_src + r + 1 * simd_w)), v_res_1);
+                    v_res_2 = reduce_vector_kernel_fp32_avx512<_op>(reduce_vector_map_fp32_avx512<_op>(_mm512_loadu_ps(base_src + r + 2 * simd_w)), v_res_2);
+                    v_res_3 = reduce_vector_kernel_fp32_avx512<_op>(reduce_vector_map_fp32_avx512<_op>(_mm512_loadu_ps(base_src + r + 3 * simd_w)), v_res_3);
+                }
+                for (; r < reduce_dim; r += simd_w) {
+                    const __mmask16 mask = reduce_tail_mask_fp32_avx512(reduce_dim - r);
+                    v_res_0 = reduce_vector_kernel_fp32_avx512<_op>(reduce_vector_map_fp32_avx512<_op>(_mm512_mask_loadu_ps(v_init_val, mask, base_src + r)), v_res_0);
+                }
+                v_res_0 = reduce_vector_kernel_fp32_avx512<_op>(v_res_0, v_res_1);
+                v_res_2 = reduce_vector_kernel_fp32_avx512<_op>(v_res_2, v_res_3);
+                v_res_0 = reduce_vector_kernel_fp32_avx512<_op>(v_res_0, v_res_2);
+                float res_val = reduce_vector_all_lanes_kernel_fp32_avx512<_op>(v_res_0);
+                if (_op == REDUCE_MEAN) {
+                    res_val /= reduce_dim;
+                }
+                if (_op == REDUCE_L2) {
+                    res_val = sqrtf(res_val);
+                }
+                base_dst[0] = res_val;
+            } else {
+                // tail of inner dim, handled by up to 4 masked vectors
+                const __mmask16 mask_0 = reduce_tail_mask_fp32_avx512(inner_eff - 0 * simd_w);
+                const __mmask16 mask_1 = reduce_tail_mask_fp32_avx512(inner_eff - 1 * simd_w);
+                const __mmask16 mask_2 = reduce_tail_mask_fp32_avx512(inner_eff - 2 * simd_w);
+                const __mmask16 mask_3 = reduce_tail_mask_fp32_avx512(inner_eff - 3 * simd_w);
+                __m512 v_res_0 = v_init_val;
+                __m512 v_res_1 = v_init_val;
+                __m512 v_res_2 = v_init_val;
+                __m512 v_res_3 = v_init_val;
+                for (int64_t r = 0; r < reduce_dim; ++r) {
+                    v_res_0 = reduce_vector_kernel_fp32_avx512<_op>(reduce_vector_map_fp32_avx512<_op>(_mm512_mask_loadu_ps(v_init_val, mask_0, base_src + 0 * simd_w)), v_res_0);
+                    v_res_1 = reduce_vector_kernel_fp32_avx512<_op>(reduce_vector_map_fp32_avx512<_op>(_mm512_mask_loadu_ps(v_init_val, mask_1, base_src + 1 * simd_w)), v_res_1);
+                    v_res_2 = reduce_vector_kernel_fp32_avx512<_op>(reduce_vector_map_fp32_avx512<_op>(_mm512_mask_loadu_ps(v_init_val, mask_2, base_src + 2 * simd_w)), v_res_2);
+                    v_res_3 = reduce_vector_kernel_fp32_avx512<_op>(reduce_vector_map_fp32_avx512<_op>(_mm512_mask_loadu_ps(v_init_val, mask_3, base_src + 3 * simd_w)), v_res_3);
+                    base_src += inner_dim;
+                }
+                if (_op == REDUCE_MEAN) {
+                    v_res_0 = _mm512_mul_ps(v_res_0, v_rdiv);
+                    v_res_1 = _mm512_mul_ps(v_res_1, v_rdiv);
+                    v_res_2 = _mm512_mul_ps(v_res_2, v_rdiv);
+                    v_res_3 = _mm512_mul_ps(v_res_3, v_rdiv);
+                }
+                if (_op == REDUCE_L2) {
+                    v_res_0 = _mm512_sqrt_ps(v_res_0);
+                    v_res_1 = _mm512_sqrt_ps(v_res_1);
+                    v_res_2 = _mm512_sqrt_ps(v_res_2);
+                    v_res_3 = _mm512_sqrt_ps(v_res_3);
+                }
+                _mm512_mask_storeu_ps(base_dst + 0 * simd_w, mask_0, v_res_0);
+                _mm512_mask_storeu_ps(base_dst + 1 * simd_w, mask_1, v_res_1);
+                _mm512_mask_storeu_ps(base_dst + 2 * simd_w, mask_2, v_res_2);
+                _mm512_mask_storeu_ps(base_dst + 3 * simd_w, mask_3, v_res_3);
+            }
+        }
+    }
+
+    return ppl::common::RC_SUCCESS;
+}
+
+}}}; // namespace ppl::kernel::x86
+
+#endif // !__ST_PPL_KERNEL_X86_FP32_REDUCE_AVX512_REDUCE_SINGLE_AXIS_NDARRAY_FP32_AVX512_H_
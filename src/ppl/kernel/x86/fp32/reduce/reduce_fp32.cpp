@@ -0,0 +1,202 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/fp32/reduce.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+ppl::common::RetCode reduce_max_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return reduce_max_fp32_avx512(src_shape, dst_shape, src, axes, num_axes, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) {
+        return reduce_max_fp32_avx(src_shape, dst_shape, src, axes, num_axes, dst);
+    }
+    return reduce_max_fp32_sse(src_shape, dst_shape, src, axes, num_axes, dst);
+}
+
+ppl::common::RetCode reduce_min_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return reduce_min_fp32_avx512(src_shape, dst_shape, src, axes, num_axes, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) {
+        return reduce_min_fp32_avx(src_shape, dst_shape, src, axes, num_axes, dst);
+    }
+    return reduce_min_fp32_sse(src_shape, dst_shape, src, axes, num_axes, dst);
+}
+
+ppl::common::RetCode reduce_mean_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return reduce_mean_fp32_avx512(src_shape, dst_shape, src, axes, num_axes, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) {
+        return reduce_mean_fp32_avx(src_shape, dst_shape, src, axes, num_axes, dst);
+    }
+    return reduce_mean_fp32_sse(src_shape, dst_shape, src, axes, num_axes, dst);
+}
+
+ppl::common::RetCode reduce_sum_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return reduce_sum_fp32_avx512(src_shape, dst_shape, src, axes, num_axes, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) {
+        return reduce_sum_fp32_avx(src_shape, dst_shape, src, axes, num_axes, dst);
+    }
+    return reduce_sum_fp32_sse(src_shape, dst_shape, src, axes, num_axes, dst);
+}
+ppl::common::RetCode reduce_prod_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return reduce_prod_fp32_avx512(src_shape, dst_shape, src, axes, num_axes, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) {
+        return reduce_prod_fp32_avx(src_shape, dst_shape, src, axes, num_axes, dst);
+    }
+    return reduce_prod_fp32_sse(src_shape, dst_shape, src, axes, num_axes, dst);
+}
+
+ppl::common::RetCode reduce_l1_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return reduce_l1_fp32_avx512(src_shape, dst_shape, src, axes, num_axes, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) {
+        return reduce_l1_fp32_avx(src_shape, dst_shape, src, axes, num_axes, dst);
+    }
+    return reduce_l1_fp32_sse(src_shape, dst_shape, src, axes, num_axes, dst);
+}
+
+ppl::common::RetCode reduce_l2_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return reduce_l2_fp32_avx512(src_shape, dst_shape, src, axes, num_axes, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) {
+        return reduce_l2_fp32_avx(src_shape, dst_shape, src, axes, num_axes, dst);
+    }
+    return reduce_l2_fp32_sse(src_shape, dst_shape, src, axes, num_axes, dst);
+}
+
+ppl::common::RetCode reduce_sum_square_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return reduce_sum_square_fp32_avx512(src_shape, dst_shape, src, axes, num_axes, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) {
+        return reduce_sum_square_fp32_avx(src_shape, dst_shape, src, axes, num_axes, dst);
+    }
+    return reduce_sum_square_fp32_sse(src_shape, dst_shape, src, axes, num_axes, dst);
+}
+
+ppl::common::RetCode reduce_log_sum_exp_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return reduce_log_sum_exp_fp32_avx512(src_shape, dst_shape, src, axes, num_axes, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_FMA) {
+        return reduce_log_sum_exp_fp32_fma(src_shape, dst_shape, src, axes, num_axes, dst);
+    }
+    return reduce_log_sum_exp_fp32_sse(src_shape, dst_shape, src, axes, num_axes, dst);
+}
+
+}}}; // namespace ppl::kernel::x86
@@ -0,0 +1,345 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_FP32_REDUCE_REDUCE_LOG_SUM_EXP_FP32_COMMON_H_
+#define __ST_PPL_KERNEL_X86_FP32_REDUCE_REDUCE_LOG_SUM_EXP_FP32_COMMON_H_
+
+#include <float.h>
+#include <math.h>
+#include <vector>
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/common/reduce/reduce_common.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+// log-sum-exp is done in one pass by keeping a running (max, sum) pair for
+// every output, with sum taken relative to max. a new maximum rescales the
+// sum instead of being exponentiated against a stale one, so each input costs
+// one exp and nothing can overflow.
+
+inline void reduce_log_sum_exp_update_fp32(const float x, float *m, float *s)
+{
+    const float e = expf(-fabsf(x - m[0]));
+    if (x > m[0]) {
+        s[0] = s[0] * e + 1.0f;
+        m[0] = x;
+    } else {
+        s[0] = s[0] + e;
+    }
+}
+
+inline void reduce_log_sum_exp_merge_fp32(const float pm, const float ps, float *m, float *s)
+{
+    const float e = expf(-fabsf(pm - m[0]));
+    if (pm > m[0]) {
+        s[0] = s[0] * e + ps;
+        m[0] = pm;
+    } else {
+        s[0] = s[0] + ps * e;
+    }
+}
+
+struct reduce_log_sum_exp_plan_fp32_t {
+    // outer dims are split into kept dims and reduced dims, outer to inner
+    int64_t kept_dims[PPL_X86_TENSOR_MAX_DIMS() + 1];
+    int64_t kept_src_inc[PPL_X86_TENSOR_MAX_DIMS() + 1];
+    int64_t kept_dst_inc[PPL_X86_TENSOR_MAX_DIMS() + 1];
+    int64_t red_dims[PPL_X86_TENSOR_MAX_DIMS() + 1];
+    int64_t red_src_inc[PPL_X86_TENSOR_MAX_DIMS() + 1];
+    int32_t num_kept;
+    int32_t num_red;
+    // innermost dim, contiguous in src, and in dst when it is kept
+    int64_t row_len;
+    int32_t row_reduced;
+    // n16cx reducing on channel: the last channel block has only row_tail
+    // valid lanes, tail_red_idx is that block dim in red_dims or -1 if the
+    // tensor has a single channel block
+    int64_t row_tail;
+    int32_t tail_red_idx;
+};
+
+inline ppl::common::RetCode reduce_log_sum_exp_prepare_fp32(
+    const ppl::common::TensorShape *src_shape,
+    const int32_t *axes,
+    const int32_t num_axes,
+    reduce_log_sum_exp_plan_fp32_t *plan)
+{
+    const int64_t c_blk     = 16;
+    const int64_t dim_count = src_shape->GetDimCount();
+    const bool is_n16cx     = src_shape->GetDataFormat() == ppl::common::DATAFORMAT_N16CX;
+    if (dim_count > PPL_X86_TENSOR_MAX_DIMS()) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+    if (!is_n16cx && src_shape->GetDataFormat() != ppl::common::DATAFORMAT_NDARRAY) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+    if (is_n16cx && dim_count < 2) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+
+    bool reduced[PPL_X86_TENSOR_MAX_DIMS()] = {false};
+    for (int32_t i = 0; i < num_axes; ++i) {
+        const int32_t axis = axes[i] < 0 ? axes[i] + dim_count : axes[i];
+        if (axis < 0 || axis >= dim_count) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+        reduced[axis] = true;
+    }
+
+    // n16cx is viewed as [N, C / 16, spatial..., 16]
+    const int64_t view_count = is_n16cx ? dim_count + 1 : dim_count;
+    const int64_t lane_dim   = is_n16cx ? dim_count : -1;
+    const int64_t channels   = is_n16cx ? src_shape->GetDim(1) : 0;
+    const bool split_tail    = is_n16cx && reduced[1] && channels % c_blk != 0;
+    int64_t dims[PPL_X86_TENSOR_MAX_DIMS() + 1];
+    bool red[PPL_X86_TENSOR_MAX_DIMS() + 1];
+    for (int64_t i = 0; i < dim_count; ++i) {
+        dims[i] = (is_n16cx && i == 1) ? div_up(channels, c_blk) : src_shape->GetDim(i);
+        red[i]  = reduced[i];
+    }
+    if (is_n16cx) {
+        dims[lane_dim] = c_blk;
+        red[lane_dim]  = reduced[1];
+    }
+
+    int64_t src_inc[PPL_X86_TENSOR_MAX_DIMS() + 1];
+    int64_t dst_inc[PPL_X86_TENSOR_MAX_DIMS() + 1];
+    int64_t src_stride = 1;
+    int64_t dst_stride = 1;
+    for (int64_t i = view_count - 1; i >= 0; --i) {
+        src_inc[i] = src_stride;
+        dst_inc[i] = red[i] ? 0 : dst_stride;
+        src_stride *= dims[i];
+        if (!red[i] || i == lane_dim) { // dst keeps a whole channel block even if it has only 1 channel
+            dst_stride *= dims[i];
+        }
+    }
+
+    // drop unit dims and merge contiguous neighbours, inner to outer. the
+    // lane dim and channel block dim must stay apart when the tail is split
+    int64_t g_dims[PPL_X86_TENSOR_MAX_DIMS() + 1];
+    int64_t g_src_inc[PPL_X86_TENSOR_MAX_DIMS() + 1];
+    int64_t g_dst_inc[PPL_X86_TENSOR_MAX_DIMS() + 1];
+    bool g_red[PPL_X86_TENSOR_MAX_DIMS() + 1];
+    bool g_tail[PPL_X86_TENSOR_MAX_DIMS() + 1];
+    int64_t num_g = 0;
+    for (int64_t i = view_count - 1; i >= 0; --i) {
+        const bool no_merge = split_tail && (i == lane_dim || i == 1);
+        if (dims[i] == 1 && i != lane_dim) {
+            continue;
+        }
+        if (num_g > 0 && !no_merge && !g_tail[num_g - 1] && g_red[num_g - 1] == red[i] &&
+            src_inc[i] == g_dims[num_g - 1] * g_src_inc[num_g - 1] &&
+            (red[i] || dst_inc[i] == g_dims[num_g - 1] * g_dst_inc[num_g - 1])) {
+            g_dims[num_g - 1] *= dims[i];
+            continue;
+        }
+        g_dims[num_g]    = dims[i];
+        g_src_inc[num_g] = src_inc[i];
+        g_dst_inc[num_g] = dst_inc[i];
+        g_red[num_g]     = red[i];
+        g_tail[num_g]    = no_merge;
+        ++num_g;
+    }
+    if (num_g == 0) {
+        g_dims[0]    = 1;
+        g_src_inc[0] = 1;
+        g_dst_inc[0] = 1;
+        g_red[0]     = false;
+        g_tail[0]    = false;
+        num_g        = 1;
+    }
+
+    plan->row_len      = g_dims[0];
+    plan->row_reduced  = g_red[0];
+    plan->row_tail     = split_tail ? channels - (div_up(channels, c_blk) - 1) * c_blk : g_dims[0];
+    plan->tail_red_idx = -1;
+    plan->num_kept     = 0;
+    plan->num_red      = 0;
+    for (int64_t i = num_g - 1; i >= 1; --i) {
+        if (g_red[i]) {
+            if (g_tail[i]) {
+                plan->tail_red_idx = plan->num_red;
+            }
+            plan->red_dims[plan->num_red]    = g_dims[i];
+            plan->red_src_inc[plan->num_red] = g_src_inc[i];
+            ++plan->num_red;
+        } else {
+            plan->kept_dims[plan->num_kept]    = g_dims[i];
+            plan->kept_src_inc[plan->num_kept] = g_src_inc[i];
+            plan->kept_dst_inc[plan->num_kept] = g_dst_inc[i];
+            ++plan->num_kept;
+        }
+    }
+
+    return ppl::common::RC_SUCCESS;
+}
+
+inline void reduce_log_sum_exp_kept_offset_fp32(
+    const reduce_log_sum_exp_plan_fp32_t *plan,
+    int64_t outer,
+    int64_t *src_off,
+    int64_t *dst_off)
+{
+    src_off[0] = 0;
+    dst_off[0] = 0;
+    for (int32_t d = plan->num_kept - 1; d >= 0; --d) {
+        const int64_t idx = outer % plan->kept_dims[d];
+        outer /= plan->kept_dims[d];
+        src_off[0] += idx * plan->kept_src_inc[d];
+        dst_off[0] += idx * plan->kept_dst_inc[d];
+    }
+}
+
+inline void reduce_log_sum_exp_red_begin_fp32(
+    const reduce_log_sum_exp_plan_fp32_t *plan,
+    int64_t red_row,
+    int64_t *idx,
+    int64_t *src_off)
+{
+    src_off[0] = 0;
+    for (int32_t d = plan->num_red - 1; d >= 0; --d) {
+        idx[d] = red_row % plan->red_dims[d];
+        red_row /= plan->red_dims[d];
+        src_off[0] += idx[d] * plan->red_src_inc[d];
+    }
+}
+
+inline void reduce_log_sum_exp_red_next_fp32(
+    const reduce_log_sum_exp_plan_fp32_t *plan,
+    int64_t *idx,
+    int64_t *src_off)
+{
+    for (int32_t d = plan->num_red - 1; d >= 0; --d) {
+        ++idx[d];
+        src_off[0] += plan->red_src_inc[d];
+        if (idx[d] < plan->red_dims[d]) {
+            return;
+        }
+        src_off[0] -= plan->red_dims[d] * plan->red_src_inc[d];
+        idx[d] = 0;
+    }
+}
+
+// kernel_t supplies the vector code:
+//   update_row(src, n, m, s)  folds a src row into n (max, sum) pairs
+//   reduce_init(st)           clears a state
+//   reduce_row(src, n, st)    folds a whole src row into one state
+//   reduce_finish(st, m, s)   collapses a state into one (max, sum) pair
+template <typename kernel_t>
+ppl::common::RetCode reduce_log_sum_exp_fp32_common(
+    const ppl::common::TensorShape *src_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst)
+{
+    reduce_log_sum_exp_plan_fp32_t plan;
+    ppl::common::RetCode ret = reduce_log_sum_exp_prepare_fp32(src_shape, axes, num_axes, &plan);
+    if (ret != ppl::common::RC_SUCCESS) {
+        return ret;
+    }
+
+    int64_t num_outer = 1;
+    for (int32_t d = 0; d < plan.num_kept; ++d) {
+        num_outer *= plan.kept_dims[d];
+    }
+    int64_t num_red_rows = 1;
+    for (int32_t d = 0; d < plan.num_red; ++d) {
+        num_red_rows *= plan.red_dims[d];
+    }
+
+    if (!plan.row_reduced) {
+        // rows are cut into blocks so that the sum part stays on stack and in L1
+        const int64_t row_blk     = 256;
+        const int64_t num_row_blk = div_up(plan.row_len, row_blk);
+        PRAGMA_OMP_PARALLEL_FOR()
+        for (int64_t t = 0; t < num_outer * num_row_blk; ++t) {
+            const int64_t j = (t % num_row_blk) * row_blk;
+            const int64_t n = min(row_blk, plan.row_len - j);
+            int64_t src_off, dst_off;
+            reduce_log_sum_exp_kept_offset_fp32(&plan, t / num_row_blk, &src_off, &dst_off);
+
+            float *m = dst + dst_off + j;
+            float s[row_blk];
+            for (int64_t i = 0; i < n; ++i) {
+                m[i] = -FLT_MAX;
+                s[i] = 0.0f;
+            }
+            int64_t idx[PPL_X86_TENSOR_MAX_DIMS() + 1];
+            int64_t red_off;
+            reduce_log_sum_exp_red_begin_fp32(&plan, 0, idx, &red_off);
+            for (int64_t r = 0; r < num_red_rows; ++r) {
+                kernel_t::update_row(src + src_off + red_off + j, n, m, s);
+                reduce_log_sum_exp_red_next_fp32(&plan, idx, &red_off);
+            }
+            for (int64_t i = 0; i < n; ++i) {
+                m[i] += logf(s[i]);
+            }
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    // rows are reduced too. with fewer outputs than threads the reduced rows
+    // are split into parts, and the partial pairs merged afterwards
+    const int64_t num_parts = reduce_select_num_chunks(
+        num_outer, num_outer, num_red_rows, plan.row_len, PPL_OMP_MAX_THREADS());
+    std::vector<float> partial(num_outer * num_parts * 2);
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t t = 0; t < num_outer * num_parts; ++t) {
+        const int64_t p     = t % num_parts;
+        const int64_t r_beg = p * num_red_rows / num_parts;
+        const int64_t r_end = (p + 1) * num_red_rows / num_parts;
+        int64_t src_off, dst_off;
+        reduce_log_sum_exp_kept_offset_fp32(&plan, t / num_parts, &src_off, &dst_off);
+
+        typename kernel_t::state_t st;
+        kernel_t::reduce_init(&st);
+        int64_t idx[PPL_X86_TENSOR_MAX_DIMS() + 1];
+        int64_t red_off;
+        reduce_log_sum_exp_red_begin_fp32(&plan, r_beg, idx, &red_off);
+        for (int64_t r = r_beg; r < r_end; ++r) {
+            const bool tail = plan.tail_red_idx < 0 || idx[plan.tail_red_idx] == plan.red_dims[plan.tail_red_idx] - 1;
+            kernel_t::reduce_row(src + src_off + red_off, tail ? plan.row_tail : plan.row_len, &st);
+            reduce_log_sum_exp_red_next_fp32(&plan, idx, &red_off);
+        }
+        kernel_t::reduce_finish(&st, &partial[t * 2 + 0], &partial[t * 2 + 1]);
+    }
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t o = 0; o < num_outer; ++o) {
+        float *part = partial.data() + o * num_parts * 2;
+        for (int64_t stride = 1; stride < num_parts; stride *= 2) {
+            for (int64_t p = 0; p + stride < num_parts; p += 2 * stride) {
+                reduce_log_sum_exp_merge_fp32(part[(p + stride) * 2 + 0], part[(p + stride) * 2 + 1], &part[p * 2 + 0], &part[p * 2 + 1]);
+            }
+        }
+        const float m = part[0];
+        const float s = part[1];
+        int64_t src_off, dst_off;
+        reduce_log_sum_exp_kept_offset_fp32(&plan, o, &src_off, &dst_off);
+        dst[dst_off] = m + logf(s);
+    }
+
+    return ppl::common::RC_SUCCESS;
+}
+
+}}}; // namespace ppl::kernel::x86
+
+#endif // !__ST_PPL_KERNEL_X86_FP32_REDUCE_REDUCE_LOG_SUM_EXP_FP32_COMMON_H_
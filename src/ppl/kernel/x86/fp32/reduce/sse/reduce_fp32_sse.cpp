@@ -33,6 +33,15 @@ ppl::common::RetCode reduce_fp32_sse(
     float *dst)
 {
     if (src_shape->CalcElementsExcludingPadding() == dst_shape->CalcElementsExcludingPadding()) { // no actual reduce happened, just copy
+        if (_op == REDUCE_L1 || _op == REDUCE_L2 || _op == REDUCE_SUM_SQUARE) { // except for element-wise transform
+            const int64_t len = src_shape->CalcElementsIncludingPadding();
+            PRAGMA_OMP_PARALLEL_FOR()
+            for (int64_t i = 0; i < len; i++) {
+                dst[i] = reduce_scalar_map_fp32<_op>(src[i]);
+            }
+            reduce_postprocess_fp32_sse<_op>(dst, len, 1.0f);
+            return ppl::common::RC_SUCCESS;
+        }
         memcpy(dst, src, src_shape->CalcBytesIncludingPadding());
         return ppl::common::RC_SUCCESS;
     }
@@ -57,13 +66,18 @@ ppl::common::RetCode reduce_fp32_sse(
     }
 
     if (src_shape->GetDataFormat() == ppl::common::DATAFORMAT_NDARRAY) {
+        const reduce_split_plan_t split_plan = reduce_select_split_plan(
+            src_shape->GetDims(), src_shape->GetDimCount(), real_axes, num_axes, PPL_OMP_MAX_THREADS());
+        if (split_plan.num_chunks > 1) { // too few outputs to feed all threads, split the reduced axis instead
+            return reduce_ndarray_split_fp32_sse<_op>(src_shape, src, &split_plan, dst);
+        }
         if (continous_reduce_axis) { // continous_reduce_axis, use special optimized code
             return reduce_single_axis_ndarray_fp32_sse<_op>(src_shape, dst_shape, src, real_axes, num_axes, dst);
         } else {
             return reduce_ndarray_fp32_sse<_op>(src_shape, dst_shape, src, real_axes, num_axes, dst);
         }
     } else if (src_shape->GetDataFormat() == ppl::common::DATAFORMAT_N16CX) {
-        return reduce_n16cx_fp32_sse<_op>(src_shape, dst_shape, src, axes, num_axes, 1, dst);
+        return reduce_n16cx_fp32_sse<_op>(src_shape, dst_shape, src, real_axes, num_axes, 1, dst);
     }
 
     return ppl::common::RC_UNSUPPORTED;
@@ -113,4 +127,48 @@ ppl::common::RetCode reduce_sum_fp32_sse(
     return reduce_fp32_sse<REDUCE_SUM>(src_shape, dst_shape, src, axes, num_axes, dst);
 }
 
+ppl::common::RetCode reduce_prod_fp32_sse(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst)
+{
+    return reduce_fp32_sse<REDUCE_PROD>(src_shape, dst_shape, src, axes, num_axes, dst);
+}
+
+ppl::common::RetCode reduce_l1_fp32_sse(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst)
+{
+    return reduce_fp32_sse<REDUCE_L1>(src_shape, dst_shape, src, axes, num_axes, dst);
+}
+
+ppl::common::RetCode reduce_l2_fp32_sse(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst)
+{
+    return reduce_fp32_sse<REDUCE_L2>(src_shape, dst_shape, src, axes, num_axes, dst);
+}
+
+ppl::common::RetCode reduce_sum_square_fp32_sse(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst)
+{
+    return reduce_fp32_sse<REDUCE_SUM_SQUARE>(src_shape, dst_shape, src, axes, num_axes, dst);
+}
+
 }}}; // namespace ppl::kernel::x86
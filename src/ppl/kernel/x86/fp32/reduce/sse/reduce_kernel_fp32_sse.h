@@ -20,6 +20,7 @@
 
 #include <string.h>
 #include <float.h>
+#include <math.h>
 #include <nmmintrin.h>
 
 #include "ppl/kernel/x86/common/internal_include.h"
@@ -45,6 +46,12 @@ inline float reduce_init_val_fp32<REDUCE_MIN>(void)
     return FLT_MAX;
 }
 
+template <>
+inline float reduce_init_val_fp32<REDUCE_PROD>(void)
+{
+    return 1.0f;
+}
+
 template <reduce_op_type_t _op>
 static void reduce_preprocess_fp32_sse(
     float *dst,
@@ -96,6 +103,56 @@ inline float reduce_scalar_kernel_fp32<REDUCE_SUM>(float a, float r)
     return a + r;
 }
 
+template <>
+inline float reduce_scalar_kernel_fp32<REDUCE_PROD>(float a, float r)
+{
+    return a * r;
+}
+
+template <>
+inline float reduce_scalar_kernel_fp32<REDUCE_L1>(float a, float r)
+{
+    return a + r;
+}
+
+template <>
+inline float reduce_scalar_kernel_fp32<REDUCE_L2>(float a, float r)
+{
+    return a + r;
+}
+
+template <>
+inline float reduce_scalar_kernel_fp32<REDUCE_SUM_SQUARE>(float a, float r)
+{
+    return a + r;
+}
+
+// element-wise transform applied to source values before accumulating,
+// must keep reduce_init_val_fp32 neutral because padded lanes are filled with it
+template <reduce_op_type_t _op>
+inline float reduce_scalar_map_fp32(float a)
+{
+    return a;
+}
+
+template <>
+inline float reduce_scalar_map_fp32<REDUCE_L1>(float a)
+{
+    return fabsf(a);
+}
+
+template <>
+inline float reduce_scalar_map_fp32<REDUCE_L2>(float a)
+{
+    return a * a;
+}
+
+template <>
+inline float reduce_scalar_map_fp32<REDUCE_SUM_SQUARE>(float a)
+{
+    return a * a;
+}
+
 template <reduce_op_type_t _op>
 inline __m128 reduce_vector_kernel_fp32_sse(__m128 a, __m128 r);
 
@@ -123,6 +180,54 @@ inline __m128 reduce_vector_kernel_fp32_sse<REDUCE_SUM>(__m128 a, __m128 r)
     return _mm_add_ps(a, r);
 }
 
+template <>
+inline __m128 reduce_vector_kernel_fp32_sse<REDUCE_PROD>(__m128 a, __m128 r)
+{
+    return _mm_mul_ps(a, r);
+}
+
+template <>
+inline __m128 reduce_vector_kernel_fp32_sse<REDUCE_L1>(__m128 a, __m128 r)
+{
+    return _mm_add_ps(a, r);
+}
+
+template <>
+inline __m128 reduce_vector_kernel_fp32_sse<REDUCE_L2>(__m128 a, __m128 r)
+{
+    return _mm_add_ps(a, r);
+}
+
+template <>
+inline __m128 reduce_vector_kernel_fp32_sse<REDUCE_SUM_SQUARE>(__m128 a, __m128 r)
+{
+    return _mm_add_ps(a, r);
+}
+
+template <reduce_op_type_t _op>
+inline __m128 reduce_vector_map_fp32_sse(__m128 a)
+{
+    return a;
+}
+
+template <>
+inline __m128 reduce_vector_map_fp32_sse<REDUCE_L1>(__m128 a)
+{
+    return _mm_andnot_ps(_mm_set1_ps(-0.0f), a);
+}
+
+template <>
+inline __m128 reduce_vector_map_fp32_sse<REDUCE_L2>(__m128 a)
+{
+    return _mm_mul_ps(a, a);
+}
+
+template <>
+inline __m128 reduce_vector_map_fp32_sse<REDUCE_SUM_SQUARE>(__m128 a)
+{
+    return _mm_mul_ps(a, a);
+}
+
 template <reduce_op_type_t _op>
 inline float reduce_vector_all_lanes_kernel_fp32_sse(__m128 v)
 {
@@ -169,6 +274,23 @@ static void reduce_postprocess_fp32_sse(
             dst[i] *= rdiv;
         }
     }
+
+    if (_op == REDUCE_L2) {
+        const int64_t simd_w      = 4;
+        const int64_t unroll_len  = simd_w * 4;
+        const int64_t unroll_body = round(len, unroll_len);
+
+        PRAGMA_OMP_PARALLEL_FOR()
+        for (int64_t i = 0; i < unroll_body; i += unroll_len) {
+            _mm_storeu_ps(dst + i + simd_w * 0, _mm_sqrt_ps(_mm_loadu_ps(dst + i + simd_w * 0)));
+            _mm_storeu_ps(dst + i + simd_w * 1, _mm_sqrt_ps(_mm_loadu_ps(dst + i + simd_w * 1)));
+            _mm_storeu_ps(dst + i + simd_w * 2, _mm_sqrt_ps(_mm_loadu_ps(dst + i + simd_w * 2)));
+            _mm_storeu_ps(dst + i + simd_w * 3, _mm_sqrt_ps(_mm_loadu_ps(dst + i + simd_w * 3)));
+        }
+        for (int64_t i = unroll_body; i < len; i++) {
+            dst[i] = sqrtf(dst[i]);
+        }
+    }
 }
 
 }}}; // namespace ppl::kernel::x86
@@ -0,0 +1,126 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <nmmintrin.h>
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/common/math_sse.h"
+#include "ppl/kernel/x86/fp32/reduce/reduce_log_sum_exp_fp32_common.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+static inline void reduce_log_sum_exp_vector_update_fp32_sse(const __m128 x, __m128 *vm, __m128 *vs)
+{
+    const __m128 e  = _sse_exp_ps(_mm_or_ps(_mm_sub_ps(x, vm[0]), _mm_set1_ps(-0.0f)));
+    const __m128 gt = _mm_cmpgt_ps(x, vm[0]);
+    vs[0] = _mm_blendv_ps(_mm_add_ps(vs[0], e), _mm_add_ps(_mm_mul_ps(vs[0], e), _mm_set1_ps(1.0f)), gt);
+    vm[0] = _mm_max_ps(vm[0], x);
+}
+
+struct reduce_log_sum_exp_kernel_fp32_sse {
+    struct state_t {
+        __m128 vm[2];
+        __m128 vs[2];
+        float m;
+        float s;
+    };
+
+    static void update_row(const float *src, const int64_t n, float *m, float *s)
+    {
+        const int64_t simd_w = 4;
+        int64_t i            = 0;
+        for (; i + simd_w * 2 <= n; i += simd_w * 2) {
+            __m128 vm_0 = _mm_loadu_ps(m + i + simd_w * 0);
+            __m128 vm_1 = _mm_loadu_ps(m + i + simd_w * 1);
+            __m128 vs_0 = _mm_loadu_ps(s + i + simd_w * 0);
+            __m128 vs_1 = _mm_loadu_ps(s + i + simd_w * 1);
+            reduce_log_sum_exp_vector_update_fp32_sse(_mm_loadu_ps(src + i + simd_w * 0), &vm_0, &vs_0);
+            reduce_log_sum_exp_vector_update_fp32_sse(_mm_loadu_ps(src + i + simd_w * 1), &vm_1, &vs_1);
+            _mm_storeu_ps(m + i + simd_w * 0, vm_0);
+            _mm_storeu_ps(m + i + simd_w * 1, vm_1);
+            _mm_storeu_ps(s + i + simd_w * 0, vs_0);
+            _mm_storeu_ps(s + i + simd_w * 1, vs_1);
+        }
+        if (i + simd_w <= n) {
+            __m128 vm_0 = _mm_loadu_ps(m + i);
+            __m128 vs_0 = _mm_loadu_ps(s + i);
+            reduce_log_sum_exp_vector_update_fp32_sse(_mm_loadu_ps(src + i), &vm_0, &vs_0);
+            _mm_storeu_ps(m + i, vm_0);
+            _mm_storeu_ps(s + i, vs_0);
+            i += simd_w;
+        }
+        for (; i < n; ++i) {
+            reduce_log_sum_exp_update_fp32(src[i], m + i, s + i);
+        }
+    }
+
+    static void reduce_init(state_t *st)
+    {
+        st->vm[0] = _mm_set1_ps(-FLT_MAX);
+        st->vm[1] = _mm_set1_ps(-FLT_MAX);
+        st->vs[0] = _mm_setzero_ps();
+        st->vs[1] = _mm_setzero_ps();
+        st->m     = -FLT_MAX;
+        st->s     = 0.0f;
+    }
+
+    static void reduce_row(const float *src, const int64_t n, state_t *st)
+    {
+        const int64_t simd_w = 4;
+        int64_t i            = 0;
+        for (; i + simd_w * 2 <= n; i += simd_w * 2) {
+            reduce_log_sum_exp_vector_update_fp32_sse(_mm_loadu_ps(src + i + simd_w * 0), &st->vm[0], &st->vs[0]);
+            reduce_log_sum_exp_vector_update_fp32_sse(_mm_loadu_ps(src + i + simd_w * 1), &st->vm[1], &st->vs[1]);
+        }
+        if (i + simd_w <= n) {
+            reduce_log_sum_exp_vector_update_fp32_sse(_mm_loadu_ps(src + i), &st->vm[0], &st->vs[0]);
+            i += simd_w;
+        }
+        for (; i < n; ++i) {
+            reduce_log_sum_exp_update_fp32(src[i], &st->m, &st->s);
+        }
+    }
+
+    static void reduce_finish(const state_t *st, float *m, float *s)
+    {
+        const int64_t simd_w = 4;
+        float lane_m[simd_w * 2];
+        float lane_s[simd_w * 2];
+        _mm_storeu_ps(lane_m + 0 * simd_w, st->vm[0]);
+        _mm_storeu_ps(lane_m + 1 * simd_w, st->vm[1]);
+        _mm_storeu_ps(lane_s + 0 * simd_w, st->vs[0]);
+        _mm_storeu_ps(lane_s + 1 * simd_w, st->vs[1]);
+        m[0] = st->m;
+        s[0] = st->s;
+        for (int64_t i = 0; i < simd_w * 2; ++i) {
+            reduce_log_sum_exp_merge_fp32(lane_m[i], lane_s[i], m, s);
+        }
+    }
+};
+
+ppl::common::RetCode reduce_log_sum_exp_fp32_sse(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *axes,
+    const int32_t num_axes,
+    float *dst)
+{
+    return reduce_log_sum_exp_fp32_common<reduce_log_sum_exp_kernel_fp32_sse>(src_shape, src, axes, num_axes, dst);
+}
+
+}}}; // namespace ppl::kernel::x86
@@ -36,10 +36,10 @@ void reduce_n16cx_lastdim_no_reduce_fp32_sse(
 
     int64_t i = 0;
     for (; i < width; i++) {
-        __m128 v_src_0 = _mm_loadu_ps(src + i * C_BLK() + simd_w * 0);
-        __m128 v_src_1 = _mm_loadu_ps(src + i * C_BLK() + simd_w * 1);
-        __m128 v_src_2 = _mm_loadu_ps(src + i * C_BLK() + simd_w * 2);
-        __m128 v_src_3 = _mm_loadu_ps(src + i * C_BLK() + simd_w * 3);
+        __m128 v_src_0 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i * C_BLK() + simd_w * 0));
+        __m128 v_src_1 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i * C_BLK() + simd_w * 1));
+        __m128 v_src_2 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i * C_BLK() + simd_w * 2));
+        __m128 v_src_3 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i * C_BLK() + simd_w * 3));
 
         __m128 v_dst_0 = _mm_loadu_ps(dst + i * C_BLK() + simd_w * 0);
         __m128 v_dst_1 = _mm_loadu_ps(dst + i * C_BLK() + simd_w * 1);
@@ -73,10 +73,10 @@ void reduce_n16cx_lastdim_reduce_w_fp32_sse(
 
     int64_t i = 0;
     for (; i < width; i++) {
-        __m128 v_src_0 = _mm_loadu_ps(src + i * C_BLK() + simd_w * 0);
-        __m128 v_src_1 = _mm_loadu_ps(src + i * C_BLK() + simd_w * 1);
-        __m128 v_src_2 = _mm_loadu_ps(src + i * C_BLK() + simd_w * 2);
-        __m128 v_src_3 = _mm_loadu_ps(src + i * C_BLK() + simd_w * 3);
+        __m128 v_src_0 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i * C_BLK() + simd_w * 0));
+        __m128 v_src_1 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i * C_BLK() + simd_w * 1));
+        __m128 v_src_2 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i * C_BLK() + simd_w * 2));
+        __m128 v_src_3 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i * C_BLK() + simd_w * 3));
 
         v_reduce_val_0 = reduce_vector_kernel_fp32_sse<_op>(v_src_0, v_reduce_val_0);
         v_reduce_val_1 = reduce_vector_kernel_fp32_sse<_op>(v_src_1, v_reduce_val_1);
@@ -113,10 +113,10 @@ void reduce_n16cx_lastdim_reduce_c_fp32_sse(
     if (remain_c >= C_BLK()) {
         int64_t i = 0;
         for (; i < width; i++) {
-            __m128 v_src_0 = _mm_loadu_ps(src + i * C_BLK() + simd_w * 0);
-            __m128 v_src_1 = _mm_loadu_ps(src + i * C_BLK() + simd_w * 1);
-            __m128 v_src_2 = _mm_loadu_ps(src + i * C_BLK() + simd_w * 2);
-            __m128 v_src_3 = _mm_loadu_ps(src + i * C_BLK() + simd_w * 3);
+            __m128 v_src_0 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i * C_BLK() + simd_w * 0));
+            __m128 v_src_1 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i * C_BLK() + simd_w * 1));
+            __m128 v_src_2 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i * C_BLK() + simd_w * 2));
+            __m128 v_src_3 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i * C_BLK() + simd_w * 3));
 
             v_src_0          = reduce_vector_kernel_fp32_sse<_op>(v_src_0, v_src_1);
             v_src_2          = reduce_vector_kernel_fp32_sse<_op>(v_src_2, v_src_3);
@@ -143,10 +143,10 @@ void reduce_n16cx_lastdim_reduce_c_fp32_sse(
 
         int64_t i = 0;
         for (; i < width; i++) {
-            __m128 v_src_0 = _mm_loadu_ps(src + i * C_BLK() + simd_w * 0);
-            __m128 v_src_1 = _mm_loadu_ps(src + i * C_BLK() + simd_w * 1);
-            __m128 v_src_2 = _mm_loadu_ps(src + i * C_BLK() + simd_w * 2);
-            __m128 v_src_3 = _mm_loadu_ps(src + i * C_BLK() + simd_w * 3);
+            __m128 v_src_0 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i * C_BLK() + simd_w * 0));
+            __m128 v_src_1 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i * C_BLK() + simd_w * 1));
+            __m128 v_src_2 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i * C_BLK() + simd_w * 2));
+            __m128 v_src_3 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i * C_BLK() + simd_w * 3));
 
             v_src_0 = _mm_or_ps(_mm_and_ps(v_src_0, v_mask_0), v_fill_0);
             v_src_1 = _mm_or_ps(_mm_and_ps(v_src_1, v_mask_1), v_fill_1);
@@ -176,10 +176,10 @@ void reduce_n16cx_lastdim_reduce_cw_fp32_sse(
 
         int64_t i = 0;
         for (; i < width; i++) {
-            __m128 v_src_0 = _mm_loadu_ps(src + i * C_BLK() + simd_w * 0);
-            __m128 v_src_1 = _mm_loadu_ps(src + i * C_BLK() + simd_w * 1);
-            __m128 v_src_2 = _mm_loadu_ps(src + i * C_BLK() + simd_w * 2);
-            __m128 v_src_3 = _mm_loadu_ps(src + i * C_BLK() + simd_w * 3);
+            __m128 v_src_0 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i * C_BLK() + simd_w * 0));
+            __m128 v_src_1 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i * C_BLK() + simd_w * 1));
+            __m128 v_src_2 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i * C_BLK() + simd_w * 2));
+            __m128 v_src_3 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i * C_BLK() + simd_w * 3));
 
             v_src_0 = reduce_vector_kernel_fp32_sse<_op>(v_src_0, v_src_1);
             v_src_2 = reduce_vector_kernel_fp32_sse<_op>(v_src_2, v_src_3);
@@ -209,10 +209,10 @@ void reduce_n16cx_lastdim_reduce_cw_fp32_sse(
 
         int64_t i = 0;
         for (; i < width; i++) {
-            __m128 v_src_0 = _mm_loadu_ps(src + i * C_BLK() + simd_w * 0);
-            __m128 v_src_1 = _mm_loadu_ps(src + i * C_BLK() + simd_w * 1);
-            __m128 v_src_2 = _mm_loadu_ps(src + i * C_BLK() + simd_w * 2);
-            __m128 v_src_3 = _mm_loadu_ps(src + i * C_BLK() + simd_w * 3);
+            __m128 v_src_0 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i * C_BLK() + simd_w * 0));
+            __m128 v_src_1 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i * C_BLK() + simd_w * 1));
+            __m128 v_src_2 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i * C_BLK() + simd_w * 2));
+            __m128 v_src_3 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i * C_BLK() + simd_w * 3));
 
             v_src_0 = _mm_or_ps(_mm_and_ps(v_src_0, v_mask_0), v_fill_0);
             v_src_1 = _mm_or_ps(_mm_and_ps(v_src_1, v_mask_1), v_fill_1);
@@ -36,10 +36,10 @@ static void reduce_ndarray_lastdim_no_reduce_fp32_sse(
 
     int64_t i = 0;
     for (; i + unroll_len <= width; i += unroll_len) {
-        __m128 v_src_0 = _mm_loadu_ps(src + i + simd_w * 0);
-        __m128 v_src_1 = _mm_loadu_ps(src + i + simd_w * 1);
-        __m128 v_src_2 = _mm_loadu_ps(src + i + simd_w * 2);
-        __m128 v_src_3 = _mm_loadu_ps(src + i + simd_w * 3);
+        __m128 v_src_0 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i + simd_w * 0));
+        __m128 v_src_1 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i + simd_w * 1));
+        __m128 v_src_2 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i + simd_w * 2));
+        __m128 v_src_3 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i + simd_w * 3));
 
         __m128 v_dst_0 = _mm_loadu_ps(dst + i + simd_w * 0);
         __m128 v_dst_1 = _mm_loadu_ps(dst + i + simd_w * 1);
@@ -57,7 +57,7 @@ static void reduce_ndarray_lastdim_no_reduce_fp32_sse(
         _mm_storeu_ps(dst + i + simd_w * 3, v_dst_3);
     }
     for (; i < width; i++) {
-        dst[i] = reduce_scalar_kernel_fp32<_op>(src[i], dst[i]);
+        dst[i] = reduce_scalar_kernel_fp32<_op>(reduce_scalar_map_fp32<_op>(src[i]), dst[i]);
     }
 }
 
@@ -80,10 +80,10 @@ static void reduce_ndarray_lastdim_reduce_fp32_sse(
 
     int64_t i = 0;
     for (; i + unroll_len <= width; i += unroll_len) {
-        __m128 v_src_0 = _mm_loadu_ps(src + i + simd_w * 0);
-        __m128 v_src_1 = _mm_loadu_ps(src + i + simd_w * 1);
-        __m128 v_src_2 = _mm_loadu_ps(src + i + simd_w * 2);
-        __m128 v_src_3 = _mm_loadu_ps(src + i + simd_w * 3);
+        __m128 v_src_0 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i + simd_w * 0));
+        __m128 v_src_1 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i + simd_w * 1));
+        __m128 v_src_2 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i + simd_w * 2));
+        __m128 v_src_3 = reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(src + i + simd_w * 3));
 
         v_reduce_val_0 = reduce_vector_kernel_fp32_sse<_op>(v_src_0, v_reduce_val_0);
         v_reduce_val_1 = reduce_vector_kernel_fp32_sse<_op>(v_src_1, v_reduce_val_1);
@@ -91,7 +91,7 @@ static void reduce_ndarray_lastdim_reduce_fp32_sse(
         v_reduce_val_3 = reduce_vector_kernel_fp32_sse<_op>(v_src_3, v_reduce_val_3);
     }
     for (; i < width; i++) {
-        reduce_val = reduce_scalar_kernel_fp32<_op>(src[i], reduce_val);
+        reduce_val = reduce_scalar_kernel_fp32<_op>(reduce_scalar_map_fp32<_op>(src[i]), reduce_val);
     }
 
     if (width >= unroll_len) {
@@ -216,6 +216,140 @@ ppl::common::RetCode reduce_ndarray_fp32_sse(
     return ppl::common::RC_SUCCESS;
 }
 
+template <reduce_op_type_t _op>
+ppl::common::RetCode reduce_ndarray_split_fp32_sse(
+    const ppl::common::TensorShape *src_shape,
+    const float *src,
+    const reduce_split_plan_t *plan,
+    float *dst)
+{
+    // work on the collapsed shape, padding 1 to dst shape to keepdims
+    ppl::common::TensorShape split_shape = *src_shape;
+    split_shape.Reshape(plan->dims, plan->dim_count);
+    ppl::common::TensorShape padded_dst_shape = split_shape;
+    for (int64_t i = 0; i < plan->num_axes; i++) {
+        padded_dst_shape.SetDim(plan->axes[i], 1);
+    }
+    const int64_t dst_len = padded_dst_shape.CalcElementsIncludingPadding();
+
+    float *partials = (float *)ppl::common::AlignedAlloc(plan->num_chunks * dst_len * sizeof(float), PPL_X86_CACHELINE_BYTES());
+    if (partials == nullptr) {
+        return ppl::common::RC_OUT_OF_MEMORY;
+    }
+
+    // pre process
+    reduce_preprocess_fp32_sse<_op>(partials, plan->num_chunks * dst_len);
+
+    // prepare incs
+    const int64_t dim_count = plan->dim_count;
+    int64_t inc_src[PPL_X86_TENSOR_MAX_DIMS()] = {0};
+    int64_t inc_dst[PPL_X86_TENSOR_MAX_DIMS()] = {0};
+    int64_t stride_src = 1;
+    int64_t stride_dst = 1;
+
+    for (int64_t i = dim_count - 1; i >= 0; i--) {
+        inc_src[i] = split_shape.GetDim(i) == 1 ? 0 : stride_src;
+        inc_dst[i] = padded_dst_shape.GetDim(i) == 1 ? 0 : stride_dst;
+
+        stride_src *= split_shape.GetDim(i);
+        stride_dst *= padded_dst_shape.GetDim(i);
+    }
+
+    // rows shorter than one unrolled step are folded: unroll_rows rows are
+    // reduced as one flat strip, then the strip is folded back to inner_len
+    const int64_t simd_w      = 4;
+    const int64_t unroll_rows = 4 * simd_w;
+    const int64_t split_axis  = plan->split_axis;
+    const int64_t split_len   = split_shape.GetDim(split_axis);
+    const int64_t inner_len   = split_shape.GetDim(dim_count - 1);
+    const bool fold_rows      = split_axis == dim_count - 2 && inner_len < unroll_rows;
+
+    // reduce every (outer, chunk) into its own partial, nothing is shared between tasks
+    const single_parallel_loop_config_t serial_pc = {-1, 1};
+    const int64_t num_tasks = plan->outer_len * plan->num_chunks;
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t t = 0; t < num_tasks; ++t) {
+        const int64_t o = t / plan->num_chunks;
+        const int64_t c = t % plan->num_chunks;
+
+        int64_t src_offset = 0;
+        int64_t dst_offset = 0;
+        int64_t outer_idx  = o;
+        for (int64_t i = split_axis - 1; i >= 0; --i) {
+            const int64_t idx = outer_idx % split_shape.GetDim(i);
+            outer_idx /= split_shape.GetDim(i);
+            src_offset += idx * inc_src[i];
+            dst_offset += idx * inc_dst[i];
+        }
+
+        const int64_t r_start = c * plan->chunk_len;
+        const int64_t r_end   = min(r_start + plan->chunk_len, split_len);
+        float *p_dst          = partials + c * dst_len + dst_offset;
+        if (split_axis == dim_count - 1) {
+            reduce_ndarray_lastdim_reduce_fp32_sse<_op>(src + src_offset + r_start, r_end - r_start, p_dst);
+        } else if (fold_rows) {
+            const int64_t fold_len = unroll_rows * inner_len;
+            float fold_buf[unroll_rows * unroll_rows];
+            for (int64_t i = 0; i < fold_len; ++i) {
+                fold_buf[i] = reduce_init_val_fp32<_op>();
+            }
+            const float *p_src = src + src_offset + r_start * inner_len;
+            int64_t r          = r_start;
+            for (; r + unroll_rows <= r_end; r += unroll_rows) {
+                reduce_ndarray_lastdim_no_reduce_fp32_sse<_op>(p_src, fold_len, fold_buf);
+                p_src += fold_len;
+            }
+            for (; r < r_end; ++r) {
+                reduce_ndarray_lastdim_no_reduce_fp32_sse<_op>(p_src, inner_len, p_dst);
+                p_src += inner_len;
+            }
+            for (int64_t g = 0; g < unroll_rows; ++g) {
+                for (int64_t i = 0; i < inner_len; ++i) {
+                    p_dst[i] = reduce_scalar_kernel_fp32<_op>(fold_buf[g * inner_len + i], p_dst[i]);
+                }
+            }
+        } else {
+            for (int64_t r = r_start; r < r_end; ++r) {
+                const float *p_src = src + src_offset + r * inc_src[split_axis];
+                reduce_ndarray_recursive_fp32_sse<_op>(&split_shape, &padded_dst_shape, p_src, split_axis + 1, inc_src, inc_dst, &serial_pc, p_dst);
+            }
+        }
+    }
+
+    // combine partials pairwise in place, the tree only depends on num_chunks
+    const int64_t dst_body = round(dst_len, simd_w);
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t i = 0; i < dst_body; i += simd_w) {
+        for (int64_t stride = 1; stride < plan->num_chunks; stride *= 2) {
+            for (int64_t c = 0; c + stride < plan->num_chunks; c += 2 * stride) {
+                float *p_l = partials + c * dst_len + i;
+                float *p_r = partials + (c + stride) * dst_len + i;
+                _mm_storeu_ps(p_l, reduce_vector_kernel_fp32_sse<_op>(_mm_loadu_ps(p_r), _mm_loadu_ps(p_l)));
+            }
+        }
+        _mm_storeu_ps(dst + i, _mm_loadu_ps(partials + i));
+    }
+    for (int64_t i = dst_body; i < dst_len; ++i) {
+        for (int64_t stride = 1; stride < plan->num_chunks; stride *= 2) {
+            for (int64_t c = 0; c + stride < plan->num_chunks; c += 2 * stride) {
+                float *p_l = partials + c * dst_len + i;
+                p_l[0]     = reduce_scalar_kernel_fp32<_op>(p_l[stride * dst_len], p_l[0]);
+            }
+        }
+        dst[i] = partials[i];
+    }
+    ppl::common::AlignedFree(partials);
+
+    // post process
+    int64_t reduce_factor = 1;
+    for (int64_t i = 0; i < plan->num_axes; i++) {
+        reduce_factor *= split_shape.GetDim(plan->axes[i]);
+    }
+    reduce_postprocess_fp32_sse<_op>(dst, dst_len, reduce_factor);
+
+    return ppl::common::RC_SUCCESS;
+}
+
 }}}; // namespace ppl::kernel::x86
 
 #endif // !__ST_PPL_KERNEL_X86_FP32_REDUCE_SSE_REDUCE_NDARRAY_FP32_SSE_H_
@@ -21,43 +21,24 @@
 #include <nmmintrin.h>
 #include <float.h>
 
-#include "ppl/kernel/x86/common/internal_include.h"
-#include "ppl/kernel/x86/common/reduce/reduce_common.h"
+#include "ppl/kernel/x86/fp32/reduce/sse/reduce_kernel_fp32_sse.h"
 
-#define _MM_ROP_PS(DST, A, B)                          \
-    do {                                               \
-        if (_op == REDUCE_MAX) {                       \
-            DST = _mm_max_ps(A, B);                    \
-        }                                              \
-        if (_op == REDUCE_MIN) {                       \
-            DST = _mm_min_ps(A, B);                    \
-        }                                              \
-        if (_op == REDUCE_SUM || _op == REDUCE_MEAN) { \
-            DST = _mm_add_ps(A, B);                    \
-        }                                              \
+#define _MM_ROP_PS(DST, A, B)                           \
+    do {                                                \
+        DST = reduce_vector_kernel_fp32_sse<_op>(A, B); \
     } while (0)
 
-#define ROP_ADD(A, B) (A) + (B)
-
-#define ROP(DST, A, B)                                 \
-    do {                                               \
-        if (_op == REDUCE_MAX) {                       \
-            DST = max(A, B);                           \
-        }                                              \
-        if (_op == REDUCE_MIN) {                       \
-            DST = min(A, B);                           \
-        }                                              \
-        if (_op == REDUCE_SUM || _op == REDUCE_MEAN) { \
-            DST = ROP_ADD(A, B);                       \
-        }                                              \
+#define ROP(DST, A, B)                              \
+    do {                                            \
+        DST = reduce_scalar_kernel_fp32<_op>(A, B); \
     } while (0)
 
-#define REDUCE_LOOP(R)                                                                     \
-    do {                                                                                   \
-        _MM_ROP_PS(mm_res0, _mm_loadu_ps(base_src + (R)*inner_dim + 0 * simd_w), mm_res0); \
-        _MM_ROP_PS(mm_res1, _mm_loadu_ps(base_src + (R)*inner_dim + 1 * simd_w), mm_res1); \
-        _MM_ROP_PS(mm_res2, _mm_loadu_ps(base_src + (R)*inner_dim + 2 * simd_w), mm_res2); \
-        _MM_ROP_PS(mm_res3, _mm_loadu_ps(base_src + (R)*inner_dim + 3 * simd_w), mm_res3); \
+#define REDUCE_LOOP(R)                                                                                                      \
+    do {                                                                                                                    \
+        _MM_ROP_PS(mm_res0, reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(base_src + (R)*inner_dim + 0 * simd_w)), mm_res0); \
+        _MM_ROP_PS(mm_res1, reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(base_src + (R)*inner_dim + 1 * simd_w)), mm_res1); \
+        _MM_ROP_PS(mm_res2, reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(base_src + (R)*inner_dim + 2 * simd_w)), mm_res2); \
+        _MM_ROP_PS(mm_res3, reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(base_src + (R)*inner_dim + 3 * simd_w)), mm_res3); \
     } while (0)
 
 namespace ppl { namespace kernel { namespace x86 {
@@ -90,13 +71,7 @@ ppl::common::RetCode reduce_single_axis_ndarray_fp32_sse(
     const int64_t unroll_inner  = 4 * simd_w;
     const int64_t reduce_body   = round(reduce_dim, unroll_reduce);
     const int64_t reduce_tail   = reduce_dim - reduce_body;
-    float init_val              = 0.0f;
-    if (_op == REDUCE_MAX) {
-        init_val = -FLT_MAX;
-    }
-    if (_op == REDUCE_MIN) {
-        init_val = FLT_MAX;
-    }
+    const float init_val        = reduce_init_val_fp32<_op>();
 
 #ifdef PPL_USE_X86_OMP_COLLAPSE
     PRAGMA_OMP_PARALLEL_FOR_COLLAPSE(2)
@@ -132,6 +107,12 @@ ppl::common::RetCode reduce_single_axis_ndarray_fp32_sse(
                     mm_res2      = _mm_mul_ps(mm_res2, mm_rr);
                     mm_res3      = _mm_mul_ps(mm_res3, mm_rr);
                 }
+                if (_op == REDUCE_L2) {
+                    mm_res0 = _mm_sqrt_ps(mm_res0);
+                    mm_res1 = _mm_sqrt_ps(mm_res1);
+                    mm_res2 = _mm_sqrt_ps(mm_res2);
+                    mm_res3 = _mm_sqrt_ps(mm_res3);
+                }
                 _mm_storeu_ps(base_dst + 0 * simd_w, mm_res0);
                 _mm_storeu_ps(base_dst + 1 * simd_w, mm_res1);
                 _mm_storeu_ps(base_dst + 2 * simd_w, mm_res2);
@@ -143,7 +124,7 @@ ppl::common::RetCode reduce_single_axis_ndarray_fp32_sse(
                     float res[simd_w];
                     mm_res0 = _mm_set1_ps(init_val);
                     for (int64_t r = 0; r < reduce_body; r += unroll_reduce) {
-                        _MM_ROP_PS(mm_res0, _mm_loadu_ps(base_src + r), mm_res0);
+                        _MM_ROP_PS(mm_res0, reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(base_src + r)), mm_res0);
                     }
                     _mm_storeu_ps(res, mm_res0);
 
@@ -154,15 +135,18 @@ ppl::common::RetCode reduce_single_axis_ndarray_fp32_sse(
                 }
                 if (reduce_tail) {
                     for (int64_t r = reduce_body; r < reduce_dim; ++r) {
-                        ROP(res_val, res_val, base_src[r]);
+                        ROP(res_val, res_val, reduce_scalar_map_fp32<_op>(base_src[r]));
                     }
                 }
                 if (_op == REDUCE_MEAN) {
                     res_val /= reduce_dim;
                 }
+                if (_op == REDUCE_L2) {
+                    res_val = sqrtf(res_val);
+                }
                 base_dst[0] = res_val;
             } else {
-                const int64_t tail_offset = simd_w - (inner_eff % simd_w);
+                const int64_t tail_offset = (simd_w - inner_eff % simd_w) % simd_w;
                 if (inner_eff > 3 * simd_w) {
                     __m128 mm_res0, mm_res1, mm_res2, mm_res3;
                     mm_res0 = _mm_set1_ps(init_val);
@@ -170,12 +154,10 @@ ppl::common::RetCode reduce_single_axis_ndarray_fp32_sse(
                     mm_res2 = _mm_set1_ps(init_val);
                     mm_res3 = _mm_set1_ps(init_val);
                     for (int64_t r = 0; r < reduce_dim; ++r) {
-                        if (_op == REDUCE_MAX) {
-                            _MM_ROP_PS(mm_res0, _mm_loadu_ps(base_src + 0 * inner_dim + 0 * simd_w), mm_res0);
-                            _MM_ROP_PS(mm_res1, _mm_loadu_ps(base_src + 0 * inner_dim + 1 * simd_w), mm_res1);
-                            _MM_ROP_PS(mm_res2, _mm_loadu_ps(base_src + 0 * inner_dim + 2 * simd_w), mm_res2);
-                            _MM_ROP_PS(mm_res3, _mm_loadu_ps(base_src + 0 * inner_dim + 3 * simd_w - tail_offset), mm_res3);
-                        }
+                        _MM_ROP_PS(mm_res0, reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(base_src + 0 * inner_dim + 0 * simd_w)), mm_res0);
+                        _MM_ROP_PS(mm_res1, reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(base_src + 0 * inner_dim + 1 * simd_w)), mm_res1);
+                        _MM_ROP_PS(mm_res2, reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(base_src + 0 * inner_dim + 2 * simd_w)), mm_res2);
+                        _MM_ROP_PS(mm_res3, reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(base_src + 0 * inner_dim + 3 * simd_w - tail_offset)), mm_res3);
                         base_src += inner_dim;
                     }
                     if (_op == REDUCE_MEAN) {
@@ -185,6 +167,12 @@ ppl::common::RetCode reduce_single_axis_ndarray_fp32_sse(
                         mm_res2      = _mm_mul_ps(mm_res2, mm_rr);
                         mm_res3      = _mm_mul_ps(mm_res3, mm_rr);
                     }
+                    if (_op == REDUCE_L2) {
+                        mm_res0 = _mm_sqrt_ps(mm_res0);
+                        mm_res1 = _mm_sqrt_ps(mm_res1);
+                        mm_res2 = _mm_sqrt_ps(mm_res2);
+                        mm_res3 = _mm_sqrt_ps(mm_res3);
+                    }
                     _mm_storeu_ps(base_dst + 0 * simd_w, mm_res0);
                     _mm_storeu_ps(base_dst + 1 * simd_w, mm_res1);
                     _mm_storeu_ps(base_dst + 2 * simd_w, mm_res2);
@@ -195,9 +183,9 @@ ppl::common::RetCode reduce_single_axis_ndarray_fp32_sse(
                     mm_res1 = _mm_set1_ps(init_val);
                     mm_res2 = _mm_set1_ps(init_val);
                     for (int64_t r = 0; r < reduce_dim; ++r) {
-                        _MM_ROP_PS(mm_res0, _mm_loadu_ps(base_src + 0 * inner_dim + 0 * simd_w), mm_res0);
-                        _MM_ROP_PS(mm_res1, _mm_loadu_ps(base_src + 0 * inner_dim + 1 * simd_w), mm_res1);
-                        _MM_ROP_PS(mm_res2, _mm_loadu_ps(base_src + 0 * inner_dim + 2 * simd_w - tail_offset), mm_res2);
+                        _MM_ROP_PS(mm_res0, reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(base_src + 0 * inner_dim + 0 * simd_w)), mm_res0);
+                        _MM_ROP_PS(mm_res1, reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(base_src + 0 * inner_dim + 1 * simd_w)), mm_res1);
+                        _MM_ROP_PS(mm_res2, reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(base_src + 0 * inner_dim + 2 * simd_w - tail_offset)), mm_res2);
                         base_src += inner_dim;
                     }
                     if (_op == REDUCE_MEAN) {
@@ -206,6 +194,11 @@ ppl::common::RetCode reduce_single_axis_ndarray_fp32_sse(
                         mm_res1      = _mm_mul_ps(mm_res1, mm_rr);
                         mm_res2      = _mm_mul_ps(mm_res2, mm_rr);
                     }
+                    if (_op == REDUCE_L2) {
+                        mm_res0 = _mm_sqrt_ps(mm_res0);
+                        mm_res1 = _mm_sqrt_ps(mm_res1);
+                        mm_res2 = _mm_sqrt_ps(mm_res2);
+                    }
                     _mm_storeu_ps(base_dst + 0 * simd_w, mm_res0);
                     _mm_storeu_ps(base_dst + 1 * simd_w, mm_res1);
                     _mm_storeu_ps(base_dst + 2 * simd_w - tail_offset, mm_res2);
@@ -214,8 +207,8 @@ ppl::common::RetCode reduce_single_axis_ndarray_fp32_sse(
                     mm_res0 = _mm_set1_ps(init_val);
                     mm_res1 = _mm_set1_ps(init_val);
                     for (int64_t r = 0; r < reduce_dim; ++r) {
-                        _MM_ROP_PS(mm_res0, _mm_loadu_ps(base_src + 0 * inner_dim + 0 * simd_w), mm_res0);
-                        _MM_ROP_PS(mm_res1, _mm_loadu_ps(base_src + 0 * inner_dim + 1 * simd_w - tail_offset), mm_res1);
+                        _MM_ROP_PS(mm_res0, reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(base_src + 0 * inner_dim + 0 * simd_w)), mm_res0);
+                        _MM_ROP_PS(mm_res1, reduce_vector_map_fp32_sse<_op>(_mm_loadu_ps(base_src + 0 * inner_dim + 1 * simd_w - tail_offset)), mm_res1);
                         base_src += inner_dim;
                     }
                     if (_op == REDUCE_MEAN) {
@@ -223,13 +216,17 @@ ppl::common::RetCode reduce_single_axis_ndarray_fp32_sse(
                         mm_res0      = _mm_mul_ps(mm_res0, mm_rr);
                         mm_res1      = _mm_mul_ps(mm_res1, mm_rr);
                     }
+                    if (_op == REDUCE_L2) {
+                        mm_res0 = _mm_sqrt_ps(mm_res0);
+                        mm_res1 = _mm_sqrt_ps(mm_res1);
+                    }
                     _mm_storeu_ps(base_dst + 0 * simd_w, mm_res0);
                     _mm_storeu_ps(base_dst + 1 * simd_w - tail_offset, mm_res1);
                 } else {
                     float res[4] = {init_val, init_val, init_val, init_val};
                     for (int64_t r = 0; r < reduce_dim; ++r) {
                         for (int64_t i = 0; i < inner_eff; ++i) {
-                            ROP(res[i], base_src[i], res[i]);
+                            ROP(res[i], reduce_scalar_map_fp32<_op>(base_src[i]), res[i]);
                         }
                         base_src += inner_dim;
                     }
@@ -238,6 +235,11 @@ ppl::common::RetCode reduce_single_axis_ndarray_fp32_sse(
                             res[i] /= reduce_dim;
                         }
                     }
+                    if (_op == REDUCE_L2) {
+                        for (int64_t i = 0; i < inner_eff; ++i) {
+                            res[i] = sqrtf(res[i]);
+                        }
+                    }
                     for (int64_t i = 0; i < inner_eff; ++i) {
                         base_dst[i] = res[i];
                     }
@@ -0,0 +1,137 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/fp32/relation.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+ppl::common::RetCode greater_eltwise_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    uint8_t *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return greater_eltwise_fp32_avx512(dst_shape, src0, src1, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) {
+        return greater_eltwise_fp32_avx(dst_shape, src0, src1, dst);
+    }
+    return greater_eltwise_fp32_sse(dst_shape, src0, src1, dst);
+}
+
+ppl::common::RetCode greater_ndarray_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    uint8_t *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return greater_ndarray_fp32_avx512(src0_shape, src1_shape, dst_shape, src0, src1, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) {
+        return greater_ndarray_fp32_avx(src0_shape, src1_shape, dst_shape, src0, src1, dst);
+    }
+    return greater_ndarray_fp32_sse(src0_shape, src1_shape, dst_shape, src0, src1, dst);
+}
+
+ppl::common::RetCode equal_eltwise_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    uint8_t *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return equal_eltwise_fp32_avx512(dst_shape, src0, src1, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) {
+        return equal_eltwise_fp32_avx(dst_shape, src0, src1, dst);
+    }
+    return equal_eltwise_fp32_sse(dst_shape, src0, src1, dst);
+}
+
+ppl::common::RetCode equal_ndarray_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    uint8_t *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return equal_ndarray_fp32_avx512(src0_shape, src1_shape, dst_shape, src0, src1, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) {
+        return equal_ndarray_fp32_avx(src0_shape, src1_shape, dst_shape, src0, src1, dst);
+    }
+    return equal_ndarray_fp32_sse(src0_shape, src1_shape, dst_shape, src0, src1, dst);
+}
+
+ppl::common::RetCode less_eltwise_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    uint8_t *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return less_eltwise_fp32_avx512(dst_shape, src0, src1, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) {
+        return less_eltwise_fp32_avx(dst_shape, src0, src1, dst);
+    }
+    return less_eltwise_fp32_sse(dst_shape, src0, src1, dst);
+}
+
+ppl::common::RetCode less_ndarray_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    uint8_t *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return less_ndarray_fp32_avx512(src0_shape, src1_shape, dst_shape, src0, src1, dst);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) {
+        return less_ndarray_fp32_avx(src0_shape, src1_shape, dst_shape, src0, src1, dst);
+    }
+    return less_ndarray_fp32_sse(src0_shape, src1_shape, dst_shape, src0, src1, dst);
+}
+
+}}}; // namespace ppl::kernel::x86
@@ -60,35 +60,37 @@ ppl::common::RetCode reorder_goidhw_gIOBidhw16i16o_fp32(
     const int32_t ic_big_blk = channels_blk;
     const int32_t ic_big_cnt = div_up(padded_ic, channels_blk);
 
-    for (int64_t g = 0; g < group; ++g) {
-        for (int64_t ic_big = 0; ic_big < padded_ic; ic_big += ic_big_blk) {
-            for (int64_t ocb = 0; ocb < padded_oc; ocb += CH_DT_BLK()) {
-                const int64_t ic_big_eff = min<int64_t>(ic_per_gp - ic_big, ic_big_blk);
-                const int64_t ocb_eff    = min<int64_t>(oc_per_gp - ocb, CH_DT_BLK());
-                const float *base_src    = src + g * oc_per_gp * ic_per_gp * kernel_d * kernel_h * kernel_w + ocb * ic_per_gp * kernel_d * kernel_h * kernel_w + ic_big * kernel_d * kernel_h * kernel_w;
-                float *base_dst          = dst + g * ic_big_cnt * padded_oc * ic_big_blk * kernel_d * kernel_h * kernel_w + ic_big * padded_oc * kernel_d * kernel_h * kernel_w + ocb * ic_big_blk * kernel_d * kernel_h * kernel_w;
-                for (int64_t icb = 0; icb < ic_big_eff; icb += CH_DT_BLK()) {
-                    const int64_t icb_eff = min<int64_t>(ic_big_eff - icb, CH_DT_BLK());
-                    for (int64_t kd = 0; kd < kernel_d; ++kd) {
-                        for (int64_t kh = 0; kh < kernel_h; ++kh) {
-                            for (int64_t kw = 0; kw < kernel_w; ++kw) {
-                                const float *l_src = base_src + icb * kernel_d * kernel_h * kernel_w + kd * kernel_h * kernel_w + kh * kernel_w + kw;
-                                float *l_dst       = base_dst + icb * kernel_d * kernel_h * kernel_w * CH_DT_BLK() + kd * kernel_h * kernel_w * CH_DT_BLK() * CH_DT_BLK() + kh * kernel_w * CH_DT_BLK() * CH_DT_BLK() + kw * CH_DT_BLK() * CH_DT_BLK();
-                                int64_t ic         = 0;
-                                for (; ic < icb_eff; ++ic) {
-                                    int64_t oc = 0;
-                                    for (; oc < ocb_eff; ++oc) {
-                                        l_dst[ic * CH_DT_BLK() + oc] = l_src[(oc * ic_per_gp + ic) * kernel_d * kernel_h * kernel_w];
-                                    }
-                                    for (; oc < CH_DT_BLK(); ++oc) {
-                                        l_dst[ic * CH_DT_BLK() + oc] = 0;
-                                    }
-                                }
-                                for (; ic < CH_DT_BLK(); ++ic) {
-                                    memset(l_dst + ic * CH_DT_BLK(), 0, CH_DT_BLK() * sizeof(float));
-                                }
+    const int64_t ocb_cnt = padded_oc / CH_DT_BLK();
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t task = 0; task < group * ic_big_cnt * ocb_cnt; ++task) {
+        const int64_t g          = task / (ic_big_cnt * ocb_cnt);
+        const int64_t ic_big     = task / ocb_cnt % ic_big_cnt * ic_big_blk;
+        const int64_t ocb        = task % ocb_cnt * CH_DT_BLK();
+        const int64_t ic_big_eff = min<int64_t>(ic_per_gp - ic_big, ic_big_blk);
+        const int64_t ocb_eff    = min<int64_t>(oc_per_gp - ocb, CH_DT_BLK());
+        const float *base_src    = src + g * oc_per_gp * ic_per_gp * kernel_d * kernel_h * kernel_w + ocb * ic_per_gp * kernel_d * kernel_h * kernel_w + ic_big * kernel_d * kernel_h * kernel_w;
+        float *base_dst          = dst + g * ic_big_cnt * padded_oc * ic_big_blk * kernel_d * kernel_h * kernel_w + ic_big * padded_oc * kernel_d * kernel_h * kernel_w + ocb * ic_big_blk * kernel_d * kernel_h * kernel_w;
+        for (int64_t icb = 0; icb < ic_big_eff; icb += CH_DT_BLK()) {
+            const int64_t icb_eff = min<int64_t>(ic_big_eff - icb, CH_DT_BLK());
+            for (int64_t kd = 0; kd < kernel_d; ++kd) {
+                for (int64_t kh = 0; kh < kernel_h; ++kh) {
+                    for (int64_t kw = 0; kw < kernel_w; ++kw) {
+                        const float *l_src = base_src + icb * kernel_d * kernel_h * kernel_w + kd * kernel_h * kernel_w + kh * kernel_w + kw;
+                        float *l_dst       = base_dst + icb * kernel_d * kernel_h * kernel_w * CH_DT_BLK() + kd * kernel_h * kernel_w * CH_DT_BLK() * CH_DT_BLK() + kh * kernel_w * CH_DT_BLK() * CH_DT_BLK() + kw * CH_DT_BLK() * CH_DT_BLK();
+                        int64_t ic         = 0;
+                        for (; ic < icb_eff; ++ic) {
+                            int64_t oc = 0;
+                            for (; oc < ocb_eff; ++oc) {
+                                l_dst[ic * CH_DT_BLK() + oc] = l_src[(oc * ic_per_gp + ic) * kernel_d * kernel_h * kernel_w];
+                            }
+                            for (; oc < CH_DT_BLK(); ++oc) {
+                                l_dst[ic * CH_DT_BLK() + oc] = 0;
                             }
                         }
+                        for (; ic < CH_DT_BLK(); ++ic) {
+                            memset(l_dst + ic * CH_DT_BLK(), 0, CH_DT_BLK() * sizeof(float));
+                        }
                     }
                 }
             }
@@ -0,0 +1,92 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/kernel/x86/fp32/resize2d/resize2d_engine_fp32.h"
+#include "ppl/kernel/x86/fp32/resize2d.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+static void resize2d_ndarray_horizontal_fp32(
+    const float *src,
+    const resize2d_fp32_axis_table &tab_w,
+    float *dst)
+{
+    const int64_t dst_w = tab_w.len;
+    if (tab_w.taps == 1) {
+        for (int64_t ow = 0; ow < dst_w; ++ow) {
+            dst[ow] = src[tab_w.idx[ow]];
+        }
+        return;
+    }
+    for (int64_t ow = 0; ow < dst_w; ++ow) {
+        dst[ow] = src[tab_w.idx[ow]] * tab_w.wei[ow];
+    }
+    for (int64_t k = 1; k < tab_w.taps; ++k) {
+        const int32_t *idx = tab_w.idx + k * dst_w;
+        const float *wei   = tab_w.wei + k * dst_w;
+        for (int64_t ow = 0; ow < dst_w; ++ow) {
+            dst[ow] += src[idx[ow]] * wei[ow];
+        }
+    }
+}
+
+static void resize2d_vertical_fp32(
+    const float **row_list,
+    const float *wei_list,
+    const int64_t taps,
+    const int64_t length,
+    float *dst)
+{
+    for (int64_t i = 0; i < length; ++i) {
+        dst[i] = row_list[0][i] * wei_list[0];
+    }
+    for (int64_t k = 1; k < taps; ++k) {
+        const float *row = row_list[k];
+        const float wei  = wei_list[k];
+        for (int64_t i = 0; i < length; ++i) {
+            dst[i] += row[i] * wei;
+        }
+    }
+}
+
+uint64_t resize2d_ndarray_fp32_get_buffer_bytes(
+    const ppl::common::TensorShape *dst_shape,
+    const resize2d_param *param)
+{
+    return resize2d_fp32_engine_get_buffer_bytes(dst_shape, param, 1);
+}
+
+uint64_t resize2d_n16cx_fp32_get_buffer_bytes(
+    const ppl::common::TensorShape *dst_shape,
+    const resize2d_param *param)
+{
+    return resize2d_fp32_engine_get_buffer_bytes(dst_shape, param, 16);
+}
+
+ppl::common::RetCode resize2d_ndarray_fp32(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const resize2d_param *param,
+    void *temp_buffer,
+    float *dst)
+{
+    return resize2d_fp32_engine_execute<1, resize2d_ndarray_horizontal_fp32, resize2d_vertical_fp32>(
+        src_shape, dst_shape, src, param, temp_buffer, dst);
+}
+
+}}}; // namespace ppl::kernel::x86
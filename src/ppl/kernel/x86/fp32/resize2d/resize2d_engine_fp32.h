@@ -0,0 +1,291 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_FP32_RESIZE2D_RESIZE2D_ENGINE_FP32_H_
+#define __ST_PPL_KERNEL_X86_FP32_RESIZE2D_RESIZE2D_ENGINE_FP32_H_
+
+#include <math.h>
+#include <string.h>
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/common/resize2d_common.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+// Separable resize: every output pixel is sum(wei_h[kh] * wei_w[kw] * src[idx_h[kh]][idx_w[kw]]).
+// Rows are first resized horizontally into a per-thread row cache, then blended vertically.
+// Horizontally resized rows are reused by consecutive output rows when upsampling.
+
+struct resize2d_fp32_axis_table {
+    int64_t taps;
+    int64_t len;
+    int32_t *idx;     // [taps][len]
+    float *wei;       // [taps][len]
+    uint8_t *outside; // [len], extrapolate for TF_CROP_AND_RESIZE
+};
+
+inline int64_t resize2d_fp32_taps(const resize2d_interp_mode_t interp_mode)
+{
+    if (interp_mode == resize2d_interp_mode::CUBIC) return 4;
+    if (interp_mode == resize2d_interp_mode::LINEAR) return 2;
+    return 1;
+}
+
+inline uint64_t resize2d_fp32_axis_table_bytes(const int64_t taps, const int64_t len)
+{
+    return round_up(taps * len * (sizeof(int32_t) + sizeof(float)) + len * sizeof(uint8_t), PPL_X86_CACHELINE_BYTES());
+}
+
+inline void resize2d_fp32_bind_axis_table(
+    const int64_t taps,
+    const int64_t len,
+    void *buffer,
+    resize2d_fp32_axis_table *table)
+{
+    table->taps    = taps;
+    table->len     = len;
+    table->idx     = (int32_t*)buffer;
+    table->wei     = (float*)(table->idx + taps * len);
+    table->outside = (uint8_t*)(table->wei + taps * len);
+}
+
+inline float resize2d_fp32_origin_coord(
+    const resize2d_param *param,
+    const int64_t x,
+    const int64_t in_len,
+    const int64_t out_len,
+    const float scale,
+    const float roi_start,
+    const float roi_end)
+{
+    switch (param->coord_trans_mode) {
+        case resize2d_coord_trans_mode::PYTORCH_HALF_PIXEL:
+            return out_len > 1 ? (x + 0.5f) / scale - 0.5f : 0.0f;
+        case resize2d_coord_trans_mode::ALIGN_CORNERS:
+            return out_len > 1 ? x * float(in_len - 1) / float(out_len - 1) : 0.0f;
+        case resize2d_coord_trans_mode::ASYMMETRIC:
+            return x / scale;
+        case resize2d_coord_trans_mode::TF_HALF_PIXEL_FOR_NN:
+            return (x + 0.5f) / scale;
+        case resize2d_coord_trans_mode::TF_CROP_AND_RESIZE:
+            return out_len > 1
+                ? roi_start * (in_len - 1) + x * (roi_end - roi_start) * (in_len - 1) / float(out_len - 1)
+                : 0.5f * (roi_start + roi_end) * (in_len - 1);
+        default: // HALF_PIXEL
+            return (x + 0.5f) / scale - 0.5f;
+    }
+}
+
+inline int64_t resize2d_fp32_nearest_pixel(const resize2d_nearest_mode_t nearest_mode, const float x)
+{
+    switch (nearest_mode) {
+        case resize2d_nearest_mode::ROUND_PREFER_CEIL:
+            return (int64_t)::floorf(x + 0.5f);
+        case resize2d_nearest_mode::FLOOR:
+            return (int64_t)::floorf(x);
+        case resize2d_nearest_mode::CEIL:
+            return (int64_t)::ceilf(x);
+        default: // ROUND_PREFER_FLOOR
+            return (int64_t)::ceilf(x - 0.5f);
+    }
+}
+
+inline void resize2d_fp32_cubic_coeff(const float r, const float A, float *coeff)
+{
+    coeff[0] = ((A * (r + 1) - 5 * A) * (r + 1) + 8 * A) * (r + 1) - 4 * A;
+    coeff[1] = ((A + 2) * r - (A + 3)) * r * r + 1;
+    coeff[2] = ((A + 2) * (1 - r) - (A + 3)) * (1 - r) * (1 - r) + 1;
+    coeff[3] = 1.0f - coeff[0] - coeff[1] - coeff[2];
+}
+
+inline void resize2d_fp32_init_axis_table(
+    const resize2d_param *param,
+    const int64_t in_len,
+    const float scale,
+    const float roi_start,
+    const float roi_end,
+    resize2d_fp32_axis_table *table)
+{
+    const int64_t taps    = table->taps;
+    const int64_t out_len = table->len;
+    for (int64_t o = 0; o < out_len; ++o) {
+        const float x = resize2d_fp32_origin_coord(param, o, in_len, out_len, scale, roi_start, roi_end);
+        table->outside[o] = param->coord_trans_mode == resize2d_coord_trans_mode::TF_CROP_AND_RESIZE && (x < 0 || x > in_len - 1);
+        if (taps == 1) {
+            const int64_t i = resize2d_fp32_nearest_pixel(param->nearest_mode, x);
+            table->idx[o] = (int32_t)max<int64_t>(min<int64_t>(i, in_len - 1), 0);
+            table->wei[o] = 1.0f;
+        } else if (taps == 2) {
+            const float cx  = max(min(x, float(in_len - 1)), 0.0f);
+            const int64_t i = (int64_t)cx;
+            const float r   = cx - i;
+            table->idx[0 * out_len + o] = (int32_t)i;
+            table->idx[1 * out_len + o] = (int32_t)min<int64_t>(i + 1, in_len - 1);
+            table->wei[0 * out_len + o] = 1.0f - r;
+            table->wei[1 * out_len + o] = r;
+        } else {
+            const int64_t i = (int64_t)::floorf(x);
+            float coeff[4];
+            resize2d_fp32_cubic_coeff(x - i, param->cubic_coeff_a, coeff);
+            float wsum = 0.0f;
+            for (int64_t k = 0; k < 4; ++k) {
+                const int64_t ik = i - 1 + k;
+                if (param->exclude_outside && (ik < 0 || ik >= in_len)) {
+                    coeff[k] = 0.0f;
+                }
+                wsum += coeff[k];
+                table->idx[k * out_len + o] = (int32_t)max<int64_t>(min<int64_t>(ik, in_len - 1), 0);
+            }
+            for (int64_t k = 0; k < 4; ++k) {
+                table->wei[k * out_len + o] = param->exclude_outside && wsum != 0.0f ? coeff[k] / wsum : coeff[k];
+            }
+        }
+    }
+}
+
+inline uint64_t resize2d_fp32_engine_get_buffer_bytes(
+    const ppl::common::TensorShape *dst_shape,
+    const resize2d_param *param,
+    const int64_t c_blk)
+{
+    const int64_t taps  = resize2d_fp32_taps(param->interp_mode);
+    const int64_t dst_h = dst_shape->GetDim(2);
+    const int64_t dst_w = dst_shape->GetDim(3);
+    const uint64_t cache_len = round_up(taps * dst_w * c_blk * sizeof(float), PPL_X86_CACHELINE_BYTES());
+    return resize2d_fp32_axis_table_bytes(taps, dst_h)
+        + resize2d_fp32_axis_table_bytes(taps, dst_w)
+        + cache_len * PPL_OMP_MAX_THREADS();
+}
+
+// horizontal_func(src_row, tab_w, dst_row): resize one row of c_blk channels to tab_w.len pixels
+// vertical_func(row_list, wei_list, taps, length, dst_row): dst_row = sum(row_list[k] * wei_list[k])
+typedef void (*resize2d_fp32_horizontal_func_t)(const float *, const resize2d_fp32_axis_table &, float *);
+typedef void (*resize2d_fp32_vertical_func_t)(const float **, const float *, const int64_t, const int64_t, float *);
+
+template <int64_t c_blk, resize2d_fp32_horizontal_func_t horizontal_func, resize2d_fp32_vertical_func_t vertical_func>
+ppl::common::RetCode resize2d_fp32_engine_execute(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const resize2d_param *param,
+    void *temp_buffer,
+    float *dst)
+{
+    if (!temp_buffer) {
+        return ppl::common::RC_INVALID_VALUE;
+    }
+    const int64_t batch    = src_shape->GetDim(0);
+    const int64_t channels = src_shape->GetDim(1);
+    const int64_t src_h    = src_shape->GetDim(2);
+    const int64_t src_w    = src_shape->GetDim(3);
+    const int64_t dst_h    = dst_shape->GetDim(2);
+    const int64_t dst_w    = dst_shape->GetDim(3);
+    const int64_t planes   = batch * div_up(channels, c_blk);
+    const int64_t taps     = resize2d_fp32_taps(param->interp_mode);
+
+    const int64_t src_p_stride = src_h * src_w * c_blk;
+    const int64_t dst_p_stride = dst_h * dst_w * c_blk;
+    const int64_t row_len      = dst_w * c_blk;
+    const uint64_t cache_len   = round_up(taps * row_len * sizeof(float), PPL_X86_CACHELINE_BYTES()) / sizeof(float);
+
+    resize2d_fp32_axis_table tab_h, tab_w;
+    uint8_t *tab_buffer = (uint8_t*)temp_buffer;
+    resize2d_fp32_bind_axis_table(taps, dst_h, tab_buffer, &tab_h);
+    tab_buffer += resize2d_fp32_axis_table_bytes(taps, dst_h);
+    resize2d_fp32_bind_axis_table(taps, dst_w, tab_buffer, &tab_w);
+    tab_buffer += resize2d_fp32_axis_table_bytes(taps, dst_w);
+    float *cache_buffer = (float*)tab_buffer;
+
+    resize2d_fp32_init_axis_table(param, src_h, param->scale_h, param->roi_start_h, param->roi_end_h, &tab_h);
+    resize2d_fp32_init_axis_table(param, src_w, param->scale_w, param->roi_start_w, param->roi_end_w, &tab_w);
+
+    bool has_outside_w = false;
+    for (int64_t ow = 0; ow < dst_w; ++ow) {
+        has_outside_w = has_outside_w || tab_w.outside[ow];
+    }
+
+    const int64_t num_threads = PPL_OMP_MAX_THREADS();
+    int64_t oh_blk = dst_h;
+    if (planes < num_threads) {
+        oh_blk = max<int64_t>(div_up(dst_h, div_up(num_threads, planes)), max<int64_t>(taps, 4));
+    }
+
+#ifdef PPL_USE_X86_OMP_COLLAPSE
+    PRAGMA_OMP_PARALLEL_FOR_COLLAPSE(2)
+#else
+    PRAGMA_OMP_PARALLEL_FOR()
+#endif
+    for (int64_t p = 0; p < planes; ++p) {
+        for (int64_t ohb = 0; ohb < dst_h; ohb += oh_blk) {
+            const int64_t ohb_eff = min(dst_h - ohb, oh_blk);
+            const float *l_src    = src + p * src_p_stride;
+            float *l_dst          = dst + p * dst_p_stride;
+            float *l_cache        = cache_buffer + PPL_OMP_THREAD_ID() * cache_len;
+
+            int64_t cached_ih[4] = {-1, -1, -1, -1};
+            const float *row_list[4];
+            float wei_list[4];
+            for (int64_t oh = ohb; oh < ohb + ohb_eff; ++oh) {
+                float *dst_row = l_dst + oh * row_len;
+                if (tab_h.outside[oh]) {
+                    for (int64_t i = 0; i < row_len; ++i) {
+                        dst_row[i] = param->extrapolation_value;
+                    }
+                    if (taps == 1) cached_ih[0] = -1; // previous dst row is not a copy source any more
+                    continue;
+                }
+                if (taps == 1) {
+                    const int64_t ih = tab_h.idx[oh];
+                    if (oh > ohb && ih == cached_ih[0]) {
+                        memcpy(dst_row, dst_row - row_len, row_len * sizeof(float));
+                    } else {
+                        horizontal_func(l_src + ih * src_w * c_blk, tab_w, dst_row);
+                        cached_ih[0] = ih;
+                    }
+                } else {
+                    for (int64_t k = 0; k < taps; ++k) {
+                        const int64_t ih   = tab_h.idx[k * dst_h + oh];
+                        const int64_t slot = ih % taps;
+                        float *cache_row   = l_cache + slot * row_len;
+                        if (cached_ih[slot] != ih) {
+                            horizontal_func(l_src + ih * src_w * c_blk, tab_w, cache_row);
+                            cached_ih[slot] = ih;
+                        }
+                        row_list[k] = cache_row;
+                        wei_list[k] = tab_h.wei[k * dst_h + oh];
+                    }
+                    vertical_func(row_list, wei_list, taps, row_len, dst_row);
+                }
+                if (has_outside_w) {
+                    for (int64_t ow = 0; ow < dst_w; ++ow) {
+                        if (tab_w.outside[ow]) {
+                            for (int64_t c = 0; c < c_blk; ++c) {
+                                dst_row[ow * c_blk + c] = param->extrapolation_value;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return ppl::common::RC_SUCCESS;
+}
+
+}}}; // namespace ppl::kernel::x86
+
+#endif
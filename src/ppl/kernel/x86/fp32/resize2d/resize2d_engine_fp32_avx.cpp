@@ -0,0 +1,178 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "ppl/kernel/x86/fp32/resize2d/resize2d_engine_fp32.h"
+#include "ppl/kernel/x86/fp32/resize2d.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+template <int64_t taps>
+static void resize2d_n16cx_horizontal_fp32_avx_kernel(
+    const float *src,
+    const resize2d_fp32_axis_table &tab_w,
+    float *dst)
+{
+    const int64_t c_blk = 16;
+    const int64_t dst_w = tab_w.len;
+    for (int64_t ow = 0; ow < dst_w; ++ow) {
+        const float *s0 = src + tab_w.idx[0 * dst_w + ow] * c_blk;
+        if (taps == 1) {
+            _mm256_storeu_ps(dst + 0, _mm256_loadu_ps(s0 + 0));
+            _mm256_storeu_ps(dst + 8, _mm256_loadu_ps(s0 + 8));
+        } else {
+            __m256 w0   = _mm256_set1_ps(tab_w.wei[0 * dst_w + ow]);
+            __m256 acc0 = _mm256_mul_ps(_mm256_loadu_ps(s0 + 0), w0);
+            __m256 acc1 = _mm256_mul_ps(_mm256_loadu_ps(s0 + 8), w0);
+            for (int64_t k = 1; k < taps; ++k) {
+                const float *sk = src + tab_w.idx[k * dst_w + ow] * c_blk;
+                __m256 wk = _mm256_set1_ps(tab_w.wei[k * dst_w + ow]);
+                acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(sk + 0), wk));
+                acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(_mm256_loadu_ps(sk + 8), wk));
+            }
+            _mm256_storeu_ps(dst + 0, acc0);
+            _mm256_storeu_ps(dst + 8, acc1);
+        }
+        dst += c_blk;
+    }
+}
+
+static void resize2d_n16cx_horizontal_fp32_avx(
+    const float *src,
+    const resize2d_fp32_axis_table &tab_w,
+    float *dst)
+{
+    if (tab_w.taps == 4) {
+        resize2d_n16cx_horizontal_fp32_avx_kernel<4>(src, tab_w, dst);
+    } else if (tab_w.taps == 2) {
+        resize2d_n16cx_horizontal_fp32_avx_kernel<2>(src, tab_w, dst);
+    } else {
+        resize2d_n16cx_horizontal_fp32_avx_kernel<1>(src, tab_w, dst);
+    }
+}
+
+#define GATHER8(SRC, IDX) _mm256_setr_ps(\
+    (SRC)[(IDX)[0]], (SRC)[(IDX)[1]], (SRC)[(IDX)[2]], (SRC)[(IDX)[3]],\
+    (SRC)[(IDX)[4]], (SRC)[(IDX)[5]], (SRC)[(IDX)[6]], (SRC)[(IDX)[7]])
+
+static void resize2d_ndarray_horizontal_fp32_avx(
+    const float *src,
+    const resize2d_fp32_axis_table &tab_w,
+    float *dst)
+{
+    const int64_t simd_w = 8;
+    const int64_t taps   = tab_w.taps;
+    const int64_t dst_w  = tab_w.len;
+    const int64_t body   = round(dst_w, simd_w);
+    for (int64_t ow = 0; ow < body; ow += simd_w) {
+        __m256 acc = GATHER8(src, tab_w.idx + ow);
+        if (taps > 1) {
+            acc = _mm256_mul_ps(acc, _mm256_loadu_ps(tab_w.wei + ow));
+            for (int64_t k = 1; k < taps; ++k) {
+                __m256 sk = GATHER8(src, tab_w.idx + k * dst_w + ow);
+                acc = _mm256_add_ps(acc, _mm256_mul_ps(sk, _mm256_loadu_ps(tab_w.wei + k * dst_w + ow)));
+            }
+        }
+        _mm256_storeu_ps(dst + ow, acc);
+    }
+    for (int64_t ow = body; ow < dst_w; ++ow) {
+        float acc = src[tab_w.idx[ow]] * tab_w.wei[ow];
+        for (int64_t k = 1; k < taps; ++k) {
+            acc += src[tab_w.idx[k * dst_w + ow]] * tab_w.wei[k * dst_w + ow];
+        }
+        dst[ow] = acc;
+    }
+}
+
+#undef GATHER8
+
+static void resize2d_vertical_fp32_avx(
+    const float **row_list,
+    const float *wei_list,
+    const int64_t taps,
+    const int64_t length,
+    float *dst)
+{
+    const int64_t simd_w = 8;
+    const int64_t unroll = 2 * simd_w;
+    const int64_t body   = round(length, unroll);
+    const float *r0 = row_list[0];
+    const float *r1 = row_list[min<int64_t>(1, taps - 1)];
+    const float *r2 = row_list[min<int64_t>(2, taps - 1)];
+    const float *r3 = row_list[min<int64_t>(3, taps - 1)];
+    __m256 w0 = _mm256_set1_ps(wei_list[0]);
+    __m256 w1 = _mm256_set1_ps(taps > 1 ? wei_list[1] : 0.0f);
+    __m256 w2 = _mm256_set1_ps(taps > 2 ? wei_list[2] : 0.0f);
+    __m256 w3 = _mm256_set1_ps(taps > 3 ? wei_list[3] : 0.0f);
+    if (taps == 2) {
+        for (int64_t i = 0; i < body; i += unroll) {
+            __m256 acc0 = _mm256_mul_ps(_mm256_loadu_ps(r0 + i + 0), w0);
+            __m256 acc1 = _mm256_mul_ps(_mm256_loadu_ps(r0 + i + 8), w0);
+            acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(r1 + i + 0), w1));
+            acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(_mm256_loadu_ps(r1 + i + 8), w1));
+            _mm256_storeu_ps(dst + i + 0, acc0);
+            _mm256_storeu_ps(dst + i + 8, acc1);
+        }
+    } else {
+        for (int64_t i = 0; i < body; i += unroll) {
+            __m256 acc0 = _mm256_mul_ps(_mm256_loadu_ps(r0 + i + 0), w0);
+            __m256 acc1 = _mm256_mul_ps(_mm256_loadu_ps(r0 + i + 8), w0);
+            acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(r1 + i + 0), w1));
+            acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(_mm256_loadu_ps(r1 + i + 8), w1));
+            acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(r2 + i + 0), w2));
+            acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(_mm256_loadu_ps(r2 + i + 8), w2));
+            acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(r3 + i + 0), w3));
+            acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(_mm256_loadu_ps(r3 + i + 8), w3));
+            _mm256_storeu_ps(dst + i + 0, acc0);
+            _mm256_storeu_ps(dst + i + 8, acc1);
+        }
+    }
+    for (int64_t i = body; i < length; ++i) {
+        float acc = r0[i] * wei_list[0];
+        for (int64_t k = 1; k < taps; ++k) {
+            acc += row_list[k][i] * wei_list[k];
+        }
+        dst[i] = acc;
+    }
+}
+
+ppl::common::RetCode resize2d_ndarray_fp32_avx(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const resize2d_param *param,
+    void *temp_buffer,
+    float *dst)
+{
+    return resize2d_fp32_engine_execute<1, resize2d_ndarray_horizontal_fp32_avx, resize2d_vertical_fp32_avx>(
+        src_shape, dst_shape, src, param, temp_buffer, dst);
+}
+
+ppl::common::RetCode resize2d_n16cx_fp32_avx(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const resize2d_param *param,
+    void *temp_buffer,
+    float *dst)
+{
+    return resize2d_fp32_engine_execute<16, resize2d_n16cx_horizontal_fp32_avx, resize2d_vertical_fp32_avx>(
+        src_shape, dst_shape, src, param, temp_buffer, dst);
+}
+
+}}}; // namespace ppl::kernel::x86
@@ -0,0 +1,152 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "ppl/kernel/x86/fp32/resize2d/resize2d_engine_fp32.h"
+#include "ppl/kernel/x86/fp32/resize2d.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+template <int64_t taps>
+static void resize2d_n16cx_horizontal_fp32_avx512_kernel(
+    const float *src,
+    const resize2d_fp32_axis_table &tab_w,
+    float *dst)
+{
+    const int64_t c_blk = 16;
+    const int64_t dst_w = tab_w.len;
+    for (int64_t ow = 0; ow < dst_w; ++ow) {
+        __m512 acc = _mm512_loadu_ps(src + tab_w.idx[0 * dst_w + ow] * c_blk);
+        if (taps > 1) {
+            acc = _mm512_mul_ps(acc, _mm512_set1_ps(tab_w.wei[0 * dst_w + ow]));
+            for (int64_t k = 1; k < taps; ++k) {
+                acc = _mm512_fmadd_ps(
+                    _mm512_loadu_ps(src + tab_w.idx[k * dst_w + ow] * c_blk),
+                    _mm512_set1_ps(tab_w.wei[k * dst_w + ow]),
+                    acc);
+            }
+        }
+        _mm512_storeu_ps(dst, acc);
+        dst += c_blk;
+    }
+}
+
+static void resize2d_n16cx_horizontal_fp32_avx512(
+    const float *src,
+    const resize2d_fp32_axis_table &tab_w,
+    float *dst)
+{
+    if (tab_w.taps == 4) {
+        resize2d_n16cx_horizontal_fp32_avx512_kernel<4>(src, tab_w, dst);
+    } else if (tab_w.taps == 2) {
+        resize2d_n16cx_horizontal_fp32_avx512_kernel<2>(src, tab_w, dst);
+    } else {
+        resize2d_n16cx_horizontal_fp32_avx512_kernel<1>(src, tab_w, dst);
+    }
+}
+
+static void resize2d_ndarray_horizontal_fp32_avx512(
+    const float *src,
+    const resize2d_fp32_axis_table &tab_w,
+    float *dst)
+{
+    const int64_t simd_w = 16;
+    const int64_t taps   = tab_w.taps;
+    const int64_t dst_w  = tab_w.len;
+    const int64_t tail   = dst_w % simd_w;
+    const __mmask16 tail_mask = (__mmask16)((1 << tail) - 1);
+    for (int64_t ow = 0; ow < dst_w; ow += simd_w) {
+        const __mmask16 mask = ow + simd_w <= dst_w ? (__mmask16)0xffff : tail_mask;
+        __m512i idx = _mm512_maskz_loadu_epi32(mask, tab_w.idx + ow);
+        __m512 acc  = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), mask, idx, src, 4);
+        if (taps > 1) {
+            acc = _mm512_mul_ps(acc, _mm512_maskz_loadu_ps(mask, tab_w.wei + ow));
+            for (int64_t k = 1; k < taps; ++k) {
+                idx = _mm512_maskz_loadu_epi32(mask, tab_w.idx + k * dst_w + ow);
+                acc = _mm512_fmadd_ps(
+                    _mm512_mask_i32gather_ps(_mm512_setzero_ps(), mask, idx, src, 4),
+                    _mm512_maskz_loadu_ps(mask, tab_w.wei + k * dst_w + ow),
+                    acc);
+            }
+        }
+        _mm512_mask_storeu_ps(dst + ow, mask, acc);
+    }
+}
+
+static void resize2d_vertical_fp32_avx512(
+    const float **row_list,
+    const float *wei_list,
+    const int64_t taps,
+    const int64_t length,
+    float *dst)
+{
+    const int64_t simd_w = 16;
+    const int64_t tail   = length % simd_w;
+    const __mmask16 tail_mask = (__mmask16)((1 << tail) - 1);
+    const float *r0 = row_list[0];
+    const float *r1 = row_list[min<int64_t>(1, taps - 1)];
+    const float *r2 = row_list[min<int64_t>(2, taps - 1)];
+    const float *r3 = row_list[min<int64_t>(3, taps - 1)];
+    __m512 w0 = _mm512_set1_ps(wei_list[0]);
+    __m512 w1 = _mm512_set1_ps(taps > 1 ? wei_list[1] : 0.0f);
+    __m512 w2 = _mm512_set1_ps(taps > 2 ? wei_list[2] : 0.0f);
+    __m512 w3 = _mm512_set1_ps(taps > 3 ? wei_list[3] : 0.0f);
+    if (taps == 2) {
+        for (int64_t i = 0; i < length; i += simd_w) {
+            const __mmask16 mask = i + simd_w <= length ? (__mmask16)0xffff : tail_mask;
+            __m512 acc = _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, r0 + i), w0);
+            acc = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, r1 + i), w1, acc);
+            _mm512_mask_storeu_ps(dst + i, mask, acc);
+        }
+    } else {
+        for (int64_t i = 0; i < length; i += simd_w) {
+            const __mmask16 mask = i + simd_w <= length ? (__mmask16)0xffff : tail_mask;
+            __m512 acc = _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, r0 + i), w0);
+            acc = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, r1 + i), w1, acc);
+            acc = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, r2 + i), w2, acc);
+            acc = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, r3 + i), w3, acc);
+            _mm512_mask_storeu_ps(dst + i, mask, acc);
+        }
+    }
+}
+
+ppl::common::RetCode resize2d_ndarray_fp32_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const resize2d_param *param,
+    void *temp_buffer,
+    float *dst)
+{
+    return resize2d_fp32_engine_execute<1, resize2d_ndarray_horizontal_fp32_avx512, resize2d_vertical_fp32_avx512>(
+        src_shape, dst_shape, src, param, temp_buffer, dst);
+}
+
+ppl::common::RetCode resize2d_n16cx_fp32_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const resize2d_param *param,
+    void *temp_buffer,
+    float *dst)
+{
+    return resize2d_fp32_engine_execute<16, resize2d_n16cx_horizontal_fp32_avx512, resize2d_vertical_fp32_avx512>(
+        src_shape, dst_shape, src, param, temp_buffer, dst);
+}
+
+}}}; // namespace ppl::kernel::x86
@@ -31,4 +31,17 @@ ppl::common::RetCode scatter_elements_ndarray_fp32(
     return scatter_elements_ndarray_common<float>(src_shape, indices_shape, src, indices, updates, axis, dst);
 }
 
+ppl::common::RetCode scatter_elements_ndarray_fp32(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *indices_shape,
+    const float *src,
+    const int64_t *indices,
+    const float *updates,
+    const int64_t axis,
+    const int32_t reduction,
+    float *dst)
+{
+    return scatter_elements_ndarray_common<float>(src_shape, indices_shape, src, indices, updates, axis, reduction, dst);
+}
+
 }}} // namespace ppl::kernel::x86
\ No newline at end of file
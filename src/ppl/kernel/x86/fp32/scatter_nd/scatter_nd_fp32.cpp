@@ -16,7 +16,10 @@
 // under the License.
 
 #include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/common/memory.h"
+#include "ppl/kernel/x86/common/scatter_reduce/scatter_reduce_common.h"
 #include <string.h>
+#include <vector>
 
 namespace ppl { namespace kernel { namespace x86 {
 
@@ -69,4 +72,45 @@ ppl::common::RetCode scatter_nd_ndarray_fp32(
     return ppl::common::RC_SUCCESS;
 }
 
+ppl::common::RetCode scatter_nd_ndarray_fp32(
+    const float *src,
+    const float *updates,
+    const int64_t *indices,
+    const int32_t *strides,
+    const int64_t src_length,
+    const int64_t inner_dim,
+    const int64_t num_indices,
+    const int64_t indices_dim,
+    const int32_t reduction,
+    float *dst)
+{
+    if (reduction == SCATTER_REDUCTION_NONE) {
+        return scatter_nd_ndarray_fp32(src, updates, indices, strides, src_length, inner_dim, num_indices, indices_dim, dst);
+    }
+
+    // check every slice before dst is touched, so a bad index leaves dst as it was
+    std::vector<int64_t> offsets(num_indices);
+    std::vector<uint8_t> thread_invalid(PPL_OMP_MAX_THREADS(), 0);
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t k = 0; k < num_indices; ++k) {
+        int64_t offset           = 0;
+        const int64_t *l_indices = indices + k * indices_dim;
+        for (int64_t i = 0; i < indices_dim; ++i) {
+            offset += l_indices[i] * strides[i];
+        }
+        offsets[k] = offset;
+        if (offset < 0 || offset + inner_dim > src_length) {
+            thread_invalid[PPL_OMP_THREAD_ID()] = 1;
+        }
+    }
+    for (size_t t = 0; t < thread_invalid.size(); ++t) {
+        if (thread_invalid[t]) {
+            return ppl::common::RC_INVALID_VALUE;
+        }
+    }
+
+    memory_copy(src, src_length * sizeof(float), dst);
+    return scatter_reduce_offsets<float>(offsets.data(), updates, num_indices, inner_dim, src_length, reduction, dst);
+}
+
 }}} // namespace ppl::kernel::x86
@@ -16,6 +16,7 @@
 // under the License.
 
 #include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/fp32/split.h"
 #include "ppl/kernel/x86/common/split/split_common.h"
 
 namespace ppl { namespace kernel { namespace x86 {
@@ -31,4 +32,25 @@ ppl::common::RetCode split_n16cx_fp32(
     return split_n16cx<float>(src_shape, dst_shape_list, src, slice_axis, num_dst, dst_list);
 }
 
+ppl::common::RetCode split_n16cx_interleave_channels_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape **dst_shape_list,
+    const float *src,
+    const int32_t slice_axis,
+    const int32_t num_dst,
+    const int32_t c_dim_idx,
+    float **dst_list)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return split_n16cx_interleave_channels_fp32_avx512(src_shape, dst_shape_list, src, slice_axis, num_dst, c_dim_idx, dst_list);
+    }
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) {
+        return split_n16cx_interleave_channels_fp32_avx(src_shape, dst_shape_list, src, slice_axis, num_dst, c_dim_idx, dst_list);
+    }
+    return split_n16cx_interleave_channels<float>(src_shape, dst_shape_list, src, slice_axis, num_dst, c_dim_idx, dst_list);
+}
+
 }}} // namespace ppl::kernel::x86
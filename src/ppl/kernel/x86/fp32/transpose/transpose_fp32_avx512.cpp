@@ -0,0 +1,45 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/kernel/x86/common/transpose/transpose_common.h"
+#include "ppl/kernel/x86/fp32/transpose/transpose_fp32_avx512.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+struct transpose_block_kernel_fp32_avx512 {
+    static const int64_t BLK = 16;
+    static inline void transpose_blk(
+        const float *src,
+        const int64_t src_stride,
+        const int64_t dst_stride,
+        float *dst)
+    {
+        transpose_16x16_fp32_avx512(src, src_stride, dst_stride, dst);
+    }
+};
+
+ppl::common::RetCode transpose_ndarray_fp32_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src,
+    const int32_t *perm,
+    float *dst)
+{
+    return transpose_ndarray_engine<float, transpose_block_kernel_fp32_avx512>(src_shape, perm, src, dst);
+}
+
+}}}; // namespace ppl::kernel::x86
@@ -0,0 +1,67 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_FP32_TRANSPOSE_AVX512_TRANSPOSE_FP32_AVX512_H_
+#define __ST_PPL_KERNEL_X86_FP32_TRANSPOSE_AVX512_TRANSPOSE_FP32_AVX512_H_
+
+#include <immintrin.h>
+
+#include "ppl/kernel/x86/common/internal_include.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+inline void transpose_16x16_fp32_avx512(
+    const float *src,
+    const int64_t src_stride,
+    const int64_t dst_stride,
+    float *dst)
+{
+    __m512 r[16], t[16];
+    for (int64_t i = 0; i < 16; ++i) {
+        r[i] = _mm512_loadu_ps(src + i * src_stride);
+    }
+
+    for (int64_t i = 0; i < 16; i += 2) {
+        t[i + 0] = _mm512_unpacklo_ps(r[i + 0], r[i + 1]);
+        t[i + 1] = _mm512_unpackhi_ps(r[i + 0], r[i + 1]);
+    }
+    // r[4 * g + j] lane k holds rows [4g, 4g + 4) of column 4k + j
+    for (int64_t i = 0; i < 16; i += 4) {
+        r[i + 0] = _mm512_shuffle_ps(t[i + 0], t[i + 2], 0x44);
+        r[i + 1] = _mm512_shuffle_ps(t[i + 0], t[i + 2], 0xee);
+        r[i + 2] = _mm512_shuffle_ps(t[i + 1], t[i + 3], 0x44);
+        r[i + 3] = _mm512_shuffle_ps(t[i + 1], t[i + 3], 0xee);
+    }
+    for (int64_t j = 0; j < 4; ++j) {
+        t[j + 0]  = _mm512_shuffle_f32x4(r[j + 0], r[j + 4], 0x88);
+        t[j + 4]  = _mm512_shuffle_f32x4(r[j + 0], r[j + 4], 0xdd);
+        t[j + 8]  = _mm512_shuffle_f32x4(r[j + 8], r[j + 12], 0x88);
+        t[j + 12] = _mm512_shuffle_f32x4(r[j + 8], r[j + 12], 0xdd);
+    }
+    for (int64_t j = 0; j < 8; ++j) {
+        r[j + 0] = _mm512_shuffle_f32x4(t[j + 0], t[j + 8], 0x88);
+        r[j + 8] = _mm512_shuffle_f32x4(t[j + 0], t[j + 8], 0xdd);
+    }
+
+    for (int64_t i = 0; i < 16; ++i) {
+        _mm512_storeu_ps(dst + i * dst_stride, r[i]);
+    }
+}
+
+}}}; // namespace ppl::kernel::x86
+
+#endif
@@ -15,6 +15,8 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/fp32/where.h"
 #include "ppl/kernel/x86/common/where/where_common.h"
 
 namespace ppl { namespace kernel { namespace x86 {
@@ -42,4 +44,39 @@ ppl::common::RetCode where_ndarray_fp32(
     return where_ndarray_common<float>(cond_shape, src_x_shape, src_y_shape, dst_shape, cond, src_x, src_y, dst);
 }
 
+ppl::common::RetCode where_eltwise_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *dst_shape,
+    const uint8_t *cond,
+    const float *src_x,
+    const float *src_y,
+    float *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return where_eltwise_fp32_avx512(dst_shape, cond, src_x, src_y, dst);
+    }
+#endif
+    return where_eltwise_fp32(dst_shape, cond, src_x, src_y, dst);
+}
+
+ppl::common::RetCode where_ndarray_fp32(
+    const ppl::common::isa_t isa,
+    const ppl::common::TensorShape *cond_shape,
+    const ppl::common::TensorShape *src_x_shape,
+    const ppl::common::TensorShape *src_y_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const uint8_t *cond,
+    const float *src_x,
+    const float *src_y,
+    float *dst)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) {
+        return where_ndarray_fp32_avx512(cond_shape, src_x_shape, src_y_shape, dst_shape, cond, src_x, src_y, dst);
+    }
+#endif
+    return where_ndarray_fp32(cond_shape, src_x_shape, src_y_shape, dst_shape, cond, src_x, src_y, dst);
+}
+
 }}}; // namespace ppl::kernel::x86
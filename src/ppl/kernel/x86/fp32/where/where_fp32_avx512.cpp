@@ -0,0 +1,183 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+#include <string.h>
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/kernel/x86/common/where/where_common.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+static inline __mmask16 where_load_cond_fp32_avx512(const uint8_t *cond)
+{
+    const __m512i v_cond = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i *)cond));
+    return _mm512_test_epi32_mask(v_cond, v_cond);
+}
+
+static inline __mmask16 where_load_cond_fp32_avx512(const uint8_t *cond, const int64_t len)
+{
+    // avx512f has no byte mask load, stage the tail to avoid reading past the end
+    uint8_t cond_buf[16] = {0};
+    memcpy(cond_buf, cond, len);
+    return where_load_cond_fp32_avx512(cond_buf);
+}
+
+static inline __mmask16 where_tail_mask_fp32_avx512(const int64_t len)
+{
+    return (__mmask16)((1 << len) - 1);
+}
+
+// inc_* is either 0 (broadcast) or 1 (contiguous) on the last dim
+static void where_lastdim_fp32_avx512(
+    const uint8_t *cond,
+    const float *src_x,
+    const float *src_y,
+    const int64_t inc_cond,
+    const int64_t inc_x,
+    const int64_t inc_y,
+    const int64_t length,
+    float *dst)
+{
+    const int64_t simd_w = 16;
+
+    const __mmask16 bc_cond = cond[0] ? 0xFFFF : 0;
+    const __m512 bc_x       = _mm512_set1_ps(src_x[0]);
+    const __m512 bc_y       = _mm512_set1_ps(src_y[0]);
+
+    int64_t i = 0;
+    for (; i + simd_w <= length; i += simd_w) {
+        const __mmask16 k = inc_cond ? where_load_cond_fp32_avx512(cond + i) : bc_cond;
+        const __m512 v_x  = inc_x ? _mm512_loadu_ps(src_x + i) : bc_x;
+        const __m512 v_y  = inc_y ? _mm512_loadu_ps(src_y + i) : bc_y;
+        _mm512_storeu_ps(dst + i, _mm512_mask_blend_ps(k, v_y, v_x));
+    }
+    if (i < length) {
+        const int64_t tail     = length - i;
+        const __mmask16 t_mask = where_tail_mask_fp32_avx512(tail);
+        const __mmask16 k      = inc_cond ? where_load_cond_fp32_avx512(cond + i, tail) : bc_cond;
+        const __m512 v_x       = inc_x ? _mm512_maskz_loadu_ps(t_mask, src_x + i) : bc_x;
+        const __m512 v_y       = inc_y ? _mm512_maskz_loadu_ps(t_mask, src_y + i) : bc_y;
+        _mm512_mask_storeu_ps(dst + i, t_mask, _mm512_mask_blend_ps(k, v_y, v_x));
+    }
+}
+
+ppl::common::RetCode where_eltwise_fp32_avx512(
+    const ppl::common::TensorShape *dst_shape,
+    const uint8_t *cond,
+    const float *src_x,
+    const float *src_y,
+    float *dst)
+{
+    const int64_t length   = dst_shape->CalcElementsIncludingPadding();
+    const int64_t simd_w   = 16;
+    const int64_t task_len = 64 * simd_w;
+    const int64_t num_task = div_up(length, task_len);
+
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t t = 0; t < num_task; t++) {
+        const int64_t start = t * task_len;
+        const int64_t len   = min(task_len, length - start);
+        where_lastdim_fp32_avx512(cond + start, src_x + start, src_y + start, 1, 1, 1, len, dst + start);
+    }
+
+    return ppl::common::RC_SUCCESS;
+}
+
+static void where_ndarray_recursive_fp32_avx512(
+    const ppl::common::TensorShape *dst_shape,
+    const uint8_t *cond,
+    const float *src_x,
+    const float *src_y,
+    const int64_t *inc_cond,
+    const int64_t *inc_x,
+    const int64_t *inc_y,
+    const int64_t *inc_out,
+    const uint32_t dim_idx,
+    const bool has_paralleld,
+    float *dst)
+{
+    const uint32_t dim_count = dst_shape->GetDimCount();
+    const int64_t length     = dst_shape->GetDim(dim_idx);
+
+    if (dim_idx == dim_count - 1) {
+        where_lastdim_fp32_avx512(cond, src_x, src_y, inc_cond[dim_idx], inc_x[dim_idx], inc_y[dim_idx], length, dst);
+    } else {
+        if (length > 1 && !has_paralleld) {
+            PRAGMA_OMP_PARALLEL_FOR()
+            for (int64_t i = 0; i < length; i++) {
+                where_ndarray_recursive_fp32_avx512(dst_shape, cond + i * inc_cond[dim_idx], src_x + i * inc_x[dim_idx], src_y + i * inc_y[dim_idx], inc_cond, inc_x, inc_y, inc_out, dim_idx + 1, true, dst + i * inc_out[dim_idx]);
+            }
+        } else {
+            for (int64_t i = 0; i < length; i++) {
+                where_ndarray_recursive_fp32_avx512(dst_shape, cond + i * inc_cond[dim_idx], src_x + i * inc_x[dim_idx], src_y + i * inc_y[dim_idx], inc_cond, inc_x, inc_y, inc_out, dim_idx + 1, has_paralleld, dst + i * inc_out[dim_idx]);
+            }
+        }
+    }
+}
+
+ppl::common::RetCode where_ndarray_fp32_avx512(
+    const ppl::common::TensorShape *cond_shape,
+    const ppl::common::TensorShape *src_x_shape,
+    const ppl::common::TensorShape *src_y_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const uint8_t *cond,
+    const float *src_x,
+    const float *src_y,
+    float *dst)
+{
+    const int64_t dim_count = dst_shape->GetDimCount();
+    if (dim_count > PPL_X86_TENSOR_MAX_DIMS()) {
+        return ppl::common::RC_UNSUPPORTED;
+    }
+    if (dim_count == 0) {
+        dst[0] = cond[0] ? src_x[0] : src_y[0];
+        return ppl::common::RC_SUCCESS;
+    }
+
+    ppl::common::TensorShape padded_cond_shape = pad_shape(cond_shape, dim_count);
+    ppl::common::TensorShape padded_x_shape    = pad_shape(src_x_shape, dim_count);
+    ppl::common::TensorShape padded_y_shape    = pad_shape(src_y_shape, dim_count);
+
+    int64_t inc_cond[PPL_X86_TENSOR_MAX_DIMS()] = {0};
+    int64_t inc_x[PPL_X86_TENSOR_MAX_DIMS()]    = {0};
+    int64_t inc_y[PPL_X86_TENSOR_MAX_DIMS()]    = {0};
+    int64_t inc_out[PPL_X86_TENSOR_MAX_DIMS()]  = {0};
+
+    int64_t stride_cond = 1;
+    int64_t stride_x    = 1;
+    int64_t stride_y    = 1;
+    int64_t stride_out  = 1;
+
+    for (int64_t i = dim_count - 1; i >= 0; --i) {
+        inc_cond[i] = padded_cond_shape.GetDim(i) == 1 ? 0 : stride_cond;
+        inc_x[i]    = padded_x_shape.GetDim(i) == 1 ? 0 : stride_x;
+        inc_y[i]    = padded_y_shape.GetDim(i) == 1 ? 0 : stride_y;
+        inc_out[i]  = stride_out;
+
+        stride_cond *= padded_cond_shape.GetDim(i);
+        stride_x *= padded_x_shape.GetDim(i);
+        stride_y *= padded_y_shape.GetDim(i);
+        stride_out *= dst_shape->GetDim(i);
+    }
+
+    where_ndarray_recursive_fp32_avx512(dst_shape, cond, src_x, src_y, inc_cond, inc_x, inc_y, inc_out, 0, false, dst);
+
+    return ppl::common::RC_SUCCESS;
+}
+
+}}}; // namespace ppl::kernel::x86
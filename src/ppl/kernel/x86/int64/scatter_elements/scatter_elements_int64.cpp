@@ -31,4 +31,17 @@ ppl::common::RetCode scatter_elements_ndarray_int64(
     return scatter_elements_ndarray_common<int64_t>(src_shape, indices_shape, src, indices, updates, axis, dst);
 }
 
+ppl::common::RetCode scatter_elements_ndarray_int64(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *indices_shape,
+    const int64_t *src,
+    const int64_t *indices,
+    const int64_t *updates,
+    const int64_t axis,
+    const int32_t reduction,
+    int64_t *dst)
+{
+    return scatter_elements_ndarray_common<int64_t>(src_shape, indices_shape, src, indices, updates, axis, reduction, dst);
+}
+
 }}} // namespace ppl::kernel::x86
\ No newline at end of file
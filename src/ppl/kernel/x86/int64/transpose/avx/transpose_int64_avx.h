@@ -31,8 +31,8 @@ namespace ppl { namespace kernel { namespace x86 {
         ymm6 = _mm256_unpacklo_pd(ymm2, ymm3);           \
         ymm7 = _mm256_unpackhi_pd(ymm2, ymm3);           \
         ymm0 = _mm256_permute2f128_pd(ymm4, ymm6, 0x20); \
-        ymm1 = _mm256_permute2f128_pd(ymm4, ymm6, 0x31); \
-        ymm2 = _mm256_permute2f128_pd(ymm5, ymm7, 0x20); \
+        ymm1 = _mm256_permute2f128_pd(ymm5, ymm7, 0x20); \
+        ymm2 = _mm256_permute2f128_pd(ymm4, ymm6, 0x31); \
         ymm3 = _mm256_permute2f128_pd(ymm5, ymm7, 0x31); \
     } while (false)
 
@@ -0,0 +1,45 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "ppl/kernel/x86/common/transpose/transpose_common.h"
+#include "ppl/kernel/x86/int64/transpose/avx512/transpose_int64_avx512.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+struct transpose_block_kernel_int64_avx512 {
+    static const int64_t BLK = 8;
+    static inline void transpose_blk(
+        const int64_t *src,
+        const int64_t src_stride,
+        const int64_t dst_stride,
+        int64_t *dst)
+    {
+        transpose_8x8_int64_avx512(src, src_stride, dst_stride, dst);
+    }
+};
+
+ppl::common::RetCode transpose_ndarray_int64_avx512(
+    const ppl::common::TensorShape *src_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const int64_t *src,
+    const int32_t *perm,
+    int64_t *dst)
+{
+    return transpose_ndarray_engine<int64_t, transpose_block_kernel_int64_avx512>(src_shape, perm, src, dst);
+}
+
+}}}; // namespace ppl::kernel::x86
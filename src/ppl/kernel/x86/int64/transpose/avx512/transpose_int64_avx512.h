@@ -0,0 +1,61 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_INT64_TRANSPOSE_AVX512_TRANSPOSE_INT64_AVX512_H_
+#define __ST_PPL_KERNEL_X86_INT64_TRANSPOSE_AVX512_TRANSPOSE_INT64_AVX512_H_
+
+#include <immintrin.h>
+
+#include "ppl/kernel/x86/common/internal_include.h"
+
+namespace ppl { namespace kernel { namespace x86 {
+
+inline void transpose_8x8_int64_avx512(
+    const int64_t *src,
+    const int64_t src_stride,
+    const int64_t dst_stride,
+    int64_t *dst)
+{
+    __m512d r[8], t[8];
+    for (int64_t i = 0; i < 8; ++i) {
+        r[i] = _mm512_loadu_pd((const double *)src + i * src_stride);
+    }
+
+    for (int64_t i = 0; i < 8; i += 2) {
+        t[i + 0] = _mm512_unpacklo_pd(r[i + 0], r[i + 1]);
+        t[i + 1] = _mm512_unpackhi_pd(r[i + 0], r[i + 1]);
+    }
+    // r[4 * h + j] holds columns j and j + 4 of rows [4h, 4h + 4), two rows per lane
+    for (int64_t g = 0; g < 8; g += 4) {
+        r[g + 0] = _mm512_shuffle_f64x2(t[g + 0], t[g + 2], 0x88);
+        r[g + 1] = _mm512_shuffle_f64x2(t[g + 1], t[g + 3], 0x88);
+        r[g + 2] = _mm512_shuffle_f64x2(t[g + 0], t[g + 2], 0xdd);
+        r[g + 3] = _mm512_shuffle_f64x2(t[g + 1], t[g + 3], 0xdd);
+    }
+    for (int64_t j = 0; j < 4; ++j) {
+        t[j + 0] = _mm512_shuffle_f64x2(r[j + 0], r[j + 4], 0x88);
+        t[j + 4] = _mm512_shuffle_f64x2(r[j + 0], r[j + 4], 0xdd);
+    }
+
+    for (int64_t i = 0; i < 8; ++i) {
+        _mm512_storeu_pd((double *)dst + i * dst_stride, t[i]);
+    }
+}
+
+}}}; // namespace ppl::kernel::x86
+
+#endif
@@ -0,0 +1,142 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <stdio.h>
+#include <math.h>
+
+#include "ppl/kernel/x86/fp32/argmax.h"
+#include "ppl/kernel/x86/common/argmax/argmax_common.h"
+#include "bench/bench_common.h"
+
+// reduce the middle axis of [outer, len, inner]
+#define ARG_REDUCE_CASE_STRING_FMT() "outer%" PRId64 "len%" PRId64 "inner%" PRId64 "_last%" PRId64 "_data%" PRId64 "_n"
+
+typedef decltype(ppl::kernel::x86::argmax_ndarray_fp32_sse)* ppl_x86_arg_reduce_func_t;
+
+// data 0: uniform values, 1: values in {-1, 0, 1} so every row is full of ties,
+// 2: ties with a NaN in every 7th element
+class arg_reduce_bench_case : public bench_case_impl<ppl_x86_arg_reduce_func_t> {
+public:
+    arg_reduce_bench_case(const bool is_max) : is_max_(is_max)
+    {
+        if (is_max) {
+            impls_ = {
+                {"sse", ppl::kernel::x86::argmax_ndarray_fp32_sse},
+                {"fma", ppl::kernel::x86::argmax_ndarray_fp32_fma},
+#ifdef PPL_USE_X86_AVX512
+                {"avx512", ppl::kernel::x86::argmax_ndarray_fp32_avx512},
+#endif
+            };
+        } else {
+            impls_ = {
+                {"sse", ppl::kernel::x86::argmin_ndarray_fp32_sse},
+                {"fma", ppl::kernel::x86::argmin_ndarray_fp32_fma},
+#ifdef PPL_USE_X86_AVX512
+                {"avx512", ppl::kernel::x86::argmin_ndarray_fp32_avx512},
+#endif
+            };
+        }
+    }
+
+    bool parse(const char *line) override
+    {
+        return 6 == sscanf(line, ARG_REDUCE_CASE_STRING_FMT() "%99s", &outer_, &len_, &inner_, &last_, &data_, name_) &&
+            outer_ >= 0 && len_ > 0 && inner_ >= 0 && (last_ == 0 || last_ == 1) && data_ >= 0 && data_ <= 2;
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), ARG_REDUCE_CASE_STRING_FMT() "%s", outer_, len_, inner_, last_, data_, name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        bench_make_shape({outer_, len_, inner_}, ppl::common::DATAFORMAT_NDARRAY, &src_shape_);
+        if (!src_.alloc(outer_ * len_ * inner_) || !dst_.alloc(outer_ * inner_)) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        if (data_ == 0) {
+            bench_fill_uniform(src_.data(), src_.size(), -1.0f, 1.0f);
+        } else {
+            bench_fill_int(src_.data(), src_.size(), 3, -1, 1.0f);
+        }
+        if (data_ == 2) {
+            for (uint64_t i = 0; i < src_.size(); i += 7) {
+                src_.data()[i] = NAN;
+            }
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    ppl::common::RetCode reference() override
+    {
+        if (!dst_ref_.alloc(dst_.size())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        if (is_max_) {
+            return ppl::kernel::x86::arg_reduce_ndarray<float, true>(&src_shape_, src_.data(), 1, last_, dst_ref_.data());
+        }
+        return ppl::kernel::x86::arg_reduce_ndarray<float, false>(&src_shape_, src_.data(), 1, last_, dst_ref_.data());
+    }
+
+    bool check(const float eps) override
+    {
+        for (uint64_t i = 0; i < dst_.size(); ++i) {
+            if (dst_.data()[i] != dst_ref_.data()[i]) {
+                std::cerr << "error[" << i << "]=" << dst_.data()[i] << " ref:" << dst_ref_.data()[i];
+                return false;
+            }
+        }
+        std::cerr << "pass";
+        return true;
+    }
+
+    ppl::common::RetCode run() override
+    {
+        return func_(&src_shape_, src_.data(), 1, last_, dst_.data());
+    }
+
+    double gops() const override
+    {
+        return src_.size() / 1e9;
+    }
+
+    double gbytes() const override
+    {
+        return (src_.bytes() + dst_.bytes()) / 1e9;
+    }
+
+private:
+    const bool is_max_;
+    int64_t outer_, len_, inner_, last_, data_;
+    char name_[100];
+    ppl::common::TensorShape src_shape_;
+    bench_buffer<float> src_;
+    bench_buffer<int64_t> dst_, dst_ref_;
+};
+
+bench_case *create_argmax_bench_case()
+{
+    return new arg_reduce_bench_case(true);
+}
+
+bench_case *create_argmin_bench_case()
+{
+    return new arg_reduce_bench_case(false);
+}
@@ -0,0 +1,168 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <stdio.h>
+#include <math.h>
+
+#include "ppl/kernel/x86/fp32/arithmetic_max6d.h"
+#include "bench/bench_common.h"
+
+/*
+    op 0: add, 1: sub, 2: mul, 3: div, 4: pow. bit i of lmask/rmask
+    broadcasts dim i of lhs/rhs, a broadcast last dim takes the scalar
+    broadcast kernels, equal masks the strided eltwise ones.
+*/
+#define ARITHMETIC_MAX6D_CASE_STRING_FMT() \
+    "n%" PRId64 "c%" PRId64 "h%" PRId64 "w%" PRId64 "_lmask%" PRId64 "rmask%" PRId64 "_op%" PRId64 "_n"
+
+typedef decltype(ppl::kernel::x86::add_ndarray_max6d_fp32_sse)* ppl_x86_arithmetic_max6d_func_t;
+
+struct arithmetic_max6d_bench_funcs {
+    ppl_x86_arithmetic_max6d_func_t op[5];
+};
+
+#define ARITHMETIC_MAX6D_BENCH_FUNCS(ISA) \
+    {{ppl::kernel::x86::add_ndarray_max6d_fp32_##ISA, ppl::kernel::x86::sub_ndarray_max6d_fp32_##ISA, \
+      ppl::kernel::x86::mul_ndarray_max6d_fp32_##ISA, ppl::kernel::x86::div_ndarray_max6d_fp32_##ISA, \
+      ppl::kernel::x86::pow_ndarray_max6d_fp32_##ISA}}
+
+class arithmetic_max6d_bench_case : public bench_case {
+public:
+    arithmetic_max6d_bench_case()
+    {
+        impls_ = {
+            {"sse", ARITHMETIC_MAX6D_BENCH_FUNCS(sse)},
+            {"avx", ARITHMETIC_MAX6D_BENCH_FUNCS(avx)},
+#ifdef PPL_USE_X86_AVX512
+            {"avx512", ARITHMETIC_MAX6D_BENCH_FUNCS(avx512)},
+#endif
+        };
+    }
+
+    bool parse(const char *line) override
+    {
+        return 8 == sscanf(line, ARITHMETIC_MAX6D_CASE_STRING_FMT() "%99s", &n_, &c_, &h_, &w_, &lmask_, &rmask_, &op_, name_) &&
+            n_ > 0 && c_ > 0 && h_ > 0 && w_ > 0 && lmask_ >= 0 && lmask_ < 16 && rmask_ >= 0 && rmask_ < 16 &&
+            op_ >= 0 && op_ <= 4;
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), ARITHMETIC_MAX6D_CASE_STRING_FMT() "%s", n_, c_, h_, w_, lmask_, rmask_, op_, name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        dims_ = {n_, c_, h_, w_};
+        bench_make_shape(bench_bcast_dims(dims_, lmask_), ppl::common::DATAFORMAT_NDARRAY, &lhs_shape_);
+        bench_make_shape(bench_bcast_dims(dims_, rmask_), ppl::common::DATAFORMAT_NDARRAY, &rhs_shape_);
+        if (!lhs_.alloc(lhs_shape_.CalcElementsExcludingPadding()) ||
+            !rhs_.alloc(rhs_shape_.CalcElementsExcludingPadding()) ||
+            !dst_.alloc(n_ * c_ * h_ * w_)) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        // positive bases for pow, no zero divisor for div
+        bench_fill_uniform(lhs_.data(), lhs_.size(), 0.5f, 2.0f);
+        bench_fill_uniform(rhs_.data(), rhs_.size(), 0.5f, 2.0f);
+        return ppl::common::RC_SUCCESS;
+    }
+
+    ppl::common::RetCode reference() override
+    {
+        if (!dst_ref_.alloc(dst_.size())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        for (int64_t i = 0; i < (int64_t)dst_.size(); ++i) {
+            const double l = lhs_.data()[bench_bcast_offset(dims_, lmask_, i)];
+            const double r = rhs_.data()[bench_bcast_offset(dims_, rmask_, i)];
+            double y = 0.0;
+            if (op_ == 0) y = l + r;
+            if (op_ == 1) y = l - r;
+            if (op_ == 2) y = l * r;
+            if (op_ == 3) y = l / r;
+            if (op_ == 4) y = pow(l, r);
+            dst_ref_.data()[i] = (float)y;
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    bool check(const float eps) override
+    {
+        return check_array_error(dst_.data(), dst_ref_.data(), dst_.size(), eps);
+    }
+
+    const void *output() const override
+    {
+        return dst_.data();
+    }
+
+    uint64_t output_bytes() const override
+    {
+        return dst_.bytes();
+    }
+
+    std::vector<std::string> impl_names() const override
+    {
+        std::vector<std::string> names;
+        for (auto &impl : impls_) {
+            names.push_back(impl.first);
+        }
+        return names;
+    }
+
+    bool select(const std::string &impl) override
+    {
+        func_ = nullptr;
+        for (auto &it : impls_) {
+            if (it.first == impl) {
+                func_ = it.second.op[op_];
+            }
+        }
+        return func_ != nullptr;
+    }
+
+    ppl::common::RetCode run() override
+    {
+        return func_(&lhs_shape_, &rhs_shape_, lhs_.data(), rhs_.data(), dst_.data());
+    }
+
+    double gops() const override
+    {
+        return dst_.size() / 1e9;
+    }
+
+    double gbytes() const override
+    {
+        return (lhs_.bytes() + rhs_.bytes() + dst_.bytes()) / 1e9;
+    }
+
+private:
+    int64_t n_, c_, h_, w_, lmask_, rmask_, op_;
+    char name_[100];
+    std::vector<int64_t> dims_;
+    ppl::common::TensorShape lhs_shape_, rhs_shape_;
+    bench_buffer<float> lhs_, rhs_, dst_, dst_ref_;
+    std::vector<std::pair<std::string, arithmetic_max6d_bench_funcs>> impls_;
+    ppl_x86_arithmetic_max6d_func_t func_ = nullptr;
+};
+
+bench_case *create_arithmetic_max6d_bench_case()
+{
+    return new arithmetic_max6d_bench_case();
+}
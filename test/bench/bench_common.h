@@ -0,0 +1,258 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PPL_KERNEL_X86_TEST_BENCH_BENCH_COMMON_H_
+#define __ST_PPL_KERNEL_X86_TEST_BENCH_BENCH_COMMON_H_
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <utility>
+#include <random>
+#include <inttypes.h>
+
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "ppl/common/generic_cpu_allocator.h"
+#include "ppl/common/tensor_shape.h"
+#include "utils/check.h"
+
+// One benchmark case is one line of an op config file.
+// The driver calls parse() -> prepare() -> [reference()] and then, for each
+// selected implementation: select() -> warm up run() -> timed run() -> [check()].
+class bench_case {
+public:
+    virtual ~bench_case() {}
+
+    // parse one config line, return false if the line does not match the op format
+    virtual bool parse(const char *line) = 0;
+    virtual std::string case_string() const = 0;
+
+    // allocate and fill inputs and outputs, called once per case
+    virtual ppl::common::RetCode prepare() = 0;
+    // compute the reference output, called once per case when validating,
+    // with the op's _ref kernel when the library has one, else plain loops
+    virtual ppl::common::RetCode reference() = 0;
+    // compare the output of the last run() with the reference output
+    virtual bool check(const float eps) = 0;
+    // output of the last run() for bitwise comparison, nullptr if the op does not expose one
+    virtual const void *output() const
+    {
+        return nullptr;
+    }
+    virtual uint64_t output_bytes() const
+    {
+        return 0;
+    }
+
+    virtual std::vector<std::string> impl_names() const = 0;
+    virtual bool select(const std::string &impl) = 0;
+    virtual ppl::common::RetCode run() = 0;
+
+    // workload of one run(), flops counts 1 for each add/mul/cmp/transcendental
+    virtual double gops() const = 0;
+    virtual double gbytes() const = 0;
+};
+
+// implementation table with the same layout as the func tables of test_gemm
+template <typename func_t>
+class bench_case_impl : public bench_case {
+public:
+    std::vector<std::string> impl_names() const override
+    {
+        std::vector<std::string> names;
+        for (auto &impl : impls_) {
+            names.push_back(impl.first);
+        }
+        return names;
+    }
+
+    bool select(const std::string &impl) override
+    {
+        for (auto &it : impls_) {
+            if (it.first == impl) {
+                func_ = it.second;
+                return true;
+            }
+        }
+        func_ = nullptr;
+        return false;
+    }
+
+protected:
+    std::vector<std::pair<std::string, func_t>> impls_;
+    func_t func_ = nullptr;
+};
+
+typedef bench_case *(*bench_case_creator_t)();
+
+struct bench_op {
+    const char *name;
+    const char *case_fmt;
+    bench_case_creator_t create;
+};
+
+template <typename T>
+class bench_buffer {
+public:
+    bench_buffer() : allocator_(PPL_X86_CACHELINE_BYTES()) {}
+    ~bench_buffer()
+    {
+        free();
+    }
+
+    bool alloc(const uint64_t num_elements)
+    {
+        free();
+        // never hand out a null pointer for empty tensors
+        data_ = (T *)allocator_.Alloc(std::max<uint64_t>(num_elements, 1) * sizeof(T));
+        size_ = data_ ? num_elements : 0;
+        return data_ != nullptr;
+    }
+
+    void free()
+    {
+        if (data_) {
+            allocator_.Free(data_);
+        }
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    T *data() const
+    {
+        return data_;
+    }
+
+    uint64_t size() const
+    {
+        return size_;
+    }
+
+    uint64_t bytes() const
+    {
+        return size_ * sizeof(T);
+    }
+
+private:
+    bench_buffer(const bench_buffer &) = delete;
+    bench_buffer &operator=(const bench_buffer &) = delete;
+
+    ppl::common::GenericCpuAllocator allocator_;
+    T *data_ = nullptr;
+    uint64_t size_ = 0;
+};
+
+// same data pattern as test_gemm, small integers keep fp32 sums exact
+inline void bench_fill_int(float *data, const uint64_t len, const int32_t mod = 7, const int32_t shift = -3, const float scale = 0.1f)
+{
+    for (uint64_t i = 0; i < len; ++i) {
+        data[i] = (rand() % mod + shift) * scale;
+    }
+}
+
+inline void bench_fill_uniform(float *data, const uint64_t len, const float lo, const float hi)
+{
+    for (uint64_t i = 0; i < len; ++i) {
+        data[i] = lo + (hi - lo) * (rand() / (float)RAND_MAX);
+    }
+}
+
+inline void bench_make_shape(
+    const std::vector<int64_t> &dims,
+    const ppl::common::dataformat_t format,
+    ppl::common::TensorShape *shape)
+{
+    shape->Reshape(dims);
+    shape->SetDataType(ppl::common::DATATYPE_FLOAT32);
+    shape->SetDataFormat(format);
+    shape->CalcPadding();
+}
+
+// dims of a broadcast input, bit i of bmask sets dim i to 1, e.g. bmask13 of nchw is [1, c, 1, 1]
+inline std::vector<int64_t> bench_bcast_dims(const std::vector<int64_t> &dims, const int64_t bmask)
+{
+    std::vector<int64_t> bcast_dims(dims);
+    for (size_t i = 0; i < dims.size(); ++i) {
+        if (bmask & (1 << i)) {
+            bcast_dims[i] = 1;
+        }
+    }
+    return bcast_dims;
+}
+
+// offset in the broadcast input of element idx of a dims shaped output
+inline int64_t bench_bcast_offset(const std::vector<int64_t> &dims, const int64_t bmask, int64_t idx)
+{
+    int64_t offset = 0;
+    int64_t stride = 1;
+    for (int64_t i = (int64_t)dims.size() - 1; i >= 0; --i) {
+        const int64_t d = idx % dims[i];
+        idx /= dims[i];
+        if (!(bmask & (1 << i))) {
+            offset += d * stride;
+            stride *= dims[i];
+        }
+    }
+    return offset;
+}
+
+// ops are declared here and listed in the op table of test_bench.cpp
+bench_case *create_add_bench_case();
+bench_case *create_mul_bench_case();
+bench_case *create_add_dst_view_bench_case();
+bench_case *create_fused_eltwise_bench_case();
+bench_case *create_softmax_bench_case();
+bench_case *create_reduce_sum_bench_case();
+bench_case *create_reduce_max_bench_case();
+bench_case *create_reduce_prod_bench_case();
+bench_case *create_reduce_l1_bench_case();
+bench_case *create_reduce_l2_bench_case();
+bench_case *create_reduce_sum_square_bench_case();
+bench_case *create_reduce_log_sum_exp_bench_case();
+bench_case *create_cumsum_bench_case();
+bench_case *create_transpose_bench_case();
+bench_case *create_transpose_int64_bench_case();
+bench_case *create_transpose_bool_bench_case();
+bench_case *create_reorder_bench_case();
+bench_case *create_maxpool2d_bench_case();
+bench_case *create_averagepool2d_bench_case();
+bench_case *create_resize2d_bench_case();
+bench_case *create_lstm_bench_case();
+bench_case *create_mmcv_nms_bench_case();
+bench_case *create_topk_bench_case();
+bench_case *create_gather_bench_case();
+bench_case *create_argmax_bench_case();
+bench_case *create_argmin_bench_case();
+bench_case *create_ir_conv2d_bench_case();
+bench_case *create_pd_conv2d_bench_case();
+bench_case *create_conv2d_slice_bench_case();
+bench_case *create_embedding_bag_bench_case();
+bench_case *create_grid_sample_bench_case();
+bench_case *create_mmcv_roialign_rotated_bench_case();
+bench_case *create_scatter_nd_bench_case();
+bench_case *create_scatter_elements_bench_case();
+bench_case *create_deform_conv2d_bench_case();
+bench_case *create_gemm_bench_case();
+bench_case *create_relation_bench_case();
+bench_case *create_where_bench_case();
+bench_case *create_arithmetic_max6d_bench_case();
+bench_case *create_concat_bench_case();
+bench_case *create_split_bench_case();
+bench_case *create_memory_copy_bench_case();
+bench_case *create_memory_init_bench_case();
+
+#endif
@@ -0,0 +1,195 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ppl/kernel/x86/fp32/concat.h"
+#include "ppl/kernel/x86/fp32/split.h"
+#include "ppl/kernel/x86/fp32/reorder.h"
+#include "bench/bench_common.h"
+
+/*
+    n16cx concat (split) of up to 3 tensors along channels, the parts have
+    c0, c1 and c2 channels, c2 0 for 2 parts. channel counts that are not a
+    multiple of 16 take the interleave channels kernels, noarch runs the
+    generic template.
+*/
+#define CONCAT_CASE_STRING_FMT() \
+    "n%" PRId64 "c%" PRId64 "c%" PRId64 "c%" PRId64 "h%" PRId64 "w%" PRId64 "_n"
+
+class concat_bench_case : public bench_case {
+public:
+    concat_bench_case(const bool is_split) : is_split_(is_split) {}
+
+    bool parse(const char *line) override
+    {
+        if (!(7 == sscanf(line, CONCAT_CASE_STRING_FMT() "%99s", &n_, &c_[0], &c_[1], &c_[2], &h_, &w_, name_) &&
+            n_ > 0 && c_[0] > 0 && c_[1] > 0 && c_[2] >= 0 && h_ > 0 && w_ > 0)) {
+            return false;
+        }
+        num_parts_ = c_[2] > 0 ? 3 : 2;
+        return true;
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), CONCAT_CASE_STRING_FMT() "%s", n_, c_[0], c_[1], c_[2], h_, w_, name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        ctot_ = c_[0] + c_[1] + c_[2];
+        bench_make_shape({n_, ctot_, h_, w_}, ppl::common::DATAFORMAT_NDARRAY, &full_nd_shape_);
+        bench_make_shape({n_, ctot_, h_, w_}, ppl::common::DATAFORMAT_N16CX, &full_shape_);
+        if (!full_nd_.alloc(full_nd_shape_.CalcElementsExcludingPadding()) ||
+            !full_.alloc(full_shape_.CalcElementsIncludingPadding())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        for (int32_t p = 0; p < num_parts_; ++p) {
+            bench_make_shape({n_, c_[p], h_, w_}, ppl::common::DATAFORMAT_NDARRAY, &part_nd_shapes_[p]);
+            bench_make_shape({n_, c_[p], h_, w_}, ppl::common::DATAFORMAT_N16CX, &part_shapes_[p]);
+            if (!part_nd_[p].alloc(part_nd_shapes_[p].CalcElementsExcludingPadding()) ||
+                !part_[p].alloc(part_shapes_[p].CalcElementsIncludingPadding())) {
+                return ppl::common::RC_OUT_OF_MEMORY;
+            }
+            part_shape_list_[p] = &part_shapes_[p];
+            part_list_[p] = part_[p].data();
+        }
+        // distinct values per element so a channel landing in the wrong slot shows up
+        for (uint64_t i = 0; i < full_nd_.size(); ++i) {
+            full_nd_.data()[i] = (float)i;
+        }
+        const int64_t hw = h_ * w_;
+        for (int64_t n = 0; n < n_; ++n) {
+            int64_t c_off = 0;
+            for (int32_t p = 0; p < num_parts_; ++p) {
+                memcpy(part_nd_[p].data() + n * c_[p] * hw, full_nd_.data() + (n * ctot_ + c_off) * hw, c_[p] * hw * sizeof(float));
+                c_off += c_[p];
+            }
+        }
+        if (is_split_) {
+            return ppl::kernel::x86::reorder_ndarray_n16cx_fp32(&full_nd_shape_, full_nd_.data(), full_.data());
+        }
+        for (int32_t p = 0; p < num_parts_; ++p) {
+            auto rc = ppl::kernel::x86::reorder_ndarray_n16cx_fp32(&part_nd_shapes_[p], part_nd_[p].data(), part_[p].data());
+            if (rc != ppl::common::RC_SUCCESS) {
+                return rc;
+            }
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    // the parts and the full tensor in ndarray are built in prepare()
+    ppl::common::RetCode reference() override
+    {
+        return ppl::common::RC_SUCCESS;
+    }
+
+    bool check(const float eps) override
+    {
+        if (!is_split_) {
+            return check_reordered(&full_shape_, full_.data(), full_nd_.data(), full_nd_.size());
+        }
+        for (int32_t p = 0; p < num_parts_; ++p) {
+            if (!check_reordered(&part_shapes_[p], part_[p].data(), part_nd_[p].data(), part_nd_[p].size())) {
+                return false;
+            }
+            if (p + 1 < num_parts_) {
+                std::cerr << " ";
+            }
+        }
+        return true;
+    }
+
+    std::vector<std::string> impl_names() const override
+    {
+#ifdef PPL_USE_X86_AVX512
+        return {"noarch", "avx", "avx512"};
+#else
+        return {"noarch", "avx"};
+#endif
+    }
+
+    bool select(const std::string &impl) override
+    {
+        isa_ = 0;
+        if (impl == "avx") {
+            isa_ = ppl::common::ISA_X86_AVX;
+        }
+#ifdef PPL_USE_X86_AVX512
+        if (impl == "avx512") {
+            isa_ = ppl::common::ISA_X86_AVX512;
+        }
+#endif
+        return impl == "noarch" || isa_ != 0;
+    }
+
+    ppl::common::RetCode run() override
+    {
+        if (is_split_) {
+            return ppl::kernel::x86::split_n16cx_interleave_channels_fp32(
+                isa_, &full_shape_, part_shape_list_, full_.data(), 1, num_parts_, 1, part_list_);
+        }
+        return ppl::kernel::x86::concat_n16cx_interleave_channels_fp32(
+            isa_, part_shape_list_, (const float **)part_list_, num_parts_, 1, 1, full_.data());
+    }
+
+    double gops() const override
+    {
+        return 0;
+    }
+
+    double gbytes() const override
+    {
+        return 2.0 * full_nd_.bytes() / 1e9;
+    }
+
+private:
+    bool check_reordered(const ppl::common::TensorShape *shape, const float *data, const float *ref, const uint64_t len)
+    {
+        bench_buffer<float> nd;
+        if (!nd.alloc(len) || ppl::common::RC_SUCCESS != ppl::kernel::x86::reorder_n16cx_ndarray_fp32(shape, data, nd.data())) {
+            std::cerr << "reorder dst failed";
+            return false;
+        }
+        return check_array_bitwise(nd.data(), ref, len);
+    }
+
+    const bool is_split_;
+    int64_t n_, c_[3], h_, w_;
+    int64_t ctot_ = 0;
+    int32_t num_parts_ = 0;
+    char name_[100];
+    ppl::common::isa_t isa_ = 0;
+    ppl::common::TensorShape full_nd_shape_, full_shape_, part_nd_shapes_[3], part_shapes_[3];
+    const ppl::common::TensorShape *part_shape_list_[3];
+    float *part_list_[3];
+    bench_buffer<float> full_nd_, full_, part_nd_[3], part_[3];
+};
+
+bench_case *create_concat_bench_case()
+{
+    return new concat_bench_case(false);
+}
+
+bench_case *create_split_bench_case()
+{
+    return new concat_bench_case(true);
+}
@@ -0,0 +1,716 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ppl/kernel/x86/fp32/conv2d.h"
+#include "ppl/kernel/x86/fp32/ir_conv2d.h"
+#include "ppl/kernel/x86/fp32/pd_conv2d.h"
+#include "ppl/kernel/x86/fp32/reorder.h"
+#include "ppl/common/generic_cpu_allocator.h"
+#include "bench/bench_common.h"
+
+// conv impls are isa masks handed to the algo selectors, not function pointers
+static ppl::common::isa_t bench_conv2d_isa_mask(const std::string &impl)
+{
+    ppl::common::isa_t isa = ppl::common::GetCpuISA();
+    if (impl != "avx512") {
+        isa &= ~(ppl::common::ISA_X86_AVX512);
+    }
+    if (impl == "sse") {
+        isa &= ~(ppl::common::ISA_X86_FMA);
+        isa &= ~(ppl::common::ISA_X86_AVX);
+    }
+    return isa;
+}
+
+// integers in [-3, 3] and filters in {-1, 0, 1} keep every fp32 sum exact
+static void bench_conv2d_fill(float *data, const uint64_t len, const bool is_filter)
+{
+    if (is_filter) {
+        bench_fill_int(data, len, 3, -1, 1.0f);
+    } else {
+        bench_fill_int(data, len, 7, -3, 1.0f);
+    }
+}
+
+static void bench_conv2d_make_param(
+    const int64_t channels,
+    const int64_t num_output,
+    const int64_t group,
+    const int64_t kernel,
+    const int64_t stride,
+    const int64_t act,
+    ppl::kernel::x86::conv2d_param *param)
+{
+    param->kernel_h   = kernel;
+    param->kernel_w   = kernel;
+    param->stride_h   = stride;
+    param->stride_w   = stride;
+    param->pad_h      = kernel / 2;
+    param->pad_w      = kernel / 2;
+    param->dilation_h = 1;
+    param->dilation_w = 1;
+    param->channels   = channels;
+    param->num_output = num_output;
+    param->group      = group;
+    param->fuse_flag  = 0;
+    if (act == 1) {
+        param->fuse_flag |= ppl::kernel::x86::conv_fuse_flag::RELU;
+    } else if (act == 6) {
+        param->fuse_flag |= ppl::kernel::x86::conv_fuse_flag::RELU6;
+    }
+}
+
+/*
+    n16cx conv2d on channel slices: reads channels [coff, coff + c) of a
+    ctot channel src and writes channels [ocoff, ocoff + oc) of an octot
+    channel dst through set_src_total_channels/set_dst_total_channels.
+    slices start on a multiple of 16 and only the last slice may end inside
+    a channel block, as concat_view.h requires. algo 0 lets the selector
+    choose, else it is a conv2d_algo value.
+*/
+#define CONV2D_SLICE_CASE_STRING_FMT() \
+    "n%" PRId64 "c%" PRId64 "h%" PRId64 "w%" PRId64 \
+    "_oc%" PRId64 "_k%" PRId64 "s%" PRId64 "_g%" PRId64 "_algo%" PRId64 \
+    "_ctot%" PRId64 "coff%" PRId64 "_octot%" PRId64 "ocoff%" PRId64 "_n"
+
+class conv2d_slice_bench_case : public bench_case {
+public:
+    ~conv2d_slice_bench_case()
+    {
+        release();
+    }
+
+    bool parse(const char *line) override
+    {
+        return 14 == sscanf(line, CONV2D_SLICE_CASE_STRING_FMT() "%99s", &n_, &c_, &h_, &w_,
+            &oc_, &k_, &s_, &g_, &algo_, &ctot_, &coff_, &octot_, &ocoff_, name_) &&
+            n_ > 0 && c_ > 0 && h_ > 0 && w_ > 0 && oc_ > 0 && k_ > 0 && k_ % 2 == 1 && s_ > 0 &&
+            g_ > 0 && c_ % g_ == 0 && oc_ % g_ == 0 && algo_ >= 0 &&
+            coff_ % 16 == 0 && coff_ + c_ <= ctot_ && (c_ % 16 == 0 || coff_ + c_ == ctot_) &&
+            ocoff_ % 16 == 0 && ocoff_ + oc_ <= octot_ && (oc_ % 16 == 0 || ocoff_ + oc_ == octot_);
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), CONV2D_SLICE_CASE_STRING_FMT() "%s", n_, c_, h_, w_,
+            oc_, k_, s_, g_, algo_, ctot_, coff_, octot_, ocoff_, name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        bench_conv2d_make_param(c_, oc_, g_, k_, s_, 0, &param_);
+        const int64_t dst_h = (h_ + 2 * param_.pad_h - k_) / s_ + 1;
+        const int64_t dst_w = (w_ + 2 * param_.pad_w - k_) / s_ + 1;
+
+        bench_make_shape({n_, ctot_, h_, w_}, ppl::common::DATAFORMAT_NDARRAY, &src_all_nd_shape_);
+        bench_make_shape({n_, octot_, dst_h, dst_w}, ppl::common::DATAFORMAT_NDARRAY, &dst_all_nd_shape_);
+        bench_make_shape({n_, ctot_, h_, w_}, ppl::common::DATAFORMAT_N16CX, &src_all_shape_);
+        bench_make_shape({n_, octot_, dst_h, dst_w}, ppl::common::DATAFORMAT_N16CX, &dst_all_shape_);
+        bench_make_shape({n_, c_, h_, w_}, ppl::common::DATAFORMAT_NDARRAY, &src_nd_shape_);
+        bench_make_shape({n_, oc_, dst_h, dst_w}, ppl::common::DATAFORMAT_NDARRAY, &dst_nd_shape_);
+        bench_make_shape({n_, c_, h_, w_}, ppl::common::DATAFORMAT_N16CX, &src_shape_);
+        bench_make_shape({n_, oc_, dst_h, dst_w}, ppl::common::DATAFORMAT_N16CX, &dst_shape_);
+
+        if (!src_all_nd_.alloc(src_all_nd_shape_.CalcElementsExcludingPadding()) ||
+            !src_all_.alloc(src_all_shape_.CalcElementsIncludingPadding()) ||
+            !dst_all_.alloc(dst_all_shape_.CalcElementsIncludingPadding()) ||
+            !filter_.alloc(oc_ * (c_ / g_) * k_ * k_) || !bias_.alloc(oc_)) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        bench_conv2d_fill(src_all_nd_.data(), src_all_nd_.size(), false);
+        bench_conv2d_fill(filter_.data(), filter_.size(), true);
+        bench_conv2d_fill(bias_.data(), bias_.size(), true);
+        // channels out of the dst slice must keep this value
+        for (uint64_t i = 0; i < dst_all_.size(); ++i) {
+            dst_all_.data()[i] = guard_value();
+        }
+        return ppl::kernel::x86::reorder_ndarray_n16cx_fp32(&src_all_nd_shape_, src_all_nd_.data(), src_all_.data());
+    }
+
+    ppl::common::RetCode reference() override
+    {
+        bench_buffer<float> src;
+        if (!src.alloc(src_nd_shape_.CalcElementsExcludingPadding()) ||
+            !dst_ref_.alloc(dst_nd_shape_.CalcElementsExcludingPadding()) ||
+            !dst_all_nd_.alloc(dst_all_nd_shape_.CalcElementsExcludingPadding())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        const int64_t hw = h_ * w_;
+        for (int64_t n = 0; n < n_; ++n) {
+            memcpy(src.data() + n * c_ * hw, src_all_nd_.data() + (n * ctot_ + coff_) * hw, c_ * hw * sizeof(float));
+        }
+        return ppl::kernel::x86::conv2d_fp32_ref(&src_nd_shape_, nullptr, &dst_nd_shape_,
+            src.data(), nullptr, filter_.data(), bias_.data(), param_, dst_ref_.data());
+    }
+
+    bool check(const float eps) override
+    {
+        if (ppl::common::RC_SUCCESS != ppl::kernel::x86::reorder_n16cx_ndarray_fp32(&dst_all_shape_, dst_all_.data(), dst_all_nd_.data())) {
+            std::cerr << "reorder dst failed";
+            return false;
+        }
+        const int64_t ohw = dst_nd_shape_.GetDim(2) * dst_nd_shape_.GetDim(3);
+        for (int64_t n = 0; n < n_; ++n) {
+            for (int64_t c = 0; c < octot_; ++c) {
+                if (c >= ocoff_ && c < ocoff_ + oc_) {
+                    continue;
+                }
+                const float *l_dst = dst_all_nd_.data() + (n * octot_ + c) * ohw;
+                for (int64_t i = 0; i < ohw; ++i) {
+                    if (l_dst[i] != guard_value()) {
+                        std::cerr << "channel " << c << " out of the dst slice was written";
+                        return false;
+                    }
+                }
+            }
+        }
+        bench_buffer<float> dst;
+        if (!dst.alloc(dst_ref_.size())) {
+            std::cerr << "out of memory";
+            return false;
+        }
+        for (int64_t n = 0; n < n_; ++n) {
+            memcpy(dst.data() + n * oc_ * ohw, dst_all_nd_.data() + (n * octot_ + ocoff_) * ohw, oc_ * ohw * sizeof(float));
+        }
+        // winograd transforms round the exact integer sums of the other algos
+        const float algo_eps = winograd_ ? std::max(eps, 1e-3f) : eps;
+        return check_array_error(dst.data(), dst_ref_.data(), dst_ref_.size(), algo_eps);
+    }
+
+    std::vector<std::string> impl_names() const override
+    {
+#ifdef PPL_USE_X86_AVX512
+        return {"fma", "avx512"};
+#else
+        return {"fma"};
+#endif
+    }
+
+    bool select(const std::string &impl) override
+    {
+        release();
+        const ppl::common::isa_t isa = bench_conv2d_isa_mask(impl);
+        ppl::kernel::x86::conv2d_algo_info algo = ppl::kernel::x86::conv2d_fp32_algo_selector::select_algo(ppl::common::DATAFORMAT_N16CX, param_, isa);
+        if (algo_ != 0) {
+            algo.algo_type = (ppl::kernel::x86::conv2d_algo_t)algo_;
+        }
+        if (algo.algo_type == ppl::kernel::x86::conv2d_algo::UNKNOWN ||
+            algo.input_format != ppl::common::DATAFORMAT_N16CX ||
+            algo.output_format != ppl::common::DATAFORMAT_N16CX) {
+            return false;
+        }
+        winograd_ = algo.algo_type >= ppl::kernel::x86::conv2d_algo::WINOGRAD_B2F3;
+        mgr_ = ppl::kernel::x86::conv2d_fp32_algo_selector::gen_algo(param_, algo, &allocator_);
+        if (!mgr_ || ppl::common::RC_SUCCESS != mgr_->gen_cvt_weights(filter_.data(), bias_.data())) {
+            return false;
+        }
+        exe_ = mgr_->gen_executor();
+        exe_->set_src_shape(&src_shape_);
+        exe_->set_dst_shape(&dst_shape_);
+        exe_->set_src_total_channels(ctot_);
+        exe_->set_dst_total_channels(octot_);
+        if (ppl::common::RC_SUCCESS != exe_->prepare() || !temp_.alloc(exe_->cal_temp_buffer_size())) {
+            return false;
+        }
+        exe_->set_temp_buffer(temp_.data());
+        // an n16cx channel slice starts coff / 16 channel blocks in
+        exe_->set_src(src_all_.data() + coff_ * h_ * w_);
+        exe_->set_dst(dst_all_.data() + ocoff_ * dst_shape_.GetDim(2) * dst_shape_.GetDim(3));
+        return true;
+    }
+
+    ppl::common::RetCode run() override
+    {
+        if (!exe_) {
+            return ppl::common::RC_UNSUPPORTED;
+        }
+        return exe_->execute();
+    }
+
+    double gops() const override
+    {
+        return 2.0 * dst_nd_shape_.CalcElementsExcludingPadding() * (c_ / g_) * k_ * k_ / 1e9;
+    }
+
+    double gbytes() const override
+    {
+        return (src_shape_.CalcBytesIncludingPadding() + dst_shape_.CalcBytesIncludingPadding() + filter_.bytes()) / 1e9;
+    }
+
+private:
+    static float guard_value()
+    {
+        return 12345.0f;
+    }
+
+    void release()
+    {
+        if (exe_) {
+            delete exe_;
+            exe_ = nullptr;
+        }
+        if (mgr_) {
+            mgr_->release_cvt_weights();
+            delete mgr_;
+            mgr_ = nullptr;
+        }
+    }
+
+    int64_t n_, c_, h_, w_, oc_, k_, s_, g_, algo_, ctot_, coff_, octot_, ocoff_;
+    bool winograd_ = false;
+    char name_[100];
+    ppl::kernel::x86::conv2d_param param_;
+    ppl::common::TensorShape src_all_nd_shape_, dst_all_nd_shape_, src_all_shape_, dst_all_shape_;
+    ppl::common::TensorShape src_nd_shape_, dst_nd_shape_, src_shape_, dst_shape_;
+    bench_buffer<float> src_all_nd_, src_all_, dst_all_, dst_all_nd_, dst_ref_, filter_, bias_;
+    bench_buffer<uint8_t> temp_;
+    ppl::common::GenericCpuAllocator allocator_;
+    ppl::kernel::x86::conv2d_fp32_manager *mgr_ = nullptr;
+    ppl::kernel::x86::conv2d_fp32_executor *exe_ = nullptr;
+};
+
+/*
+    inverted residual block: 1x1 expand to hid channels, kxk depthwise with
+    stride s, 1x1 project to oc channels, act 0/1/6 fuses none/relu/relu6
+    after expand and depthwise, res 1 adds src to the project output.
+    the reference is conv2d_fp32_ref on ndarray for each of the three convs.
+*/
+#define IR_CONV2D_CASE_STRING_FMT() \
+    "n%" PRId64 "c%" PRId64 "h%" PRId64 "w%" PRId64 \
+    "_hid%" PRId64 "_k%" PRId64 "s%" PRId64 "_oc%" PRId64 \
+    "_act%" PRId64 "_res%" PRId64 "_n"
+
+class ir_conv2d_bench_case : public bench_case {
+public:
+    ~ir_conv2d_bench_case()
+    {
+        release();
+    }
+
+    bool parse(const char *line) override
+    {
+        return 11 == sscanf(line, IR_CONV2D_CASE_STRING_FMT() "%99s", &n_, &c_, &h_, &w_,
+            &hid_, &k_, &s_, &oc_, &act_, &res_, name_) &&
+            n_ > 0 && c_ > 0 && h_ > 0 && w_ > 0 && hid_ > 0 && k_ > 0 && k_ % 2 == 1 &&
+            s_ > 0 && oc_ > 0 && (act_ == 0 || act_ == 1 || act_ == 6) &&
+            (res_ == 0 || (res_ == 1 && s_ == 1 && oc_ == c_));
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), IR_CONV2D_CASE_STRING_FMT() "%s", n_, c_, h_, w_,
+            hid_, k_, s_, oc_, act_, res_, name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        bench_conv2d_make_param(c_, hid_, 1, 1, 1, act_, &ex_param_);
+        bench_conv2d_make_param(hid_, hid_, hid_, k_, s_, act_, &dw_param_);
+        bench_conv2d_make_param(hid_, oc_, 1, 1, 1, 0, &pj_param_);
+        if (res_) {
+            pj_param_.fuse_flag |= ppl::kernel::x86::conv_fuse_flag::SUM;
+        }
+        const int64_t dst_h = (h_ + 2 * dw_param_.pad_h - k_) / s_ + 1;
+        const int64_t dst_w = (w_ + 2 * dw_param_.pad_w - k_) / s_ + 1;
+
+        bench_make_shape({n_, c_, h_, w_}, ppl::common::DATAFORMAT_NDARRAY, &src_nd_shape_);
+        bench_make_shape({n_, hid_, h_, w_}, ppl::common::DATAFORMAT_NDARRAY, &ex_nd_shape_);
+        bench_make_shape({n_, hid_, dst_h, dst_w}, ppl::common::DATAFORMAT_NDARRAY, &dw_nd_shape_);
+        bench_make_shape({n_, oc_, dst_h, dst_w}, ppl::common::DATAFORMAT_NDARRAY, &dst_nd_shape_);
+        bench_make_shape({n_, c_, h_, w_}, ppl::common::DATAFORMAT_N16CX, &src_shape_);
+        bench_make_shape({n_, oc_, dst_h, dst_w}, ppl::common::DATAFORMAT_N16CX, &dst_shape_);
+
+        if (!src_nd_.alloc(src_nd_shape_.CalcElementsExcludingPadding()) ||
+            !src_.alloc(src_shape_.CalcElementsIncludingPadding()) ||
+            !dst_.alloc(dst_shape_.CalcElementsIncludingPadding()) ||
+            !ex_filter_.alloc(hid_ * c_) || !ex_bias_.alloc(hid_) ||
+            !dw_filter_.alloc(hid_ * k_ * k_) || !dw_bias_.alloc(hid_) ||
+            !pj_filter_.alloc(oc_ * hid_) || !pj_bias_.alloc(oc_)) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        bench_conv2d_fill(src_nd_.data(), src_nd_.size(), false);
+        bench_conv2d_fill(ex_filter_.data(), ex_filter_.size(), true);
+        bench_conv2d_fill(ex_bias_.data(), ex_bias_.size(), true);
+        bench_conv2d_fill(dw_filter_.data(), dw_filter_.size(), true);
+        bench_conv2d_fill(dw_bias_.data(), dw_bias_.size(), true);
+        bench_conv2d_fill(pj_filter_.data(), pj_filter_.size(), true);
+        bench_conv2d_fill(pj_bias_.data(), pj_bias_.size(), true);
+        return ppl::kernel::x86::reorder_ndarray_n16cx_fp32(&src_nd_shape_, src_nd_.data(), src_.data());
+    }
+
+    ppl::common::RetCode reference() override
+    {
+        bench_buffer<float> ex, dw;
+        if (!ex.alloc(ex_nd_shape_.CalcElementsExcludingPadding()) ||
+            !dw.alloc(dw_nd_shape_.CalcElementsExcludingPadding()) ||
+            !dst_ref_.alloc(dst_nd_shape_.CalcElementsExcludingPadding()) ||
+            !dst_nd_.alloc(dst_nd_shape_.CalcElementsExcludingPadding())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        auto ret = ppl::kernel::x86::conv2d_fp32_ref(&src_nd_shape_, nullptr, &ex_nd_shape_,
+            src_nd_.data(), nullptr, ex_filter_.data(), ex_bias_.data(), ex_param_, ex.data());
+        if (ppl::common::RC_SUCCESS != ret) {
+            return ret;
+        }
+        ret = ppl::kernel::x86::conv2d_fp32_ref(&ex_nd_shape_, nullptr, &dw_nd_shape_,
+            ex.data(), nullptr, dw_filter_.data(), dw_bias_.data(), dw_param_, dw.data());
+        if (ppl::common::RC_SUCCESS != ret) {
+            return ret;
+        }
+        return ppl::kernel::x86::conv2d_fp32_ref(&dw_nd_shape_, &src_nd_shape_, &dst_nd_shape_,
+            dw.data(), src_nd_.data(), pj_filter_.data(), pj_bias_.data(), pj_param_, dst_ref_.data());
+    }
+
+    bool check(const float eps) override
+    {
+        if (ppl::common::RC_SUCCESS != ppl::kernel::x86::reorder_n16cx_ndarray_fp32(&dst_shape_, dst_.data(), dst_nd_.data())) {
+            std::cerr << "reorder dst failed";
+            return false;
+        }
+        return check_array_error(dst_nd_.data(), dst_ref_.data(), dst_ref_.size(), eps);
+    }
+
+    std::vector<std::string> impl_names() const override
+    {
+#ifdef PPL_USE_X86_AVX512
+        return {"fma", "avx512"};
+#else
+        return {"fma"};
+#endif
+    }
+
+    bool select(const std::string &impl) override
+    {
+        release();
+        const ppl::common::isa_t isa = bench_conv2d_isa_mask(impl);
+        const auto ex_algo = ppl::kernel::x86::conv2d_fp32_algo_selector::select_algo(ppl::common::DATAFORMAT_N16CX, ex_param_, isa);
+        const auto dw_algo = ppl::kernel::x86::conv2d_fp32_algo_selector::select_algo(ppl::common::DATAFORMAT_N16CX, dw_param_, isa);
+        const auto pj_algo = ppl::kernel::x86::conv2d_fp32_algo_selector::select_algo(ppl::common::DATAFORMAT_N16CX, pj_param_, isa);
+        const auto algo = ppl::kernel::x86::ir_conv2d_algo_selector::select_algo(ex_algo, dw_algo, pj_algo, ex_param_, dw_param_, pj_param_);
+        if (algo.algo_type == ppl::kernel::x86::ir_conv2d_fp32_algo::UNKNOWN) {
+            return false;
+        }
+        mgr_ = ppl::kernel::x86::ir_conv2d_algo_selector::gen_algo(ex_param_, dw_param_, pj_param_, algo, &allocator_);
+        if (!mgr_ || ppl::common::RC_SUCCESS != mgr_->gen_cvt_weights(
+                ex_filter_.data(), ex_bias_.data(), dw_filter_.data(), dw_bias_.data(), pj_filter_.data(), pj_bias_.data())) {
+            return false;
+        }
+        exe_ = mgr_->gen_executor();
+        exe_->set_src_shape(&src_shape_);
+        exe_->set_dst_shape(&dst_shape_);
+        if (res_) {
+            exe_->set_sum_src_shape(&src_shape_);
+            exe_->set_sum_src(src_.data());
+        }
+        if (ppl::common::RC_SUCCESS != exe_->prepare() || !temp_.alloc(exe_->cal_temp_buffer_size())) {
+            return false;
+        }
+        exe_->set_temp_buffer(temp_.data());
+        exe_->set_src(src_.data());
+        exe_->set_dst(dst_.data());
+        return true;
+    }
+
+    ppl::common::RetCode run() override
+    {
+        if (!exe_) {
+            return ppl::common::RC_UNSUPPORTED;
+        }
+        return exe_->execute();
+    }
+
+    double gops() const override
+    {
+        const double src_hw = h_ * w_;
+        const double dst_hw = dst_shape_.GetDim(2) * dst_shape_.GetDim(3);
+        return n_ * (2.0 * src_hw * c_ * hid_ + 2.0 * dst_hw * hid_ * k_ * k_ + 2.0 * dst_hw * hid_ * oc_) / 1e9;
+    }
+
+    double gbytes() const override
+    {
+        return (src_shape_.CalcBytesIncludingPadding() * (res_ ? 2 : 1) + dst_shape_.CalcBytesIncludingPadding() +
+            ex_filter_.bytes() + dw_filter_.bytes() + pj_filter_.bytes()) / 1e9;
+    }
+
+private:
+    void release()
+    {
+        if (exe_) {
+            delete exe_->expand_conv2d_executor();
+            delete exe_->depthwise_conv2d_executor();
+            delete exe_->project_conv2d_executor();
+            delete exe_;
+            exe_ = nullptr;
+        }
+        if (mgr_) {
+            mgr_->release_cvt_weights();
+            delete mgr_->expand_conv2d_manager();
+            delete mgr_->depthwise_conv2d_manager();
+            delete mgr_->project_conv2d_manager();
+            delete mgr_;
+            mgr_ = nullptr;
+        }
+    }
+
+    int64_t n_, c_, h_, w_, hid_, k_, s_, oc_, act_, res_;
+    char name_[100];
+    ppl::kernel::x86::conv2d_param ex_param_, dw_param_, pj_param_;
+    ppl::common::TensorShape src_nd_shape_, ex_nd_shape_, dw_nd_shape_, dst_nd_shape_;
+    ppl::common::TensorShape src_shape_, dst_shape_;
+    bench_buffer<float> src_nd_, src_, dst_, dst_nd_, dst_ref_;
+    bench_buffer<float> ex_filter_, ex_bias_, dw_filter_, dw_bias_, pj_filter_, pj_bias_;
+    bench_buffer<uint8_t> temp_;
+    ppl::common::GenericCpuAllocator allocator_;
+    ppl::kernel::x86::ir_conv2d_fp32_manager *mgr_ = nullptr;
+    ppl::kernel::x86::ir_conv2d_fp32_executor *exe_ = nullptr;
+};
+
+/*
+    depthwise kxk conv with stride s followed by a 1x1 conv to oc channels,
+    the pair pd_conv2d fuses into DEPTHWISE_GEMM_DIRECT. act 0/1/6 fuses
+    none/relu/relu6 into both convs, sum 1 adds a dst shaped tensor to the
+    1x1 output. sse runs the n8cx kernels, fma and avx512 the n16cx ones.
+*/
+#define PD_CONV2D_CASE_STRING_FMT() \
+    "n%" PRId64 "c%" PRId64 "h%" PRId64 "w%" PRId64 \
+    "_k%" PRId64 "s%" PRId64 "_oc%" PRId64 \
+    "_act%" PRId64 "_sum%" PRId64 "_n"
+
+class pd_conv2d_bench_case : public bench_case {
+public:
+    ~pd_conv2d_bench_case()
+    {
+        release();
+    }
+
+    bool parse(const char *line) override
+    {
+        return 10 == sscanf(line, PD_CONV2D_CASE_STRING_FMT() "%99s", &n_, &c_, &h_, &w_,
+            &k_, &s_, &oc_, &act_, &sum_, name_) &&
+            n_ > 0 && c_ > 0 && h_ > 0 && w_ > 0 && k_ > 0 && k_ % 2 == 1 &&
+            s_ > 0 && oc_ > 0 && (act_ == 0 || act_ == 1 || act_ == 6) && (sum_ == 0 || sum_ == 1);
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), PD_CONV2D_CASE_STRING_FMT() "%s", n_, c_, h_, w_,
+            k_, s_, oc_, act_, sum_, name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        bench_conv2d_make_param(c_, c_, c_, k_, s_, act_, &dw_param_);
+        bench_conv2d_make_param(c_, oc_, 1, 1, 1, act_, &pw_param_);
+        if (sum_) {
+            pw_param_.fuse_flag |= ppl::kernel::x86::conv_fuse_flag::SUM;
+        }
+        const int64_t dst_h = (h_ + 2 * dw_param_.pad_h - k_) / s_ + 1;
+        const int64_t dst_w = (w_ + 2 * dw_param_.pad_w - k_) / s_ + 1;
+
+        bench_make_shape({n_, c_, h_, w_}, ppl::common::DATAFORMAT_NDARRAY, &src_nd_shape_);
+        bench_make_shape({n_, c_, dst_h, dst_w}, ppl::common::DATAFORMAT_NDARRAY, &dw_nd_shape_);
+        bench_make_shape({n_, oc_, dst_h, dst_w}, ppl::common::DATAFORMAT_NDARRAY, &dst_nd_shape_);
+
+        if (!src_nd_.alloc(src_nd_shape_.CalcElementsExcludingPadding()) ||
+            !sum_nd_.alloc(sum_ ? dst_nd_shape_.CalcElementsExcludingPadding() : 0) ||
+            !dw_filter_.alloc(c_ * k_ * k_) || !dw_bias_.alloc(c_) ||
+            !pw_filter_.alloc(oc_ * c_) || !pw_bias_.alloc(oc_)) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        bench_conv2d_fill(src_nd_.data(), src_nd_.size(), false);
+        bench_conv2d_fill(sum_nd_.data(), sum_nd_.size(), false);
+        bench_conv2d_fill(dw_filter_.data(), dw_filter_.size(), true);
+        bench_conv2d_fill(dw_bias_.data(), dw_bias_.size(), true);
+        bench_conv2d_fill(pw_filter_.data(), pw_filter_.size(), true);
+        bench_conv2d_fill(pw_bias_.data(), pw_bias_.size(), true);
+        return ppl::common::RC_SUCCESS;
+    }
+
+    ppl::common::RetCode reference() override
+    {
+        bench_buffer<float> dw;
+        if (!dw.alloc(dw_nd_shape_.CalcElementsExcludingPadding()) ||
+            !dst_ref_.alloc(dst_nd_shape_.CalcElementsExcludingPadding()) ||
+            !dst_nd_.alloc(dst_nd_shape_.CalcElementsExcludingPadding())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        auto ret = ppl::kernel::x86::conv2d_fp32_ref(&src_nd_shape_, nullptr, &dw_nd_shape_,
+            src_nd_.data(), nullptr, dw_filter_.data(), dw_bias_.data(), dw_param_, dw.data());
+        if (ppl::common::RC_SUCCESS != ret) {
+            return ret;
+        }
+        return ppl::kernel::x86::conv2d_fp32_ref(&dw_nd_shape_, sum_ ? &dst_nd_shape_ : nullptr, &dst_nd_shape_,
+            dw.data(), sum_nd_.data(), pw_filter_.data(), pw_bias_.data(), pw_param_, dst_ref_.data());
+    }
+
+    bool check(const float eps) override
+    {
+        if (ppl::common::RC_SUCCESS != reorder_to_ndarray(&dst_shape_, dst_.data(), dst_nd_.data())) {
+            std::cerr << "reorder dst failed";
+            return false;
+        }
+        return check_array_error(dst_nd_.data(), dst_ref_.data(), dst_ref_.size(), eps);
+    }
+
+    std::vector<std::string> impl_names() const override
+    {
+#ifdef PPL_USE_X86_AVX512
+        return {"sse", "fma", "avx512"};
+#else
+        return {"sse", "fma"};
+#endif
+    }
+
+    bool select(const std::string &impl) override
+    {
+        release();
+        const ppl::common::isa_t isa = bench_conv2d_isa_mask(impl);
+        const auto dw_algo = ppl::kernel::x86::conv2d_fp32_algo_selector::select_algo(ppl::common::DATAFORMAT_N16CX, dw_param_, isa);
+        const auto pw_algo = ppl::kernel::x86::conv2d_fp32_algo_selector::select_algo(ppl::common::DATAFORMAT_N16CX, pw_param_, isa);
+        const auto algo = ppl::kernel::x86::pd_conv2d_algo_selector::select_algo(dw_algo, pw_algo, dw_param_, pw_param_);
+        if (algo.algo_type != ppl::kernel::x86::pd_conv2d_fp32_algo::DEPTHWISE_GEMM_DIRECT) {
+            return false;
+        }
+        // blocked layout of the selected kernels, n8cx for sse
+        bench_make_shape({n_, c_, h_, w_}, algo.input_format, &src_shape_);
+        bench_make_shape({n_, oc_, dst_nd_shape_.GetDim(2), dst_nd_shape_.GetDim(3)}, algo.output_format, &dst_shape_);
+        if (!src_.alloc(src_shape_.CalcElementsIncludingPadding()) ||
+            !dst_.alloc(dst_shape_.CalcElementsIncludingPadding()) ||
+            !sum_src_.alloc(sum_ ? dst_shape_.CalcElementsIncludingPadding() : 0) ||
+            ppl::common::RC_SUCCESS != reorder_from_ndarray(&src_nd_shape_, algo.input_format, src_nd_.data(), src_.data()) ||
+            (sum_ && ppl::common::RC_SUCCESS != reorder_from_ndarray(&dst_nd_shape_, algo.output_format, sum_nd_.data(), sum_src_.data()))) {
+            return false;
+        }
+
+        mgr_ = ppl::kernel::x86::pd_conv2d_algo_selector::gen_algo(pw_param_, dw_param_, algo, &allocator_);
+        if (!mgr_ || ppl::common::RC_SUCCESS != mgr_->gen_cvt_weights(
+                pw_filter_.data(), pw_bias_.data(), dw_filter_.data(), dw_bias_.data())) {
+            return false;
+        }
+        exe_ = mgr_->gen_executor();
+        exe_->set_src_shape(&src_shape_);
+        exe_->set_dst_shape(&dst_shape_);
+        if (sum_) {
+            exe_->set_sum_src_shape(&dst_shape_);
+            exe_->set_sum_src(sum_src_.data());
+        }
+        if (ppl::common::RC_SUCCESS != exe_->prepare() || !temp_.alloc(exe_->cal_temp_buffer_size())) {
+            return false;
+        }
+        exe_->set_temp_buffer(temp_.data());
+        exe_->set_src(src_.data());
+        exe_->set_dst(dst_.data());
+        return true;
+    }
+
+    ppl::common::RetCode run() override
+    {
+        if (!exe_) {
+            return ppl::common::RC_UNSUPPORTED;
+        }
+        return exe_->execute();
+    }
+
+    double gops() const override
+    {
+        const double dst_hw = dst_nd_shape_.GetDim(2) * dst_nd_shape_.GetDim(3);
+        return n_ * (2.0 * dst_hw * c_ * k_ * k_ + 2.0 * dst_hw * c_ * oc_) / 1e9;
+    }
+
+    double gbytes() const override
+    {
+        return (src_nd_.bytes() + dst_nd_shape_.CalcBytesExcludingPadding() * (sum_ ? 2 : 1) +
+            dw_filter_.bytes() + pw_filter_.bytes()) / 1e9;
+    }
+
+private:
+    static ppl::common::RetCode reorder_from_ndarray(
+        const ppl::common::TensorShape *nd_shape,
+        const ppl::common::dataformat_t format,
+        const float *src,
+        float *dst)
+    {
+        if (format == ppl::common::DATAFORMAT_N8CX) {
+            return ppl::kernel::x86::reorder_ndarray_n8cx_fp32(nd_shape, src, dst);
+        }
+        return ppl::kernel::x86::reorder_ndarray_n16cx_fp32(nd_shape, src, dst);
+    }
+
+    static ppl::common::RetCode reorder_to_ndarray(
+        const ppl::common::TensorShape *shape,
+        const float *src,
+        float *dst)
+    {
+        if (shape->GetDataFormat() == ppl::common::DATAFORMAT_N8CX) {
+            return ppl::kernel::x86::reorder_n8cx_ndarray_fp32(shape, src, dst);
+        }
+        return ppl::kernel::x86::reorder_n16cx_ndarray_fp32(shape, src, dst);
+    }
+
+    void release()
+    {
+        if (exe_) {
+            delete exe_->conv2d_executor();
+            delete exe_->depthwise_conv2d_executor();
+            delete exe_;
+            exe_ = nullptr;
+        }
+        if (mgr_) {
+            mgr_->release_cvt_weights();
+            delete mgr_->conv2d_manager();
+            delete mgr_->depthwise_conv2d_manager();
+            delete mgr_;
+            mgr_ = nullptr;
+        }
+    }
+
+    int64_t n_, c_, h_, w_, k_, s_, oc_, act_, sum_;
+    char name_[100];
+    ppl::kernel::x86::conv2d_param dw_param_, pw_param_;
+    ppl::common::TensorShape src_nd_shape_, dw_nd_shape_, dst_nd_shape_;
+    ppl::common::TensorShape src_shape_, dst_shape_;
+    bench_buffer<float> src_nd_, sum_nd_, src_, sum_src_, dst_, dst_nd_, dst_ref_;
+    bench_buffer<float> dw_filter_, dw_bias_, pw_filter_, pw_bias_;
+    bench_buffer<uint8_t> temp_;
+    ppl::common::GenericCpuAllocator allocator_;
+    ppl::kernel::x86::pd_conv2d_fp32_manager *mgr_ = nullptr;
+    ppl::kernel::x86::pd_conv2d_fp32_executor *exe_ = nullptr;
+};
+
+bench_case *create_ir_conv2d_bench_case()
+{
+    return new ir_conv2d_bench_case();
+}
+
+bench_case *create_pd_conv2d_bench_case()
+{
+    return new pd_conv2d_bench_case();
+}
+
+bench_case *create_conv2d_slice_bench_case()
+{
+    return new conv2d_slice_bench_case();
+}
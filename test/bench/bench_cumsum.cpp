@@ -0,0 +1,181 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <stdio.h>
+
+#include "ppl/kernel/x86/fp32/cumsum.h"
+#include "ppl/kernel/x86/int64/cumsum.h"
+#include "bench/bench_common.h"
+
+// scan the middle axis of [outer, len, inner]
+#define CUMSUM_CASE_STRING_FMT() \
+    "outer%" PRId64 "len%" PRId64 "inner%" PRId64 "_ex%" PRId64 "rev%" PRId64 "_data%" PRId64 "_n"
+
+typedef decltype(ppl::kernel::x86::cumsum_ndarray_fp32_sse)* ppl_x86_cumsum_fp32_func_t;
+
+/*
+    data 0: fp32 small integers with a positive drift, every prefix sum is
+    exact in fp32 and the output must match the reference bits.
+    data 1: fp32 uniform values in [0, 1], rounding depends on how the axis
+    is cut into blocks, which is what -reproducible compares.
+    data 2: int64 with the integers of data 0.
+*/
+class cumsum_bench_case : public bench_case_impl<ppl_x86_cumsum_fp32_func_t> {
+public:
+    cumsum_bench_case()
+    {
+        impls_ = {
+            {"noarch", ppl::kernel::x86::cumsum_ndarray_fp32},
+            {"sse", ppl::kernel::x86::cumsum_ndarray_fp32_sse},
+            {"fma", ppl::kernel::x86::cumsum_ndarray_fp32_fma},
+#ifdef PPL_USE_X86_AVX512
+            {"avx512", ppl::kernel::x86::cumsum_ndarray_fp32_avx512},
+#endif
+        };
+    }
+
+    bool parse(const char *line) override
+    {
+        return 7 == sscanf(line, CUMSUM_CASE_STRING_FMT() "%99s", &outer_, &len_, &inner_, &exclusive_, &reverse_, &data_, name_) &&
+            outer_ > 0 && len_ > 0 && inner_ > 0 && (exclusive_ == 0 || exclusive_ == 1) &&
+            (reverse_ == 0 || reverse_ == 1) && data_ >= 0 && data_ <= 2;
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), CUMSUM_CASE_STRING_FMT() "%s", outer_, len_, inner_, exclusive_, reverse_, data_, name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        bench_make_shape({outer_, len_, inner_}, ppl::common::DATAFORMAT_NDARRAY, &x_shape_);
+        if (data_ == 2) {
+            x_shape_.SetDataType(ppl::common::DATATYPE_INT64);
+        }
+        const uint64_t len = outer_ * len_ * inner_;
+        if (!x_.alloc(len) || !y_.alloc(len) || !x_int64_.alloc(data_ == 2 ? len : 0) || !y_int64_.alloc(data_ == 2 ? len : 0)) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        if (data_ == 1) {
+            bench_fill_uniform(x_.data(), len, 0.0f, 1.0f);
+        } else {
+            // mean +1, prefix sums stay below 2^24 for len up to millions
+            bench_fill_int(x_.data(), len, 7, -2, 1.0f);
+        }
+        for (uint64_t i = 0; i < x_int64_.size(); ++i) {
+            x_int64_.data()[i] = (int64_t)x_.data()[i];
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    ppl::common::RetCode reference() override
+    {
+        if (!y_ref_.alloc(y_.size())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        for (int64_t o = 0; o < outer_; ++o) {
+            for (int64_t i = 0; i < inner_; ++i) {
+                double carry = 0.0;
+                for (int64_t k = 0; k < len_; ++k) {
+                    const int64_t l = reverse_ ? len_ - 1 - k : k;
+                    const int64_t off = (o * len_ + l) * inner_ + i;
+                    if (exclusive_) y_ref_.data()[off] = carry;
+                    carry += x_.data()[off];
+                    if (!exclusive_) y_ref_.data()[off] = carry;
+                }
+            }
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    bool check(const float eps) override
+    {
+        if (data_ == 2) {
+            for (uint64_t i = 0; i < y_int64_.size(); ++i) {
+                if (y_int64_.data()[i] != (int64_t)y_ref_.data()[i]) {
+                    std::cerr << "error[" << i << "]=" << y_int64_.data()[i] << " ref:" << (int64_t)y_ref_.data()[i];
+                    return false;
+                }
+            }
+            std::cerr << "pass";
+            return true;
+        }
+        if (data_ == 0) {
+            return check_array_bitwise(y_.data(), y_ref_.data(), y_.size());
+        }
+        return check_array_error(y_.data(), y_ref_.data(), y_.size(), eps);
+    }
+
+    const void *output() const override
+    {
+        return data_ == 2 ? (const void *)y_int64_.data() : (const void *)y_.data();
+    }
+
+    uint64_t output_bytes() const override
+    {
+        return data_ == 2 ? y_int64_.bytes() : y_.bytes();
+    }
+
+    std::vector<std::string> impl_names() const override
+    {
+        if (data_ == 2) {
+            return {"noarch"};
+        }
+        return bench_case_impl<ppl_x86_cumsum_fp32_func_t>::impl_names();
+    }
+
+    bool select(const std::string &impl) override
+    {
+        if (data_ == 2) {
+            func_ = nullptr;
+            return impl == "noarch";
+        }
+        return bench_case_impl<ppl_x86_cumsum_fp32_func_t>::select(impl);
+    }
+
+    ppl::common::RetCode run() override
+    {
+        if (data_ == 2) {
+            return ppl::kernel::x86::cumsum_ndarray_int64(&x_shape_, x_int64_.data(), 1, exclusive_, reverse_, y_int64_.data());
+        }
+        return func_(&x_shape_, x_.data(), 1, exclusive_, reverse_, y_.data());
+    }
+
+    double gops() const override
+    {
+        return y_.size() / 1e9;
+    }
+
+    double gbytes() const override
+    {
+        return (data_ == 2 ? x_int64_.bytes() + y_int64_.bytes() : x_.bytes() + y_.bytes()) / 1e9;
+    }
+
+private:
+    int64_t outer_, len_, inner_, exclusive_, reverse_, data_;
+    char name_[100];
+    ppl::common::TensorShape x_shape_;
+    bench_buffer<float> x_, y_, y_ref_;
+    bench_buffer<int64_t> x_int64_, y_int64_;
+};
+
+bench_case *create_cumsum_bench_case()
+{
+    return new cumsum_bench_case();
+}
@@ -0,0 +1,210 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ppl/kernel/x86/fp32/deform_conv2d.h"
+#include "ppl/kernel/x86/fp32/reorder.h"
+#include "bench/bench_common.h"
+
+/*
+    deformable conv with square kernel k, stride s, pad p and dilation d.
+    offsets are uniform in [-2, 2], so some samples fall outside of the
+    image. g: group, og: offset_group, mask 1 passes a mask in [0, 1].
+    fmt 0 runs the ndarray fma impl, fmt 1 the n16cx impls, whose weights
+    are converted once in select() like a conv2d manager would.
+*/
+#define DEFORM_CONV2D_CASE_STRING_FMT() \
+    "n%" PRId64 "c%" PRId64 "h%" PRId64 "w%" PRId64 "_oc%" PRId64 \
+    "_k%" PRId64 "s%" PRId64 "p%" PRId64 "d%" PRId64 "_g%" PRId64 "og%" PRId64 \
+    "_mask%" PRId64 "_fmt%" PRId64 "_n"
+
+class deform_conv2d_bench_case : public bench_case {
+public:
+    bool parse(const char *line) override
+    {
+        if (!(14 == sscanf(line, DEFORM_CONV2D_CASE_STRING_FMT() "%99s", &n_, &c_, &h_, &w_, &oc_,
+                &k_, &s_, &p_, &d_, &g_, &og_, &mask_, &fmt_, name_) &&
+            n_ > 0 && c_ > 0 && h_ > 0 && w_ > 0 && oc_ > 0 && k_ > 0 && s_ > 0 && p_ >= 0 && d_ > 0 &&
+            g_ > 0 && og_ > 0 && c_ % g_ == 0 && oc_ % g_ == 0 && c_ / g_ % og_ == 0 &&
+            (mask_ == 0 || mask_ == 1) && (fmt_ == 0 || fmt_ == 1))) {
+            return false;
+        }
+        dst_h_ = (h_ + 2 * p_ - d_ * (k_ - 1) - 1) / s_ + 1;
+        dst_w_ = (w_ + 2 * p_ - d_ * (k_ - 1) - 1) / s_ + 1;
+        return dst_h_ > 0 && dst_w_ > 0;
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), DEFORM_CONV2D_CASE_STRING_FMT() "%s", n_, c_, h_, w_, oc_,
+            k_, s_, p_, d_, g_, og_, mask_, fmt_, name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        const ppl::common::dataformat_t format = fmt_ ? ppl::common::DATAFORMAT_N16CX : ppl::common::DATAFORMAT_NDARRAY;
+        bench_make_shape({n_, c_, h_, w_}, ppl::common::DATAFORMAT_NDARRAY, &src_nd_shape_);
+        bench_make_shape({n_, oc_, dst_h_, dst_w_}, ppl::common::DATAFORMAT_NDARRAY, &dst_nd_shape_);
+        bench_make_shape({n_, c_, h_, w_}, format, &src_shape_);
+        bench_make_shape({n_, oc_, dst_h_, dst_w_}, format, &dst_shape_);
+        const int64_t dst_space = dst_h_ * dst_w_;
+        if (!src_nd_.alloc(src_nd_shape_.CalcElementsExcludingPadding()) ||
+            !src_.alloc(src_shape_.CalcElementsIncludingPadding()) ||
+            !dst_.alloc(dst_shape_.CalcElementsIncludingPadding()) ||
+            !offset_.alloc(n_ * og_ * 2 * k_ * k_ * dst_space) ||
+            !mask_data_.alloc(n_ * og_ * k_ * k_ * dst_space) ||
+            !filter_.alloc(oc_ * c_ / g_ * k_ * k_) || !bias_.alloc(oc_)) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        bench_fill_uniform(src_nd_.data(), src_nd_.size(), -1.0f, 1.0f);
+        bench_fill_uniform(offset_.data(), offset_.size(), -2.0f, 2.0f);
+        bench_fill_uniform(mask_data_.data(), mask_data_.size(), 0.0f, 1.0f);
+        bench_fill_uniform(filter_.data(), filter_.size(), -0.1f, 0.1f);
+        bench_fill_uniform(bias_.data(), bias_.size(), -1.0f, 1.0f);
+        if (fmt_) {
+            return ppl::kernel::x86::reorder_ndarray_n16cx_fp32(&src_nd_shape_, src_nd_.data(), src_.data());
+        }
+        memcpy(src_.data(), src_nd_.data(), src_nd_.bytes());
+        return ppl::common::RC_SUCCESS;
+    }
+
+    ppl::common::RetCode reference() override
+    {
+        bench_buffer<uint8_t> temp;
+        if (!dst_ref_.alloc(dst_nd_shape_.CalcElementsExcludingPadding()) ||
+            !dst_nd_.alloc(dst_nd_shape_.CalcElementsExcludingPadding()) ||
+            !temp.alloc(ppl::kernel::x86::deform_conv2d_fp32_ref_get_buffer_bytes(dst_h_, dst_w_, g_, c_, k_, k_))) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        return ppl::kernel::x86::deform_conv2d_fp32_ref(
+            &src_nd_shape_, &dst_nd_shape_, src_nd_.data(), offset_.data(), mask_ ? mask_data_.data() : nullptr,
+            filter_.data(), bias_.data(), g_, og_, c_, oc_, k_, k_, s_, s_, p_, p_, d_, d_,
+            temp.data(), dst_ref_.data());
+    }
+
+    bool check(const float eps) override
+    {
+        if (fmt_) {
+            if (ppl::common::RC_SUCCESS != ppl::kernel::x86::reorder_n16cx_ndarray_fp32(&dst_shape_, dst_.data(), dst_nd_.data())) {
+                std::cerr << "reorder dst failed";
+                return false;
+            }
+        } else {
+            memcpy(dst_nd_.data(), dst_.data(), dst_nd_.bytes());
+        }
+        return check_array_error(dst_nd_.data(), dst_ref_.data(), dst_ref_.size(), eps);
+    }
+
+    std::vector<std::string> impl_names() const override
+    {
+        if (!fmt_) {
+            return {"fma"};
+        }
+#ifdef PPL_USE_X86_AVX512
+        return {"fma", "avx512"};
+#else
+        return {"fma"};
+#endif
+    }
+
+    bool select(const std::string &impl) override
+    {
+        impl_ = impl;
+        uint64_t temp_bytes = 0;
+        if (!fmt_) {
+            temp_bytes = ppl::kernel::x86::deform_conv2d_fp32_fma_get_buffer_bytes(dst_h_, dst_w_, g_, c_, k_, k_);
+            return impl == "fma" && temp_.alloc(temp_bytes);
+        }
+        uint64_t cvt_bytes = 0;
+        ppl::common::RetCode rc = ppl::common::RC_UNSUPPORTED;
+        if (impl == "fma") {
+            temp_bytes = ppl::kernel::x86::deform_conv2d_n16cx_fp32_fma_get_buffer_bytes(dst_h_, dst_w_, g_, c_, oc_, k_, k_);
+            cvt_bytes  = ppl::kernel::x86::deform_conv2d_n16cx_fp32_fma_get_cvt_weights_bytes(g_, c_, oc_, k_, k_);
+            if (temp_.alloc(temp_bytes) && cvt_weights_.alloc(cvt_bytes)) {
+                rc = ppl::kernel::x86::deform_conv2d_n16cx_fp32_fma_gen_cvt_weights(
+                    filter_.data(), bias_.data(), g_, c_, oc_, k_, k_, cvt_weights_.data());
+            }
+        }
+#ifdef PPL_USE_X86_AVX512
+        if (impl == "avx512") {
+            temp_bytes = ppl::kernel::x86::deform_conv2d_n16cx_fp32_avx512_get_buffer_bytes(dst_h_, dst_w_, g_, c_, oc_, k_, k_);
+            cvt_bytes  = ppl::kernel::x86::deform_conv2d_n16cx_fp32_avx512_get_cvt_weights_bytes(g_, c_, oc_, k_, k_);
+            if (temp_.alloc(temp_bytes) && cvt_weights_.alloc(cvt_bytes)) {
+                rc = ppl::kernel::x86::deform_conv2d_n16cx_fp32_avx512_gen_cvt_weights(
+                    filter_.data(), bias_.data(), g_, c_, oc_, k_, k_, cvt_weights_.data());
+            }
+        }
+#endif
+        if (rc != ppl::common::RC_SUCCESS) {
+            impl_.clear();
+        }
+        return rc == ppl::common::RC_SUCCESS;
+    }
+
+    ppl::common::RetCode run() override
+    {
+        const float *mask = mask_ ? mask_data_.data() : nullptr;
+        if (!fmt_ && impl_ == "fma") {
+            return ppl::kernel::x86::deform_conv2d_fp32_fma(
+                &src_shape_, &dst_shape_, src_.data(), offset_.data(), mask, filter_.data(), bias_.data(),
+                g_, og_, c_, oc_, k_, k_, s_, s_, p_, p_, d_, d_, temp_.data(), dst_.data());
+        }
+        if (fmt_ && impl_ == "fma") {
+            return ppl::kernel::x86::deform_conv2d_n16cx_fp32_fma(
+                &src_shape_, &dst_shape_, src_.data(), offset_.data(), mask, cvt_weights_.data(),
+                g_, og_, c_, oc_, k_, k_, s_, s_, p_, p_, d_, d_, temp_.data(), dst_.data());
+        }
+#ifdef PPL_USE_X86_AVX512
+        if (fmt_ && impl_ == "avx512") {
+            return ppl::kernel::x86::deform_conv2d_n16cx_fp32_avx512(
+                &src_shape_, &dst_shape_, src_.data(), offset_.data(), mask, cvt_weights_.data(),
+                g_, og_, c_, oc_, k_, k_, s_, s_, p_, p_, d_, d_, temp_.data(), dst_.data());
+        }
+#endif
+        return ppl::common::RC_UNSUPPORTED;
+    }
+
+    // gemm of the sampled columns plus 4 taps of one mul and one add per sample
+    double gops() const override
+    {
+        const double dst_pixels = (double)n_ * dst_h_ * dst_w_;
+        return (dst_pixels * oc_ * c_ / g_ * k_ * k_ * 2 + dst_pixels * c_ * k_ * k_ * 8) / 1e9;
+    }
+
+    double gbytes() const override
+    {
+        return (src_.bytes() + offset_.bytes() + (mask_ ? mask_data_.bytes() : 0) + filter_.bytes() + dst_.bytes()) / 1e9;
+    }
+
+private:
+    int64_t n_, c_, h_, w_, oc_, k_, s_, p_, d_, g_, og_, mask_, fmt_;
+    int64_t dst_h_ = 0, dst_w_ = 0;
+    char name_[100];
+    std::string impl_;
+    ppl::common::TensorShape src_nd_shape_, dst_nd_shape_, src_shape_, dst_shape_;
+    bench_buffer<float> src_nd_, src_, dst_, dst_nd_, dst_ref_, offset_, mask_data_, filter_, bias_;
+    bench_buffer<uint8_t> temp_, cvt_weights_;
+};
+
+bench_case *create_deform_conv2d_bench_case()
+{
+    return new deform_conv2d_bench_case();
+}
@@ -0,0 +1,291 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ppl/kernel/x86/fp32/arithmetic.h"
+#include "ppl/kernel/x86/fp32/reorder.h"
+#include "bench/bench_common.h"
+
+#define ELTWISE_CASE_STRING_FMT() "n%" PRId64 "c%" PRId64 "h%" PRId64 "w%" PRId64 "_bcast%" PRId64 "_n"
+
+typedef decltype(ppl::kernel::x86::add_fp32_sse)* ppl_x86_eltwise_func_t;
+
+/*
+    n16cx add writing channels [coff, coff + c) of a ctot channel dst, as a
+    concat input does. the slice must start on a channel block and only the
+    last slice may end inside one.
+*/
+#define ELTWISE_DST_VIEW_CASE_STRING_FMT() \
+    "n%" PRId64 "c%" PRId64 "h%" PRId64 "w%" PRId64 "_bcast%" PRId64 \
+    "_ctot%" PRId64 "coff%" PRId64 "_n"
+
+// bcast 0: src1 has the same shape as src0, bcast 1: src1 is a [1, c, 1, 1] per channel vector
+class eltwise_bench_case : public bench_case_impl<ppl_x86_eltwise_func_t> {
+public:
+    eltwise_bench_case(const bool is_mul) : is_mul_(is_mul)
+    {
+        if (is_mul) {
+            impls_ = {
+                {"sse", ppl::kernel::x86::mul_fp32_sse},
+                {"avx", ppl::kernel::x86::mul_fp32_avx},
+#ifdef PPL_USE_X86_AVX512
+                {"avx512", ppl::kernel::x86::mul_fp32_avx512},
+#endif
+            };
+        } else {
+            impls_ = {
+                {"sse", ppl::kernel::x86::add_fp32_sse},
+                {"avx", ppl::kernel::x86::add_fp32_avx},
+#ifdef PPL_USE_X86_AVX512
+                {"avx512", ppl::kernel::x86::add_fp32_avx512},
+#endif
+            };
+        }
+    }
+
+    bool parse(const char *line) override
+    {
+        return 6 == sscanf(line, ELTWISE_CASE_STRING_FMT() "%99s", &n_, &c_, &h_, &w_, &bcast_, name_) &&
+            n_ > 0 && c_ > 0 && h_ > 0 && w_ > 0 && (bcast_ == 0 || bcast_ == 1);
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), ELTWISE_CASE_STRING_FMT() "%s", n_, c_, h_, w_, bcast_, name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        bench_make_shape({n_, c_, h_, w_}, ppl::common::DATAFORMAT_NDARRAY, &src0_shape_);
+        bench_make_shape(bcast_ ? std::vector<int64_t>{1, c_, 1, 1} : std::vector<int64_t>{n_, c_, h_, w_},
+            ppl::common::DATAFORMAT_NDARRAY, &src1_shape_);
+        bench_make_shape({n_, c_, h_, w_}, ppl::common::DATAFORMAT_NDARRAY, &dst_shape_);
+        if (!src0_.alloc(src0_shape_.CalcElementsExcludingPadding()) ||
+            !src1_.alloc(src1_shape_.CalcElementsExcludingPadding()) ||
+            !dst_.alloc(dst_shape_.CalcElementsExcludingPadding())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        bench_fill_int(src0_.data(), src0_.size());
+        bench_fill_int(src1_.data(), src1_.size());
+        return ppl::common::RC_SUCCESS;
+    }
+
+    ppl::common::RetCode reference() override
+    {
+        if (!dst_ref_.alloc(dst_.size())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        const int64_t inner = h_ * w_;
+        for (int64_t i = 0; i < (int64_t)dst_.size(); ++i) {
+            const float s1 = bcast_ ? src1_.data()[(i / inner) % c_] : src1_.data()[i];
+            dst_ref_.data()[i] = is_mul_ ? src0_.data()[i] * s1 : src0_.data()[i] + s1;
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    bool check(const float eps) override
+    {
+        return check_array_error(dst_.data(), dst_ref_.data(), dst_.size(), eps);
+    }
+
+    ppl::common::RetCode run() override
+    {
+        return func_(&src0_shape_, &src1_shape_, &dst_shape_, src0_.data(), src1_.data(), false, dst_.data());
+    }
+
+    double gops() const override
+    {
+        return dst_.size() / 1e9;
+    }
+
+    double gbytes() const override
+    {
+        return (src0_.bytes() + src1_.bytes() + dst_.bytes()) / 1e9;
+    }
+
+private:
+    const bool is_mul_;
+    int64_t n_, c_, h_, w_, bcast_;
+    char name_[100];
+    ppl::common::TensorShape src0_shape_, src1_shape_, dst_shape_;
+    bench_buffer<float> src0_, src1_, dst_, dst_ref_;
+};
+
+class eltwise_dst_view_bench_case : public bench_case {
+public:
+    bool parse(const char *line) override
+    {
+        return 8 == sscanf(line, ELTWISE_DST_VIEW_CASE_STRING_FMT() "%99s", &n_, &c_, &h_, &w_,
+            &bcast_, &ctot_, &coff_, name_) &&
+            n_ > 0 && c_ > 0 && h_ > 0 && w_ > 0 && (bcast_ == 0 || bcast_ == 1) &&
+            coff_ % 16 == 0 && coff_ + c_ <= ctot_ && (c_ % 16 == 0 || coff_ + c_ == ctot_);
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), ELTWISE_DST_VIEW_CASE_STRING_FMT() "%s", n_, c_, h_, w_,
+            bcast_, ctot_, coff_, name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        const std::vector<int64_t> src1_dims = bcast_ ? std::vector<int64_t>{1, c_, 1, 1} : std::vector<int64_t>{n_, c_, h_, w_};
+        bench_make_shape({n_, c_, h_, w_}, ppl::common::DATAFORMAT_NDARRAY, &src0_nd_shape_);
+        bench_make_shape(src1_dims, ppl::common::DATAFORMAT_NDARRAY, &src1_nd_shape_);
+        bench_make_shape({n_, ctot_, h_, w_}, ppl::common::DATAFORMAT_NDARRAY, &dst_all_nd_shape_);
+        bench_make_shape({n_, c_, h_, w_}, ppl::common::DATAFORMAT_N16CX, &src0_shape_);
+        bench_make_shape(src1_dims, ppl::common::DATAFORMAT_N16CX, &src1_shape_);
+        bench_make_shape({n_, c_, h_, w_}, ppl::common::DATAFORMAT_N16CX, &dst_shape_);
+        bench_make_shape({n_, ctot_, h_, w_}, ppl::common::DATAFORMAT_N16CX, &dst_all_shape_);
+        if (!src0_nd_.alloc(src0_nd_shape_.CalcElementsExcludingPadding()) ||
+            !src1_nd_.alloc(src1_nd_shape_.CalcElementsExcludingPadding()) ||
+            !src0_.alloc(src0_shape_.CalcElementsIncludingPadding()) ||
+            !src1_.alloc(src1_shape_.CalcElementsIncludingPadding()) ||
+            !dst_all_.alloc(dst_all_shape_.CalcElementsIncludingPadding())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        bench_fill_int(src0_nd_.data(), src0_nd_.size());
+        bench_fill_int(src1_nd_.data(), src1_nd_.size());
+        // channels out of the dst slice must keep this value
+        for (uint64_t i = 0; i < dst_all_.size(); ++i) {
+            dst_all_.data()[i] = guard_value();
+        }
+        ppl::common::RetCode rc = ppl::kernel::x86::reorder_ndarray_n16cx_fp32(&src0_nd_shape_, src0_nd_.data(), src0_.data());
+        if (rc != ppl::common::RC_SUCCESS) {
+            return rc;
+        }
+        return ppl::kernel::x86::reorder_ndarray_n16cx_fp32(&src1_nd_shape_, src1_nd_.data(), src1_.data());
+    }
+
+    ppl::common::RetCode reference() override
+    {
+        if (!dst_ref_.alloc(src0_nd_.size()) ||
+            !dst_all_nd_.alloc(dst_all_nd_shape_.CalcElementsExcludingPadding())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        const int64_t inner = h_ * w_;
+        for (int64_t i = 0; i < (int64_t)dst_ref_.size(); ++i) {
+            const float s1 = bcast_ ? src1_nd_.data()[(i / inner) % c_] : src1_nd_.data()[i];
+            dst_ref_.data()[i] = src0_nd_.data()[i] + s1;
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    bool check(const float eps) override
+    {
+        if (ppl::common::RC_SUCCESS != ppl::kernel::x86::reorder_n16cx_ndarray_fp32(&dst_all_shape_, dst_all_.data(), dst_all_nd_.data())) {
+            std::cerr << "reorder dst failed";
+            return false;
+        }
+        const int64_t hw = h_ * w_;
+        for (int64_t n = 0; n < n_; ++n) {
+            for (int64_t c = 0; c < ctot_; ++c) {
+                if (c >= coff_ && c < coff_ + c_) {
+                    continue;
+                }
+                const float *l_dst = dst_all_nd_.data() + (n * ctot_ + c) * hw;
+                for (int64_t i = 0; i < hw; ++i) {
+                    if (l_dst[i] != guard_value()) {
+                        std::cerr << "channel " << c << " out of the dst slice was written";
+                        return false;
+                    }
+                }
+            }
+        }
+        bench_buffer<float> dst;
+        if (!dst.alloc(dst_ref_.size())) {
+            std::cerr << "out of memory";
+            return false;
+        }
+        for (int64_t n = 0; n < n_; ++n) {
+            memcpy(dst.data() + n * c_ * hw, dst_all_nd_.data() + (n * ctot_ + coff_) * hw, c_ * hw * sizeof(float));
+        }
+        return check_array_error(dst.data(), dst_ref_.data(), dst_ref_.size(), eps);
+    }
+
+    std::vector<std::string> impl_names() const override
+    {
+#ifdef PPL_USE_X86_AVX512
+        return {"sse", "avx", "avx512"};
+#else
+        return {"sse", "avx"};
+#endif
+    }
+
+    bool select(const std::string &impl) override
+    {
+        isa_ = ppl::common::ISA_X86_SSE;
+        if (impl == "avx") {
+            isa_ = ppl::common::ISA_X86_AVX;
+        }
+        if (impl == "avx512") {
+            isa_ = ppl::common::ISA_X86_AVX512;
+        }
+        return true;
+    }
+
+    ppl::common::RetCode run() override
+    {
+        // an n16cx channel slice starts coff / 16 channel blocks in
+        return ppl::kernel::x86::add_n16cx_fp32_dst_view(isa_, &src0_shape_, &src1_shape_, &dst_shape_,
+            src0_.data(), src1_.data(), false, ctot_, dst_all_.data() + coff_ * h_ * w_);
+    }
+
+    double gops() const override
+    {
+        return src0_nd_.size() / 1e9;
+    }
+
+    double gbytes() const override
+    {
+        return (src0_nd_.bytes() * 2 + src1_nd_.bytes()) / 1e9;
+    }
+
+private:
+    static float guard_value()
+    {
+        return 12345.0f;
+    }
+
+    int64_t n_, c_, h_, w_, bcast_, ctot_, coff_;
+    char name_[100];
+    ppl::common::isa_t isa_ = 0;
+    ppl::common::TensorShape src0_nd_shape_, src1_nd_shape_, dst_all_nd_shape_;
+    ppl::common::TensorShape src0_shape_, src1_shape_, dst_shape_, dst_all_shape_;
+    bench_buffer<float> src0_nd_, src1_nd_, src0_, src1_, dst_all_, dst_all_nd_, dst_ref_;
+};
+
+bench_case *create_add_bench_case()
+{
+    return new eltwise_bench_case(false);
+}
+
+bench_case *create_mul_bench_case()
+{
+    return new eltwise_bench_case(true);
+}
+
+bench_case *create_add_dst_view_bench_case()
+{
+    return new eltwise_dst_view_bench_case();
+}
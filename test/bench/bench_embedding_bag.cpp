@@ -0,0 +1,241 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "ppl/kernel/x86/fp32/embedding_bag.h"
+#include "bench/bench_common.h"
+
+/*
+    rows x dim table, bags with lengths in [0, 2 * len].
+    mode 0: sum, 1: mean, 2: max. w 1 passes per sample weights.
+    bag 0: offsets, 1: lengths, 2: one index per bag.
+    type 3: fp32 table, else the table_type of embedding_bag_quantized_fp32,
+    0: fp16, 1: int8 rowwise, 2: int4 rowwise.
+*/
+#define EMBEDDING_BAG_CASE_STRING_FMT() \
+    "rows%" PRId64 "dim%" PRId64 "_bags%" PRId64 "len%" PRId64 \
+    "_mode%" PRId64 "_w%" PRId64 "_bag%" PRId64 "_type%" PRId64 "_n"
+
+// impls are isa masks handed to the dispatcher, like the conv algo selectors
+class embedding_bag_bench_case : public bench_case {
+public:
+    bool parse(const char *line) override
+    {
+        return 9 == sscanf(line, EMBEDDING_BAG_CASE_STRING_FMT() "%99s", &rows_, &dim_, &bags_, &len_,
+            &mode_, &w_, &bag_, &type_, name_) &&
+            rows_ > 0 && dim_ > 0 && bags_ > 0 && len_ >= 0 && mode_ >= 0 && mode_ <= 2 &&
+            (w_ == 0 || (w_ == 1 && mode_ == 0)) && bag_ >= 0 && bag_ <= 2 && type_ >= 0 && type_ <= 3;
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), EMBEDDING_BAG_CASE_STRING_FMT() "%s", rows_, dim_, bags_, len_,
+            mode_, w_, bag_, type_, name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        if (!offsets_.alloc(bags_) || !lengths_.alloc(bags_)) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        num_indices_ = 0;
+        for (int64_t b = 0; b < bags_; ++b) {
+            lengths_.data()[b] = bag_ == 2 ? 1 : rand() % (2 * len_ + 1);
+            offsets_.data()[b] = num_indices_;
+            num_indices_ += lengths_.data()[b];
+        }
+        if (!table_.alloc(rows_ * dim_) || !qtable_.alloc(rows_ * row_bytes()) ||
+            !indices_.alloc(num_indices_) || !weights_.alloc(num_indices_) || !dst_.alloc(bags_ * dim_)) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        // every table below holds values whose sums are exact in any order,
+        // so check() can ask for the reference up to the mean division
+        bench_fill_int(weights_.data(), weights_.size(), 7, -3, 0.5f);
+        for (int64_t i = 0; i < num_indices_; ++i) {
+            indices_.data()[i] = rand() % rows_;
+        }
+        if (type_ == 3) {
+            bench_fill_int(table_.data(), table_.size(), 7, -3, 1.0f);
+            return ppl::common::RC_SUCCESS;
+        }
+        // fp16 has a subnormal in every other value, the rest are normals
+        // below 2^-10 so all of them are multiples of 2^-24. rowwise levels
+        // fill whole bytes, which leaves garbage in the unused high nibble
+        // of odd int4 rows.
+        const float scales[] = {0.5f, 0.25f, 0.125f, 0.0625f};
+        const float biases[] = {-8.0f, -2.0f, 0.0f, 1.5f};
+        for (int64_t r = 0; r < rows_; ++r) {
+            uint8_t *row = qtable_.data() + r * row_bytes();
+            if (type_ == 0) {
+                for (int64_t c = 0; c < dim_; ++c) {
+                    const uint16_t exp = c % 2 ? 0 : rand() % 5;
+                    const uint16_t h   = ((rand() % 2) << 15) | (exp << 10) | (rand() % 1024);
+                    memcpy(row + c * sizeof(uint16_t), &h, sizeof(h));
+                }
+            } else {
+                const int64_t data_bytes = type_ == 1 ? dim_ : (dim_ + 1) / 2;
+                for (int64_t c = 0; c < data_bytes; ++c) {
+                    row[c] = rand() % 256;
+                }
+                memcpy(row + data_bytes, &scales[rand() % 4], sizeof(float));
+                memcpy(row + data_bytes + sizeof(float), &biases[rand() % 4], sizeof(float));
+            }
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    ppl::common::RetCode reference() override
+    {
+        if (!dst_ref_.alloc(dst_.size())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        for (int64_t b = 0; b < bags_; ++b) {
+            const int64_t beg = offsets_.data()[b];
+            const int64_t len = lengths_.data()[b];
+            for (int64_t c = 0; c < dim_; ++c) {
+                double acc = 0.0;
+                for (int64_t i = beg; i < beg + len; ++i) {
+                    const double val = table_value(indices_.data()[i], c);
+                    if (mode_ == 2) {
+                        acc = i == beg ? val : std::max(acc, val);
+                    } else {
+                        acc += w_ ? val * weights_.data()[i] : val;
+                    }
+                }
+                if (mode_ == 1 && len > 0) {
+                    acc /= len;
+                }
+                dst_ref_.data()[b * dim_ + c] = (float)acc;
+            }
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    // relative error only, an absolute bound would hide wrong subnormals
+    bool check(const float eps) override
+    {
+        for (uint64_t i = 0; i < dst_.size(); ++i) {
+            if (fabs(dst_.data()[i] - dst_ref_.data()[i]) > eps * fabs(dst_ref_.data()[i])) {
+                std::cerr << "error[" << i << "]=" << dst_.data()[i] << " ref:" << dst_ref_.data()[i];
+                return false;
+            }
+        }
+        std::cerr << "pass";
+        return true;
+    }
+
+    std::vector<std::string> impl_names() const override
+    {
+#ifdef PPL_USE_X86_AVX512
+        return {"sse", "fma", "avx512"};
+#else
+        return {"sse", "fma"};
+#endif
+    }
+
+    bool select(const std::string &impl) override
+    {
+        if (impl == "avx512") {
+            isa_ = ppl::common::ISA_X86_AVX512;
+        } else if (impl == "fma") {
+            isa_ = ppl::common::ISA_X86_FMA;
+        } else {
+            isa_ = ppl::common::ISA_X86_SSE;
+        }
+        return true;
+    }
+
+    ppl::common::RetCode run() override
+    {
+        if (type_ == 3) {
+            return ppl::kernel::x86::embedding_bag_fp32(
+                isa_, table_.data(), indices_.data(),
+                bag_ == 0 ? offsets_.data() : nullptr,
+                bag_ == 1 ? lengths_.data() : nullptr,
+                w_ ? weights_.data() : nullptr,
+                rows_, dim_, num_indices_, bags_, mode_, dst_.data());
+        }
+        return ppl::kernel::x86::embedding_bag_quantized_fp32(
+            isa_, qtable_.data(), type_, indices_.data(),
+            bag_ == 0 ? offsets_.data() : nullptr,
+            bag_ == 1 ? lengths_.data() : nullptr,
+            w_ ? weights_.data() : nullptr,
+            rows_, dim_, num_indices_, bags_, mode_, dst_.data());
+    }
+
+    double gops() const override
+    {
+        return (double)num_indices_ * dim_ * (w_ ? 2 : 1) / 1e9;
+    }
+
+    double gbytes() const override
+    {
+        return ((double)num_indices_ * row_bytes() + indices_.bytes() + dst_.bytes()) / 1e9;
+    }
+
+private:
+    int64_t row_bytes() const
+    {
+        switch (type_) {
+            case 0: return dim_ * sizeof(uint16_t);
+            case 1: return dim_ + 2 * sizeof(float);
+            case 2: return (dim_ + 1) / 2 + 2 * sizeof(float);
+            default: return dim_ * sizeof(float);
+        }
+    }
+
+    // decodes the table without the kernel helpers
+    double table_value(const int64_t r, const int64_t c) const
+    {
+        if (type_ == 3) {
+            return table_.data()[r * dim_ + c];
+        }
+        const uint8_t *row = qtable_.data() + r * row_bytes();
+        if (type_ == 0) {
+            uint16_t h;
+            memcpy(&h, row + c * sizeof(uint16_t), sizeof(h));
+            const int32_t exp  = (h >> 10) & 0x1f;
+            const int32_t mant = h & 0x3ff;
+            const double val   = exp == 0 ? ldexp(mant, -24) : ldexp(mant + 1024, exp - 25);
+            return (h & 0x8000) ? -val : val;
+        }
+        const int64_t data_bytes = type_ == 1 ? dim_ : (dim_ + 1) / 2;
+        float scale, bias;
+        memcpy(&scale, row + data_bytes, sizeof(float));
+        memcpy(&bias, row + data_bytes + sizeof(float), sizeof(float));
+        const int32_t level = type_ == 1 ? row[c] : (c % 2 ? row[c / 2] >> 4 : row[c / 2] & 0xf);
+        return (double)level * scale + bias;
+    }
+
+    int64_t rows_, dim_, bags_, len_, mode_, w_, bag_, type_;
+    int64_t num_indices_ = 0;
+    char name_[100];
+    ppl::common::isa_t isa_ = 0;
+    bench_buffer<float> table_, weights_, dst_, dst_ref_;
+    bench_buffer<uint8_t> qtable_;
+    bench_buffer<int64_t> indices_, offsets_, lengths_;
+};
+
+bench_case *create_embedding_bag_bench_case()
+{
+    return new embedding_bag_bench_case();
+}
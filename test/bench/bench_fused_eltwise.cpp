@@ -0,0 +1,216 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <math.h>
+#include <stdio.h>
+
+#include "ppl/kernel/x86/fp32/fused_eltwise.h"
+#include "bench/bench_common.h"
+
+/*
+    programs over x [n, c, h, w], y and z [1, c, 1, 1]:
+        expr 0: x * sigmoid(x) + y
+        expr 1: x * (0.5 + 0.5 * erf(x / sqrt(2))) - y
+        expr 2: every other op, inputs and the first node are read again
+                many nodes later, so tiles are reused around live values
+    bcast 0: y is [n, c, h, w], 1: [c, 1, 1], 2: [1], 3: [w]
+*/
+#define FUSED_ELTWISE_CASE_STRING_FMT() \
+    "n%" PRId64 "c%" PRId64 "h%" PRId64 "w%" PRId64 "_expr%" PRId64 "_bcast%" PRId64 "_n"
+
+typedef decltype(ppl::kernel::x86::fused_eltwise_fp32_sse)* ppl_x86_fused_eltwise_func_t;
+
+class fused_eltwise_bench_case : public bench_case_impl<ppl_x86_fused_eltwise_func_t> {
+public:
+    fused_eltwise_bench_case()
+    {
+        impls_ = {
+            {"sse", ppl::kernel::x86::fused_eltwise_fp32_sse},
+            {"fma", ppl::kernel::x86::fused_eltwise_fp32_fma},
+#ifdef PPL_USE_X86_AVX512
+            {"avx512", ppl::kernel::x86::fused_eltwise_fp32_avx512},
+#endif
+        };
+    }
+
+    bool parse(const char *line) override
+    {
+        return 7 == sscanf(line, FUSED_ELTWISE_CASE_STRING_FMT() "%99s", &n_, &c_, &h_, &w_, &expr_, &bcast_, name_) &&
+            n_ > 0 && c_ > 0 && h_ > 0 && w_ > 0 && expr_ >= 0 && expr_ <= 2 && bcast_ >= 0 && bcast_ <= 3;
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), FUSED_ELTWISE_CASE_STRING_FMT() "%s", n_, c_, h_, w_, expr_, bcast_, name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        typedef ppl::kernel::x86::fused_eltwise_op op;
+        const float rsqrt2 = 0.70710678f;
+        if (expr_ == 0) {
+            nodes_ = {
+                {op::SIGMOID, {0, 0, 0}, 0.0f, 0.0f}, // 3
+                {op::MUL, {0, 3, 0}, 0.0f, 0.0f},
+                {op::ADD, {4, 1, 0}, 0.0f, 0.0f},
+            };
+        } else if (expr_ == 1) {
+            nodes_ = {
+                {op::AFFINE, {0, 0, 0}, rsqrt2, 0.0f}, // 3
+                {op::ERF, {3, 0, 0}, 0.0f, 0.0f},
+                {op::AFFINE, {4, 0, 0}, 0.5f, 0.5f},
+                {op::MUL, {0, 5, 0}, 0.0f, 0.0f},
+                {op::SUB, {6, 1, 0}, 0.0f, 0.0f},
+            };
+        } else {
+            nodes_ = {
+                {op::FMA, {0, 1, 2}, 0.0f, 0.0f}, // 3
+                {op::LEAKY_RELU, {3, 0, 0}, 0.1f, 0.0f},
+                {op::CLIP, {4, 0, 0}, -2.0f, 2.0f},
+                {op::NEG, {0, 0, 0}, 0.0f, 0.0f}, // 6
+                {op::MAX, {5, 6, 0}, 0.0f, 0.0f},
+                {op::SELECT, {1, 7, 2}, 0.0f, 0.0f},
+                {op::ABS, {2, 0, 0}, 0.0f, 0.0f}, // 9
+                {op::AFFINE, {9, 0, 0}, 1.0f, 1.0f},
+                {op::DIV, {8, 10, 0}, 0.0f, 0.0f},
+                {op::ABS, {0, 0, 0}, 0.0f, 0.0f}, // 12
+                {op::SQRT, {12, 0, 0}, 0.0f, 0.0f},
+                {op::MIN, {11, 13, 0}, 0.0f, 0.0f},
+                {op::TANH, {14, 0, 0}, 0.0f, 0.0f}, // 15
+                {op::EXP, {15, 0, 0}, 0.0f, 0.0f},
+                {op::SUB, {16, 3, 0}, 0.0f, 0.0f},
+                {op::RELU, {17, 0, 0}, 0.0f, 0.0f},
+            };
+        }
+
+        std::vector<int64_t> y_dims = {n_, c_, h_, w_};
+        if (bcast_ == 1) y_dims = {c_, 1, 1};
+        if (bcast_ == 2) y_dims = {1};
+        if (bcast_ == 3) y_dims = {w_};
+        bench_make_shape({n_, c_, h_, w_}, ppl::common::DATAFORMAT_NDARRAY, &x_shape_);
+        bench_make_shape(y_dims, ppl::common::DATAFORMAT_NDARRAY, &y_shape_);
+        bench_make_shape({1, c_, 1, 1}, ppl::common::DATAFORMAT_NDARRAY, &z_shape_);
+        if (!x_.alloc(x_shape_.CalcElementsExcludingPadding()) ||
+            !y_.alloc(y_shape_.CalcElementsExcludingPadding()) ||
+            !z_.alloc(z_shape_.CalcElementsExcludingPadding()) ||
+            !dst_.alloc(x_.size())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        bench_fill_uniform(x_.data(), x_.size(), -3.0f, 3.0f);
+        // zeros in y take the other branch of select
+        bench_fill_int(y_.data(), y_.size(), 5, -2, 0.5f);
+        bench_fill_uniform(z_.data(), z_.size(), -2.0f, 2.0f);
+        return ppl::common::RC_SUCCESS;
+    }
+
+    ppl::common::RetCode reference() override
+    {
+        if (!dst_ref_.alloc(dst_.size())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        typedef ppl::kernel::x86::fused_eltwise_op op;
+        const int64_t hw = h_ * w_;
+        std::vector<float> v(3 + nodes_.size());
+        for (int64_t i = 0; i < (int64_t)dst_.size(); ++i) {
+            const int64_t c = i / hw % c_;
+            int64_t y_idx = i;
+            if (bcast_ == 1) y_idx = c;
+            if (bcast_ == 2) y_idx = 0;
+            if (bcast_ == 3) y_idx = i % w_;
+            v[0] = x_.data()[i];
+            v[1] = y_.data()[y_idx];
+            v[2] = z_.data()[c];
+            for (size_t k = 0; k < nodes_.size(); ++k) {
+                const ppl::kernel::x86::fused_eltwise_node &node = nodes_[k];
+                const float a = v[node.src[0]], b = v[node.src[1]], cc = v[node.src[2]];
+                float r = 0.0f;
+                switch (node.op) {
+                case op::ADD: r = a + b; break;
+                case op::SUB: r = a - b; break;
+                case op::MUL: r = a * b; break;
+                case op::DIV: r = a / b; break;
+                case op::MAX: r = std::max(a, b); break;
+                case op::MIN: r = std::min(a, b); break;
+                case op::NEG: r = -a; break;
+                case op::ABS: r = fabsf(a); break;
+                case op::RELU: r = std::max(a, 0.0f); break;
+                case op::SIGMOID: r = 1.0f / (1.0f + expf(-a)); break;
+                case op::TANH: r = tanhf(a); break;
+                case op::EXP: r = expf(a); break;
+                case op::ERF: r = erff(a); break;
+                case op::SQRT: r = sqrtf(a); break;
+                case op::CLIP: r = std::min(std::max(a, node.alpha), node.beta); break;
+                case op::LEAKY_RELU: r = a >= 0.0f ? a : node.alpha * a; break;
+                case op::AFFINE: r = node.alpha * a + node.beta; break;
+                case op::FMA: r = a * b + cc; break;
+                case op::SELECT: r = a != 0.0f ? b : cc; break;
+                default: return ppl::common::RC_UNSUPPORTED;
+                }
+                v[3 + k] = r;
+            }
+            dst_ref_.data()[i] = v.back();
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    bool check(const float eps) override
+    {
+        // the vector exp, erf and tanh are polynomial approximations
+        return check_array_error(dst_.data(), dst_ref_.data(), dst_.size(), std::max(eps, 1e-3f));
+    }
+
+    const void *output() const override
+    {
+        return dst_.data();
+    }
+
+    uint64_t output_bytes() const override
+    {
+        return dst_.bytes();
+    }
+
+    ppl::common::RetCode run() override
+    {
+        const ppl::common::TensorShape *shapes[] = {&x_shape_, &y_shape_, &z_shape_};
+        const float *srcs[] = {x_.data(), y_.data(), z_.data()};
+        return func_(shapes, srcs, 3, nodes_.data(), (int32_t)nodes_.size(), &x_shape_, dst_.data());
+    }
+
+    double gops() const override
+    {
+        return (double)dst_.size() * nodes_.size() / 1e9;
+    }
+
+    double gbytes() const override
+    {
+        return (x_.bytes() + y_.bytes() + z_.bytes() + dst_.bytes()) / 1e9;
+    }
+
+private:
+    int64_t n_, c_, h_, w_, expr_, bcast_;
+    char name_[100];
+    std::vector<ppl::kernel::x86::fused_eltwise_node> nodes_;
+    ppl::common::TensorShape x_shape_, y_shape_, z_shape_;
+    bench_buffer<float> x_, y_, z_, dst_, dst_ref_;
+};
+
+bench_case *create_fused_eltwise_bench_case()
+{
+    return new fused_eltwise_bench_case();
+}
@@ -0,0 +1,112 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <stdio.h>
+
+#include "ppl/kernel/x86/fp32/gather.h"
+#include "bench/bench_common.h"
+
+// gather idx random rows of the middle axis of [outer, len, inner]
+#define GATHER_CASE_STRING_FMT() "outer%" PRId64 "len%" PRId64 "inner%" PRId64 "_idx%" PRId64 "_n"
+
+typedef decltype(ppl::kernel::x86::gather_ndarray_fp32)* ppl_x86_gather_func_t;
+
+class gather_bench_case : public bench_case_impl<ppl_x86_gather_func_t> {
+public:
+    gather_bench_case()
+    {
+        impls_ = {
+            {"noarch", ppl::kernel::x86::gather_ndarray_fp32},
+        };
+    }
+
+    bool parse(const char *line) override
+    {
+        return 5 == sscanf(line, GATHER_CASE_STRING_FMT() "%99s", &outer_, &len_, &inner_, &num_indices_, name_) &&
+            outer_ > 0 && len_ > 0 && inner_ > 0 && num_indices_ > 0;
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), GATHER_CASE_STRING_FMT() "%s", outer_, len_, inner_, num_indices_, name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        if (!src_.alloc(outer_ * len_ * inner_) ||
+            !indices_.alloc(num_indices_) ||
+            !dst_.alloc(outer_ * num_indices_ * inner_)) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        bench_fill_int(src_.data(), src_.size());
+        for (int64_t i = 0; i < num_indices_; ++i) {
+            indices_.data()[i] = rand() % len_;
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    ppl::common::RetCode reference() override
+    {
+        if (!dst_ref_.alloc(dst_.size())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        for (int64_t o = 0; o < outer_; ++o) {
+            for (int64_t k = 0; k < num_indices_; ++k) {
+                const float *src = src_.data() + (o * len_ + indices_.data()[k]) * inner_;
+                float *dst = dst_ref_.data() + (o * num_indices_ + k) * inner_;
+                for (int64_t i = 0; i < inner_; ++i) {
+                    dst[i] = src[i];
+                }
+            }
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    bool check(const float eps) override
+    {
+        return check_array_error(dst_.data(), dst_ref_.data(), dst_.size(), eps);
+    }
+
+    ppl::common::RetCode run() override
+    {
+        return func_(src_.data(), indices_.data(), outer_, len_, inner_, num_indices_, 1, dst_.data());
+    }
+
+    double gops() const override
+    {
+        return 0;
+    }
+
+    // only the gathered rows of src are touched
+    double gbytes() const override
+    {
+        return (2.0 * dst_.bytes() + indices_.bytes()) / 1e9;
+    }
+
+private:
+    int64_t outer_, len_, inner_, num_indices_;
+    char name_[100];
+    bench_buffer<float> src_, dst_, dst_ref_;
+    bench_buffer<int64_t> indices_;
+};
+
+bench_case *create_gather_bench_case()
+{
+    return new gather_bench_case();
+}
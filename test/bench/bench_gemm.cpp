@@ -0,0 +1,229 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ppl/kernel/x86/fp32/gemm.h"
+#include "bench/bench_common.h"
+
+/*
+    batch of b gemms C = alpha * op(A) * op(B) + beta * C + bias + sum, with
+    the options test_gemm takes as flags encoded in the case so one config can
+    sweep them. ta: 0 no_trans, 1 trans. tb: 0 no_trans, 1 trans, 2 packed
+    from no_trans, 3 packed from trans. bias: 0 empty, 1 scalar, 2 col vector,
+    3 row vector. sum: 0 empty, 1 no_trans. relu: 0 none, 1 relu, 6 relu6.
+    beta: 0 or 1, the value of beta.
+*/
+#define GEMM_CASE_STRING_FMT() \
+    "b%" PRId64 "m%" PRId64 "n%" PRId64 "k%" PRId64 "_ta%" PRId64 "tb%" PRId64 \
+    "_bias%" PRId64 "_sum%" PRId64 "_relu%" PRId64 "_beta%" PRId64 "_n"
+
+struct gemm_bench_funcs {
+    decltype(ppl::kernel::x86::batch_gemm_fp32_sse)* gemm;
+    decltype(ppl::kernel::x86::gemm_fp32_sse_pack_b)* pack_b;
+    decltype(ppl::kernel::x86::gemm_fp32_sse_get_packed_b_bytes)* get_packed_b_bytes;
+};
+
+class gemm_bench_case : public bench_case {
+public:
+    gemm_bench_case()
+    {
+        impls_ = {
+            {"sse", {ppl::kernel::x86::batch_gemm_fp32_sse, ppl::kernel::x86::gemm_fp32_sse_pack_b, ppl::kernel::x86::gemm_fp32_sse_get_packed_b_bytes}},
+            {"fma", {ppl::kernel::x86::batch_gemm_fp32_fma, ppl::kernel::x86::gemm_fp32_fma_pack_b, ppl::kernel::x86::gemm_fp32_fma_get_packed_b_bytes}},
+#ifdef PPL_USE_X86_AVX512
+            {"avx512", {ppl::kernel::x86::batch_gemm_fp32_avx512, ppl::kernel::x86::gemm_fp32_avx512_pack_b, ppl::kernel::x86::gemm_fp32_avx512_get_packed_b_bytes}},
+#endif
+        };
+    }
+
+    bool parse(const char *line) override
+    {
+        return 11 == sscanf(line, GEMM_CASE_STRING_FMT() "%99s", &batch_, &M_, &N_, &K_, &ta_, &tb_,
+            &bias_type_, &sum_type_, &relu_, &beta_, name_) &&
+            batch_ > 0 && M_ > 0 && N_ > 0 && K_ > 0 && (ta_ == 0 || ta_ == 1) && tb_ >= 0 && tb_ <= 3 &&
+            bias_type_ >= 0 && bias_type_ <= 3 && (sum_type_ == 0 || sum_type_ == 1) &&
+            (relu_ == 0 || relu_ == 1 || relu_ == 6) && (beta_ == 0 || beta_ == 1);
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), GEMM_CASE_STRING_FMT() "%s", batch_, M_, N_, K_, ta_, tb_,
+            bias_type_, sum_type_, relu_, beta_, name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        typeA_ = ta_ ? ppl::kernel::x86::gemm_m_type::TRANS : ppl::kernel::x86::gemm_m_type::NOTRANS;
+        typeB_ = (tb_ & 1) ? ppl::kernel::x86::gemm_m_type::TRANS : ppl::kernel::x86::gemm_m_type::NOTRANS;
+        typebias_ = ppl::kernel::x86::gemm_v_type::EMPTY;
+        if (bias_type_ == 1) typebias_ = ppl::kernel::x86::gemm_v_type::SCALAR;
+        if (bias_type_ == 2) typebias_ = ppl::kernel::x86::gemm_v_type::COL_VEC;
+        if (bias_type_ == 3) typebias_ = ppl::kernel::x86::gemm_v_type::ROW_VEC;
+        typesum_ = sum_type_ ? ppl::kernel::x86::gemm_m_type::NOTRANS : ppl::kernel::x86::gemm_m_type::EMPTY;
+        post_ = ppl::kernel::x86::gemm_post::NONE;
+        if (relu_ == 1) post_ = ppl::kernel::x86::gemm_post::RELU;
+        if (relu_ == 6) post_ = ppl::kernel::x86::gemm_post::RELU6;
+
+        lda_ = ta_ ? M_ : K_;
+        ldb_ = (tb_ & 1) ? K_ : N_;
+        const int64_t bias_len = bias_type_ == 1 ? 1 : (bias_type_ == 2 ? M_ : (bias_type_ == 3 ? N_ : 0));
+        if (!A_.alloc(batch_ * M_ * K_) || !B_.alloc(batch_ * K_ * N_) || !C_init_.alloc(batch_ * M_ * N_) ||
+            !C_.alloc(batch_ * M_ * N_) || !bias_.alloc(bias_len) || !sum_.alloc(sum_type_ ? batch_ * M_ * N_ : 0)) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        // small integers keep every dot product exact for K up to thousands
+        bench_fill_int(A_.data(), A_.size(), 7, -3, 1.0f);
+        bench_fill_int(B_.data(), B_.size(), 7, -3, 1.0f);
+        bench_fill_int(C_init_.data(), C_init_.size(), 7, -3, 1.0f);
+        bench_fill_int(bias_.data(), bias_.size(), 7, -3, 1.0f);
+        bench_fill_int(sum_.data(), sum_.size(), 7, -3, 1.0f);
+        return ppl::common::RC_SUCCESS;
+    }
+
+    ppl::common::RetCode reference() override
+    {
+        if (!C_ref_.alloc(C_.size())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        memcpy(C_ref_.data(), C_init_.data(), C_init_.bytes());
+        std::vector<const float*> A_list, B_list, bias_list, sum_list;
+        std::vector<float*> C_list;
+        make_lists(B_.data(), K_ * N_, C_ref_.data(), &A_list, &B_list, &bias_list, &sum_list, &C_list);
+        return ppl::kernel::x86::batch_gemm_fp32_ref(
+            A_list.data(), B_list.data(), bias_list.data(), sum_list.data(),
+            typeA_, typeB_, typebias_, typesum_, batch_, M_, N_, K_,
+            lda_, ldb_, N_, N_, 1.0f, (float)beta_, 1.0f, 1.0f, post_, C_list.data());
+    }
+
+    bool check(const float eps) override
+    {
+        return check_array_error(C_.data(), C_ref_.data(), C_.size(), eps);
+    }
+
+    const void *output() const override
+    {
+        return C_.data();
+    }
+
+    uint64_t output_bytes() const override
+    {
+        return C_.bytes();
+    }
+
+    std::vector<std::string> impl_names() const override
+    {
+        std::vector<std::string> names;
+        for (auto &impl : impls_) {
+            names.push_back(impl.first);
+        }
+        return names;
+    }
+
+    // packs B with the layout of the selected isa
+    bool select(const std::string &impl) override
+    {
+        func_ = nullptr;
+        for (auto &it : impls_) {
+            if (it.first == impl) {
+                func_ = &it.second;
+            }
+        }
+        if (!func_) {
+            return false;
+        }
+        if (tb_ < 2) {
+            return true;
+        }
+        per_packed_b_len_ = func_->get_packed_b_bytes(N_, K_) / sizeof(float);
+        if (!packed_B_.alloc(batch_ * per_packed_b_len_)) {
+            return false;
+        }
+        for (int64_t b = 0; b < batch_; ++b) {
+            if (ppl::common::RC_SUCCESS != func_->pack_b(B_.data() + b * K_ * N_, typeB_, N_, K_, ldb_,
+                packed_B_.data() + b * per_packed_b_len_)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    ppl::common::RetCode run() override
+    {
+        // beta reads C, so every run starts from the same C
+        memcpy(C_.data(), C_init_.data(), C_init_.bytes());
+        std::vector<const float*> A_list, B_list, bias_list, sum_list;
+        std::vector<float*> C_list;
+        if (tb_ < 2) {
+            make_lists(B_.data(), K_ * N_, C_.data(), &A_list, &B_list, &bias_list, &sum_list, &C_list);
+        } else {
+            make_lists(packed_B_.data(), per_packed_b_len_, C_.data(), &A_list, &B_list, &bias_list, &sum_list, &C_list);
+        }
+        return func_->gemm(
+            A_list.data(), B_list.data(), bias_list.data(), sum_list.data(),
+            typeA_, tb_ < 2 ? typeB_ : ppl::kernel::x86::gemm_m_type::PACKED, typebias_, typesum_, batch_, M_, N_, K_,
+            lda_, ldb_, N_, N_, 1.0f, (float)beta_, 1.0f, 1.0f, post_, C_list.data());
+    }
+
+    double gops() const override
+    {
+        return 2.0 * batch_ * M_ * N_ * K_ / 1e9;
+    }
+
+    double gbytes() const override
+    {
+        return (A_.bytes() + B_.bytes() + (beta_ ? 2 : 1) * C_.bytes() + bias_.bytes() + sum_.bytes()) / 1e9;
+    }
+
+private:
+    void make_lists(
+        const float *B,
+        const int64_t per_B_len,
+        float *C,
+        std::vector<const float*> *A_list,
+        std::vector<const float*> *B_list,
+        std::vector<const float*> *bias_list,
+        std::vector<const float*> *sum_list,
+        std::vector<float*> *C_list) const
+    {
+        for (int64_t b = 0; b < batch_; ++b) {
+            A_list->push_back(A_.data() + b * M_ * K_);
+            B_list->push_back(B + b * per_B_len);
+            bias_list->push_back(bias_type_ ? bias_.data() : nullptr);
+            sum_list->push_back(sum_type_ ? sum_.data() + b * M_ * N_ : nullptr);
+            C_list->push_back(C + b * M_ * N_);
+        }
+    }
+
+    int64_t batch_, M_, N_, K_, ta_, tb_, bias_type_, sum_type_, relu_, beta_;
+    int64_t lda_ = 0, ldb_ = 0, per_packed_b_len_ = 0;
+    char name_[100];
+    ppl::kernel::x86::gemm_m_type_t typeA_, typeB_, typesum_;
+    ppl::kernel::x86::gemm_v_type_t typebias_;
+    ppl::kernel::x86::gemm_post_t post_;
+    bench_buffer<float> A_, B_, packed_B_, C_init_, C_, C_ref_, bias_, sum_;
+    std::vector<std::pair<std::string, gemm_bench_funcs>> impls_;
+    const gemm_bench_funcs *func_ = nullptr;
+};
+
+bench_case *create_gemm_bench_case()
+{
+    return new gemm_bench_case();
+}
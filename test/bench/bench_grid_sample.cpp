@@ -0,0 +1,238 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "ppl/kernel/x86/fp32/grid_sample.h"
+#include "ppl/kernel/x86/fp32/reorder.h"
+#include "bench/bench_common.h"
+
+/*
+    grid [n, oh, ow, 2] is uniform in [-g, g] / 10, g > 10 puts samples
+    outside of the image. mode: 0 bilinear, 1 nearest, 2 bicubic.
+    pad: 0 zeros, 1 border, 2 reflection. fmt: 0 ndarray, 1 n16cx.
+*/
+#define GRID_SAMPLE_CASE_STRING_FMT() \
+    "n%" PRId64 "c%" PRId64 "h%" PRId64 "w%" PRId64 \
+    "_oh%" PRId64 "ow%" PRId64 "_g%" PRId64 "_mode%" PRId64 \
+    "_pad%" PRId64 "_align%" PRId64 "_fmt%" PRId64 "_n"
+
+typedef decltype(ppl::kernel::x86::grid_sample_ndarray_fp32)* ppl_x86_grid_sample_func_t;
+
+static float grid_sample_ref_reflect(const float in, const int64_t twice_low, const int64_t twice_high)
+{
+    if (twice_low == twice_high) {
+        return 0.0f;
+    }
+    const float lo      = twice_low / 2.0f;
+    const float span    = (twice_high - twice_low) / 2.0f;
+    const float dist    = fabsf(in - lo);
+    const float extra   = fmodf(dist, span);
+    const int64_t flips = (int64_t)floorf(dist / span);
+    return flips % 2 == 0 ? extra + lo : span - extra + lo;
+}
+
+// border and reflection move a coordinate back into [0, size - 1]
+static float grid_sample_ref_pad(const float x, const int64_t size, const int64_t pad, const bool align)
+{
+    if (pad == 0) {
+        return x;
+    }
+    float r = x;
+    if (pad == 2) {
+        r = align ? grid_sample_ref_reflect(x, 0, 2 * (size - 1)) : grid_sample_ref_reflect(x, -1, 2 * size - 1);
+    }
+    return std::min(std::max(r, 0.0f), (float)(size - 1));
+}
+
+// taps of one axis straight from the onnx formulas, taps out of the image
+// get weight 0, which only happens with zeros padding
+static void grid_sample_ref_taps(
+    const float coord,
+    const int64_t size,
+    const int64_t mode,
+    const int64_t pad,
+    const bool align,
+    int64_t *idx,
+    double *wei,
+    int64_t *taps)
+{
+    const float x = align ? (coord + 1) / 2 * (size - 1) : ((coord + 1) * size - 1) / 2;
+    if (mode == 2) {
+        // bicubic pads every tap on its own, the sample point stays put
+        const float f = floorf(x);
+        const double t = x - f;
+        const double A = -0.75;
+        const double d[4] = {t + 1, t, 1 - t, 2 - t};
+        *taps = 4;
+        for (int64_t i = 0; i < 4; ++i) {
+            wei[i] = d[i] <= 1 ? ((A + 2) * d[i] - (A + 3)) * d[i] * d[i] + 1
+                               : ((A * d[i] - 5 * A) * d[i] + 8 * A) * d[i] - 4 * A;
+            idx[i] = (int64_t)grid_sample_ref_pad(f - 1 + i, size, pad, align);
+        }
+    } else {
+        const float p = grid_sample_ref_pad(x, size, pad, align);
+        if (mode == 1) {
+            *taps  = 1;
+            idx[0] = (int64_t)nearbyintf(p);
+            wei[0] = 1.0;
+        } else {
+            const float f = floorf(p);
+            *taps  = 2;
+            idx[0] = (int64_t)f;
+            idx[1] = (int64_t)f + 1;
+            wei[0] = 1.0 - (p - f);
+            wei[1] = p - f;
+        }
+    }
+    for (int64_t i = 0; i < *taps; ++i) {
+        if (idx[i] < 0 || idx[i] >= size) {
+            idx[i] = 0;
+            wei[i] = 0.0;
+        }
+    }
+}
+
+class grid_sample_bench_case : public bench_case_impl<ppl_x86_grid_sample_func_t> {
+public:
+    bool parse(const char *line) override
+    {
+        if (!(12 == sscanf(line, GRID_SAMPLE_CASE_STRING_FMT() "%99s", &n_, &c_, &h_, &w_, &oh_, &ow_,
+                &g_, &mode_, &pad_, &align_, &fmt_, name_) &&
+            n_ > 0 && c_ > 0 && h_ > 0 && w_ > 0 && oh_ > 0 && ow_ > 0 && g_ > 0 && mode_ >= 0 && mode_ <= 2 &&
+            pad_ >= 0 && pad_ <= 2 && (align_ == 0 || align_ == 1) && (fmt_ == 0 || fmt_ == 1))) {
+            return false;
+        }
+        if (fmt_ == 0) {
+            impls_ = {
+                {"noarch", ppl::kernel::x86::grid_sample_ndarray_fp32},
+            };
+        } else {
+            impls_ = {
+                {"fma", ppl::kernel::x86::grid_sample_n16cx_fp32_fma},
+#ifdef PPL_USE_X86_AVX512
+                {"avx512", ppl::kernel::x86::grid_sample_n16cx_fp32_avx512},
+#endif
+            };
+        }
+        return true;
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), GRID_SAMPLE_CASE_STRING_FMT() "%s", n_, c_, h_, w_, oh_, ow_,
+            g_, mode_, pad_, align_, fmt_, name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        const ppl::common::dataformat_t format = fmt_ ? ppl::common::DATAFORMAT_N16CX : ppl::common::DATAFORMAT_NDARRAY;
+        bench_make_shape({n_, c_, h_, w_}, ppl::common::DATAFORMAT_NDARRAY, &src_nd_shape_);
+        bench_make_shape({n_, c_, oh_, ow_}, ppl::common::DATAFORMAT_NDARRAY, &dst_nd_shape_);
+        bench_make_shape({n_, c_, h_, w_}, format, &src_shape_);
+        bench_make_shape({n_, c_, oh_, ow_}, format, &dst_shape_);
+        bench_make_shape({n_, oh_, ow_, 2}, ppl::common::DATAFORMAT_NDARRAY, &grid_shape_);
+        if (!src_nd_.alloc(src_nd_shape_.CalcElementsExcludingPadding()) ||
+            !src_.alloc(src_shape_.CalcElementsIncludingPadding()) ||
+            !dst_.alloc(dst_shape_.CalcElementsIncludingPadding()) ||
+            !grid_.alloc(grid_shape_.CalcElementsExcludingPadding())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        bench_fill_uniform(src_nd_.data(), src_nd_.size(), -1.0f, 1.0f);
+        bench_fill_uniform(grid_.data(), grid_.size(), -g_ / 10.0f, g_ / 10.0f);
+        if (fmt_) {
+            return ppl::kernel::x86::reorder_ndarray_n16cx_fp32(&src_nd_shape_, src_nd_.data(), src_.data());
+        }
+        memcpy(src_.data(), src_nd_.data(), src_nd_.bytes());
+        return ppl::common::RC_SUCCESS;
+    }
+
+    // n16cx and ndarray share the tap computation of the library, so the
+    // reference redoes it per pixel
+    ppl::common::RetCode reference() override
+    {
+        if (!dst_ref_.alloc(dst_nd_shape_.CalcElementsExcludingPadding()) ||
+            !dst_nd_.alloc(dst_nd_shape_.CalcElementsExcludingPadding())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        for (int64_t n = 0; n < n_; ++n) {
+            for (int64_t s = 0; s < oh_ * ow_; ++s) {
+                const float *l_grid = grid_.data() + (n * oh_ * ow_ + s) * 2;
+                int64_t x_idx[4], y_idx[4], x_taps, y_taps;
+                double x_wei[4], y_wei[4];
+                grid_sample_ref_taps(l_grid[0], w_, mode_, pad_, align_, x_idx, x_wei, &x_taps);
+                grid_sample_ref_taps(l_grid[1], h_, mode_, pad_, align_, y_idx, y_wei, &y_taps);
+                for (int64_t c = 0; c < c_; ++c) {
+                    const float *l_src = src_nd_.data() + (n * c_ + c) * h_ * w_;
+                    double sum = 0.0;
+                    for (int64_t j = 0; j < y_taps; ++j) {
+                        for (int64_t i = 0; i < x_taps; ++i) {
+                            sum += y_wei[j] * x_wei[i] * l_src[y_idx[j] * w_ + x_idx[i]];
+                        }
+                    }
+                    dst_ref_.data()[(n * c_ + c) * oh_ * ow_ + s] = (float)sum;
+                }
+            }
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    bool check(const float eps) override
+    {
+        if (fmt_) {
+            if (ppl::common::RC_SUCCESS != ppl::kernel::x86::reorder_n16cx_ndarray_fp32(&dst_shape_, dst_.data(), dst_nd_.data())) {
+                std::cerr << "reorder dst failed";
+                return false;
+            }
+        } else {
+            memcpy(dst_nd_.data(), dst_.data(), dst_nd_.bytes());
+        }
+        return check_array_error(dst_nd_.data(), dst_ref_.data(), dst_ref_.size(), eps);
+    }
+
+    ppl::common::RetCode run() override
+    {
+        return func_(&src_shape_, &grid_shape_, src_.data(), grid_.data(), mode_, pad_, align_ != 0, dst_.data());
+    }
+
+    // one mul and one add per tap, 1 tap for nearest, 2x2 for bilinear and 4x4 for bicubic
+    double gops() const override
+    {
+        const int64_t taps = mode_ == 1 ? 0 : (mode_ == 0 ? 4 : 16);
+        return (double)dst_nd_shape_.CalcElementsExcludingPadding() * taps * 2 / 1e9;
+    }
+
+    double gbytes() const override
+    {
+        return (src_.bytes() + grid_.bytes() + dst_.bytes()) / 1e9;
+    }
+
+private:
+    int64_t n_, c_, h_, w_, oh_, ow_, g_, mode_, pad_, align_, fmt_;
+    char name_[100];
+    ppl::common::TensorShape src_nd_shape_, dst_nd_shape_, src_shape_, dst_shape_, grid_shape_;
+    bench_buffer<float> src_nd_, src_, grid_, dst_, dst_nd_, dst_ref_;
+};
+
+bench_case *create_grid_sample_bench_case()
+{
+    return new grid_sample_bench_case();
+}
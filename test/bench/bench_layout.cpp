@@ -0,0 +1,327 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ppl/kernel/x86/fp32/transpose.h"
+#include "ppl/kernel/x86/int64/transpose.h"
+#include "ppl/kernel/x86/bool/transpose.h"
+#include "ppl/kernel/x86/fp32/reorder.h"
+#include "bench/bench_common.h"
+
+#define TRANSPOSE_CASE_STRING_FMT() \
+    "n%" PRId64 "c%" PRId64 "h%" PRId64 "w%" PRId64 \
+    "_perm%" PRId64 "-%" PRId64 "-%" PRId64 "-%" PRId64 \
+    "_n"
+
+// dir 0: ndarray to n16cx, dir 1: n16cx to ndarray
+#define REORDER_CASE_STRING_FMT() "n%" PRId64 "c%" PRId64 "h%" PRId64 "w%" PRId64 "_dir%" PRId64 "_n"
+
+template <typename eT>
+using ppl_x86_transpose_func_t = ppl::common::RetCode (*)(
+    const ppl::common::TensorShape *, const ppl::common::TensorShape *, const eT *, const int32_t *, eT *);
+typedef decltype(ppl::kernel::x86::reorder_ndarray_n16cx_fp32)* ppl_x86_reorder_func_t;
+
+inline void transpose_fill(float *data, const uint64_t len)
+{
+    bench_fill_int(data, len);
+}
+
+// both halves of each int64 differ, so a 4-byte lane swap shows up
+inline void transpose_fill(int64_t *data, const uint64_t len)
+{
+    for (uint64_t i = 0; i < len; ++i) {
+        data[i] = ((int64_t)rand() << 32) | (rand() & 0xffffffff);
+    }
+}
+
+// any byte pattern, the bool kernel only moves bytes
+inline void transpose_fill(uint8_t *data, const uint64_t len)
+{
+    for (uint64_t i = 0; i < len; ++i) {
+        data[i] = rand() & 0xff;
+    }
+}
+
+inline bool transpose_check(float *dst, float *ref, const uint64_t len, const float eps)
+{
+    return check_array_error(dst, ref, len, eps);
+}
+
+template <typename eT>
+inline bool transpose_check(eT *dst, eT *ref, const uint64_t len, const float eps)
+{
+    for (uint64_t i = 0; i < len; ++i) {
+        if (dst[i] != ref[i]) {
+            std::cerr << "diff[" << i << "]=" << (int64_t)dst[i] << " ref:" << (int64_t)ref[i];
+            return false;
+        }
+    }
+    std::cerr << "identical";
+    return true;
+}
+
+// the int64 and bool transposes share the engine of fp32 with 8-byte and 1-byte tiles
+template <typename eT>
+class transpose_bench_case : public bench_case_impl<ppl_x86_transpose_func_t<eT>> {
+public:
+    transpose_bench_case(
+        const ppl::common::datatype_t data_type,
+        const std::vector<std::pair<std::string, ppl_x86_transpose_func_t<eT>>> &impls)
+        : data_type_(data_type)
+    {
+        this->impls_ = impls;
+    }
+
+    bool parse(const char *line) override
+    {
+        if (9 != sscanf(line, TRANSPOSE_CASE_STRING_FMT() "%99s", &n_, &c_, &h_, &w_,
+            &perm_[0], &perm_[1], &perm_[2], &perm_[3], name_)) {
+            return false;
+        }
+        if (n_ <= 0 || c_ <= 0 || h_ <= 0 || w_ <= 0) {
+            return false;
+        }
+        int32_t seen = 0;
+        for (int32_t i = 0; i < 4; ++i) {
+            if (perm_[i] < 0 || perm_[i] >= 4) {
+                return false;
+            }
+            seen |= 1 << perm_[i];
+        }
+        return seen == 0xf;
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), TRANSPOSE_CASE_STRING_FMT() "%s", n_, c_, h_, w_,
+            perm_[0], perm_[1], perm_[2], perm_[3], name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        const int64_t src_dims[4] = {n_, c_, h_, w_};
+        std::vector<int64_t> dst_dims(4);
+        for (int32_t i = 0; i < 4; ++i) {
+            perm32_[i] = (int32_t)perm_[i];
+            dst_dims[i] = src_dims[perm_[i]];
+        }
+        bench_make_shape({n_, c_, h_, w_}, ppl::common::DATAFORMAT_NDARRAY, &src_shape_);
+        bench_make_shape(dst_dims, ppl::common::DATAFORMAT_NDARRAY, &dst_shape_);
+        src_shape_.SetDataType(data_type_);
+        dst_shape_.SetDataType(data_type_);
+        const uint64_t len = src_shape_.CalcElementsExcludingPadding();
+        if (!src_.alloc(len) || !dst_.alloc(len)) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        transpose_fill(src_.data(), len);
+        return ppl::common::RC_SUCCESS;
+    }
+
+    ppl::common::RetCode reference() override
+    {
+        if (!dst_ref_.alloc(dst_.size())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        const int64_t src_dims[4] = {n_, c_, h_, w_};
+        int64_t src_strides[4];
+        src_strides[3] = 1;
+        for (int32_t i = 2; i >= 0; --i) {
+            src_strides[i] = src_strides[i + 1] * src_dims[i + 1];
+        }
+        const int64_t d0 = src_dims[perm_[0]], d1 = src_dims[perm_[1]], d2 = src_dims[perm_[2]], d3 = src_dims[perm_[3]];
+        eT *dst = dst_ref_.data();
+        for (int64_t i0 = 0; i0 < d0; ++i0) {
+            for (int64_t i1 = 0; i1 < d1; ++i1) {
+                for (int64_t i2 = 0; i2 < d2; ++i2) {
+                    for (int64_t i3 = 0; i3 < d3; ++i3) {
+                        *dst++ = src_.data()[
+                            i0 * src_strides[perm_[0]] + i1 * src_strides[perm_[1]] +
+                            i2 * src_strides[perm_[2]] + i3 * src_strides[perm_[3]]];
+                    }
+                }
+            }
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    bool check(const float eps) override
+    {
+        return transpose_check(dst_.data(), dst_ref_.data(), dst_.size(), eps);
+    }
+
+    bool select(const std::string &impl) override
+    {
+        // impls share dst, poison it so elements an impl skips do not keep the values of the previous one
+        memset(dst_.data(), 0x7f, dst_.bytes());
+        return bench_case_impl<ppl_x86_transpose_func_t<eT>>::select(impl);
+    }
+
+    ppl::common::RetCode run() override
+    {
+        return this->func_(&src_shape_, &dst_shape_, src_.data(), perm32_, dst_.data());
+    }
+
+    double gops() const override
+    {
+        return 0;
+    }
+
+    double gbytes() const override
+    {
+        return (src_.bytes() + dst_.bytes()) / 1e9;
+    }
+
+private:
+    const ppl::common::datatype_t data_type_;
+    int64_t n_, c_, h_, w_;
+    int64_t perm_[4];
+    int32_t perm32_[4];
+    char name_[100];
+    ppl::common::TensorShape src_shape_, dst_shape_;
+    bench_buffer<eT> src_, dst_, dst_ref_;
+};
+
+class reorder_bench_case : public bench_case_impl<ppl_x86_reorder_func_t> {
+public:
+    bool parse(const char *line) override
+    {
+        if (6 != sscanf(line, REORDER_CASE_STRING_FMT() "%99s", &n_, &c_, &h_, &w_, &dir_, name_) ||
+            n_ <= 0 || c_ <= 0 || h_ <= 0 || w_ <= 0 || (dir_ != 0 && dir_ != 1)) {
+            return false;
+        }
+        if (dir_ == 0) {
+            impls_ = {
+                {"noarch", ppl::kernel::x86::reorder_ndarray_n16cx_fp32},
+                {"avx", ppl::kernel::x86::reorder_ndarray_n16cx_fp32_avx},
+            };
+        } else {
+            impls_ = {
+                {"noarch", ppl::kernel::x86::reorder_n16cx_ndarray_fp32},
+                {"avx", ppl::kernel::x86::reorder_n16cx_ndarray_fp32_avx},
+            };
+        }
+        return true;
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), REORDER_CASE_STRING_FMT() "%s", n_, c_, h_, w_, dir_, name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        bench_make_shape({n_, c_, h_, w_},
+            dir_ == 0 ? ppl::common::DATAFORMAT_NDARRAY : ppl::common::DATAFORMAT_N16CX, &src_shape_);
+        const uint64_t padded_len = n_ * ppl::kernel::x86::round_up(c_, 16) * h_ * w_;
+        const uint64_t len = n_ * c_ * h_ * w_;
+        if (!src_.alloc(dir_ == 0 ? len : padded_len) || !dst_.alloc(dir_ == 0 ? padded_len : len)) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        bench_fill_int(src_.data(), src_.size());
+        return ppl::common::RC_SUCCESS;
+    }
+
+    ppl::common::RetCode reference() override
+    {
+        if (!dst_ref_.alloc(dst_.size())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        const int64_t padded_c = ppl::kernel::x86::round_up(c_, 16);
+        const int64_t X = h_ * w_;
+        memset(dst_ref_.data(), 0, dst_ref_.bytes());
+        for (int64_t b = 0; b < n_; ++b) {
+            for (int64_t c = 0; c < c_; ++c) {
+                for (int64_t x = 0; x < X; ++x) {
+                    const int64_t nd_off = (b * c_ + c) * X + x;
+                    const int64_t blk_off = ((b * padded_c + ppl::kernel::x86::round(c, 16)) * X + x * 16) + c % 16;
+                    if (dir_ == 0) {
+                        dst_ref_.data()[blk_off] = src_.data()[nd_off];
+                    } else {
+                        dst_ref_.data()[nd_off] = src_.data()[blk_off];
+                    }
+                }
+            }
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    bool check(const float eps) override
+    {
+        return check_array_error(dst_.data(), dst_ref_.data(), dst_.size(), eps);
+    }
+
+    ppl::common::RetCode run() override
+    {
+        return func_(&src_shape_, src_.data(), dst_.data());
+    }
+
+    double gops() const override
+    {
+        return 0;
+    }
+
+    double gbytes() const override
+    {
+        return (src_.bytes() + dst_.bytes()) / 1e9;
+    }
+
+private:
+    int64_t n_, c_, h_, w_, dir_;
+    char name_[100];
+    ppl::common::TensorShape src_shape_;
+    bench_buffer<float> src_, dst_, dst_ref_;
+};
+
+bench_case *create_transpose_bench_case()
+{
+    return new transpose_bench_case<float>(ppl::common::DATATYPE_FLOAT32, {
+        {"noarch", ppl::kernel::x86::transpose_ndarray_fp32},
+        {"avx", ppl::kernel::x86::transpose_ndarray_fp32_avx},
+#ifdef PPL_USE_X86_AVX512
+        {"avx512", ppl::kernel::x86::transpose_ndarray_fp32_avx512},
+#endif
+    });
+}
+
+bench_case *create_transpose_int64_bench_case()
+{
+    return new transpose_bench_case<int64_t>(ppl::common::DATATYPE_INT64, {
+        {"noarch", ppl::kernel::x86::transpose_ndarray_int64},
+        {"avx", ppl::kernel::x86::transpose_ndarray_int64_avx},
+#ifdef PPL_USE_X86_AVX512
+        {"avx512", ppl::kernel::x86::transpose_ndarray_int64_avx512},
+#endif
+    });
+}
+
+bench_case *create_transpose_bool_bench_case()
+{
+    return new transpose_bench_case<uint8_t>(ppl::common::DATATYPE_BOOL, {
+        {"noarch", ppl::kernel::x86::transpose_ndarray_bool},
+    });
+}
+
+bench_case *create_reorder_bench_case()
+{
+    return new reorder_bench_case();
+}
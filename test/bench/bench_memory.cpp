@@ -0,0 +1,147 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ppl/kernel/x86/common/memory.h"
+#include "bench/bench_common.h"
+
+/*
+    memory_copy of bytes from src + soff to dst + doff, memory_init of num
+    elements of elem bytes to dst + doff. buffers come cacheline aligned, so
+    offsets make them unaligned. writes of at least half the llc take the
+    non-temporal store paths, elem up to 256 takes the pattern fill.
+*/
+#define MEMORY_COPY_CASE_STRING_FMT() "bytes%" PRId64 "_soff%" PRId64 "doff%" PRId64 "_n"
+#define MEMORY_INIT_CASE_STRING_FMT() "num%" PRId64 "_elem%" PRId64 "_doff%" PRId64 "_n"
+
+// bytes around the written range that must keep their value
+#define MEMORY_GUARD_BYTES() 64
+#define MEMORY_POISON_BYTE() 0x5a
+
+class memory_bench_case : public bench_case {
+public:
+    memory_bench_case(const bool is_init) : is_init_(is_init) {}
+
+    bool parse(const char *line) override
+    {
+        if (is_init_) {
+            return 4 == sscanf(line, MEMORY_INIT_CASE_STRING_FMT() "%99s", &num_, &elem_, &doff_, name_) &&
+                num_ >= 0 && elem_ > 0 && doff_ >= 0 && doff_ < 64;
+        }
+        elem_ = 1;
+        return 4 == sscanf(line, MEMORY_COPY_CASE_STRING_FMT() "%99s", &num_, &soff_, &doff_, name_) &&
+            num_ >= 0 && soff_ >= 0 && soff_ < 64 && doff_ >= 0 && doff_ < 64;
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        if (is_init_) {
+            snprintf(str, sizeof(str), MEMORY_INIT_CASE_STRING_FMT() "%s", num_, elem_, doff_, name_);
+        } else {
+            snprintf(str, sizeof(str), MEMORY_COPY_CASE_STRING_FMT() "%s", num_, soff_, doff_, name_);
+        }
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        bytes_ = num_ * elem_;
+        const uint64_t src_bytes = is_init_ ? elem_ : soff_ + bytes_;
+        if (!src_.alloc(src_bytes) || !dst_.alloc(doff_ + bytes_ + MEMORY_GUARD_BYTES())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        // no byte equals the poison, so a byte the kernel skips shows up
+        for (uint64_t i = 0; i < src_bytes; ++i) {
+            src_.data()[i] = MEMORY_POISON_BYTE() + 1 + rand() % 255;
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    // the expected dst is a function of src, check() walks it directly
+    ppl::common::RetCode reference() override
+    {
+        return ppl::common::RC_SUCCESS;
+    }
+
+    bool check(const float eps) override
+    {
+        const uint8_t *dst = dst_.data();
+        const uint8_t *src = src_.data();
+        for (uint64_t i = 0; i < dst_.size(); ++i) {
+            const int64_t pos = (int64_t)i - doff_;
+            uint8_t ref = MEMORY_POISON_BYTE();
+            if (pos >= 0 && pos < bytes_) {
+                ref = is_init_ ? src[pos % elem_] : src[soff_ + pos];
+            }
+            if (dst[i] != ref) {
+                std::cerr << "diff[" << pos << "]=" << (int32_t)dst[i] << " ref:" << (int32_t)ref;
+                return false;
+            }
+        }
+        std::cerr << "identical";
+        return true;
+    }
+
+    std::vector<std::string> impl_names() const override
+    {
+        return {"noarch"};
+    }
+
+    bool select(const std::string &impl) override
+    {
+        memset(dst_.data(), MEMORY_POISON_BYTE(), dst_.bytes());
+        return impl == "noarch";
+    }
+
+    ppl::common::RetCode run() override
+    {
+        if (is_init_) {
+            return ppl::kernel::x86::memory_init(src_.data(), elem_, num_, dst_.data() + doff_);
+        }
+        return ppl::kernel::x86::memory_copy(src_.data() + soff_, bytes_, dst_.data() + doff_);
+    }
+
+    double gops() const override
+    {
+        return 0;
+    }
+
+    double gbytes() const override
+    {
+        return (is_init_ ? bytes_ : 2.0 * bytes_) / 1e9;
+    }
+
+private:
+    const bool is_init_;
+    int64_t num_, elem_, soff_ = 0, doff_;
+    int64_t bytes_ = 0;
+    char name_[100];
+    bench_buffer<uint8_t> src_, dst_;
+};
+
+bench_case *create_memory_copy_bench_case()
+{
+    return new memory_bench_case(false);
+}
+
+bench_case *create_memory_init_bench_case()
+{
+    return new memory_bench_case(true);
+}
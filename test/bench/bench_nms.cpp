@@ -0,0 +1,162 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <stdio.h>
+
+#include "ppl/kernel/x86/fp32/mmcv_nms.h"
+#include "bench/bench_common.h"
+
+// iou threshold is given in percent
+#define MMCV_NMS_CASE_STRING_FMT() "box%" PRId64 "_iou%" PRId64 "_n"
+
+typedef ppl::common::RetCode (*ppl_x86_mmcv_nms_func_t)(
+    const float *boxes, const float *scores, const uint32_t num_boxes_in,
+    const float iou_threshold, const int64_t offset, int64_t *dst, int64_t *num_boxes_out);
+
+static ppl::common::RetCode mmcv_nms_noarch_wrapper(
+    const float *boxes, const float *scores, const uint32_t num_boxes_in,
+    const float iou_threshold, const int64_t offset, int64_t *dst, int64_t *num_boxes_out)
+{
+    return ppl::kernel::x86::mmcv_nms_ndarray_fp32(boxes, scores, num_boxes_in, iou_threshold, offset, dst, num_boxes_out);
+}
+
+static ppl::common::RetCode mmcv_nms_fma_wrapper(
+    const float *boxes, const float *scores, const uint32_t num_boxes_in,
+    const float iou_threshold, const int64_t offset, int64_t *dst, int64_t *num_boxes_out)
+{
+    return ppl::kernel::x86::mmcv_nms_ndarray_fp32(
+        ppl::common::ISA_X86_FMA, boxes, scores, num_boxes_in, iou_threshold, offset, dst, num_boxes_out);
+}
+
+#ifdef PPL_USE_X86_AVX512
+static ppl::common::RetCode mmcv_nms_avx512_wrapper(
+    const float *boxes, const float *scores, const uint32_t num_boxes_in,
+    const float iou_threshold, const int64_t offset, int64_t *dst, int64_t *num_boxes_out)
+{
+    return ppl::kernel::x86::mmcv_nms_ndarray_fp32(
+        ppl::common::ISA_X86_AVX512, boxes, scores, num_boxes_in, iou_threshold, offset, dst, num_boxes_out);
+}
+#endif
+
+class mmcv_nms_bench_case : public bench_case_impl<ppl_x86_mmcv_nms_func_t> {
+public:
+    mmcv_nms_bench_case()
+    {
+        impls_ = {
+            {"noarch", mmcv_nms_noarch_wrapper},
+            {"fma", mmcv_nms_fma_wrapper},
+#ifdef PPL_USE_X86_AVX512
+            {"avx512", mmcv_nms_avx512_wrapper},
+#endif
+        };
+    }
+
+    bool parse(const char *line) override
+    {
+        return 3 == sscanf(line, MMCV_NMS_CASE_STRING_FMT() "%99s", &num_boxes_, &iou_, name_) &&
+            num_boxes_ > 0 && num_boxes_ <= UINT32_MAX && iou_ >= 0 && iou_ <= 100;
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), MMCV_NMS_CASE_STRING_FMT() "%s", num_boxes_, iou_, name_);
+        return str;
+    }
+
+    // detector like boxes: clusters of jittered boxes around a few objects
+    ppl::common::RetCode prepare() override
+    {
+        if (!boxes_.alloc(num_boxes_ * 4) || !scores_.alloc(num_boxes_) || !dst_.alloc(num_boxes_)) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        const int64_t num_objects = std::max<int64_t>(num_boxes_ / 32, 1);
+        std::vector<float> objects(num_objects * 4);
+        for (int64_t i = 0; i < num_objects; ++i) {
+            const float cx = rand() % 1024, cy = rand() % 1024;
+            const float w = 16 + rand() % 256, h = 16 + rand() % 256;
+            objects[i * 4 + 0] = cx - w / 2;
+            objects[i * 4 + 1] = cy - h / 2;
+            objects[i * 4 + 2] = cx + w / 2;
+            objects[i * 4 + 3] = cy + h / 2;
+        }
+        for (int64_t i = 0; i < num_boxes_; ++i) {
+            const float *obj = objects.data() + (rand() % num_objects) * 4;
+            const float jitter = 0.1f * std::min(obj[2] - obj[0], obj[3] - obj[1]);
+            for (int64_t k = 0; k < 4; ++k) {
+                boxes_.data()[i * 4 + k] = obj[k] + jitter * (rand() / (float)RAND_MAX * 2.0f - 1.0f);
+            }
+            scores_.data()[i] = rand() / (float)RAND_MAX;
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    ppl::common::RetCode reference() override
+    {
+        if (!dst_ref_.alloc(num_boxes_)) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        return ppl::kernel::x86::mmcv_nms_ndarray_fp32(
+            boxes_.data(), scores_.data(), num_boxes_, iou_ / 100.0f, 0, dst_ref_.data(), &num_out_ref_);
+    }
+
+    // the kept indices must match exactly
+    bool check(const float eps) override
+    {
+        if (num_out_ != num_out_ref_) {
+            std::cerr << "num_boxes_out=" << num_out_ << " ref:" << num_out_ref_;
+            return false;
+        }
+        for (int64_t i = 0; i < num_out_; ++i) {
+            if (dst_.data()[i] != dst_ref_.data()[i]) {
+                std::cerr << "error[" << i << "]=" << dst_.data()[i] << " ref:" << dst_ref_.data()[i];
+                return false;
+            }
+        }
+        std::cerr << "pass";
+        return true;
+    }
+
+    ppl::common::RetCode run() override
+    {
+        return func_(boxes_.data(), scores_.data(), num_boxes_, iou_ / 100.0f, 0, dst_.data(), &num_out_);
+    }
+
+    // upper bound: every pair is tested once with about 10 flops per iou
+    double gops() const override
+    {
+        return (double)num_boxes_ * (num_boxes_ - 1) / 2 * 10 / 1e9;
+    }
+
+    double gbytes() const override
+    {
+        return (boxes_.bytes() + scores_.bytes() + dst_.bytes()) / 1e9;
+    }
+
+private:
+    int64_t num_boxes_, iou_;
+    int64_t num_out_ = 0;
+    int64_t num_out_ref_ = 0;
+    char name_[100];
+    bench_buffer<float> boxes_, scores_;
+    bench_buffer<int64_t> dst_, dst_ref_;
+};
+
+bench_case *create_mmcv_nms_bench_case()
+{
+    return new mmcv_nms_bench_case();
+}
@@ -0,0 +1,191 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <stdio.h>
+#include <float.h>
+
+#include "ppl/kernel/x86/fp32/maxpool2d.h"
+#include "ppl/kernel/x86/fp32/averagepool2d.h"
+#include "bench/bench_common.h"
+
+// n16cx pooling with floor output size, ex is the exclusive mode of averagepool and ignored by maxpool
+#define POOLING_CASE_STRING_FMT() \
+    "n%" PRId64 "c%" PRId64 "h%" PRId64 "w%" PRId64 \
+    "_kh%" PRId64 "kw%" PRId64 "sh%" PRId64 "sw%" PRId64 "ph%" PRId64 "pw%" PRId64 \
+    "_ex%" PRId64 "_n"
+
+typedef decltype(ppl::kernel::x86::averagepool2d_n16cx_blk1x4_fp32_sse)* ppl_x86_averagepool2d_func_t;
+
+static ppl::common::RetCode maxpool2d_n16cx_sse_wrapper(
+    const ppl::common::TensorShape *src_shape, const ppl::common::TensorShape *dst_shape, const float *src,
+    const int64_t kernel_h, const int64_t kernel_w, const int64_t stride_h, const int64_t stride_w,
+    const int64_t pad_h, const int64_t pad_w, const bool exclusive_mode, const bool ceil_mode, float *dst)
+{
+    return ppl::kernel::x86::maxpool2d_n16cx_blk1x4_fp32_sse(
+        src_shape, dst_shape, src, kernel_h, kernel_w, stride_h, stride_w, pad_h, pad_w, dst);
+}
+
+static ppl::common::RetCode maxpool2d_n16cx_avx_wrapper(
+    const ppl::common::TensorShape *src_shape, const ppl::common::TensorShape *dst_shape, const float *src,
+    const int64_t kernel_h, const int64_t kernel_w, const int64_t stride_h, const int64_t stride_w,
+    const int64_t pad_h, const int64_t pad_w, const bool exclusive_mode, const bool ceil_mode, float *dst)
+{
+    return ppl::kernel::x86::maxpool2d_n16cx_blk1x8_fp32_avx(
+        src_shape, dst_shape, src, kernel_h, kernel_w, stride_h, stride_w, pad_h, pad_w, dst);
+}
+
+#ifdef PPL_USE_X86_AVX512
+static ppl::common::RetCode maxpool2d_n16cx_avx512_wrapper(
+    const ppl::common::TensorShape *src_shape, const ppl::common::TensorShape *dst_shape, const float *src,
+    const int64_t kernel_h, const int64_t kernel_w, const int64_t stride_h, const int64_t stride_w,
+    const int64_t pad_h, const int64_t pad_w, const bool exclusive_mode, const bool ceil_mode, float *dst)
+{
+    return ppl::kernel::x86::maxpool2d_n16cx_blk1x16_fp32_avx512(
+        src_shape, dst_shape, src, kernel_h, kernel_w, stride_h, stride_w, pad_h, pad_w, dst);
+}
+#endif
+
+// maxpool is wrapped into the averagepool signature so both share one case class
+class pooling_bench_case : public bench_case_impl<ppl_x86_averagepool2d_func_t> {
+public:
+    pooling_bench_case(const bool is_max) : is_max_(is_max)
+    {
+        if (is_max) {
+            impls_ = {
+                {"sse", maxpool2d_n16cx_sse_wrapper},
+                {"avx", maxpool2d_n16cx_avx_wrapper},
+#ifdef PPL_USE_X86_AVX512
+                {"avx512", maxpool2d_n16cx_avx512_wrapper},
+#endif
+            };
+        } else {
+            impls_ = {
+                {"sse", ppl::kernel::x86::averagepool2d_n16cx_blk1x4_fp32_sse},
+                {"avx", ppl::kernel::x86::averagepool2d_n16cx_blk1x8_fp32_avx},
+#ifdef PPL_USE_X86_AVX512
+                {"avx512", ppl::kernel::x86::averagepool2d_n16cx_blk1x16_fp32_avx512},
+#endif
+            };
+        }
+    }
+
+    bool parse(const char *line) override
+    {
+        return 12 == sscanf(line, POOLING_CASE_STRING_FMT() "%99s", &n_, &c_, &h_, &w_,
+            &kh_, &kw_, &sh_, &sw_, &ph_, &pw_, &ex_, name_) &&
+            n_ > 0 && c_ > 0 && h_ > 0 && w_ > 0 && kh_ > 0 && kw_ > 0 && sh_ > 0 && sw_ > 0 &&
+            ph_ >= 0 && pw_ >= 0 && ph_ < kh_ && pw_ < kw_ && h_ + 2 * ph_ >= kh_ && w_ + 2 * pw_ >= kw_;
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), POOLING_CASE_STRING_FMT() "%s", n_, c_, h_, w_,
+            kh_, kw_, sh_, sw_, ph_, pw_, ex_, name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        oh_ = (h_ + 2 * ph_ - kh_) / sh_ + 1;
+        ow_ = (w_ + 2 * pw_ - kw_) / sw_ + 1;
+        bench_make_shape({n_, c_, h_, w_}, ppl::common::DATAFORMAT_N16CX, &src_shape_);
+        bench_make_shape({n_, c_, oh_, ow_}, ppl::common::DATAFORMAT_N16CX, &dst_shape_);
+        const int64_t padded_c = ppl::kernel::x86::round_up(c_, 16);
+        if (!src_.alloc(n_ * padded_c * h_ * w_) || !dst_.alloc(n_ * padded_c * oh_ * ow_)) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        bench_fill_int(src_.data(), src_.size());
+        return ppl::common::RC_SUCCESS;
+    }
+
+    ppl::common::RetCode reference() override
+    {
+        if (!dst_ref_.alloc(dst_.size())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        const int64_t num_blk = n_ * ppl::kernel::x86::div_up(c_, 16);
+        for (int64_t bc = 0; bc < num_blk; ++bc) {
+            const float *src = src_.data() + bc * h_ * w_ * 16;
+            float *dst = dst_ref_.data() + bc * oh_ * ow_ * 16;
+            for (int64_t oh = 0; oh < oh_; ++oh) {
+                for (int64_t ow = 0; ow < ow_; ++ow) {
+                    const int64_t padded_ihstart = oh * sh_ - ph_;
+                    const int64_t padded_iwstart = ow * sw_ - pw_;
+                    const int64_t padded_ihend = std::min(padded_ihstart + kh_, h_ + ph_);
+                    const int64_t padded_iwend = std::min(padded_iwstart + kw_, w_ + pw_);
+                    const int64_t ihstart = std::max<int64_t>(padded_ihstart, 0);
+                    const int64_t iwstart = std::max<int64_t>(padded_iwstart, 0);
+                    const int64_t ihend = std::min(padded_ihend, h_);
+                    const int64_t iwend = std::min(padded_iwend, w_);
+                    const int64_t pool_len = ex_
+                        ? (ihend - ihstart) * (iwend - iwstart)
+                        : (padded_ihend - padded_ihstart) * (padded_iwend - padded_iwstart);
+                    for (int64_t cb = 0; cb < 16; ++cb) {
+                        double acc = is_max_ ? -DBL_MAX : 0.0;
+                        for (int64_t ih = ihstart; ih < ihend; ++ih) {
+                            for (int64_t iw = iwstart; iw < iwend; ++iw) {
+                                const double v = src[(ih * w_ + iw) * 16 + cb];
+                                acc = is_max_ ? std::max(acc, v) : acc + v;
+                            }
+                        }
+                        dst[(oh * ow_ + ow) * 16 + cb] = is_max_ ? acc : acc / pool_len;
+                    }
+                }
+            }
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    bool check(const float eps) override
+    {
+        return check_array_error(dst_.data(), dst_ref_.data(), dst_.size(), eps);
+    }
+
+    ppl::common::RetCode run() override
+    {
+        return func_(&src_shape_, &dst_shape_, src_.data(), kh_, kw_, sh_, sw_, ph_, pw_, ex_ != 0, false, dst_.data());
+    }
+
+    double gops() const override
+    {
+        return (double)dst_.size() * kh_ * kw_ / 1e9;
+    }
+
+    double gbytes() const override
+    {
+        return (src_.bytes() + dst_.bytes()) / 1e9;
+    }
+
+private:
+    const bool is_max_;
+    int64_t n_, c_, h_, w_, kh_, kw_, sh_, sw_, ph_, pw_, ex_;
+    int64_t oh_, ow_;
+    char name_[100];
+    ppl::common::TensorShape src_shape_, dst_shape_;
+    bench_buffer<float> src_, dst_, dst_ref_;
+};
+
+bench_case *create_maxpool2d_bench_case()
+{
+    return new pooling_bench_case(true);
+}
+
+bench_case *create_averagepool2d_bench_case()
+{
+    return new pooling_bench_case(false);
+}
@@ -0,0 +1,256 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+#include <math.h>
+
+#include "ppl/kernel/x86/fp32/reduce.h"
+#include "ppl/kernel/x86/fp32/reorder.h"
+#include "bench/bench_common.h"
+
+// bit i of rmask reduces dim i, e.g. rmask12 reduces h and w of nchw.
+// fmt 0 runs on ndarray, fmt 1 on n16cx.
+#define REDUCE_CASE_STRING_FMT() "n%" PRId64 "c%" PRId64 "h%" PRId64 "w%" PRId64 "_rmask%" PRId64 "_fmt%" PRId64 "_n"
+
+typedef decltype(ppl::kernel::x86::reduce_sum_fp32_sse)* ppl_x86_reduce_func_t;
+
+enum reduce_bench_op_t {
+    REDUCE_BENCH_SUM,
+    REDUCE_BENCH_MAX,
+    REDUCE_BENCH_PROD,
+    REDUCE_BENCH_L1,
+    REDUCE_BENCH_L2,
+    REDUCE_BENCH_SUM_SQUARE,
+    REDUCE_BENCH_LOG_SUM_EXP,
+};
+
+class reduce_bench_case : public bench_case_impl<ppl_x86_reduce_func_t> {
+public:
+    reduce_bench_case(const reduce_bench_op_t op, const std::vector<std::pair<std::string, ppl_x86_reduce_func_t>> &impls)
+        : op_(op)
+    {
+        impls_ = impls;
+    }
+
+    bool parse(const char *line) override
+    {
+        return 7 == sscanf(line, REDUCE_CASE_STRING_FMT() "%99s", &n_, &c_, &h_, &w_, &rmask_, &fmt_, name_) &&
+            n_ > 0 && c_ > 0 && h_ > 0 && w_ > 0 && rmask_ > 0 && rmask_ < 16 && (fmt_ == 0 || fmt_ == 1);
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), REDUCE_CASE_STRING_FMT() "%s", n_, c_, h_, w_, rmask_, fmt_, name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        const ppl::common::dataformat_t format = fmt_ ? ppl::common::DATAFORMAT_N16CX : ppl::common::DATAFORMAT_NDARRAY;
+        const std::vector<int64_t> src_dims = {n_, c_, h_, w_};
+        std::vector<int64_t> dst_dims = src_dims;
+        axes_.clear();
+        for (int32_t i = 0; i < 4; ++i) {
+            if (rmask_ & (1 << i)) {
+                axes_.push_back(i);
+                dst_dims[i] = 1;
+            }
+        }
+        bench_make_shape(src_dims, ppl::common::DATAFORMAT_NDARRAY, &src_nd_shape_);
+        bench_make_shape(dst_dims, ppl::common::DATAFORMAT_NDARRAY, &dst_nd_shape_);
+        bench_make_shape(src_dims, format, &src_shape_);
+        bench_make_shape(dst_dims, format, &dst_shape_);
+        if (!src_nd_.alloc(src_nd_shape_.CalcElementsExcludingPadding()) ||
+            !src_.alloc(src_shape_.CalcElementsIncludingPadding()) ||
+            !dst_.alloc(dst_shape_.CalcElementsIncludingPadding())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        if (op_ == REDUCE_BENCH_PROD) {
+            // close to 1 so that long products neither overflow nor vanish,
+            // but not so close that every product rounds the same way
+            bench_fill_uniform(src_nd_.data(), src_nd_.size(), 0.99f, 1.01f);
+            for (uint64_t i = 0; i < src_nd_.size(); i += 3) {
+                src_nd_.data()[i] = -src_nd_.data()[i];
+            }
+        } else if (op_ == REDUCE_BENCH_LOG_SUM_EXP) {
+            bench_fill_uniform(src_nd_.data(), src_nd_.size(), -4.0f, 4.0f);
+        } else {
+            // integer values keep the fp32 sums of long rows exact
+            bench_fill_int(src_nd_.data(), src_nd_.size(), 7, -3, 1.0f);
+        }
+        if (fmt_) {
+            return ppl::kernel::x86::reorder_ndarray_n16cx_fp32(&src_nd_shape_, src_nd_.data(), src_.data());
+        }
+        memcpy(src_.data(), src_nd_.data(), src_nd_.bytes());
+        return ppl::common::RC_SUCCESS;
+    }
+
+    ppl::common::RetCode reference() override
+    {
+        if (!dst_ref_.alloc(dst_nd_shape_.CalcElementsExcludingPadding()) ||
+            !dst_nd_.alloc(dst_nd_shape_.CalcElementsExcludingPadding())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        double init = 0.0;
+        if (op_ == REDUCE_BENCH_MAX) init = -DBL_MAX;
+        if (op_ == REDUCE_BENCH_PROD) init = 1.0;
+        std::vector<double> acc(dst_ref_.size(), init);
+        const int64_t dims[4] = {n_, c_, h_, w_};
+        int64_t dst_dims[4];
+        for (int32_t i = 0; i < 4; ++i) {
+            dst_dims[i] = (rmask_ & (1 << i)) ? 1 : dims[i];
+        }
+        int64_t idx[4];
+        for (idx[0] = 0; idx[0] < n_; ++idx[0]) {
+            for (idx[1] = 0; idx[1] < c_; ++idx[1]) {
+                for (idx[2] = 0; idx[2] < h_; ++idx[2]) {
+                    for (idx[3] = 0; idx[3] < w_; ++idx[3]) {
+                        int64_t src_off = 0;
+                        int64_t dst_off = 0;
+                        for (int32_t i = 0; i < 4; ++i) {
+                            src_off = src_off * dims[i] + idx[i];
+                            dst_off = dst_off * dst_dims[i] + ((rmask_ & (1 << i)) ? 0 : idx[i]);
+                        }
+                        const double v = src_nd_.data()[src_off];
+                        double &a = acc[dst_off];
+                        switch (op_) {
+                            case REDUCE_BENCH_MAX: a = std::max(a, v); break;
+                            case REDUCE_BENCH_PROD: a *= v; break;
+                            case REDUCE_BENCH_L1: a += fabs(v); break;
+                            case REDUCE_BENCH_L2:
+                            case REDUCE_BENCH_SUM_SQUARE: a += v * v; break;
+                            case REDUCE_BENCH_LOG_SUM_EXP: a += exp(v); break;
+                            default: a += v; break;
+                        }
+                    }
+                }
+            }
+        }
+        for (uint64_t i = 0; i < dst_ref_.size(); ++i) {
+            if (op_ == REDUCE_BENCH_L2) acc[i] = sqrt(acc[i]);
+            if (op_ == REDUCE_BENCH_LOG_SUM_EXP) acc[i] = log(acc[i]);
+            dst_ref_.data()[i] = acc[i];
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    bool check(const float eps) override
+    {
+        if (fmt_) {
+            if (ppl::common::RC_SUCCESS != ppl::kernel::x86::reorder_n16cx_ndarray_fp32(&dst_shape_, dst_.data(), dst_nd_.data())) {
+                std::cerr << "reorder dst failed";
+                return false;
+            }
+        } else {
+            memcpy(dst_nd_.data(), dst_.data(), dst_nd_.bytes());
+        }
+        // rounding of a product chain grows with its length, about 1e-4 for 1M
+        const float prod_eps = op_ == REDUCE_BENCH_PROD ? std::max(eps, 1e-3f) : eps;
+        return check_array_error(dst_nd_.data(), dst_ref_.data(), dst_ref_.size(), prod_eps);
+    }
+
+    const void *output() const override
+    {
+        return dst_.data();
+    }
+
+    uint64_t output_bytes() const override
+    {
+        return dst_.bytes();
+    }
+
+    ppl::common::RetCode run() override
+    {
+        return func_(&src_shape_, &dst_shape_, src_.data(), axes_.data(), (int32_t)axes_.size(), dst_.data());
+    }
+
+    double gops() const override
+    {
+        return src_nd_.size() / 1e9;
+    }
+
+    double gbytes() const override
+    {
+        return (src_.bytes() + dst_.bytes()) / 1e9;
+    }
+
+private:
+    const reduce_bench_op_t op_;
+    int64_t n_, c_, h_, w_, rmask_, fmt_;
+    char name_[100];
+    std::vector<int32_t> axes_;
+    ppl::common::TensorShape src_nd_shape_, dst_nd_shape_, src_shape_, dst_shape_;
+    bench_buffer<float> src_nd_, src_, dst_, dst_nd_, dst_ref_;
+};
+
+#ifdef PPL_USE_X86_AVX512
+#define REDUCE_BENCH_IMPLS(OP) \
+    {{"sse", ppl::kernel::x86::reduce_##OP##_fp32_sse}, \
+     {"avx", ppl::kernel::x86::reduce_##OP##_fp32_avx}, \
+     {"avx512", ppl::kernel::x86::reduce_##OP##_fp32_avx512}}
+#else
+#define REDUCE_BENCH_IMPLS(OP) \
+    {{"sse", ppl::kernel::x86::reduce_##OP##_fp32_sse}, \
+     {"avx", ppl::kernel::x86::reduce_##OP##_fp32_avx}}
+#endif
+
+bench_case *create_reduce_sum_bench_case()
+{
+    return new reduce_bench_case(REDUCE_BENCH_SUM, REDUCE_BENCH_IMPLS(sum));
+}
+
+bench_case *create_reduce_max_bench_case()
+{
+    return new reduce_bench_case(REDUCE_BENCH_MAX, REDUCE_BENCH_IMPLS(max));
+}
+
+bench_case *create_reduce_prod_bench_case()
+{
+    return new reduce_bench_case(REDUCE_BENCH_PROD, REDUCE_BENCH_IMPLS(prod));
+}
+
+bench_case *create_reduce_l1_bench_case()
+{
+    return new reduce_bench_case(REDUCE_BENCH_L1, REDUCE_BENCH_IMPLS(l1));
+}
+
+bench_case *create_reduce_l2_bench_case()
+{
+    return new reduce_bench_case(REDUCE_BENCH_L2, REDUCE_BENCH_IMPLS(l2));
+}
+
+bench_case *create_reduce_sum_square_bench_case()
+{
+    return new reduce_bench_case(REDUCE_BENCH_SUM_SQUARE, REDUCE_BENCH_IMPLS(sum_square));
+}
+
+#undef REDUCE_BENCH_IMPLS
+
+// log-sum-exp has an fma kernel instead of an avx one
+bench_case *create_reduce_log_sum_exp_bench_case()
+{
+    return new reduce_bench_case(REDUCE_BENCH_LOG_SUM_EXP, {
+        {"sse", ppl::kernel::x86::reduce_log_sum_exp_fp32_sse},
+        {"fma", ppl::kernel::x86::reduce_log_sum_exp_fp32_fma},
+#ifdef PPL_USE_X86_AVX512
+        {"avx512", ppl::kernel::x86::reduce_log_sum_exp_fp32_avx512},
+#endif
+    });
+}
@@ -0,0 +1,174 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <stdio.h>
+
+#include "ppl/kernel/x86/fp32/relation.h"
+#include "bench/bench_common.h"
+
+/*
+    op 0: greater, 1: equal, 2: less. bit i of lmask/rmask broadcasts dim i
+    of src0/src1, both 0 runs the eltwise kernel, anything else the ndarray one.
+*/
+#define RELATION_CASE_STRING_FMT() \
+    "n%" PRId64 "c%" PRId64 "h%" PRId64 "w%" PRId64 "_lmask%" PRId64 "rmask%" PRId64 "_op%" PRId64 "_n"
+
+typedef decltype(ppl::kernel::x86::greater_eltwise_fp32_sse)* ppl_x86_relation_eltwise_func_t;
+typedef decltype(ppl::kernel::x86::greater_ndarray_fp32_sse)* ppl_x86_relation_ndarray_func_t;
+
+struct relation_bench_funcs {
+    ppl_x86_relation_eltwise_func_t eltwise[3];
+    ppl_x86_relation_ndarray_func_t ndarray[3];
+};
+
+#define RELATION_BENCH_FUNCS(ISA) \
+    {{ppl::kernel::x86::greater_eltwise_fp32_##ISA, ppl::kernel::x86::equal_eltwise_fp32_##ISA, ppl::kernel::x86::less_eltwise_fp32_##ISA}, \
+     {ppl::kernel::x86::greater_ndarray_fp32_##ISA, ppl::kernel::x86::equal_ndarray_fp32_##ISA, ppl::kernel::x86::less_ndarray_fp32_##ISA}}
+
+class relation_bench_case : public bench_case {
+public:
+    relation_bench_case()
+    {
+        impls_ = {
+            {"sse", RELATION_BENCH_FUNCS(sse)},
+            {"avx", RELATION_BENCH_FUNCS(avx)},
+#ifdef PPL_USE_X86_AVX512
+            {"avx512", RELATION_BENCH_FUNCS(avx512)},
+#endif
+        };
+    }
+
+    bool parse(const char *line) override
+    {
+        return 8 == sscanf(line, RELATION_CASE_STRING_FMT() "%99s", &n_, &c_, &h_, &w_, &lmask_, &rmask_, &op_, name_) &&
+            n_ > 0 && c_ > 0 && h_ > 0 && w_ > 0 && lmask_ >= 0 && lmask_ < 16 && rmask_ >= 0 && rmask_ < 16 &&
+            op_ >= 0 && op_ <= 2;
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), RELATION_CASE_STRING_FMT() "%s", n_, c_, h_, w_, lmask_, rmask_, op_, name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        dims_ = {n_, c_, h_, w_};
+        bench_make_shape(bench_bcast_dims(dims_, lmask_), ppl::common::DATAFORMAT_NDARRAY, &src0_shape_);
+        bench_make_shape(bench_bcast_dims(dims_, rmask_), ppl::common::DATAFORMAT_NDARRAY, &src1_shape_);
+        bench_make_shape(dims_, ppl::common::DATAFORMAT_NDARRAY, &dst_shape_);
+        dst_shape_.SetDataType(ppl::common::DATATYPE_BOOL);
+        if (!src0_.alloc(src0_shape_.CalcElementsExcludingPadding()) ||
+            !src1_.alloc(src1_shape_.CalcElementsExcludingPadding()) ||
+            !dst_.alloc(dst_shape_.CalcElementsExcludingPadding())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        // three values make all of greater, equal and less frequent
+        bench_fill_int(src0_.data(), src0_.size(), 3, -1, 1.0f);
+        bench_fill_int(src1_.data(), src1_.size(), 3, -1, 1.0f);
+        return ppl::common::RC_SUCCESS;
+    }
+
+    ppl::common::RetCode reference() override
+    {
+        if (!dst_ref_.alloc(dst_.size())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        for (int64_t i = 0; i < (int64_t)dst_.size(); ++i) {
+            const float s0 = src0_.data()[bench_bcast_offset(dims_, lmask_, i)];
+            const float s1 = src1_.data()[bench_bcast_offset(dims_, rmask_, i)];
+            dst_ref_.data()[i] = op_ == 0 ? s0 > s1 : (op_ == 1 ? s0 == s1 : s0 < s1);
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    bool check(const float eps) override
+    {
+        for (uint64_t i = 0; i < dst_.size(); ++i) {
+            if (dst_.data()[i] != dst_ref_.data()[i]) {
+                std::cerr << "error[" << i << "]=" << (int32_t)dst_.data()[i] << " ref:" << (int32_t)dst_ref_.data()[i];
+                return false;
+            }
+        }
+        std::cerr << "pass";
+        return true;
+    }
+
+    const void *output() const override
+    {
+        return dst_.data();
+    }
+
+    uint64_t output_bytes() const override
+    {
+        return dst_.bytes();
+    }
+
+    std::vector<std::string> impl_names() const override
+    {
+        std::vector<std::string> names;
+        for (auto &impl : impls_) {
+            names.push_back(impl.first);
+        }
+        return names;
+    }
+
+    bool select(const std::string &impl) override
+    {
+        func_ = nullptr;
+        for (auto &it : impls_) {
+            if (it.first == impl) {
+                func_ = &it.second;
+            }
+        }
+        return func_ != nullptr;
+    }
+
+    ppl::common::RetCode run() override
+    {
+        if (lmask_ == 0 && rmask_ == 0) {
+            return func_->eltwise[op_](&dst_shape_, src0_.data(), src1_.data(), dst_.data());
+        }
+        return func_->ndarray[op_](&src0_shape_, &src1_shape_, &dst_shape_, src0_.data(), src1_.data(), dst_.data());
+    }
+
+    double gops() const override
+    {
+        return dst_.size() / 1e9;
+    }
+
+    double gbytes() const override
+    {
+        return (src0_.bytes() + src1_.bytes() + dst_.bytes()) / 1e9;
+    }
+
+private:
+    int64_t n_, c_, h_, w_, lmask_, rmask_, op_;
+    char name_[100];
+    std::vector<int64_t> dims_;
+    ppl::common::TensorShape src0_shape_, src1_shape_, dst_shape_;
+    bench_buffer<float> src0_, src1_;
+    bench_buffer<uint8_t> dst_, dst_ref_;
+    std::vector<std::pair<std::string, relation_bench_funcs>> impls_;
+    const relation_bench_funcs *func_ = nullptr;
+};
+
+bench_case *create_relation_bench_case()
+{
+    return new relation_bench_case();
+}
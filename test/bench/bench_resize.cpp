@@ -0,0 +1,293 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <stdio.h>
+#include <math.h>
+
+#include "ppl/kernel/x86/fp32/resize2d.h"
+#include "ppl/kernel/x86/fp32/reorder.h"
+#include "bench/bench_common.h"
+
+/*
+    mode: 0 nearest, 1 linear, 2 cubic.
+    ct: resize2d_coord_trans_mode, 5 is tf_crop_and_resize with a roi that
+    reaches outside of the image on two sides to hit the extrapolation.
+    nm: resize2d_nearest_mode. ex: cubic exclude_outside. fmt: 0 ndarray, 1 n16cx.
+*/
+#define RESIZE_CASE_STRING_FMT() \
+    "n%" PRId64 "c%" PRId64 "ih%" PRId64 "iw%" PRId64 \
+    "_oh%" PRId64 "ow%" PRId64 "_mode%" PRId64 "_ct%" PRId64 \
+    "_nm%" PRId64 "_ex%" PRId64 "_fmt%" PRId64 "_n"
+
+typedef decltype(ppl::kernel::x86::resize2d_ndarray_fp32)* ppl_x86_resize2d_func_t;
+
+// output taps of one axis, computed per pixel straight from the onnx formulas
+static void resize2d_ref_taps(
+    const ppl::kernel::x86::resize2d_param &param,
+    const int64_t o,
+    const int64_t in_len,
+    const int64_t out_len,
+    const float scale,
+    const float roi_start,
+    const float roi_end,
+    bool *outside,
+    int64_t *idx,
+    double *wei,
+    int64_t *taps)
+{
+    float x;
+    switch (param.coord_trans_mode) {
+        case ppl::kernel::x86::resize2d_coord_trans_mode::PYTORCH_HALF_PIXEL:
+            x = out_len > 1 ? (o + 0.5f) / scale - 0.5f : 0.0f;
+            break;
+        case ppl::kernel::x86::resize2d_coord_trans_mode::ALIGN_CORNERS:
+            x = out_len > 1 ? o * float(in_len - 1) / float(out_len - 1) : 0.0f;
+            break;
+        case ppl::kernel::x86::resize2d_coord_trans_mode::ASYMMETRIC:
+            x = o / scale;
+            break;
+        case ppl::kernel::x86::resize2d_coord_trans_mode::TF_HALF_PIXEL_FOR_NN:
+            x = (o + 0.5f) / scale;
+            break;
+        case ppl::kernel::x86::resize2d_coord_trans_mode::TF_CROP_AND_RESIZE:
+            x = out_len > 1
+                ? roi_start * (in_len - 1) + o * (roi_end - roi_start) * (in_len - 1) / float(out_len - 1)
+                : 0.5f * (roi_start + roi_end) * (in_len - 1);
+            break;
+        default:
+            x = (o + 0.5f) / scale - 0.5f;
+            break;
+    }
+    *outside = param.coord_trans_mode == ppl::kernel::x86::resize2d_coord_trans_mode::TF_CROP_AND_RESIZE &&
+        (x < 0 || x > in_len - 1);
+    auto clamp = [in_len](const int64_t i) {
+        return std::min<int64_t>(std::max<int64_t>(i, 0), in_len - 1);
+    };
+
+    if (param.interp_mode == ppl::kernel::x86::resize2d_interp_mode::NEAREST) {
+        const double fx = floor(x);
+        int64_t i;
+        switch (param.nearest_mode) {
+            case ppl::kernel::x86::resize2d_nearest_mode::ROUND_PREFER_CEIL:
+                i = (int64_t)(x - fx >= 0.5 ? fx + 1 : fx);
+                break;
+            case ppl::kernel::x86::resize2d_nearest_mode::FLOOR:
+                i = (int64_t)fx;
+                break;
+            case ppl::kernel::x86::resize2d_nearest_mode::CEIL:
+                i = (int64_t)ceil(x);
+                break;
+            default:
+                i = (int64_t)(x - fx > 0.5 ? fx + 1 : fx);
+                break;
+        }
+        idx[0] = clamp(i);
+        wei[0] = 1.0;
+        *taps  = 1;
+    } else if (param.interp_mode == ppl::kernel::x86::resize2d_interp_mode::LINEAR) {
+        const double cx = std::min<double>(std::max<double>(x, 0.0), in_len - 1);
+        const int64_t i = (int64_t)floor(cx);
+        idx[0] = i;
+        idx[1] = clamp(i + 1);
+        wei[1] = cx - i;
+        wei[0] = 1.0 - wei[1];
+        *taps  = 2;
+    } else {
+        const double A  = param.cubic_coeff_a;
+        const int64_t i = (int64_t)floor(x);
+        double sum      = 0.0;
+        for (int64_t k = 0; k < 4; ++k) {
+            // keys kernel on the distance to tap i - 1 + k
+            const double d = fabs(x - (i - 1 + k));
+            double w;
+            if (d <= 1) {
+                w = ((A + 2) * d - (A + 3)) * d * d + 1;
+            } else if (d < 2) {
+                w = ((A * d - 5 * A) * d + 8 * A) * d - 4 * A;
+            } else {
+                w = 0;
+            }
+            if (param.exclude_outside && (i - 1 + k < 0 || i - 1 + k >= in_len)) {
+                w = 0;
+            }
+            idx[k] = clamp(i - 1 + k);
+            wei[k] = w;
+            sum += w;
+        }
+        if (param.exclude_outside && sum != 0.0) {
+            for (int64_t k = 0; k < 4; ++k) {
+                wei[k] /= sum;
+            }
+        }
+        *taps = 4;
+    }
+}
+
+class resize2d_bench_case : public bench_case_impl<ppl_x86_resize2d_func_t> {
+public:
+    bool parse(const char *line) override
+    {
+        if (!(12 == sscanf(line, RESIZE_CASE_STRING_FMT() "%99s", &n_, &c_, &ih_, &iw_, &oh_, &ow_,
+                &mode_, &ct_, &nm_, &ex_, &fmt_, name_) &&
+            n_ > 0 && c_ > 0 && ih_ > 0 && iw_ > 0 && oh_ > 0 && ow_ > 0 && mode_ >= 0 && mode_ <= 2 &&
+            ct_ >= 0 && ct_ <= 5 && nm_ >= 0 && nm_ <= 3 && (ex_ == 0 || ex_ == 1) && (fmt_ == 0 || fmt_ == 1))) {
+            return false;
+        }
+        if (fmt_ == 0) {
+            impls_ = {
+                {"noarch", ppl::kernel::x86::resize2d_ndarray_fp32},
+                {"avx", ppl::kernel::x86::resize2d_ndarray_fp32_avx},
+#ifdef PPL_USE_X86_AVX512
+                {"avx512", ppl::kernel::x86::resize2d_ndarray_fp32_avx512},
+#endif
+            };
+        } else {
+            impls_ = {
+                {"avx", ppl::kernel::x86::resize2d_n16cx_fp32_avx},
+#ifdef PPL_USE_X86_AVX512
+                {"avx512", ppl::kernel::x86::resize2d_n16cx_fp32_avx512},
+#endif
+            };
+        }
+        return true;
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), RESIZE_CASE_STRING_FMT() "%s", n_, c_, ih_, iw_, oh_, ow_,
+            mode_, ct_, nm_, ex_, fmt_, name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        param_ = ppl::kernel::x86::resize2d_param();
+        param_.coord_trans_mode = (ppl::kernel::x86::resize2d_coord_trans_mode_t)ct_;
+        param_.interp_mode = (ppl::kernel::x86::resize2d_interp_mode_t)mode_;
+        param_.nearest_mode = (ppl::kernel::x86::resize2d_nearest_mode_t)nm_;
+        param_.scale_h = (float)oh_ / ih_;
+        param_.scale_w = (float)ow_ / iw_;
+        param_.cubic_coeff_a = -0.75f;
+        param_.exclude_outside = ex_ != 0;
+        param_.extrapolation_value = 0.5f;
+        param_.roi_start_h = -0.2f;
+        param_.roi_end_h = 0.9f;
+        param_.roi_start_w = 0.1f;
+        param_.roi_end_w = 1.2f;
+
+        const ppl::common::dataformat_t format = fmt_ ? ppl::common::DATAFORMAT_N16CX : ppl::common::DATAFORMAT_NDARRAY;
+        bench_make_shape({n_, c_, ih_, iw_}, ppl::common::DATAFORMAT_NDARRAY, &src_nd_shape_);
+        bench_make_shape({n_, c_, oh_, ow_}, ppl::common::DATAFORMAT_NDARRAY, &dst_nd_shape_);
+        bench_make_shape({n_, c_, ih_, iw_}, format, &src_shape_);
+        bench_make_shape({n_, c_, oh_, ow_}, format, &dst_shape_);
+        const uint64_t temp_bytes = fmt_
+            ? ppl::kernel::x86::resize2d_n16cx_fp32_get_buffer_bytes(&dst_shape_, &param_)
+            : ppl::kernel::x86::resize2d_ndarray_fp32_get_buffer_bytes(&dst_shape_, &param_);
+        if (!src_nd_.alloc(src_nd_shape_.CalcElementsExcludingPadding()) ||
+            !src_.alloc(src_shape_.CalcElementsIncludingPadding()) ||
+            !dst_.alloc(dst_shape_.CalcElementsIncludingPadding()) ||
+            !temp_.alloc(temp_bytes)) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        bench_fill_uniform(src_nd_.data(), src_nd_.size(), -1.0f, 1.0f);
+        if (fmt_) {
+            return ppl::kernel::x86::reorder_ndarray_n16cx_fp32(&src_nd_shape_, src_nd_.data(), src_.data());
+        }
+        memcpy(src_.data(), src_nd_.data(), src_nd_.bytes());
+        return ppl::common::RC_SUCCESS;
+    }
+
+    // the engine shares its index and weight tables between every isa,
+    // so the reference recomputes the taps of each output pixel in double
+    ppl::common::RetCode reference() override
+    {
+        if (!dst_ref_.alloc(dst_nd_shape_.CalcElementsExcludingPadding()) ||
+            !dst_nd_.alloc(dst_nd_shape_.CalcElementsExcludingPadding())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        for (int64_t oh = 0; oh < oh_; ++oh) {
+            bool h_outside;
+            int64_t h_idx[4], h_taps;
+            double h_wei[4];
+            resize2d_ref_taps(param_, oh, ih_, oh_, param_.scale_h, param_.roi_start_h, param_.roi_end_h,
+                &h_outside, h_idx, h_wei, &h_taps);
+            for (int64_t ow = 0; ow < ow_; ++ow) {
+                bool w_outside;
+                int64_t w_idx[4], w_taps;
+                double w_wei[4];
+                resize2d_ref_taps(param_, ow, iw_, ow_, param_.scale_w, param_.roi_start_w, param_.roi_end_w,
+                    &w_outside, w_idx, w_wei, &w_taps);
+                for (int64_t nc = 0; nc < n_ * c_; ++nc) {
+                    const float *l_src = src_nd_.data() + nc * ih_ * iw_;
+                    double sum = 0.0;
+                    for (int64_t i = 0; i < h_taps; ++i) {
+                        for (int64_t j = 0; j < w_taps; ++j) {
+                            sum += h_wei[i] * w_wei[j] * l_src[h_idx[i] * iw_ + w_idx[j]];
+                        }
+                    }
+                    dst_ref_.data()[(nc * oh_ + oh) * ow_ + ow] =
+                        h_outside || w_outside ? param_.extrapolation_value : (float)sum;
+                }
+            }
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    bool check(const float eps) override
+    {
+        if (fmt_) {
+            if (ppl::common::RC_SUCCESS != ppl::kernel::x86::reorder_n16cx_ndarray_fp32(&dst_shape_, dst_.data(), dst_nd_.data())) {
+                std::cerr << "reorder dst failed";
+                return false;
+            }
+        } else {
+            memcpy(dst_nd_.data(), dst_.data(), dst_nd_.bytes());
+        }
+        return check_array_error(dst_nd_.data(), dst_ref_.data(), dst_ref_.size(), eps);
+    }
+
+    ppl::common::RetCode run() override
+    {
+        return func_(&src_shape_, &dst_shape_, src_.data(), &param_, temp_.data(), dst_.data());
+    }
+
+    // one mul and one add per tap, 1 tap for nearest, 2x2 for linear and 4x4 for cubic
+    double gops() const override
+    {
+        const int64_t taps = mode_ == 0 ? 0 : (mode_ == 1 ? 4 : 16);
+        return (double)dst_nd_shape_.CalcElementsExcludingPadding() * taps * 2 / 1e9;
+    }
+
+    double gbytes() const override
+    {
+        return (src_.bytes() + dst_.bytes()) / 1e9;
+    }
+
+private:
+    int64_t n_, c_, ih_, iw_, oh_, ow_, mode_, ct_, nm_, ex_, fmt_;
+    char name_[100];
+    ppl::kernel::x86::resize2d_param param_;
+    ppl::common::TensorShape src_nd_shape_, dst_nd_shape_, src_shape_, dst_shape_;
+    bench_buffer<float> src_nd_, src_, dst_, dst_nd_, dst_ref_;
+    bench_buffer<uint8_t> temp_;
+};
+
+bench_case *create_resize2d_bench_case()
+{
+    return new resize2d_bench_case();
+}
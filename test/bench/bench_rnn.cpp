@@ -0,0 +1,194 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <stdio.h>
+#include <math.h>
+
+#include "ppl/kernel/x86/fp32/lstm.h"
+#include "bench/bench_common.h"
+
+// dir 0: forward, 1: reverse, 2: bidirectional
+#define LSTM_CASE_STRING_FMT() \
+    "seq%" PRId64 "b%" PRId64 "in%" PRId64 "hid%" PRId64 "_dir%" PRId64 "_n"
+
+typedef decltype(ppl::kernel::x86::lstm_fp32_sse)* ppl_x86_lstm_func_t;
+
+class lstm_bench_case : public bench_case_impl<ppl_x86_lstm_func_t> {
+public:
+    lstm_bench_case()
+    {
+        impls_ = {
+            {"sse", ppl::kernel::x86::lstm_fp32_sse},
+            {"fma", ppl::kernel::x86::lstm_fp32_fma},
+#ifdef PPL_USE_X86_AVX512
+            {"avx512", ppl::kernel::x86::lstm_fp32_avx512},
+#endif
+        };
+    }
+
+    bool parse(const char *line) override
+    {
+        return 6 == sscanf(line, LSTM_CASE_STRING_FMT() "%99s", &seq_len_, &batch_, &input_size_, &hidden_size_, &dir_, name_) &&
+            seq_len_ > 0 && batch_ > 0 && input_size_ > 0 && hidden_size_ > 0 && dir_ >= 0 && dir_ <= 2;
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), LSTM_CASE_STRING_FMT() "%s", seq_len_, batch_, input_size_, hidden_size_, dir_, name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        direction_ = dir_ == 0 ? ppl::kernel::x86::rnn_direction::FORWARD
+            : (dir_ == 1 ? ppl::kernel::x86::rnn_direction::REVERSE : ppl::kernel::x86::rnn_direction::BIDIRECTIONAL);
+        num_dir_ = dir_ == 2 ? 2 : 1;
+        const int64_t num_gate = ppl::kernel::x86::rnn_num_gate::LSTM;
+
+        bench_make_shape({seq_len_, batch_, input_size_}, ppl::common::DATAFORMAT_NDARRAY, &X_shape_);
+        const uint64_t temp_bytes = ppl::kernel::x86::lstm_fp32_get_buffer_bytes(
+            &X_shape_, direction_, hidden_size_, false, true, true, true);
+        if (!X_.alloc(seq_len_ * batch_ * input_size_) ||
+            !W_.alloc(num_dir_ * num_gate * hidden_size_ * input_size_) ||
+            !R_.alloc(num_dir_ * num_gate * hidden_size_ * hidden_size_) ||
+            !bias_.alloc(num_dir_ * 2 * num_gate * hidden_size_) ||
+            !init_h_.alloc(num_dir_ * batch_ * hidden_size_) ||
+            !init_c_.alloc(num_dir_ * batch_ * hidden_size_) ||
+            !Y_.alloc(seq_len_ * num_dir_ * batch_ * hidden_size_) ||
+            !Y_h_.alloc(num_dir_ * batch_ * hidden_size_) ||
+            !Y_c_.alloc(num_dir_ * batch_ * hidden_size_) ||
+            !temp_.alloc(temp_bytes)) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        // keep gate inputs in the non saturated range of sigmoid and tanh
+        const float w_range = 1.0f / sqrtf((float)(input_size_ + hidden_size_));
+        bench_fill_uniform(X_.data(), X_.size(), -1.0f, 1.0f);
+        bench_fill_uniform(W_.data(), W_.size(), -w_range, w_range);
+        bench_fill_uniform(R_.data(), R_.size(), -w_range, w_range);
+        bench_fill_uniform(bias_.data(), bias_.size(), -0.1f, 0.1f);
+        bench_fill_uniform(init_h_.data(), init_h_.size(), -0.5f, 0.5f);
+        bench_fill_uniform(init_c_.data(), init_c_.size(), -0.5f, 0.5f);
+        for (int64_t nd = 0; nd < num_dir_; ++nd) {
+            W_list_[nd] = W_.data() + nd * num_gate * hidden_size_ * input_size_;
+            R_list_[nd] = R_.data() + nd * num_gate * hidden_size_ * hidden_size_;
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    // plain onnx lstm in double precision, gate order is iofc
+    ppl::common::RetCode reference() override
+    {
+        if (!Y_ref_.alloc(Y_.size()) || !Y_h_ref_.alloc(Y_h_.size()) || !Y_c_ref_.alloc(Y_c_.size())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        const int64_t num_gate = ppl::kernel::x86::rnn_num_gate::LSTM;
+        const int64_t H = hidden_size_;
+        std::vector<double> h(batch_ * H), c(batch_ * H), gate(num_gate * H);
+        for (int64_t nd = 0; nd < num_dir_; ++nd) {
+            const bool is_reverse = nd || dir_ == 1;
+            const float *W = W_list_[nd];
+            const float *R = R_list_[nd];
+            const float *Wb = bias_.data() + nd * 2 * num_gate * H;
+            const float *Rb = Wb + num_gate * H;
+            for (int64_t i = 0; i < batch_ * H; ++i) {
+                h[i] = init_h_.data()[nd * batch_ * H + i];
+                c[i] = init_c_.data()[nd * batch_ * H + i];
+            }
+            for (int64_t s = 0; s < seq_len_; ++s) {
+                const int64_t t = is_reverse ? seq_len_ - s - 1 : s;
+                for (int64_t b = 0; b < batch_; ++b) {
+                    const float *x = X_.data() + (t * batch_ + b) * input_size_;
+                    const double *hb = h.data() + b * H;
+                    for (int64_t g = 0; g < num_gate * H; ++g) {
+                        double acc = (double)Wb[g] + Rb[g];
+                        for (int64_t k = 0; k < input_size_; ++k) {
+                            acc += (double)W[g * input_size_ + k] * x[k];
+                        }
+                        for (int64_t k = 0; k < H; ++k) {
+                            acc += (double)R[g * H + k] * hb[k];
+                        }
+                        gate[g] = acc;
+                    }
+                    for (int64_t k = 0; k < H; ++k) {
+                        const double it = 1.0 / (1.0 + exp(-gate[0 * H + k]));
+                        const double ot = 1.0 / (1.0 + exp(-gate[1 * H + k]));
+                        const double ft = 1.0 / (1.0 + exp(-gate[2 * H + k]));
+                        const double ct = tanh(gate[3 * H + k]);
+                        c[b * H + k] = ft * c[b * H + k] + it * ct;
+                        h[b * H + k] = ot * tanh(c[b * H + k]);
+                    }
+                }
+                for (int64_t i = 0; i < batch_ * H; ++i) {
+                    Y_ref_.data()[(t * num_dir_ + nd) * batch_ * H + i] = h[i];
+                }
+            }
+            for (int64_t i = 0; i < batch_ * H; ++i) {
+                Y_h_ref_.data()[nd * batch_ * H + i] = h[i];
+                Y_c_ref_.data()[nd * batch_ * H + i] = c[i];
+            }
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    bool check(const float eps) override
+    {
+        return check_array_error(Y_.data(), Y_ref_.data(), Y_.size(), eps) &&
+            check_array_error(Y_h_.data(), Y_h_ref_.data(), Y_h_.size(), eps) &&
+            check_array_error(Y_c_.data(), Y_c_ref_.data(), Y_c_.size(), eps);
+    }
+
+    ppl::common::RetCode run() override
+    {
+        return func_(
+            &X_shape_, X_.data(), W_list_, R_list_, nullptr, bias_.data(), nullptr,
+            init_h_.data(), init_c_.data(), direction_, hidden_size_, false, false,
+            temp_.data(), Y_.data(), Y_h_.data(), Y_c_.data());
+    }
+
+    // input and recurrent gemm, the pointwise gate math is not counted
+    double gops() const override
+    {
+        const int64_t num_gate = ppl::kernel::x86::rnn_num_gate::LSTM;
+        return 2.0 * num_dir_ * seq_len_ * batch_ * num_gate * hidden_size_ * (input_size_ + hidden_size_) / 1e9;
+    }
+
+    // weights are counted once, they stay in cache across steps for typical sizes
+    double gbytes() const override
+    {
+        return (X_.bytes() + W_.bytes() + R_.bytes() + bias_.bytes() + init_h_.bytes() + init_c_.bytes() +
+            Y_.bytes() + Y_h_.bytes() + Y_c_.bytes()) / 1e9;
+    }
+
+private:
+    int64_t seq_len_, batch_, input_size_, hidden_size_, dir_;
+    int64_t num_dir_;
+    ppl::kernel::x86::rnn_direction_t direction_;
+    char name_[100];
+    ppl::common::TensorShape X_shape_;
+    const float *W_list_[2] = {nullptr, nullptr};
+    const float *R_list_[2] = {nullptr, nullptr};
+    bench_buffer<float> X_, W_, R_, bias_, init_h_, init_c_;
+    bench_buffer<float> Y_, Y_h_, Y_c_;
+    bench_buffer<float> Y_ref_, Y_h_ref_, Y_c_ref_;
+    bench_buffer<uint8_t> temp_;
+};
+
+bench_case *create_lstm_bench_case()
+{
+    return new lstm_bench_case();
+}
@@ -0,0 +1,230 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <stdio.h>
+#include <math.h>
+
+#include "ppl/kernel/x86/fp32/mmcv_roialign.h"
+#include "ppl/kernel/x86/fp32/reorder.h"
+#include "bench/bench_common.h"
+
+/*
+    mmcv roi_align_rotated on an n16cx feature map with spatial_scale 0.5.
+    rois have random centers, sizes up to max_roi pixels of the map and
+    angles in [-pi, pi], some of them sample outside of the map.
+    sr: sampling_ratio, 0 is adaptive. cw: clockwise.
+*/
+#define ROIALIGN_ROTATED_CASE_STRING_FMT() \
+    "n%" PRId64 "c%" PRId64 "h%" PRId64 "w%" PRId64 \
+    "_rois%" PRId64 "max%" PRId64 "_ph%" PRId64 "pw%" PRId64 \
+    "_sr%" PRId64 "_aligned%" PRId64 "_cw%" PRId64 "_n"
+
+// mmcv bilinear_interpolate, coordinates stay in float like the cpu op
+static double roialign_ref_bilinear(const float *src, const int64_t height, const int64_t width, float y, float x)
+{
+    if (y < -1.0f || y > height || x < -1.0f || x > width) {
+        return 0.0;
+    }
+    y = std::max(y, 0.0f);
+    x = std::max(x, 0.0f);
+    int64_t y_low = (int64_t)y;
+    int64_t x_low = (int64_t)x;
+    int64_t y_high, x_high;
+    if (y_low >= height - 1) {
+        y_high = y_low = height - 1;
+        y = (float)y_low;
+    } else {
+        y_high = y_low + 1;
+    }
+    if (x_low >= width - 1) {
+        x_high = x_low = width - 1;
+        x = (float)x_low;
+    } else {
+        x_high = x_low + 1;
+    }
+    const double ly = y - y_low;
+    const double lx = x - x_low;
+    const double hy = 1.0 - ly;
+    const double hx = 1.0 - lx;
+    return hy * hx * src[y_low * width + x_low] + hy * lx * src[y_low * width + x_high] +
+           ly * hx * src[y_high * width + x_low] + ly * lx * src[y_high * width + x_high];
+}
+
+// impls are isa masks handed to the dispatcher, noarch is the scalar fallback
+class roialign_rotated_bench_case : public bench_case {
+public:
+    bool parse(const char *line) override
+    {
+        return 12 == sscanf(line, ROIALIGN_ROTATED_CASE_STRING_FMT() "%99s", &n_, &c_, &h_, &w_,
+            &rois_, &max_roi_, &ph_, &pw_, &sr_, &aligned_, &cw_, name_) &&
+            n_ > 0 && c_ > 0 && h_ > 0 && w_ > 0 && rois_ >= 0 && max_roi_ > 0 && ph_ > 0 && pw_ > 0 &&
+            sr_ >= 0 && (aligned_ == 0 || aligned_ == 1) && (cw_ == 0 || cw_ == 1);
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), ROIALIGN_ROTATED_CASE_STRING_FMT() "%s", n_, c_, h_, w_,
+            rois_, max_roi_, ph_, pw_, sr_, aligned_, cw_, name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        bench_make_shape({n_, c_, h_, w_}, ppl::common::DATAFORMAT_NDARRAY, &src_nd_shape_);
+        bench_make_shape({rois_, c_, ph_, pw_}, ppl::common::DATAFORMAT_NDARRAY, &dst_nd_shape_);
+        bench_make_shape({n_, c_, h_, w_}, ppl::common::DATAFORMAT_N16CX, &src_shape_);
+        bench_make_shape({rois_, c_, ph_, pw_}, ppl::common::DATAFORMAT_N16CX, &dst_shape_);
+        bench_make_shape({rois_, 6}, ppl::common::DATAFORMAT_NDARRAY, &rois_shape_);
+        if (!src_nd_.alloc(src_nd_shape_.CalcElementsExcludingPadding()) ||
+            !src_.alloc(src_shape_.CalcElementsIncludingPadding()) ||
+            !dst_.alloc(dst_shape_.CalcElementsIncludingPadding()) ||
+            !rois_data_.alloc(rois_ * 6)) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        bench_fill_uniform(src_nd_.data(), src_nd_.size(), -1.0f, 1.0f);
+        // rois are in image coordinates, twice the size of the map
+        for (int64_t r = 0; r < rois_; ++r) {
+            float *roi = rois_data_.data() + r * 6;
+            roi[0]     = (float)(rand() % n_);
+            bench_fill_uniform(roi + 1, 1, 0.0f, w_ / spatial_scale());
+            bench_fill_uniform(roi + 2, 1, 0.0f, h_ / spatial_scale());
+            bench_fill_uniform(roi + 3, 2, 0.5f, max_roi_ / spatial_scale());
+            bench_fill_uniform(roi + 5, 1, -3.14159265f, 3.14159265f);
+        }
+        return ppl::kernel::x86::reorder_ndarray_n16cx_fp32(&src_nd_shape_, src_nd_.data(), src_.data());
+    }
+
+    // the simd kernels and the scalar fallback share the sample table of
+    // the library, so the reference walks the rotated grid of mmcv itself
+    ppl::common::RetCode reference() override
+    {
+        if (!dst_ref_.alloc(dst_nd_shape_.CalcElementsExcludingPadding()) ||
+            !dst_nd_.alloc(dst_nd_shape_.CalcElementsExcludingPadding())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        const float offset = aligned_ ? 0.5f : 0.0f;
+        for (int64_t r = 0; r < rois_; ++r) {
+            const float *roi     = rois_data_.data() + r * 6;
+            const int64_t batch  = (int64_t)roi[0];
+            const float center_w = roi[1] * spatial_scale() - offset;
+            const float center_h = roi[2] * spatial_scale() - offset;
+            const float theta    = cw_ ? -roi[5] : roi[5];
+            float roi_w          = roi[3] * spatial_scale();
+            float roi_h          = roi[4] * spatial_scale();
+            if (!aligned_) {
+                roi_w = std::max(roi_w, 1.0f);
+                roi_h = std::max(roi_h, 1.0f);
+            }
+            const float bin_h    = roi_h / ph_;
+            const float bin_w    = roi_w / pw_;
+            const int64_t grid_h = sr_ > 0 ? sr_ : (int64_t)ceilf(roi_h / ph_);
+            const int64_t grid_w = sr_ > 0 ? sr_ : (int64_t)ceilf(roi_w / pw_);
+            const float start_h  = -roi_h / 2.0f;
+            const float start_w  = -roi_w / 2.0f;
+            const float cos_t    = cosf(theta);
+            const float sin_t    = sinf(theta);
+            const int64_t count  = std::max<int64_t>(grid_h * grid_w, 1);
+            for (int64_t c = 0; c < c_; ++c) {
+                const float *l_src = src_nd_.data() + (batch * c_ + c) * h_ * w_;
+                for (int64_t ph = 0; ph < ph_; ++ph) {
+                    for (int64_t pw = 0; pw < pw_; ++pw) {
+                        double sum = 0.0;
+                        for (int64_t iy = 0; iy < grid_h; ++iy) {
+                            const float yy = start_h + ph * bin_h + (iy + 0.5f) * bin_h / grid_h;
+                            for (int64_t ix = 0; ix < grid_w; ++ix) {
+                                const float xx = start_w + pw * bin_w + (ix + 0.5f) * bin_w / grid_w;
+                                const float y  = yy * cos_t - xx * sin_t + center_h;
+                                const float x  = yy * sin_t + xx * cos_t + center_w;
+                                sum += roialign_ref_bilinear(l_src, h_, w_, y, x);
+                            }
+                        }
+                        dst_ref_.data()[((r * c_ + c) * ph_ + ph) * pw_ + pw] = (float)(sum / count);
+                    }
+                }
+            }
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    bool check(const float eps) override
+    {
+        // the reorder splits its work by batch and cannot take 0 rois
+        if (rois_ > 0 && ppl::common::RC_SUCCESS != ppl::kernel::x86::reorder_n16cx_ndarray_fp32(&dst_shape_, dst_.data(), dst_nd_.data())) {
+            std::cerr << "reorder dst failed";
+            return false;
+        }
+        return check_array_error(dst_nd_.data(), dst_ref_.data(), dst_ref_.size(), eps);
+    }
+
+    std::vector<std::string> impl_names() const override
+    {
+#ifdef PPL_USE_X86_AVX512
+        return {"noarch", "fma", "avx512"};
+#else
+        return {"noarch", "fma"};
+#endif
+    }
+
+    bool select(const std::string &impl) override
+    {
+        if (impl == "avx512") {
+            isa_ = ppl::common::ISA_X86_AVX512;
+        } else if (impl == "fma") {
+            isa_ = ppl::common::ISA_X86_FMA;
+        } else {
+            isa_ = 0;
+        }
+        return true;
+    }
+
+    ppl::common::RetCode run() override
+    {
+        return ppl::kernel::x86::mmcv_roialign_rotated_n16cx_fp32(
+            isa_, &src_shape_, &rois_shape_, &dst_shape_, src_.data(), rois_data_.data(),
+            aligned_, sr_, spatial_scale(), cw_ != 0, dst_.data());
+    }
+
+    // 4 taps of one mul and one add per sample, samples of the default grid
+    double gops() const override
+    {
+        const int64_t grid = sr_ > 0 ? sr_ * sr_ : 4;
+        return (double)dst_nd_shape_.CalcElementsExcludingPadding() * grid * 8 / 1e9;
+    }
+
+    double gbytes() const override
+    {
+        return (src_.bytes() + dst_.bytes() + rois_data_.bytes()) / 1e9;
+    }
+
+private:
+    static float spatial_scale()
+    {
+        return 0.5f;
+    }
+
+    int64_t n_, c_, h_, w_, rois_, max_roi_, ph_, pw_, sr_, aligned_, cw_;
+    char name_[100];
+    ppl::common::isa_t isa_ = 0;
+    ppl::common::TensorShape src_nd_shape_, dst_nd_shape_, src_shape_, dst_shape_, rois_shape_;
+    bench_buffer<float> src_nd_, src_, dst_, dst_nd_, dst_ref_, rois_data_;
+};
+
+bench_case *create_mmcv_roialign_rotated_bench_case()
+{
+    return new roialign_rotated_bench_case();
+}
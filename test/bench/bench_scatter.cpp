@@ -0,0 +1,272 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ppl/kernel/x86/fp32/scatter_nd.h"
+#include "ppl/kernel/x86/fp32/scatter_elements.h"
+#include "bench/bench_common.h"
+
+// red: 1 add, 2 mul, 3 max, 4 min as scatter_reduction_t
+static float scatter_ref_reduce(const int64_t red, const float a, const float b)
+{
+    switch (red) {
+        case 1: return a + b;
+        case 2: return a * b;
+        case 3: return std::max(a, b);
+        default: return std::min(a, b);
+    }
+}
+
+/*
+    scatter_nd with a reduction into src [d0, d1, inner], indices [upd, 2]
+    pick (d0, d1) at random, so slices are updated many times. every update
+    is reduced in order, so the result must match the serial reference bit
+    for bit whatever the thread count. bad 1 puts the last index out of
+    range, then run() expects RC_INVALID_VALUE and dst must stay untouched.
+*/
+#define SCATTER_ND_CASE_STRING_FMT() \
+    "d0%" PRId64 "d1%" PRId64 "inner%" PRId64 "_upd%" PRId64 "_red%" PRId64 "_bad%" PRId64 "_n"
+
+class scatter_nd_bench_case : public bench_case {
+public:
+    bool parse(const char *line) override
+    {
+        return 7 == sscanf(line, SCATTER_ND_CASE_STRING_FMT() "%99s", &d0_, &d1_, &inner_, &upd_, &red_, &bad_, name_) &&
+            d0_ > 0 && d1_ > 0 && inner_ > 0 && upd_ > 0 && red_ >= 1 && red_ <= 4 && (bad_ == 0 || bad_ == 1);
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), SCATTER_ND_CASE_STRING_FMT() "%s", d0_, d1_, inner_, upd_, red_, bad_, name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        strides_[0] = d1_ * inner_;
+        strides_[1] = inner_;
+        if (!src_.alloc(d0_ * d1_ * inner_) || !updates_.alloc(upd_ * inner_) ||
+            !indices_.alloc(upd_ * 2) || !dst_.alloc(src_.size())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        bench_fill_uniform(src_.data(), src_.size(), -1.0f, 1.0f);
+        bench_fill_uniform(updates_.data(), updates_.size(), -1.0f, 1.0f);
+        for (int64_t k = 0; k < upd_; ++k) {
+            indices_.data()[k * 2 + 0] = rand() % d0_;
+            indices_.data()[k * 2 + 1] = rand() % d1_;
+        }
+        if (bad_) {
+            indices_.data()[upd_ * 2 - 2] = d0_;
+        }
+        bench_fill_uniform(dst_.data(), dst_.size(), -1.0f, 1.0f);
+        return ppl::common::RC_SUCCESS;
+    }
+
+    ppl::common::RetCode reference() override
+    {
+        if (!dst_ref_.alloc(dst_.size())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        if (bad_) {
+            memcpy(dst_ref_.data(), dst_.data(), dst_.bytes());
+            return ppl::common::RC_SUCCESS;
+        }
+        memcpy(dst_ref_.data(), src_.data(), src_.bytes());
+        for (int64_t k = 0; k < upd_; ++k) {
+            float *l_dst = dst_ref_.data() + indices_.data()[k * 2 + 0] * strides_[0] + indices_.data()[k * 2 + 1] * strides_[1];
+            for (int64_t i = 0; i < inner_; ++i) {
+                l_dst[i] = scatter_ref_reduce(red_, l_dst[i], updates_.data()[k * inner_ + i]);
+            }
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    bool check(const float eps) override
+    {
+        return check_array_bitwise(dst_.data(), dst_ref_.data(), dst_ref_.size());
+    }
+
+    const void *output() const override
+    {
+        return dst_.data();
+    }
+
+    uint64_t output_bytes() const override
+    {
+        return dst_.bytes();
+    }
+
+    std::vector<std::string> impl_names() const override
+    {
+        return {"noarch"};
+    }
+
+    bool select(const std::string &impl) override
+    {
+        return impl == "noarch";
+    }
+
+    ppl::common::RetCode run() override
+    {
+        const ppl::common::RetCode rc = ppl::kernel::x86::scatter_nd_ndarray_fp32(
+            src_.data(), updates_.data(), indices_.data(), strides_, src_.size(),
+            inner_, upd_, 2, red_, dst_.data());
+        if (bad_) {
+            return rc == ppl::common::RC_INVALID_VALUE ? ppl::common::RC_SUCCESS : ppl::common::RC_OTHER_ERROR;
+        }
+        return rc;
+    }
+
+    double gops() const override
+    {
+        return (double)upd_ * inner_ / 1e9;
+    }
+
+    double gbytes() const override
+    {
+        return (src_.bytes() + dst_.bytes() + 2 * updates_.bytes() + indices_.bytes()) / 1e9;
+    }
+
+private:
+    int64_t d0_, d1_, inner_, upd_, red_, bad_;
+    int32_t strides_[2];
+    char name_[100];
+    bench_buffer<float> src_, updates_, dst_, dst_ref_;
+    bench_buffer<int64_t> indices_;
+};
+
+/*
+    scatter_elements with a reduction on axis 1 of src [outer, len, inner],
+    indices [outer, ilen, iinner] are in [-len, len). the kernel reduces
+    independent columns in parallel, and falls back to the counting sort of
+    scatter_nd when outer * div_up(iinner, 256) cannot feed the threads.
+*/
+#define SCATTER_ELEMENTS_CASE_STRING_FMT() \
+    "outer%" PRId64 "len%" PRId64 "inner%" PRId64 "_ilen%" PRId64 "iinner%" PRId64 "_red%" PRId64 "_n"
+
+class scatter_elements_bench_case : public bench_case {
+public:
+    bool parse(const char *line) override
+    {
+        return 7 == sscanf(line, SCATTER_ELEMENTS_CASE_STRING_FMT() "%99s", &outer_, &len_, &inner_, &ilen_, &iinner_, &red_, name_) &&
+            outer_ > 0 && len_ > 0 && inner_ > 0 && ilen_ > 0 && iinner_ > 0 && iinner_ <= inner_ && red_ >= 1 && red_ <= 4;
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), SCATTER_ELEMENTS_CASE_STRING_FMT() "%s", outer_, len_, inner_, ilen_, iinner_, red_, name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        bench_make_shape({outer_, len_, inner_}, ppl::common::DATAFORMAT_NDARRAY, &src_shape_);
+        bench_make_shape({outer_, ilen_, iinner_}, ppl::common::DATAFORMAT_NDARRAY, &indices_shape_);
+        indices_shape_.SetDataType(ppl::common::DATATYPE_INT64);
+        if (!src_.alloc(outer_ * len_ * inner_) || !updates_.alloc(outer_ * ilen_ * iinner_) ||
+            !indices_.alloc(updates_.size()) || !dst_.alloc(src_.size())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        bench_fill_uniform(src_.data(), src_.size(), -1.0f, 1.0f);
+        bench_fill_uniform(updates_.data(), updates_.size(), -1.0f, 1.0f);
+        for (uint64_t u = 0; u < indices_.size(); ++u) {
+            indices_.data()[u] = rand() % (2 * len_) - len_;
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    ppl::common::RetCode reference() override
+    {
+        if (!dst_ref_.alloc(dst_.size())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        memcpy(dst_ref_.data(), src_.data(), src_.bytes());
+        for (int64_t i = 0; i < outer_; ++i) {
+            for (int64_t j = 0; j < ilen_; ++j) {
+                for (int64_t k = 0; k < iinner_; ++k) {
+                    const int64_t u     = (i * ilen_ + j) * iinner_ + k;
+                    const int64_t index = indices_.data()[u] < 0 ? indices_.data()[u] + len_ : indices_.data()[u];
+                    float *d            = dst_ref_.data() + (i * len_ + index) * inner_ + k;
+                    *d                  = scatter_ref_reduce(red_, *d, updates_.data()[u]);
+                }
+            }
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    bool check(const float eps) override
+    {
+        return check_array_bitwise(dst_.data(), dst_ref_.data(), dst_ref_.size());
+    }
+
+    const void *output() const override
+    {
+        return dst_.data();
+    }
+
+    uint64_t output_bytes() const override
+    {
+        return dst_.bytes();
+    }
+
+    std::vector<std::string> impl_names() const override
+    {
+        return {"noarch"};
+    }
+
+    bool select(const std::string &impl) override
+    {
+        return impl == "noarch";
+    }
+
+    ppl::common::RetCode run() override
+    {
+        return ppl::kernel::x86::scatter_elements_ndarray_fp32(
+            &src_shape_, &indices_shape_, src_.data(), indices_.data(), updates_.data(), 1, red_, dst_.data());
+    }
+
+    double gops() const override
+    {
+        return updates_.size() / 1e9;
+    }
+
+    double gbytes() const override
+    {
+        return (src_.bytes() + dst_.bytes() + 2 * updates_.bytes() + indices_.bytes()) / 1e9;
+    }
+
+private:
+    int64_t outer_, len_, inner_, ilen_, iinner_, red_;
+    char name_[100];
+    ppl::common::TensorShape src_shape_, indices_shape_;
+    bench_buffer<float> src_, updates_, dst_, dst_ref_;
+    bench_buffer<int64_t> indices_;
+};
+
+bench_case *create_scatter_nd_bench_case()
+{
+    return new scatter_nd_bench_case();
+}
+
+bench_case *create_scatter_elements_bench_case()
+{
+    return new scatter_elements_bench_case();
+}
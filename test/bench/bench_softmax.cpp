@@ -0,0 +1,114 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <stdio.h>
+
+#include "ppl/kernel/x86/fp32/softmax.h"
+#include "bench/bench_common.h"
+
+#define SOFTMAX_CASE_STRING_FMT() "n%" PRId64 "c%" PRId64 "h%" PRId64 "w%" PRId64 "_axis%" PRId64 "_n"
+
+typedef decltype(ppl::kernel::x86::softmax_ndarray_fp32_ref)* ppl_x86_softmax_func_t;
+
+class softmax_bench_case : public bench_case_impl<ppl_x86_softmax_func_t> {
+public:
+    softmax_bench_case()
+    {
+        impls_ = {
+            {"noarch", ppl::kernel::x86::softmax_ndarray_fp32_ref},
+            {"sse", ppl::kernel::x86::softmax_ndarray_fp32_sse},
+            {"fma", ppl::kernel::x86::softmax_ndarray_fp32_fma},
+#ifdef PPL_USE_X86_AVX512
+            {"avx512", ppl::kernel::x86::softmax_ndarray_fp32_avx512},
+#endif
+        };
+    }
+
+    bool parse(const char *line) override
+    {
+        return 6 == sscanf(line, SOFTMAX_CASE_STRING_FMT() "%99s", &n_, &c_, &h_, &w_, &axis_, name_) &&
+            n_ > 0 && c_ > 0 && h_ > 0 && w_ > 0 && axis_ >= 0 && axis_ < 4;
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), SOFTMAX_CASE_STRING_FMT() "%s", n_, c_, h_, w_, axis_, name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        bench_make_shape({n_, c_, h_, w_}, ppl::common::DATAFORMAT_NDARRAY, &src_shape_);
+        const uint64_t len = src_shape_.CalcElementsExcludingPadding();
+        if (!src_.alloc(len) || !dst_.alloc(len)) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        bench_fill_uniform(src_.data(), len, -8.0f, 8.0f);
+        return ppl::common::RC_SUCCESS;
+    }
+
+    ppl::common::RetCode reference() override
+    {
+        if (!dst_ref_.alloc(dst_.size())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        return ppl::kernel::x86::softmax_ndarray_fp32_ref(&src_shape_, src_.data(), axis_, dst_ref_.data());
+    }
+
+    bool check(const float eps) override
+    {
+        return check_array_error(dst_.data(), dst_ref_.data(), dst_.size(), eps);
+    }
+
+    const void *output() const override
+    {
+        return dst_.data();
+    }
+
+    uint64_t output_bytes() const override
+    {
+        return dst_.bytes();
+    }
+
+    ppl::common::RetCode run() override
+    {
+        return func_(&src_shape_, src_.data(), axis_, dst_.data());
+    }
+
+    // max, sub, exp, sum and scale for each element
+    double gops() const override
+    {
+        return dst_.size() * 5.0 / 1e9;
+    }
+
+    double gbytes() const override
+    {
+        return (src_.bytes() + dst_.bytes()) / 1e9;
+    }
+
+private:
+    int64_t n_, c_, h_, w_, axis_;
+    char name_[100];
+    ppl::common::TensorShape src_shape_;
+    bench_buffer<float> src_, dst_, dst_ref_;
+};
+
+bench_case *create_softmax_bench_case()
+{
+    return new softmax_bench_case();
+}
@@ -0,0 +1,135 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <stdio.h>
+#include <algorithm>
+#include <functional>
+
+#include "ppl/kernel/x86/fp32/topk.h"
+#include "bench/bench_common.h"
+
+// largest and sorted topk over the middle axis of [outer, len, inner]
+#define TOPK_CASE_STRING_FMT() "outer%" PRId64 "len%" PRId64 "inner%" PRId64 "_k%" PRId64 "_n"
+
+typedef decltype(ppl::kernel::x86::topk_ndarray_fp32)* ppl_x86_topk_func_t;
+
+class topk_bench_case : public bench_case_impl<ppl_x86_topk_func_t> {
+public:
+    topk_bench_case()
+    {
+        impls_ = {
+            {"noarch", ppl::kernel::x86::topk_ndarray_fp32},
+        };
+    }
+
+    bool parse(const char *line) override
+    {
+        return 5 == sscanf(line, TOPK_CASE_STRING_FMT() "%99s", &outer_, &len_, &inner_, &k_, name_) &&
+            outer_ > 0 && len_ > 0 && inner_ > 0 && k_ > 0 && k_ <= len_;
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), TOPK_CASE_STRING_FMT() "%s", outer_, len_, inner_, k_, name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        bench_make_shape({outer_, len_, inner_}, ppl::common::DATAFORMAT_NDARRAY, &src_shape_);
+        bench_make_shape({outer_, k_, inner_}, ppl::common::DATAFORMAT_NDARRAY, &values_shape_);
+        bench_make_shape({outer_, k_, inner_}, ppl::common::DATAFORMAT_NDARRAY, &indices_shape_);
+        indices_shape_.SetDataType(ppl::common::DATATYPE_INT64);
+        const uint64_t temp_bytes = ppl::kernel::x86::topk_ndarray_fp32_get_buffer_bytes(&src_shape_, 1);
+        if (!src_.alloc(outer_ * len_ * inner_) ||
+            !values_.alloc(outer_ * k_ * inner_) ||
+            !indices_.alloc(outer_ * k_ * inner_) ||
+            !temp_.alloc(temp_bytes)) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        bench_fill_uniform(src_.data(), src_.size(), -1.0f, 1.0f);
+        return ppl::common::RC_SUCCESS;
+    }
+
+    ppl::common::RetCode reference() override
+    {
+        if (!values_ref_.alloc(values_.size())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        std::vector<float> slice(len_);
+        for (int64_t o = 0; o < outer_; ++o) {
+            for (int64_t i = 0; i < inner_; ++i) {
+                for (int64_t l = 0; l < len_; ++l) {
+                    slice[l] = src_.data()[(o * len_ + l) * inner_ + i];
+                }
+                std::partial_sort(slice.begin(), slice.begin() + k_, slice.end(), std::greater<float>());
+                for (int64_t l = 0; l < k_; ++l) {
+                    values_ref_.data()[(o * k_ + l) * inner_ + i] = slice[l];
+                }
+            }
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    // ties may pick any index, so indices are checked by looking their value up
+    bool check(const float eps) override
+    {
+        for (int64_t o = 0; o < outer_; ++o) {
+            for (int64_t l = 0; l < k_; ++l) {
+                for (int64_t i = 0; i < inner_; ++i) {
+                    const int64_t off = (o * k_ + l) * inner_ + i;
+                    const int64_t idx = indices_.data()[off];
+                    if (idx < 0 || idx >= len_ || src_.data()[(o * len_ + idx) * inner_ + i] != values_.data()[off]) {
+                        std::cerr << "error_indices[" << off << "]=" << idx;
+                        return false;
+                    }
+                }
+            }
+        }
+        return check_array_error(values_.data(), values_ref_.data(), values_.size(), eps);
+    }
+
+    ppl::common::RetCode run() override
+    {
+        return func_(&src_shape_, &values_shape_, &indices_shape_, src_.data(), k_, 1, 1, 1,
+            temp_.data(), values_.data(), indices_.data());
+    }
+
+    double gops() const override
+    {
+        return 0;
+    }
+
+    double gbytes() const override
+    {
+        return (src_.bytes() + values_.bytes() + indices_.bytes()) / 1e9;
+    }
+
+private:
+    int64_t outer_, len_, inner_, k_;
+    char name_[100];
+    ppl::common::TensorShape src_shape_, values_shape_, indices_shape_;
+    bench_buffer<float> src_, values_, values_ref_;
+    bench_buffer<int64_t> indices_;
+    bench_buffer<uint8_t> temp_;
+};
+
+bench_case *create_topk_bench_case()
+{
+    return new topk_bench_case();
+}
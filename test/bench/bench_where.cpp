@@ -0,0 +1,162 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <stdio.h>
+
+#include "ppl/kernel/x86/fp32/where.h"
+#include "bench/bench_common.h"
+
+/*
+    bit i of cmask/xmask/ymask broadcasts dim i of cond/x/y, all 0 runs the
+    eltwise kernel, anything else the ndarray one.
+*/
+#define WHERE_CASE_STRING_FMT() \
+    "n%" PRId64 "c%" PRId64 "h%" PRId64 "w%" PRId64 "_cmask%" PRId64 "xmask%" PRId64 "ymask%" PRId64 "_n"
+
+// where_eltwise_fp32 and where_ndarray_fp32 are overloaded, spell the types out
+typedef ppl::common::RetCode (*ppl_x86_where_eltwise_func_t)(
+    const ppl::common::TensorShape *, const uint8_t *, const float *, const float *, float *);
+typedef ppl::common::RetCode (*ppl_x86_where_ndarray_func_t)(
+    const ppl::common::TensorShape *, const ppl::common::TensorShape *, const ppl::common::TensorShape *,
+    const ppl::common::TensorShape *, const uint8_t *, const float *, const float *, float *);
+
+class where_bench_case : public bench_case {
+public:
+    bool parse(const char *line) override
+    {
+        return 8 == sscanf(line, WHERE_CASE_STRING_FMT() "%99s", &n_, &c_, &h_, &w_, &cmask_, &xmask_, &ymask_, name_) &&
+            n_ > 0 && c_ > 0 && h_ > 0 && w_ > 0 && cmask_ >= 0 && cmask_ < 16 &&
+            xmask_ >= 0 && xmask_ < 16 && ymask_ >= 0 && ymask_ < 16;
+    }
+
+    std::string case_string() const override
+    {
+        char str[256];
+        snprintf(str, sizeof(str), WHERE_CASE_STRING_FMT() "%s", n_, c_, h_, w_, cmask_, xmask_, ymask_, name_);
+        return str;
+    }
+
+    ppl::common::RetCode prepare() override
+    {
+        dims_ = {n_, c_, h_, w_};
+        bench_make_shape(bench_bcast_dims(dims_, cmask_), ppl::common::DATAFORMAT_NDARRAY, &cond_shape_);
+        bench_make_shape(bench_bcast_dims(dims_, xmask_), ppl::common::DATAFORMAT_NDARRAY, &x_shape_);
+        bench_make_shape(bench_bcast_dims(dims_, ymask_), ppl::common::DATAFORMAT_NDARRAY, &y_shape_);
+        bench_make_shape(dims_, ppl::common::DATAFORMAT_NDARRAY, &dst_shape_);
+        cond_shape_.SetDataType(ppl::common::DATATYPE_BOOL);
+        if (!cond_.alloc(cond_shape_.CalcElementsExcludingPadding()) ||
+            !x_.alloc(x_shape_.CalcElementsExcludingPadding()) ||
+            !y_.alloc(y_shape_.CalcElementsExcludingPadding()) ||
+            !dst_.alloc(dst_shape_.CalcElementsExcludingPadding())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        for (uint64_t i = 0; i < cond_.size(); ++i) {
+            cond_.data()[i] = rand() % 2;
+        }
+        // x and y never overlap, so a swapped select shows up
+        bench_fill_int(x_.data(), x_.size(), 7, 1, 1.0f);
+        bench_fill_int(y_.data(), y_.size(), 7, -7, 1.0f);
+        return ppl::common::RC_SUCCESS;
+    }
+
+    ppl::common::RetCode reference() override
+    {
+        if (!dst_ref_.alloc(dst_.size())) {
+            return ppl::common::RC_OUT_OF_MEMORY;
+        }
+        for (int64_t i = 0; i < (int64_t)dst_.size(); ++i) {
+            dst_ref_.data()[i] = cond_.data()[bench_bcast_offset(dims_, cmask_, i)]
+                ? x_.data()[bench_bcast_offset(dims_, xmask_, i)]
+                : y_.data()[bench_bcast_offset(dims_, ymask_, i)];
+        }
+        return ppl::common::RC_SUCCESS;
+    }
+
+    bool check(const float eps) override
+    {
+        return check_array_bitwise(dst_.data(), dst_ref_.data(), dst_.size());
+    }
+
+    const void *output() const override
+    {
+        return dst_.data();
+    }
+
+    uint64_t output_bytes() const override
+    {
+        return dst_.bytes();
+    }
+
+    std::vector<std::string> impl_names() const override
+    {
+#ifdef PPL_USE_X86_AVX512
+        return {"noarch", "avx512"};
+#else
+        return {"noarch"};
+#endif
+    }
+
+    bool select(const std::string &impl) override
+    {
+        eltwise_func_ = nullptr;
+        ndarray_func_ = nullptr;
+        if (impl == "noarch") {
+            eltwise_func_ = ppl::kernel::x86::where_eltwise_fp32;
+            ndarray_func_ = ppl::kernel::x86::where_ndarray_fp32;
+        }
+#ifdef PPL_USE_X86_AVX512
+        if (impl == "avx512") {
+            eltwise_func_ = ppl::kernel::x86::where_eltwise_fp32_avx512;
+            ndarray_func_ = ppl::kernel::x86::where_ndarray_fp32_avx512;
+        }
+#endif
+        return eltwise_func_ != nullptr;
+    }
+
+    ppl::common::RetCode run() override
+    {
+        if (cmask_ == 0 && xmask_ == 0 && ymask_ == 0) {
+            return eltwise_func_(&dst_shape_, cond_.data(), x_.data(), y_.data(), dst_.data());
+        }
+        return ndarray_func_(&cond_shape_, &x_shape_, &y_shape_, &dst_shape_, cond_.data(), x_.data(), y_.data(), dst_.data());
+    }
+
+    double gops() const override
+    {
+        return dst_.size() / 1e9;
+    }
+
+    double gbytes() const override
+    {
+        return (cond_.bytes() + x_.bytes() + y_.bytes() + dst_.bytes()) / 1e9;
+    }
+
+private:
+    int64_t n_, c_, h_, w_, cmask_, xmask_, ymask_;
+    char name_[100];
+    std::vector<int64_t> dims_;
+    ppl::common::TensorShape cond_shape_, x_shape_, y_shape_, dst_shape_;
+    bench_buffer<uint8_t> cond_;
+    bench_buffer<float> x_, y_, dst_, dst_ref_;
+    ppl_x86_where_eltwise_func_t eltwise_func_ = nullptr;
+    ppl_x86_where_ndarray_func_t ndarray_func_ = nullptr;
+};
+
+bench_case *create_where_bench_case()
+{
+    return new where_bench_case();
+}
@@ -0,0 +1,581 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <fstream>
+#include <memory>
+#include <chrono>
+#include <algorithm>
+
+#include <float.h>
+#include <string.h>
+#include <inttypes.h>
+
+#if defined(__linux__) && defined(PPL_USE_X86_OMP)
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <pthread.h>
+#include <omp.h>
+#endif
+
+#include "ppl/kernel/x86/fp32/gemm.h"
+#include "ppl/kernel/x86/common/simd_tools.h"
+#include "ppl/kernel/x86/common/threading_tools.h"
+#include "ppl/kernel/x86/common/internal_include.h"
+#include "simple_flags.h"
+#include "bench/bench_common.h"
+
+Define_bool_opt("--help", Flag_help, false, "show these help information");
+Define_string(op, "", "(required) comma separated op list or all, --list_ops shows the ops and their config format");
+Define_bool(list_ops, false, "(false) list ops and config formats");
+Define_string(cfg, "", "config file, only for a single op, default is <cfg_dir>/<op>.cfg");
+Define_string(cfg_dir, "", "directory of <op>.cfg files");
+Define_string(isa, "all", "(all) comma separated impl list: noarch, sse, avx, fma, avx512, or all supported");
+Define_int32(warm_up, 2, "(2) warm up iterations");
+Define_int32(min_iter, 10, "(10) min benchmark iterations");
+Define_float(min_second, 0.5f, "(0.5) min benchmark seconds");
+Define_bool(validate, false, "(false) do result validation after benchmark");
+Define_float(eps, 1e-4f, "(1e-4) rel error trunk for validation");
+Define_bool(reproducible, false, "(false) run in reproducible mode and check each output is bit-identical with one thread less");
+Define_bool(roofline, true, "(true) measure memory bandwidth and gemm peak for roofline efficiency");
+Define_int32(roofline_mb, 256, "(256) buffer size in MB of the bandwidth test, should be far larger than llc");
+Define_string(json, "", "dump results to this json file");
+Define_bool(core_bind, false, "(false) core binding");
+
+static const bench_op bench_op_table[] = {
+    {"add", "n%c%h%w%_bcast%_n%s", create_add_bench_case},
+    {"mul", "n%c%h%w%_bcast%_n%s", create_mul_bench_case},
+    {"add_dst_view", "n%c%h%w%_bcast%_ctot%coff%_n%s", create_add_dst_view_bench_case},
+    {"fused_eltwise", "n%c%h%w%_expr%_bcast%_n%s", create_fused_eltwise_bench_case},
+    {"softmax", "n%c%h%w%_axis%_n%s", create_softmax_bench_case},
+    {"reduce_sum", "n%c%h%w%_rmask%_fmt%_n%s", create_reduce_sum_bench_case},
+    {"reduce_max", "n%c%h%w%_rmask%_fmt%_n%s", create_reduce_max_bench_case},
+    {"reduce_prod", "n%c%h%w%_rmask%_fmt%_n%s", create_reduce_prod_bench_case},
+    {"reduce_l1", "n%c%h%w%_rmask%_fmt%_n%s", create_reduce_l1_bench_case},
+    {"reduce_l2", "n%c%h%w%_rmask%_fmt%_n%s", create_reduce_l2_bench_case},
+    {"reduce_sum_square", "n%c%h%w%_rmask%_fmt%_n%s", create_reduce_sum_square_bench_case},
+    {"reduce_log_sum_exp", "n%c%h%w%_rmask%_fmt%_n%s", create_reduce_log_sum_exp_bench_case},
+    {"cumsum", "outer%len%inner%_ex%rev%_data%_n%s", create_cumsum_bench_case},
+    {"transpose", "n%c%h%w%_perm%-%-%-%_n%s", create_transpose_bench_case},
+    {"transpose_int64", "n%c%h%w%_perm%-%-%-%_n%s", create_transpose_int64_bench_case},
+    {"transpose_bool", "n%c%h%w%_perm%-%-%-%_n%s", create_transpose_bool_bench_case},
+    {"reorder", "n%c%h%w%_dir%_n%s", create_reorder_bench_case},
+    {"maxpool2d", "n%c%h%w%_kh%kw%sh%sw%ph%pw%_ex%_n%s", create_maxpool2d_bench_case},
+    {"averagepool2d", "n%c%h%w%_kh%kw%sh%sw%ph%pw%_ex%_n%s", create_averagepool2d_bench_case},
+    {"resize2d", "n%c%ih%iw%_oh%ow%_mode%_ct%_nm%_ex%_fmt%_n%s", create_resize2d_bench_case},
+    {"lstm", "seq%b%in%hid%_dir%_n%s", create_lstm_bench_case},
+    {"mmcv_nms", "box%_iou%_n%s", create_mmcv_nms_bench_case},
+    {"topk", "outer%len%inner%_k%_n%s", create_topk_bench_case},
+    {"gather", "outer%len%inner%_idx%_n%s", create_gather_bench_case},
+    {"argmax", "outer%len%inner%_last%_data%_n%s", create_argmax_bench_case},
+    {"argmin", "outer%len%inner%_last%_data%_n%s", create_argmin_bench_case},
+    {"ir_conv2d", "n%c%h%w%_hid%_k%s%_oc%_act%_res%_n%s", create_ir_conv2d_bench_case},
+    {"pd_conv2d", "n%c%h%w%_k%s%_oc%_act%_sum%_n%s", create_pd_conv2d_bench_case},
+    {"conv2d_slice", "n%c%h%w%_oc%_k%s%_g%_algo%_ctot%coff%_octot%ocoff%_n%s", create_conv2d_slice_bench_case},
+    {"embedding_bag", "rows%dim%_bags%len%_mode%_w%_bag%_type%_n%s", create_embedding_bag_bench_case},
+    {"grid_sample", "n%c%h%w%_oh%ow%_g%_mode%_pad%_align%_fmt%_n%s", create_grid_sample_bench_case},
+    {"mmcv_roialign_rotated", "n%c%h%w%_rois%max%_ph%pw%_sr%_aligned%_cw%_n%s", create_mmcv_roialign_rotated_bench_case},
+    {"scatter_nd", "d0%d1%inner%_upd%_red%_bad%_n%s", create_scatter_nd_bench_case},
+    {"scatter_elements", "outer%len%inner%_ilen%iinner%_red%_n%s", create_scatter_elements_bench_case},
+    {"deform_conv2d", "n%c%h%w%_oc%_k%s%p%d%_g%og%_mask%_fmt%_n%s", create_deform_conv2d_bench_case},
+    {"gemm", "b%m%n%k%_ta%tb%_bias%_sum%_relu%_beta%_n%s", create_gemm_bench_case},
+    {"relation", "n%c%h%w%_lmask%rmask%_op%_n%s", create_relation_bench_case},
+    {"where", "n%c%h%w%_cmask%xmask%ymask%_n%s", create_where_bench_case},
+    {"arithmetic_max6d", "n%c%h%w%_lmask%rmask%_op%_n%s", create_arithmetic_max6d_bench_case},
+    {"concat", "n%c%c%c%h%w%_n%s", create_concat_bench_case},
+    {"split", "n%c%c%c%h%w%_n%s", create_split_bench_case},
+    {"memory_copy", "bytes%_soff%doff%_n%s", create_memory_copy_bench_case},
+    {"memory_init", "num%_elem%_doff%_n%s", create_memory_init_bench_case},
+};
+
+static const std::map<std::string, ppl::common::isa_t> impl_isa_table = {
+    {"noarch", 0},
+    {"sse", ppl::common::ISA_X86_SSE},
+    {"avx", ppl::common::ISA_X86_AVX},
+    {"fma", ppl::common::ISA_X86_FMA},
+    {"avx512", ppl::common::ISA_X86_AVX512},
+};
+
+struct bench_roofline {
+    double bandwidth_gbps = 0.;
+    std::map<std::string, double> peak_gflops; // gemm peak of sse, fma and avx512
+
+    // there is no avx gemm, avx impls are bound by the fma peak when present
+    double peak_of(const std::string &impl) const
+    {
+        const char *gemm_isa = "sse";
+        if (impl == "avx" || impl == "fma") gemm_isa = "fma";
+        if (impl == "avx512") gemm_isa = "avx512";
+        auto it = peak_gflops.find(gemm_isa);
+        if (it == peak_gflops.end() && impl == "avx") {
+            it = peak_gflops.find("sse");
+        }
+        return it == peak_gflops.end() ? 0. : it->second;
+    }
+
+    // achieved / min(peak, arithmetic_intensity * bandwidth), pure data movement ops use bandwidth only
+    double efficiency(const std::string &impl, const double gflops, const double gbps, const double gops, const double gbytes) const
+    {
+        if (bandwidth_gbps <= 0.) {
+            return 0.;
+        }
+        if (gops <= 0. || gbytes <= 0.) {
+            return gbps / bandwidth_gbps;
+        }
+        const double peak = peak_of(impl);
+        const double bound = gops / gbytes * bandwidth_gbps;
+        const double attainable = peak > 0. ? std::min(peak, bound) : bound;
+        return gflops / attainable;
+    }
+};
+
+struct bench_record {
+    std::string op;
+    int line_no;
+    std::string case_string;
+    std::string impl;
+    double min_ms;
+    double avg_ms;
+    double max_gflops;
+    double avg_gflops;
+    double max_gbps;
+    double avg_gbps;
+    double roofline;
+    double speedup;
+    std::string validate;
+};
+
+static std::vector<std::string> split_list(const std::string &str)
+{
+    std::vector<std::string> list;
+    std::string::size_type begin = 0;
+    while (begin <= str.size()) {
+        auto end = str.find(',', begin);
+        if (end == std::string::npos) end = str.size();
+        if (end > begin) list.push_back(str.substr(begin, end - begin));
+        begin = end + 1;
+    }
+    return list;
+}
+
+static std::string json_escape(const std::string &str)
+{
+    std::string ret;
+    for (auto c : str) {
+        if (c == '"' || c == '\\') {
+            ret += '\\';
+            ret += c;
+        } else if ((unsigned char)c < 0x20) {
+            char hex[8];
+            snprintf(hex, sizeof(hex), "\\u%04x", c);
+            ret += hex;
+        } else {
+            ret += c;
+        }
+    }
+    return ret;
+}
+
+// best of several parallel copies, read and write are both counted
+static double measure_bandwidth_gbps(const int64_t buffer_mb)
+{
+    const int64_t num_elements = buffer_mb * 1024 * 1024 / sizeof(float);
+    bench_buffer<float> src, dst;
+    if (!src.alloc(num_elements) || !dst.alloc(num_elements)) {
+        return 0.;
+    }
+    const int64_t chunk = 64 * 1024;
+    const int64_t num_chunks = ppl::kernel::x86::div_up(num_elements, chunk);
+    float *src_ptr = src.data();
+    float *dst_ptr = dst.data();
+    PRAGMA_OMP_PARALLEL_FOR()
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        const int64_t len = std::min(chunk, num_elements - c * chunk);
+        memset(src_ptr + c * chunk, 0, len * sizeof(float));
+        memset(dst_ptr + c * chunk, 0, len * sizeof(float));
+    }
+
+    double min_us = DBL_MAX;
+    for (int32_t iter = 0; iter < 5; ++iter) {
+        auto start = std::chrono::high_resolution_clock::now();
+        PRAGMA_OMP_PARALLEL_FOR()
+        for (int64_t c = 0; c < num_chunks; ++c) {
+            const int64_t len = std::min(chunk, num_elements - c * chunk);
+            memcpy(dst_ptr + c * chunk, src_ptr + c * chunk, len * sizeof(float));
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        min_us = std::min<double>(min_us, std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / 1e3);
+    }
+    return 2.0 * num_elements * sizeof(float) / 1e9 / (min_us / 1e6);
+}
+
+typedef decltype(ppl::kernel::x86::gemm_fp32_fma)* ppl_x86_gemm_fp32_func_t;
+
+// square gemm is the best compute bound kernel of each isa
+static double measure_gemm_peak_gflops(ppl_x86_gemm_fp32_func_t gemm_func)
+{
+    const int64_t M = 1024, N = 1024, K = 1024;
+    bench_buffer<float> A, B, C;
+    if (!A.alloc(M * K) || !B.alloc(K * N) || !C.alloc(M * N)) {
+        return 0.;
+    }
+    bench_fill_int(A.data(), A.size());
+    bench_fill_int(B.data(), B.size());
+
+    double min_us = DBL_MAX;
+    for (int32_t iter = 0; iter < 4; ++iter) {
+        auto start = std::chrono::high_resolution_clock::now();
+        auto ret = gemm_func(
+            A.data(), B.data(), nullptr, nullptr,
+            ppl::kernel::x86::gemm_m_type::NOTRANS, ppl::kernel::x86::gemm_m_type::NOTRANS,
+            ppl::kernel::x86::gemm_v_type::EMPTY, ppl::kernel::x86::gemm_m_type::EMPTY,
+            M, N, K, K, N, N, 0,
+            1.0f, 0.0f, 0.0f, 0.0f, ppl::kernel::x86::gemm_post::NONE, C.data());
+        auto end = std::chrono::high_resolution_clock::now();
+        if (ret != ppl::common::RC_SUCCESS) {
+            return 0.;
+        }
+        if (iter > 0) { // first one is warm up
+            min_us = std::min<double>(min_us, std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / 1e3);
+        }
+    }
+    return 2.0 * M * N * K / 1e9 / (min_us / 1e6);
+}
+
+static void dump_json(
+    const std::string &path,
+    const int32_t num_threads,
+    const bench_roofline &roofline,
+    const std::vector<bench_record> &records)
+{
+    FILE *fp = fopen(path.c_str(), "w");
+    if (!fp) {
+        std::cerr << "cannot open json file " << path << "\n";
+        return;
+    }
+    fprintf(fp, "{\n");
+    fprintf(fp, "  \"num_threads\": %d,\n", num_threads);
+    fprintf(fp, "  \"warm_up\": %d,\n", Flag_warm_up);
+    fprintf(fp, "  \"min_iter\": %d,\n", Flag_min_iter);
+    fprintf(fp, "  \"min_second\": %f,\n", Flag_min_second);
+    fprintf(fp, "  \"roofline\": {\n");
+    fprintf(fp, "    \"bandwidth_gbps\": %.2f,\n", roofline.bandwidth_gbps);
+    fprintf(fp, "    \"peak_gflops\": {");
+    bool first = true;
+    for (auto &it : roofline.peak_gflops) {
+        fprintf(fp, "%s\"%s\": %.2f", first ? "" : ", ", it.first.c_str(), it.second);
+        first = false;
+    }
+    fprintf(fp, "}\n");
+    fprintf(fp, "  },\n");
+    fprintf(fp, "  \"records\": [\n");
+    for (size_t i = 0; i < records.size(); ++i) {
+        const bench_record &r = records[i];
+        fprintf(fp,
+            "    {\"op\": \"%s\", \"line_no\": %d, \"case\": \"%s\", \"impl\": \"%s\", "
+            "\"min_ms\": %.4f, \"avg_ms\": %.4f, \"max_gflops\": %.3f, \"avg_gflops\": %.3f, "
+            "\"max_gbps\": %.3f, \"avg_gbps\": %.3f, \"roofline\": %.4f, \"speedup\": %.3f, \"validate\": \"%s\"}%s\n",
+            json_escape(r.op).c_str(), r.line_no, json_escape(r.case_string).c_str(), r.impl.c_str(),
+            r.min_ms, r.avg_ms, r.max_gflops, r.avg_gflops,
+            r.max_gbps, r.avg_gbps, r.roofline, r.speedup, r.validate.c_str(),
+            i + 1 == records.size() ? "" : ",");
+    }
+    fprintf(fp, "  ]\n");
+    fprintf(fp, "}\n");
+    fclose(fp);
+}
+
+int main(int argc, char **argv) {
+    simple_flags::parse_args(argc, argv);
+    if (Flag_help) {
+        simple_flags::print_args_info();
+        return 0;
+    }
+
+    if (Flag_list_ops) {
+        for (auto &op : bench_op_table) {
+            std::cerr << op.name << ": " << op.case_fmt << "\n";
+        }
+        return 0;
+    }
+
+    std::vector<const bench_op*> ops;
+    for (auto &name : split_list(Flag_op)) {
+        bool found = false;
+        for (auto &op : bench_op_table) {
+            if (name == "all" || name == op.name) {
+                ops.push_back(&op);
+                found = true;
+            }
+        }
+        if (!found) {
+            std::cerr << "unknown op " << name << "\n";
+            return -1;
+        }
+    }
+    if (ops.empty()) {
+        std::cerr << "no op selected\n";
+        simple_flags::print_args_info();
+        return -1;
+    }
+    if (!Flag_cfg.empty() && ops.size() > 1) {
+        std::cerr << "--cfg only works with a single op, use --cfg_dir for multiple ops\n";
+        return -1;
+    }
+    if (Flag_cfg.empty() && Flag_cfg_dir.empty()) {
+        std::cerr << "--cfg or --cfg_dir is required\n";
+        simple_flags::print_args_info();
+        return -1;
+    }
+
+    ppl::common::isa_t cpu_isa = ppl::common::GetCpuISA();
+#ifndef PPL_USE_X86_AVX512
+    cpu_isa &= ~(ppl::common::ISA_X86_AVX512);
+#endif
+    std::vector<std::string> impls;
+    for (auto &impl : split_list(Flag_isa)) {
+        if (impl == "all") {
+            for (auto &name : {"noarch", "sse", "avx", "fma", "avx512"}) {
+                impls.push_back(name);
+            }
+            continue;
+        }
+        if (impl_isa_table.find(impl) == impl_isa_table.end()) {
+            std::cerr << "unknown isa " << impl << "\n";
+            return -1;
+        }
+        impls.push_back(impl);
+    }
+    {
+        // drop what this cpu cannot run, the first one left is the speedup baseline
+        std::vector<std::string> supported;
+        for (auto &impl : impls) {
+            const ppl::common::isa_t required = impl_isa_table.at(impl);
+            if ((cpu_isa & required) == required &&
+                std::find(supported.begin(), supported.end(), impl) == supported.end()) {
+                supported.push_back(impl);
+            }
+        }
+        impls.swap(supported);
+    }
+    if (impls.empty()) {
+        std::cerr << "unsupported isa\n";
+        return -1;
+    }
+
+    ppl::kernel::x86::set_denormals_zero(1);
+    ppl::kernel::x86::set_reproducible_mode(Flag_reproducible);
+
+    int32_t num_threads = 1;
+#if defined(__linux__) && defined(PPL_USE_X86_OMP)
+    num_threads = omp_get_max_threads();
+    if (Flag_core_bind) {
+#pragma omp parallel
+    {
+#define handle_error_en(en, msg) do { errno = en; perror(msg); exit(EXIT_FAILURE); } while (0)
+        int i = omp_get_thread_num();
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        CPU_SET(i, &cpuset);
+        const int s = pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset);
+        if (s != 0) {
+            handle_error_en(s, "pthread_setaffinity_np");
+        }
+#undef handle_error_en
+    }
+    }
+#endif
+
+    std::string impls_str;
+    for (auto &impl : impls) {
+        impls_str += (impls_str.empty() ? "" : ",") + impl;
+    }
+    std::cerr << "==============================================================\n";
+    fprintf(
+        stderr,
+        "num_threads=%d\nwarm_up=%d\nmin_iter=%d\nmin_second=%f\nvalidate=%d\neps=%f\nisa=%s\nreproducible=%d\n\n",
+        num_threads, Flag_warm_up, Flag_min_iter, Flag_min_second, Flag_validate, Flag_eps, impls_str.c_str(), Flag_reproducible
+    );
+
+    bench_roofline roofline;
+    if (Flag_roofline) {
+        std::cerr << "==============================================================\n";
+        std::cerr << "measure roofline\n";
+        roofline.bandwidth_gbps = measure_bandwidth_gbps(Flag_roofline_mb);
+        if (cpu_isa & ppl::common::ISA_X86_SSE) {
+            roofline.peak_gflops["sse"] = measure_gemm_peak_gflops(ppl::kernel::x86::gemm_fp32_sse);
+        }
+        if (cpu_isa & ppl::common::ISA_X86_FMA) {
+            roofline.peak_gflops["fma"] = measure_gemm_peak_gflops(ppl::kernel::x86::gemm_fp32_fma);
+        }
+#ifdef PPL_USE_X86_AVX512
+        if (cpu_isa & ppl::common::ISA_X86_AVX512) {
+            roofline.peak_gflops["avx512"] = measure_gemm_peak_gflops(ppl::kernel::x86::gemm_fp32_avx512);
+        }
+#endif
+        fprintf(stderr, "bandwidth_gbps=%.2f\n", roofline.bandwidth_gbps);
+        for (auto &it : roofline.peak_gflops) {
+            fprintf(stderr, "peak_gflops_%s=%.2f\n", it.first.c_str(), it.second);
+        }
+        std::cerr << "\n";
+    }
+
+    std::vector<bench_record> records;
+    int32_t num_failed = 0;
+
+    for (auto op : ops) {
+        const std::string cfg_path = !Flag_cfg.empty() ? Flag_cfg : Flag_cfg_dir + "/" + op->name + ".cfg";
+        std::ifstream cfgfile;
+        cfgfile.open(cfg_path, std::ios_base::in | std::ios_base::binary);
+        if (!cfgfile.is_open()) {
+            std::cerr << "cannot open config file " << cfg_path << "\n";
+            return -1;
+        }
+
+        std::cerr << "==============================================================\n";
+        std::cerr << "begin " << op->name << " tests, format: " << op->case_fmt << "\n";
+        std::cerr << "%line_no,%case_string,%impl,%min_ms,%max_gflops,%max_gbps,%avg_ms,%avg_gflops,%avg_gbps,%roofline,%speedup\n";
+
+        char line[512];
+        int line_no = 0;
+        while (cfgfile.getline(line, 512, '\n')) {
+            ++line_no;
+
+            // skip comment
+            if (line[0] == '#' || line[0] == '\0') {
+                continue;
+            }
+
+            std::unique_ptr<bench_case> bcase(op->create());
+            if (!bcase->parse(line)) {
+                std::cerr << line_no << "," << line << ",invalid format\n";
+                continue;
+            }
+            const std::string case_string = bcase->case_string();
+
+            if (ppl::common::RC_SUCCESS != bcase->prepare()) {
+                std::cerr << line_no << "," << case_string << ",prepare failed\n";
+                ++num_failed;
+                continue;
+            }
+            if (Flag_validate && ppl::common::RC_SUCCESS != bcase->reference()) {
+                std::cerr << line_no << "," << case_string << ",reference failed\n";
+                ++num_failed;
+                continue;
+            }
+
+            const auto case_impls = bcase->impl_names();
+            double baseline_us = 0.;
+            for (auto &impl : impls) {
+                if (std::find(case_impls.begin(), case_impls.end(), impl) == case_impls.end()) {
+                    continue;
+                }
+                bcase->select(impl);
+                fprintf(stderr, "%d,%s,%s", line_no, case_string.c_str(), impl.c_str());
+
+                bool run_ok = true;
+                for (int64_t w = 0; w < Flag_warm_up && run_ok; ++w) {
+                    run_ok = bcase->run() == ppl::common::RC_SUCCESS;
+                }
+
+                std::chrono::high_resolution_clock::time_point start;
+                std::chrono::high_resolution_clock::time_point end;
+                double tot_exe_us = 0.;
+                double min_exe_us = DBL_MAX;
+                int64_t tot_exe_iter = 0;
+
+                for (; run_ok && (tot_exe_iter < Flag_min_iter || tot_exe_us < Flag_min_second * 1e6); ++tot_exe_iter) {
+                    start = std::chrono::high_resolution_clock::now();
+                    run_ok = bcase->run() == ppl::common::RC_SUCCESS;
+                    end = std::chrono::high_resolution_clock::now();
+                    double dur = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / 1e3;
+                    tot_exe_us += dur;
+                    if (dur < min_exe_us) {
+                        min_exe_us = dur;
+                    }
+                }
+                if (!run_ok) {
+                    std::cerr << ",execute failed!\n";
+                    ++num_failed;
+                    continue;
+                }
+
+                const double gops = bcase->gops();
+                const double gbs = bcase->gbytes();
+                double avg_exe_us = tot_exe_us / tot_exe_iter;
+                double max_gflops = gops / (min_exe_us / 1e6);
+                double avg_gflops = gops / (avg_exe_us / 1e6);
+                double max_gbps = gbs / (min_exe_us / 1e6);
+                double avg_gbps = gbs / (avg_exe_us / 1e6);
+                if (baseline_us == 0.) {
+                    baseline_us = avg_exe_us;
+                }
+                const double roof = roofline.efficiency(impl, avg_gflops, avg_gbps, gops, gbs);
+                const double speedup = baseline_us / avg_exe_us;
+
+                fprintf(stderr, ",%.3f,%.2f,%.2f,%.3f,%.2f,%.2f,%.1f%%,%.2fx",
+                    min_exe_us / 1e3, max_gflops, max_gbps,
+                    avg_exe_us / 1e3, avg_gflops, avg_gbps,
+                    roof * 100, speedup);
+
+                std::string validate = "skip";
+                if (Flag_validate) {
+                    std::cerr << ",";
+                    if (bcase->check(Flag_eps)) {
+                        validate = "pass";
+                    } else {
+                        validate = "fail";
+                        ++num_failed;
+                    }
+                }
+                if (Flag_reproducible && bcase->output()) {
+                    // the last run used num_threads, uneven partitions of one thread less catch thread dependent sums
+                    std::vector<uint8_t> full(bcase->output_bytes());
+                    memcpy(full.data(), bcase->output(), full.size());
+                    ppl::kernel::x86::set_omp_num_threads(std::max(num_threads - 1, 1));
+                    run_ok = bcase->run() == ppl::common::RC_SUCCESS;
+                    ppl::kernel::x86::set_omp_num_threads(num_threads);
+                    std::cerr << ",";
+                    if (!run_ok || memcmp(full.data(), bcase->output(), full.size()) != 0) {
+                        std::cerr << "not reproducible";
+                        ++num_failed;
+                    } else {
+                        std::cerr << "identical";
+                    }
+                }
+                std::cerr << "\n";
+
+                records.push_back({op->name, line_no, case_string, impl,
+                    min_exe_us / 1e3, avg_exe_us / 1e3, max_gflops, avg_gflops,
+                    max_gbps, avg_gbps, roof, speedup, validate});
+            }
+        }
+    }
+
+    if (!Flag_json.empty()) {
+        dump_json(Flag_json, num_threads, roofline, records);
+    }
+
+    std::cerr << "==============================================================\n";
+    std::cerr << "tot cases: " << records.size() << "\tfailed: " << num_failed << "\n";
+
+    return num_failed ? -1 : 0;
+}
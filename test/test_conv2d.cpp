@@ -43,6 +43,7 @@
 #include "ppl/common/tensor_shape.h"
 #include "simple_flags.h"
 #include "utils/check.h"
+#include "utils/perf_report.h"
 
 // #define ENABLE_DEBUG_TAG
 #ifdef ENABLE_DEBUG_TAG
@@ -97,6 +98,8 @@ static bool Flag_disable_avx512 = true;
 #endif
 Define_bool(disable_avx_fma3, false, "(false) disable avx, fma3, avx512 for auto select algo");
 Define_bool(core_bind, false, "(false)core binding");
+Define_bool(perf_counter, false, "(false) collect cpu counters of the benchmark iterations by perf_event_open");
+Define_float(peak_bw, 0.f, "(0) peak memory bandwidth in GB/s, decides compute or bandwidth bound with --perf_counter");
 
 /*
 
@@ -364,6 +367,9 @@ int main(int argc, char **argv) {
         num_threads, Flag_dynamic, !Flag_disable_avx512, !Flag_disable_avx_fma3, Flag_warm_up, Flag_min_iter, Flag_min_second, Flag_validate, Flag_eps, Flag_relu, Flag_sum
     );
 
+    perf_report perf;
+    perf.init(Flag_perf_counter, Flag_peak_bw);
+
 for (int64_t lcfg = 0; lcfg < Flag_loop_cfg; ++lcfg) {
 
     std::cerr << "==============================================================\n";
@@ -381,7 +387,7 @@ for (int64_t lcfg = 0; lcfg < Flag_loop_cfg; ++lcfg) {
 
     std::cerr << "==============================================================\n";
     std::cerr << "begin tests\n";
-    std::cerr << "%line_no,%case_string,%mops,%mbs,%min_ms,%max_gflops,%max_gbps,%avg_ms,%avg_gflops,%avg_gbps\n";
+    std::cerr << "%line_no,%case_string,%mops,%mbs,%min_ms,%max_gflops,%max_gbps,%avg_ms,%avg_gflops,%avg_gbps" << (perf.enabled() ? perf_report::header() : "") << "\n";
 
     char line[512];
     int line_no = 0;
@@ -726,6 +732,7 @@ DEBUG_TAG(N);
 
         conv_exe->clear_profiler();
 
+        perf.start();
         for (; tot_exe_iter < Flag_min_iter || tot_exe_us < Flag_min_second * 1e6; ++tot_exe_iter) {
             start = std::chrono::high_resolution_clock::now();
             if (Flag_dynamic) {
@@ -743,6 +750,7 @@ DEBUG_TAG(N);
                 min_exe_us = dur;
             }
         }
+        perf.stop(algoinfo.isa, gops * tot_exe_iter, mbs / 1024 * tot_exe_iter);
 
         std::string profile_result = Flag_profile ? conv_exe->export_profiler() : "";
 
@@ -752,6 +760,7 @@ DEBUG_TAG(N);
         double max_gbps = mbs / 1024 / (min_exe_us / 1e6);
         double avg_mbs = mbs / 1024 / (avg_exe_us / 1e6);
         fprintf(stderr, ",%.3f,%.3f,%.3f,%.2f,%.2f,%.3f,%.2f,%.2f", gops * 1000, mbs, min_exe_us / 1e3, max_gflops, max_gbps, avg_exe_us / 1e3, avg_gflops, avg_mbs);
+        perf.print();
 
         ++case_no;
         all_case_gflops += avg_gflops;
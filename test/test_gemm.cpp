@@ -35,9 +35,11 @@
 #include "ppl/kernel/x86/fp32/gemm.h"
 #include "ppl/common/generic_cpu_allocator.h"
 #include "ppl/kernel/x86/common/simd_tools.h"
+#include "ppl/kernel/x86/common/threading_tools.h"
 #include "ppl/kernel/x86/common/internal_include.h"
 #include "simple_flags.h"
 #include "utils/check.h"
+#include "utils/perf_report.h"
 
 // #define ENABLE_DEBUG_TAG
 #ifdef ENABLE_DEBUG_TAG
@@ -55,8 +57,11 @@ Define_int32(min_iter, 10, "(10) min benchmark iterations");
 Define_float(min_second, 1.0f, "(1.0) min benchmark seconds");
 Define_bool(validate, false, "(false) do result validation");
 Define_float(eps, 1e-5f, "(1e-5) rel error trunk for validation");
+Define_bool(reproducible, false, "(false) run in reproducible mode and check the output is bit-identical with one thread less");
 Define_string(isa, "auto", "(auto) sse, fma, avx512, auto, noarch");
 Define_bool(core_bind, false, "(false) core binding");
+Define_bool(perf_counter, false, "(false) collect cpu counters of the benchmark iterations by perf_event_open");
+Define_float(peak_bw, 0.f, "(0) peak memory bandwidth in GB/s, decides compute or bandwidth bound with --perf_counter");
 
 Define_float(alpha, 1.0f, "(1.0) gemm alpha");
 Define_float(beta, 0.0f, "(0.0) gemm c beta");
@@ -116,6 +121,7 @@ int main(int argc, char **argv) {
     }
 
     ppl::kernel::x86::set_denormals_zero(1);
+    ppl::kernel::x86::set_reproducible_mode(Flag_reproducible);
 
     std::cerr << "==============================================================\n";
     std::cerr << "read config\n";
@@ -158,8 +164,8 @@ int main(int argc, char **argv) {
     std::cerr << "==============================================================\n";
     fprintf(
         stderr,
-        "num_threads=%d\nwarm_up=%d\nmin_iter=%d\nmin_second=%f\nvalidate=%d\neps=%f\nisa=%s\n\n",
-        num_threads, Flag_warm_up, Flag_min_iter, Flag_min_second, Flag_validate, Flag_eps, Flag_isa.c_str()
+        "num_threads=%d\nwarm_up=%d\nmin_iter=%d\nmin_second=%f\nvalidate=%d\neps=%f\nisa=%s\nreproducible=%d\n\n",
+        num_threads, Flag_warm_up, Flag_min_iter, Flag_min_second, Flag_validate, Flag_eps, Flag_isa.c_str(), Flag_reproducible
     );
     std::cerr << "==============================================================\n";
     fprintf(
@@ -173,24 +179,28 @@ int main(int argc, char **argv) {
     auto gemm_func = gemm_func_table[Flag_isa];
     auto gemm_pack_b_func = gemm_pack_b_func_table[Flag_isa];
     auto gemm_get_packed_b_bytes_func = gemm_get_packed_b_bytes_func_table[Flag_isa];
+    std::string gemm_isa = Flag_isa;
 
     if (Flag_isa == "auto") {
         auto cpu_isa = ppl::common::GetCpuISA();
         if ((cpu_isa & ppl::common::ISA_X86_AVX512) && !gemm_func) {
             auto isa_str = "avx512";
             gemm_func = gemm_func_table[isa_str];
+            gemm_isa = isa_str;
             gemm_pack_b_func = gemm_pack_b_func_table[isa_str];
             gemm_get_packed_b_bytes_func = gemm_get_packed_b_bytes_func_table[isa_str];
         }
         if ((cpu_isa & ppl::common::ISA_X86_FMA) && !gemm_func) {
             auto isa_str = "fma";
             gemm_func = gemm_func_table[isa_str];
+            gemm_isa = isa_str;
             gemm_pack_b_func = gemm_pack_b_func_table[isa_str];
             gemm_get_packed_b_bytes_func = gemm_get_packed_b_bytes_func_table[isa_str];
         }
         if ((cpu_isa & ppl::common::ISA_X86_SSE) && !gemm_func) {
             auto isa_str = "sse";
             gemm_func = gemm_func_table[isa_str];
+            gemm_isa = isa_str;
             gemm_pack_b_func = gemm_pack_b_func_table[isa_str];
             gemm_get_packed_b_bytes_func = gemm_get_packed_b_bytes_func_table[isa_str];
         }
@@ -201,6 +211,14 @@ int main(int argc, char **argv) {
         return -1;
     }
 
+    ppl::common::isa_t peak_isa = 0;
+    if (gemm_isa == "avx512") peak_isa = ppl::common::ISA_X86_AVX512;
+    if (gemm_isa == "fma") peak_isa = ppl::common::ISA_X86_FMA;
+    if (gemm_isa == "sse") peak_isa = ppl::common::ISA_X86_SSE;
+
+    perf_report perf;
+    perf.init(Flag_perf_counter, Flag_peak_bw);
+
     char line[512];
     int line_no = 0;
     int case_no = 0;
@@ -263,7 +281,7 @@ int main(int argc, char **argv) {
     }
 
     std::cerr << "begin tests\n";
-    std::cerr << "%line_no,%case_string,%min_ms,%max_gflops,%max_gbps,%avg_ms,%avg_gflops,%avg_gbps\n";
+    std::cerr << "%line_no,%case_string,%min_ms,%max_gflops,%max_gbps,%avg_ms,%avg_gflops,%avg_gbps" << (perf.enabled() ? perf_report::header() : "") << (Flag_reproducible ? ",%reproducible" : "") << "\n";
 
     const int32_t data_mod = 7;
     const int32_t data_shift = -3;
@@ -475,6 +493,7 @@ DEBUG_TAG(G);
         double min_exe_us = DBL_MAX;
         int64_t tot_exe_iter = 0;
 
+        perf.start();
         for (; tot_exe_iter < Flag_min_iter || tot_exe_us < Flag_min_second * 1e6; ++tot_exe_iter) {
             start = std::chrono::high_resolution_clock::now();
             ppl::common::RetCode ret =
@@ -496,6 +515,7 @@ DEBUG_TAG(G);
                 min_exe_us = dur;
             }
         }
+        perf.stop(peak_isa, gops * tot_exe_iter, gbs * tot_exe_iter);
 
         double avg_exe_us = tot_exe_us / tot_exe_iter;
         double max_gflops = gops / (min_exe_us / 1e6);
@@ -506,6 +526,44 @@ DEBUG_TAG(G);
         fprintf(stderr, ",%.3f,%.2f,%.2f,%.3f,%.2f,%.2f",
             min_exe_us / 1e3, max_gflops, max_gbps,
             avg_exe_us / 1e3, avg_gflops, avg_gbps);
+        perf.print();
+
+        if (Flag_reproducible) {
+            // rerun from the same C with num_threads - 1, uneven partitions catch thread dependent sums
+            float *C_init = (float*)allocator.Alloc(C_num_bytes);
+            float *C_full = (float*)allocator.Alloc(C_num_bytes);
+            if (!C_init || !C_full) {
+                std::cerr << "," << "reproducible check out of memory\n";
+                return -1;
+            }
+            memcpy(C_init, C, C_num_bytes);
+            float *C_out[2] = {C_full, C};
+            for (int32_t r = 0; r < 2; ++r) {
+                memcpy(C, C_init, C_num_bytes);
+                ppl::kernel::x86::set_omp_num_threads(r == 0 ? num_threads : std::max(num_threads - 1, 1));
+                ppl::common::RetCode ret =
+                    gemm_func(
+                        A_list.data(), BB_list.data(), bias_list.data(), sum_list.data(),
+                        typeA, typeBB, typebias, typesum,
+                        max_batch, M, N, K,
+                        lda, ldb, ldc, ldsum,
+                        Flag_alpha, Flag_beta, Flag_beta_bias, Flag_beta_sum,
+                        post_flag, C_list.data());
+                if (ret != ppl::common::RC_SUCCESS) {
+                    fprintf(stderr, "execute failed!\n");
+                    return -1;
+                }
+                if (C_out[r] != C) {
+                    memcpy(C_out[r], C, C_num_bytes);
+                }
+            }
+            ppl::kernel::x86::set_omp_num_threads(num_threads);
+            std::cerr << ",";
+            check_array_bitwise(C, C_full, C_num_elements);
+            memcpy(C, C_init, C_num_bytes); // keep what the validation expects
+            allocator.Free(C_init);
+            allocator.Free(C_full);
+        }
 
         if (Flag_validate) {
             std::vector<const float*> B_list(max_batch, nullptr);
@@ -0,0 +1,355 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <string.h>
+
+#include "ppl/kernel/x86/common/kernel_registry.h"
+#include "ppl/kernel/x86/fp32/arithmetic.h"
+#include "ppl/kernel/x86/fp32/grid_sample.h"
+#include "ppl/kernel/x86/fp32/lstm.h"
+#include "ppl/common/generic_cpu_allocator.h"
+#include "ppl/common/tensor_shape.h"
+#include "simple_flags.h"
+
+Define_bool_opt("--help", Flag_help, false, "show these help information");
+
+static int32_t num_failed = 0;
+
+#define EXPECT(COND) do { \
+    if (!(COND)) { \
+        std::cerr << __FILE__ << ":" << __LINE__ << ": failed: " #COND "\n"; \
+        ++num_failed; \
+    } \
+} while (0)
+
+static std::string kernel_name(const ppl::kernel::x86::kernel_desc_t *kernel)
+{
+    return kernel ? kernel->name : "null";
+}
+
+static void make_shape(
+    const std::vector<int64_t> &dims,
+    const ppl::common::dataformat_t format,
+    ppl::common::TensorShape *shape)
+{
+    shape->Reshape(dims);
+    shape->SetDataType(ppl::common::DATATYPE_FLOAT32);
+    shape->SetDataFormat(format);
+    shape->CalcPadding();
+}
+
+// best builtin arithmetic kernel the isa allows
+static const char *expected_add(const ppl::common::isa_t isa)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) return "add_fp32_avx512";
+#endif
+    if (isa & ppl::common::ISA_X86_AVX) return "add_fp32_avx";
+    if (isa & ppl::common::ISA_X86_SSE) return "add_fp32_sse";
+    return "null";
+}
+
+static const char *expected_grid_sample_n16cx(const ppl::common::isa_t isa)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) return "grid_sample_n16cx_fp32_avx512";
+#endif
+    if (isa & ppl::common::ISA_X86_FMA) return "grid_sample_n16cx_fp32_fma";
+    return "grid_sample_n16cx_fp32_generic";
+}
+
+static const char *expected_lstm(const ppl::common::isa_t isa)
+{
+#ifdef PPL_USE_X86_AVX512
+    if (isa & ppl::common::ISA_X86_AVX512) return "lstm_fp32_avx512";
+#endif
+    if (isa & ppl::common::ISA_X86_FMA) return "lstm_fp32_fma";
+    if (isa & ppl::common::ISA_X86_SSE) return "lstm_fp32_sse";
+    return "null";
+}
+
+// every mask picks the best builtin the masked cpu can run, and the op
+// entry still computes what the sse kernel does
+static void test_dispatch_mask()
+{
+    std::cerr << "dispatch mask\n";
+    const ppl::common::isa_t masks[] = {
+        ~0u,
+        ppl::common::ISA_X86_FMA | ppl::common::ISA_X86_AVX | ppl::common::ISA_X86_SSE,
+        ppl::common::ISA_X86_AVX | ppl::common::ISA_X86_SSE,
+        ppl::common::ISA_X86_SSE,
+        0,
+    };
+
+    ppl::common::TensorShape shape, nd_shape, grid_shape, n16cx_shape;
+    make_shape({2, 3, 17, 19}, ppl::common::DATAFORMAT_NDARRAY, &shape);
+    make_shape({1, 3, 5, 7}, ppl::common::DATAFORMAT_NDARRAY, &nd_shape);
+    make_shape({1, 3, 5, 7}, ppl::common::DATAFORMAT_N16CX, &n16cx_shape);
+    make_shape({1, 4, 4, 2}, ppl::common::DATAFORMAT_NDARRAY, &grid_shape);
+
+    const uint64_t len = shape.CalcElementsExcludingPadding();
+    std::vector<float> src0(len), src1(len), dst(len), dst_ref(len);
+    for (uint64_t i = 0; i < len; ++i) {
+        src0[i] = (i % 13) * 0.25f - 1.0f;
+        src1[i] = (i % 7) * 0.5f - 1.5f;
+    }
+    EXPECT(ppl::common::RC_SUCCESS == ppl::kernel::x86::add_fp32_sse(
+        &shape, &shape, &shape, src0.data(), src1.data(), true, dst_ref.data()));
+
+    PPL_X86_KERNEL_DISPATCH_SITE(add_site, "add_fp32");
+    PPL_X86_KERNEL_DISPATCH_SITE(grid_sample_site, "grid_sample_fp32");
+    const ppl::common::TensorShape *add_shapes[]   = {&shape, &shape, &shape};
+    const ppl::common::TensorShape *nd_shapes[]    = {&nd_shape, &grid_shape};
+    const ppl::common::TensorShape *n16cx_shapes[] = {&n16cx_shape, &grid_shape};
+
+    for (auto mask : masks) {
+        const ppl::common::isa_t isa = ppl::common::GetCpuISA() & mask;
+        ppl::kernel::x86::set_kernel_dispatch_mask(mask, ~0u);
+        std::cerr << "  mask 0x" << std::hex << mask << std::dec << ": "
+                  << kernel_name(ppl::kernel::x86::resolve_kernel(&add_site, add_shapes, 3)) << ", "
+                  << kernel_name(ppl::kernel::x86::resolve_kernel(&grid_sample_site, n16cx_shapes, 2)) << "\n";
+
+        EXPECT(kernel_name(ppl::kernel::x86::resolve_kernel(&add_site, add_shapes, 3)) == expected_add(isa));
+        EXPECT(kernel_name(ppl::kernel::x86::resolve_kernel(&grid_sample_site, n16cx_shapes, 2)) == expected_grid_sample_n16cx(isa));
+        EXPECT(kernel_name(ppl::kernel::x86::resolve_kernel(&grid_sample_site, nd_shapes, 2)) == "grid_sample_ndarray_fp32");
+
+        memset(dst.data(), 0, dst.size() * sizeof(float));
+        const ppl::common::RetCode rc = ppl::kernel::x86::add_fp32(
+            &shape, &shape, &shape, src0.data(), src1.data(), true, dst.data());
+        if (isa & ppl::common::ISA_X86_SSE) {
+            EXPECT(rc == ppl::common::RC_SUCCESS);
+            EXPECT(memcmp(dst.data(), dst_ref.data(), dst.size() * sizeof(float)) == 0);
+        } else {
+            EXPECT(rc == ppl::common::RC_UNSUPPORTED);
+        }
+    }
+    ppl::kernel::x86::set_kernel_dispatch_mask(~0u, ~0u);
+}
+
+// the registry entry of lstm matches the isa entry of the kernel it picks
+static void test_lstm_entry()
+{
+    std::cerr << "lstm entry\n";
+    const ppl::common::isa_t masks[] = {
+        ~0u,
+        ppl::common::ISA_X86_FMA | ppl::common::ISA_X86_AVX | ppl::common::ISA_X86_SSE,
+        ppl::common::ISA_X86_SSE,
+    };
+    const int64_t seq_len = 3, batch = 2, input_size = 5, hidden_size = 7;
+    const int64_t num_dir  = 2;
+    const int64_t num_gate = ppl::kernel::x86::rnn_num_gate::LSTM;
+
+    ppl::common::TensorShape X_shape;
+    make_shape({seq_len, batch, input_size}, ppl::common::DATAFORMAT_NDARRAY, &X_shape);
+    std::vector<float> X(seq_len * batch * input_size), W(num_dir * num_gate * hidden_size * input_size);
+    std::vector<float> R(num_dir * num_gate * hidden_size * hidden_size);
+    for (size_t i = 0; i < X.size(); ++i) X[i] = (i % 11) * 0.2f - 1.0f;
+    for (size_t i = 0; i < W.size(); ++i) W[i] = (i % 7) * 0.05f - 0.15f;
+    for (size_t i = 0; i < R.size(); ++i) R[i] = (i % 5) * 0.05f - 0.1f;
+    const float *W_list[] = {W.data(), W.data() + num_gate * hidden_size * input_size};
+    const float *R_list[] = {R.data(), R.data() + num_gate * hidden_size * hidden_size};
+
+    const uint64_t temp_bytes = ppl::kernel::x86::lstm_fp32_get_buffer_bytes(
+        &X_shape, ppl::kernel::x86::rnn_direction::BIDIRECTIONAL, hidden_size, false, true, true, true);
+    std::vector<uint8_t> temp(temp_bytes);
+    std::vector<float> Y(seq_len * num_dir * batch * hidden_size), Y_ref(Y.size());
+
+    PPL_X86_KERNEL_DISPATCH_SITE(lstm_site, "lstm_fp32");
+    const ppl::common::TensorShape *shapes[] = {&X_shape};
+    for (auto mask : masks) {
+        const ppl::common::isa_t isa = ppl::common::GetCpuISA() & mask;
+        ppl::kernel::x86::set_kernel_dispatch_mask(mask, ~0u);
+        const ppl::kernel::x86::kernel_desc_t *kernel = ppl::kernel::x86::resolve_kernel(&lstm_site, shapes, 1);
+        std::cerr << "  mask 0x" << std::hex << mask << std::dec << ": " << kernel_name(kernel) << "\n";
+        EXPECT(kernel_name(kernel) == expected_lstm(isa));
+
+        EXPECT(ppl::common::RC_SUCCESS == ppl::kernel::x86::lstm_fp32(
+            isa, &X_shape, X.data(), W_list, R_list, nullptr, nullptr, nullptr, nullptr, nullptr,
+            ppl::kernel::x86::rnn_direction::BIDIRECTIONAL, hidden_size, false, false,
+            temp.data(), Y_ref.data(), nullptr, nullptr));
+        EXPECT(ppl::common::RC_SUCCESS == ppl::kernel::x86::lstm_fp32(
+            &X_shape, X.data(), W_list, R_list, nullptr, nullptr, nullptr, nullptr, nullptr,
+            ppl::kernel::x86::rnn_direction::BIDIRECTIONAL, hidden_size,
+            temp.data(), Y.data(), nullptr, nullptr));
+        EXPECT(memcmp(Y.data(), Y_ref.data(), Y.size() * sizeof(float)) == 0);
+    }
+    ppl::kernel::x86::set_kernel_dispatch_mask(~0u, ~0u);
+}
+
+static int32_t override_calls = 0;
+
+static ppl::common::RetCode add_fp32_override(
+    const ppl::common::TensorShape *src0_shape,
+    const ppl::common::TensorShape *src1_shape,
+    const ppl::common::TensorShape *dst_shape,
+    const float *src0,
+    const float *src1,
+    const bool fuse_relu,
+    float *dst)
+{
+    ++override_calls;
+    return ppl::kernel::x86::add_fp32_sse(src0_shape, src1_shape, dst_shape, src0, src1, fuse_relu, dst);
+}
+
+static bool src_is_small(const ppl::common::TensorShape **shapes, const int32_t num_shapes)
+{
+    return shapes[0]->CalcElementsExcludingPadding() <= 64;
+}
+
+// a kernel registered at runtime takes over the calls its predicate
+// accepts, callers that already ran keep working without any change
+static void test_register_override()
+{
+    std::cerr << "register override\n";
+    ppl::common::TensorShape small_shape, large_shape;
+    make_shape({1, 1, 8, 8}, ppl::common::DATAFORMAT_NDARRAY, &small_shape);
+    make_shape({1, 1, 64, 64}, ppl::common::DATAFORMAT_NDARRAY, &large_shape);
+    std::vector<float> src(large_shape.CalcElementsExcludingPadding(), 1.0f);
+    std::vector<float> dst(src.size());
+
+    // warm the dispatch site of add_fp32 before the registration
+    EXPECT(ppl::common::RC_SUCCESS == ppl::kernel::x86::add_fp32(
+        &small_shape, &small_shape, &small_shape, src.data(), src.data(), false, dst.data()));
+    EXPECT(override_calls == 0);
+
+    const size_t num_before = ppl::kernel::x86::get_registered_kernels("add_fp32").size();
+    const ppl::kernel::x86::kernel_desc_t desc = {
+        "add_fp32", "add_fp32_override", 0, 0, 1000, src_is_small,
+        reinterpret_cast<ppl::kernel::x86::kernel_func_t>(add_fp32_override)};
+    EXPECT(ppl::common::RC_SUCCESS == ppl::kernel::x86::register_kernel(&desc));
+
+    const std::vector<ppl::kernel::x86::kernel_desc_t> kernels = ppl::kernel::x86::get_registered_kernels("add_fp32");
+    EXPECT(kernels.size() == num_before + 1);
+    EXPECT(!kernels.empty() && strcmp(kernels.back().name, "add_fp32_override") == 0);
+
+    EXPECT(ppl::common::RC_SUCCESS == ppl::kernel::x86::add_fp32(
+        &small_shape, &small_shape, &small_shape, src.data(), src.data(), false, dst.data()));
+    EXPECT(override_calls == 1);
+    EXPECT(dst[0] == 2.0f && dst[63] == 2.0f);
+
+    EXPECT(ppl::common::RC_SUCCESS == ppl::kernel::x86::add_fp32(
+        &large_shape, &large_shape, &large_shape, src.data(), src.data(), false, dst.data()));
+    EXPECT(override_calls == 1);
+    EXPECT(dst[0] == 2.0f && dst[dst.size() - 1] == 2.0f);
+
+    // a mask without sse hides the builtins, the isa-free override stays
+    ppl::kernel::x86::set_kernel_dispatch_mask(0, ~0u);
+    EXPECT(ppl::common::RC_SUCCESS == ppl::kernel::x86::add_fp32(
+        &small_shape, &small_shape, &small_shape, src.data(), src.data(), false, dst.data()));
+    EXPECT(override_calls == 2);
+    EXPECT(ppl::common::RC_UNSUPPORTED == ppl::kernel::x86::add_fp32(
+        &large_shape, &large_shape, &large_shape, src.data(), src.data(), false, dst.data()));
+    ppl::kernel::x86::set_kernel_dispatch_mask(~0u, ~0u);
+
+    ppl::kernel::x86::kernel_desc_t bad = desc;
+    bad.func = nullptr;
+    EXPECT(ppl::common::RC_INVALID_VALUE == ppl::kernel::x86::register_kernel(&bad));
+    EXPECT(ppl::common::RC_INVALID_VALUE == ppl::kernel::x86::register_kernel(nullptr));
+}
+
+static void registry_test_kernel() {}
+
+// isa and feature bits of a kernel are checked against the masked cpu, and
+// every site of an op shares one candidate list per registry generation
+static void test_gates_and_cache()
+{
+    std::cerr << "isa and feature gates\n";
+    const ppl::kernel::x86::kernel_func_t func = registry_test_kernel;
+    const ppl::kernel::x86::kernel_desc_t descs[] = {
+        {"registry_test", "generic", 0, 0, 0, nullptr, func},
+        {"registry_test", "fma", ppl::common::ISA_X86_FMA, 0, 30, nullptr, func},
+        {"registry_test", "vnni", ppl::common::ISA_X86_AVX512, ppl::kernel::x86::CPU_FEATURE_AVX512_VNNI, 50, nullptr, func},
+        {"registry_test", "amx", 0, ppl::kernel::x86::CPU_FEATURE_AMX_TILE, 100, nullptr, func},
+        {"registry_test", "fma_late", ppl::common::ISA_X86_FMA, 0, 30, nullptr, func},
+    };
+    for (auto &d : descs) {
+        EXPECT(ppl::common::RC_SUCCESS == ppl::kernel::x86::register_kernel(&d));
+    }
+
+    PPL_X86_KERNEL_DISPATCH_SITE(site0, "registry_test");
+    PPL_X86_KERNEL_DISPATCH_SITE(site1, "registry_test");
+
+    const ppl::common::isa_t isa = ppl::common::GetCpuISA();
+    const uint32_t features      = ppl::kernel::x86::get_cpu_features();
+    // no permission was asked for, so amx kernels never run
+    EXPECT(!(features & ppl::kernel::x86::CPU_FEATURE_AMX_TILE));
+
+    std::string expected = "generic";
+    if (isa & ppl::common::ISA_X86_FMA) expected = "fma"; // ties go to the earliest registered
+    if ((isa & ppl::common::ISA_X86_AVX512) && (features & ppl::kernel::x86::CPU_FEATURE_AVX512_VNNI)) expected = "vnni";
+    EXPECT(kernel_name(ppl::kernel::x86::resolve_kernel(&site0, nullptr, 0)) == expected);
+    EXPECT(kernel_name(ppl::kernel::x86::resolve_kernel(&site1, nullptr, 0)) == expected);
+
+    std::cerr << "candidate cache\n";
+    const void *list = site0.candidates.load();
+    EXPECT(list != nullptr && list == site1.candidates.load());
+    ppl::kernel::x86::resolve_kernel(&site0, nullptr, 0);
+    EXPECT(site0.candidates.load() == list);
+
+    // hiding the vnni bit drops back to fma even when the cpu has it
+    ppl::kernel::x86::set_kernel_dispatch_mask(~0u, ~ppl::kernel::x86::CPU_FEATURE_AVX512_VNNI);
+    EXPECT(kernel_name(ppl::kernel::x86::resolve_kernel(&site0, nullptr, 0)) == ((isa & ppl::common::ISA_X86_FMA) ? "fma" : "generic"));
+    EXPECT(site0.candidates.load() != list);
+    list = site0.candidates.load();
+    EXPECT(kernel_name(ppl::kernel::x86::resolve_kernel(&site1, nullptr, 0)) == ((isa & ppl::common::ISA_X86_FMA) ? "fma" : "generic"));
+    EXPECT(site1.candidates.load() == list);
+
+    ppl::kernel::x86::set_kernel_dispatch_mask(ppl::common::ISA_X86_SSE, ~0u);
+    EXPECT(kernel_name(ppl::kernel::x86::resolve_kernel(&site0, nullptr, 0)) == "generic");
+    ppl::kernel::x86::set_kernel_dispatch_mask(~0u, ~0u);
+
+    // rebuilding one site retires the old list, the other site is reset
+    // instead of keeping it alive and rebuilds on its next call
+    std::cerr << "candidate reclaim\n";
+    for (int32_t i = 0; i < 1000; ++i) {
+        ppl::kernel::x86::set_kernel_dispatch_mask(i % 2 ? ppl::common::ISA_X86_SSE : ~0u, ~0u);
+        EXPECT(kernel_name(ppl::kernel::x86::resolve_kernel(&site0, nullptr, 0)) == (i % 2 ? "generic" : expected));
+        EXPECT(site1.candidates.load() == nullptr);
+    }
+    EXPECT(kernel_name(ppl::kernel::x86::resolve_kernel(&site1, nullptr, 0)) == "generic");
+    EXPECT(site1.candidates.load() == site0.candidates.load());
+    ppl::kernel::x86::set_kernel_dispatch_mask(~0u, ~0u);
+
+    std::cerr << "amx permission\n";
+    const ppl::common::RetCode rc = ppl::kernel::x86::request_amx_permission();
+    std::cerr << "  request_amx_permission: " << ppl::common::GetRetCodeStr(rc) << "\n";
+    const bool amx = (ppl::kernel::x86::get_cpu_features() & ppl::kernel::x86::CPU_FEATURE_AMX_TILE) != 0;
+    EXPECT(amx == (rc == ppl::common::RC_SUCCESS));
+    EXPECT(kernel_name(ppl::kernel::x86::resolve_kernel(&site0, nullptr, 0)) == (amx ? "amx" : expected));
+}
+
+int main(int argc, char **argv)
+{
+    simple_flags::parse_args(argc, argv);
+    if (Flag_help) {
+        simple_flags::print_args_info();
+        return 0;
+    }
+
+    std::cerr << "==============================================================\n";
+    test_dispatch_mask();
+    test_lstm_entry();
+    test_register_override();
+    test_gates_and_cache();
+    std::cerr << "==============================================================\n";
+    std::cerr << "failed: " << num_failed << "\n";
+    return num_failed == 0 ? 0 : -1;
+}
@@ -70,11 +70,14 @@ Define_int32(min_iter, 4, "(4) min benchmark iterations");
 Define_float(min_second, 0.5f, "(0.5) min benchmark seconds");
 Define_bool(validate, false, "(false) do result validation");
 Define_float(eps, 1e-6f, "(1e-6) rel error trunk for validation");
+Define_bool(dw_first, false, "(false) depthwise -> pointwise order, the case string still lists the pointwise conv first");
+Define_bool(sum, false, "(false) fuse eltwise sum into the last conv");
 #ifdef PPL_USE_X86_AVX512
 Define_bool(disable_avx512, false, "(false) disable avx512 for auto select algo");
 #else
 static bool Flag_disable_avx512 = true;
 #endif
+Define_bool(disable_avx_fma3, false, "(false) disable avx, fma3, avx512, -dw_first then selects the sse n8cx kernels");
 
 /*
 
@@ -123,8 +126,9 @@ int main(int argc, char **argv) {
     std::cerr << "==============================================================\n";
     fprintf(
         stderr,
-        "num_threads=%d\nwarm_up=%d\nmin_iter=%d\nmin_second=%f\nvalidate=%d\neps=%f\n",
-        num_threads, Flag_warm_up, Flag_min_iter, Flag_min_second, Flag_validate, Flag_eps
+        "num_threads=%d\nwarm_up=%d\nmin_iter=%d\nmin_second=%f\nvalidate=%d\neps=%f\ndw_first=%d\nsum=%d\navx512=%d\nfma3=%d\n",
+        num_threads, Flag_warm_up, Flag_min_iter, Flag_min_second, Flag_validate, Flag_eps,
+        Flag_dw_first, Flag_sum, !Flag_disable_avx512, !Flag_disable_avx_fma3
     );
 
 for (int64_t lcfg = 0; lcfg < Flag_loop_cfg; ++lcfg) {
@@ -194,9 +198,11 @@ for (int64_t lcfg = 0; lcfg < Flag_loop_cfg; ++lcfg) {
         cv_param.dilation_w = cv_dw + 1;
         cv_param.fuse_flag = 0;
 
-        dw_param.group = cv_param.num_output;
-        dw_param.channels = cv_param.num_output;
-        dw_param.num_output = cv_param.num_output;
+        // the depthwise conv works on the channels next to it
+        const int64_t dw_channels = Flag_dw_first ? cv_param.channels : cv_param.num_output;
+        dw_param.group = dw_channels;
+        dw_param.channels = dw_channels;
+        dw_param.num_output = dw_channels;
         dw_param.dilation_h = dw_dh + 1;
         dw_param.dilation_w = dw_dw + 1;
         dw_param.fuse_flag = 0;
@@ -227,10 +233,18 @@ for (int64_t lcfg = 0; lcfg < Flag_loop_cfg; ++lcfg) {
         const int64_t ext_cv_kernel_w = (cv_param.kernel_w - 1) * cv_param.dilation_w + 1;
         const int64_t ext_dw_kernel_h = (dw_param.kernel_h - 1) * dw_param.dilation_h + 1;
         const int64_t ext_dw_kernel_w = (dw_param.kernel_w - 1) * dw_param.dilation_w + 1;
-        const int64_t assume_inter_h = ((src_h + 2 * cv_param.pad_h - ext_cv_kernel_h) / cv_param.stride_h + 1);
-        const int64_t assume_inter_w = ((src_w + 2 * cv_param.pad_w - ext_cv_kernel_w) / cv_param.stride_w + 1);
-        const int64_t assume_dst_h = ((assume_inter_h + 2 * dw_param.pad_h - ext_dw_kernel_h) / dw_param.stride_h + 1);
-        const int64_t assume_dst_w = ((assume_inter_w + 2 * dw_param.pad_w - ext_dw_kernel_w) / dw_param.stride_w + 1);
+        int64_t assume_inter_h, assume_inter_w, assume_dst_h, assume_dst_w;
+        if (Flag_dw_first) {
+            assume_inter_h = ((src_h + 2 * dw_param.pad_h - ext_dw_kernel_h) / dw_param.stride_h + 1);
+            assume_inter_w = ((src_w + 2 * dw_param.pad_w - ext_dw_kernel_w) / dw_param.stride_w + 1);
+            assume_dst_h = ((assume_inter_h + 2 * cv_param.pad_h - ext_cv_kernel_h) / cv_param.stride_h + 1);
+            assume_dst_w = ((assume_inter_w + 2 * cv_param.pad_w - ext_cv_kernel_w) / cv_param.stride_w + 1);
+        } else {
+            assume_inter_h = ((src_h + 2 * cv_param.pad_h - ext_cv_kernel_h) / cv_param.stride_h + 1);
+            assume_inter_w = ((src_w + 2 * cv_param.pad_w - ext_cv_kernel_w) / cv_param.stride_w + 1);
+            assume_dst_h = ((assume_inter_h + 2 * dw_param.pad_h - ext_dw_kernel_h) / dw_param.stride_h + 1);
+            assume_dst_w = ((assume_inter_w + 2 * dw_param.pad_w - ext_dw_kernel_w) / dw_param.stride_w + 1);
+        }
         if (dst_h != assume_dst_h || dst_w != assume_dst_w) {
             std::cerr << "," << "dst_h(" << dst_h << ") and dst_w(" << dst_w << ") not match assume(" << assume_dst_h << ", " << assume_dst_w << ")\n";
             continue;
@@ -248,11 +262,27 @@ DEBUG_TAG(A);
         if (Flag_disable_avx512) {
             isa &= ~(ppl::common::ISA_X86_AVX512);
         }
+        if (Flag_disable_avx_fma3) {
+            isa &= ~(ppl::common::ISA_X86_AVX512);
+            isa &= ~(ppl::common::ISA_X86_FMA);
+            isa &= ~(ppl::common::ISA_X86_AVX);
+        }
 
-        auto cv_algoinfo = ppl::kernel::x86::conv2d_fp32_algo_selector::select_algo(ppl::common::DATAFORMAT_NDARRAY, cv_param, isa);
+        if (Flag_sum) {
+            if (Flag_dw_first) {
+                cv_param.fuse_flag |= ppl::kernel::x86::conv_fuse_flag::SUM;
+            } else {
+                dw_param.fuse_flag |= ppl::kernel::x86::conv_fuse_flag::SUM;
+            }
+        }
+
+        auto cv_algoinfo = ppl::kernel::x86::conv2d_fp32_algo_selector::select_algo(
+            Flag_dw_first ? ppl::common::DATAFORMAT_N16CX : ppl::common::DATAFORMAT_NDARRAY, cv_param, isa);
         auto dw_algoinfo = ppl::kernel::x86::conv2d_fp32_algo_selector::select_algo(ppl::common::DATAFORMAT_N16CX, dw_param, isa);
 
-        auto pd_conv_algo_info = ppl::kernel::x86::pd_conv2d_algo_selector::select_algo(cv_algoinfo, dw_algoinfo, cv_param, dw_param);
+        auto pd_conv_algo_info = Flag_dw_first
+            ? ppl::kernel::x86::pd_conv2d_algo_selector::select_algo(dw_algoinfo, cv_algoinfo, dw_param, cv_param)
+            : ppl::kernel::x86::pd_conv2d_algo_selector::select_algo(cv_algoinfo, dw_algoinfo, cv_param, dw_param);
         auto pd_mgr = ppl::kernel::x86::pd_conv2d_algo_selector::gen_algo(cv_param, dw_param, pd_conv_algo_info, &allocator);
 
         if (pd_conv_algo_info.algo_type == ppl::kernel::x86::pd_conv2d_fp32_algo::UNKNOWN || !pd_mgr) {
@@ -274,25 +304,34 @@ DEBUG_TAG(B);
 
         const int64_t ic = cv_param.channels / cv_param.group;
         const int64_t oc = cv_param.num_output / cv_param.group;
+        const int64_t cv_dst_h = Flag_dw_first ? dst_h : assume_inter_h;
+        const int64_t cv_dst_w = Flag_dw_first ? dst_w : assume_inter_w;
+        const int64_t dw_dst_h = Flag_dw_first ? assume_inter_h : dst_h;
+        const int64_t dw_dst_w = Flag_dw_first ? assume_inter_w : dst_w;
         const float gops = 
-            (cv_param.group * batch * ic * oc * src_h * src_w +
-             dw_param.group * batch * dw_param.kernel_h * dw_param.kernel_w * dst_h * dst_w) * 2.0f / 1e9f;
+            (cv_param.group * batch * ic * oc * cv_param.kernel_h * cv_param.kernel_w * cv_dst_h * cv_dst_w +
+             dw_param.group * batch * dw_param.kernel_h * dw_param.kernel_w * dw_dst_h * dw_dst_w) * 2.0f / 1e9f;
+        const ppl::common::dataformat_t src_format = pd_conv_algo_info.input_format;
+        const ppl::common::dataformat_t blk_format = pd_conv_algo_info.output_format;
+        const int64_t src_c = Flag_dw_first ? dw_param.channels : cv_param.channels;
+        const int64_t inter_c = Flag_dw_first ? dw_param.channels : cv_param.num_output;
+        const int64_t dst_c = Flag_dw_first ? cv_param.num_output : dw_param.num_output;
 
 DEBUG_TAG(C);
         ppl::common::TensorShape src_shape;
         src_shape.SetDataType(ppl::common::DATATYPE_FLOAT32);
-        src_shape.SetDataFormat(ppl::common::DATAFORMAT_N16CX);
-        src_shape.Reshape({batch, cv_param.channels, src_h, src_w});
+        src_shape.SetDataFormat(src_format);
+        src_shape.Reshape({batch, src_c, src_h, src_w});
 
         ppl::common::TensorShape inter_shape;
         inter_shape.SetDataType(ppl::common::DATATYPE_FLOAT32);
-        inter_shape.SetDataFormat(ppl::common::DATAFORMAT_N16CX);
-        inter_shape.Reshape({batch, cv_param.num_output, assume_inter_h, assume_inter_w});
+        inter_shape.SetDataFormat(blk_format);
+        inter_shape.Reshape({batch, inter_c, assume_inter_h, assume_inter_w});
 
         ppl::common::TensorShape dst_shape;
         dst_shape.SetDataType(ppl::common::DATATYPE_FLOAT32);
-        dst_shape.SetDataFormat(ppl::common::DATAFORMAT_N16CX);
-        dst_shape.Reshape({batch, dw_param.group, dst_h, dst_w});
+        dst_shape.SetDataFormat(blk_format);
+        dst_shape.Reshape({batch, dst_c, dst_h, dst_w});
 
         ppl::common::TensorShape cv_filter_shape;
         cv_filter_shape.SetDataType(ppl::common::DATATYPE_FLOAT32);
@@ -326,6 +365,7 @@ DEBUG_TAG(D);
         float *dst = nullptr;
         float *inter = nullptr;
         float *dst_ref = nullptr;
+        float *sum_src = nullptr;
         float *cv_filter = nullptr;
         float *cv_bias = nullptr;
         float *dw_filter = nullptr;
@@ -374,6 +414,16 @@ DEBUG_TAG(H);
         }
         memset(inter, 0, inter_shape.CalcBytesIncludingPadding());
         memset(dst_ref, 0, dst_shape.CalcBytesIncludingPadding());
+        if (Flag_sum) {
+            sum_src = (float*)allocator.Alloc(dst_shape.CalcBytesIncludingPadding());
+            if (!sum_src) {
+                std::cerr << "," << "sum_src out of memory\n";
+                return -1;
+            }
+            for (uint64_t i = 0; i < dst_shape.CalcElementsIncludingPadding(); ++i) {
+                sum_src[i] = (rand() % src_mod + src_shift) * src_scale;
+            }
+        }
 
 DEBUG_TAG(J);
         if (ppl::common::RC_SUCCESS != pd_mgr->gen_cvt_weights(cv_filter, cv_bias, dw_filter, dw_bias)) {
@@ -385,6 +435,9 @@ DEBUG_TAG(K);
         auto pd_exe = pd_mgr->gen_executor();
         pd_exe->set_src_shape(&src_shape);
         pd_exe->set_dst_shape(&dst_shape);
+        if (Flag_sum) {
+            pd_exe->set_sum_src_shape(&dst_shape);
+        }
 
         if (ppl::common::RC_SUCCESS != pd_exe->prepare()) {
             std::cerr << "," << "pd prepare failed\n";
@@ -402,6 +455,9 @@ DEBUG_TAG(L);
 DEBUG_TAG(M);
         pd_exe->set_src(src);
         pd_exe->set_dst(dst);
+        if (Flag_sum) {
+            pd_exe->set_sum_src(sum_src);
+        }
 
 DEBUG_TAG(N);
         for (int32_t i = 0; i < Flag_warm_up; ++i) {
@@ -435,49 +491,56 @@ DEBUG_TAG(N);
         double max_gbps = mbs / 1024 / (min_exe_us / 1e6);
         double avg_mbs = mbs / 1024 / (avg_exe_us / 1e6);
 
+        // run the two sub-executors one after another through inter as the reference
         auto cv_exe = pd_exe->conv2d_executor();
         auto dw_exe = pd_exe->depthwise_conv2d_executor();
+        auto first_exe = Flag_dw_first ? dw_exe : cv_exe;
+        auto second_exe = Flag_dw_first ? cv_exe : dw_exe;
 
-        cv_exe->set_src_shape(&src_shape);
-        cv_exe->set_dst_shape(&inter_shape);
-        if (ppl::common::RC_SUCCESS != cv_exe->prepare()) {
-            std::cerr << "," << "cv prepare failed\n";
+        first_exe->set_src_shape(&src_shape);
+        first_exe->set_dst_shape(&inter_shape);
+        if (ppl::common::RC_SUCCESS != first_exe->prepare()) {
+            std::cerr << "," << "first conv prepare failed\n";
             return -1;
         }
-        const uint64_t cv_temp_buffer_size = cv_exe->cal_temp_buffer_size();
+        const uint64_t cv_temp_buffer_size = first_exe->cal_temp_buffer_size();
         cv_temp_buffer = allocator.Alloc(cv_temp_buffer_size);
         if (!cv_temp_buffer) {
             std::cerr << "," << "cv_temp_buffer out of memory\n";
                 return -1;
         }
         memset(cv_temp_buffer, 0, cv_temp_buffer_size);
-        cv_exe->set_temp_buffer(cv_temp_buffer);
-        cv_exe->set_src(src);
-        cv_exe->set_dst(inter);
-
-        dw_exe->set_src_shape(&inter_shape);
-        dw_exe->set_dst_shape(&dst_shape);
-        if (ppl::common::RC_SUCCESS != dw_exe->prepare()) {
-            std::cerr << "," << "cv_dw prepare failed\n";
+        first_exe->set_temp_buffer(cv_temp_buffer);
+        first_exe->set_src(src);
+        first_exe->set_dst(inter);
+
+        second_exe->set_src_shape(&inter_shape);
+        second_exe->set_dst_shape(&dst_shape);
+        if (Flag_sum) {
+            second_exe->set_sum_src_shape(&dst_shape);
+            second_exe->set_sum_src(sum_src);
+        }
+        if (ppl::common::RC_SUCCESS != second_exe->prepare()) {
+            std::cerr << "," << "second conv prepare failed\n";
             return -1;
         }
-        const uint64_t dw_temp_buffer_size = dw_exe->cal_temp_buffer_size();
+        const uint64_t dw_temp_buffer_size = second_exe->cal_temp_buffer_size();
         dw_temp_buffer = allocator.Alloc(dw_temp_buffer_size);
         if (!dw_temp_buffer) {
             std::cerr << "," << "dw_temp_buffer out of memory\n";
                 return -1;
         }
         memset(dw_temp_buffer, 0, dw_temp_buffer_size);
-        dw_exe->set_temp_buffer(dw_temp_buffer);
-        dw_exe->set_src(inter);
-        dw_exe->set_dst(dst_ref);
+        second_exe->set_temp_buffer(dw_temp_buffer);
+        second_exe->set_src(inter);
+        second_exe->set_dst(dst_ref);
 
         for (int32_t i = 0; i < Flag_warm_up; ++i) {
-            if (ppl::common::RC_SUCCESS != cv_exe->execute()) {
+            if (ppl::common::RC_SUCCESS != first_exe->execute()) {
                 std::cerr << "," << "pd execute failed\n";
                 return -1;
             }
-            if (ppl::common::RC_SUCCESS != dw_exe->execute()) {
+            if (ppl::common::RC_SUCCESS != second_exe->execute()) {
                 std::cerr << "," << "pd execute failed\n";
                 return -1;
             }
@@ -490,14 +553,14 @@ DEBUG_TAG(N);
 
         for (; sp_exe_iter < Flag_min_iter || sp_exe_us < Flag_min_second * 1e6; ++sp_exe_iter) {
             start = std::chrono::high_resolution_clock::now();
-            cv_exe->execute();
+            first_exe->execute();
             mid = std::chrono::high_resolution_clock::now();
-            dw_exe->execute();
+            second_exe->execute();
             end = std::chrono::high_resolution_clock::now();
             double dur = std::chrono::duration_cast<std::chrono::nanoseconds>(mid - start).count() / 1e3;
-            cv_exe_us += dur;
+            (Flag_dw_first ? dw_exe_us : cv_exe_us) += dur;
             double dw_dur = std::chrono::duration_cast<std::chrono::nanoseconds>(end - mid).count() / 1e3;
-            dw_exe_us += dw_dur;
+            (Flag_dw_first ? cv_exe_us : dw_exe_us) += dw_dur;
             double sp_dur = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / 1e3;
             sp_exe_us += sp_dur;
         }
@@ -529,7 +592,9 @@ DEBUG_TAG(Y);
         if (dw_filter) allocator.Free(dw_filter);
         if (dw_bias) allocator.Free(dw_bias);
         if (dst) allocator.Free(dst);
+        if (inter) allocator.Free(inter);
         if (dst_ref) allocator.Free(dst_ref);
+        if (sum_src) allocator.Free(sum_src);
         if (pd_temp_buffer) allocator.Free(pd_temp_buffer);
         if (cv_temp_buffer) allocator.Free(cv_temp_buffer);
         if (dw_temp_buffer) allocator.Free(dw_temp_buffer);
@@ -19,6 +19,7 @@
 #define __ST_FP_H_
 
 #include <stdint.h>
+#include <string.h>
 #include <cmath>
 
 template <typename T>
@@ -35,4 +36,18 @@ bool check_array_error(T* input, T* ref, uint64_t len, T eps)
     return true;
 }
 
+// two runs of the same kernel that must give the same bits
+template <typename T>
+bool check_array_bitwise(const T* input, const T* ref, uint64_t len)
+{
+    for (uint64_t i = 0; i < len; ++i) {
+        if (memcmp(&input[i], &ref[i], sizeof(T)) != 0) {
+            std::cerr << "diff[" << i << "]=" << input[i] << " ref:" << ref[i];
+            return false;
+        }
+    }
+    std::cerr << "identical";
+    return true;
+}
+
 #endif
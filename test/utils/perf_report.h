@@ -0,0 +1,98 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_PERF_REPORT_H_
+#define __ST_PERF_REPORT_H_
+
+#include <stdio.h>
+#include <iostream>
+
+#include "ppl/kernel/x86/common/perf_counter.h"
+
+// counter columns appended to a test driver line, one open per process
+class perf_report {
+public:
+    void init(const bool enable, const double peak_bandwidth_gbps)
+    {
+        enable_ = enable;
+        peak_bandwidth_gbps_ = peak_bandwidth_gbps;
+        if (!enable_) {
+            return;
+        }
+        if (ppl::common::RC_SUCCESS != counter_.open(PPL_X86_PERF_EVENT_ALL())) {
+            std::cerr << "perf counters are not supported on this os\n";
+            enable_ = false;
+            return;
+        }
+        std::cerr << "perf_events=";
+        for (int32_t e = 0; e < ppl::kernel::x86::PERF_EVENT_COUNT; ++e) {
+            if (counter_.valid_mask() & PPL_X86_PERF_EVENT_BIT(e)) {
+                std::cerr << ppl::kernel::x86::get_perf_event_name((ppl::kernel::x86::perf_event_t)e) << ";";
+            }
+        }
+        std::cerr << "\n";
+    }
+
+    bool enabled() const
+    {
+        return enable_;
+    }
+
+    static const char *header()
+    {
+        return ",%ipc,%ghz,%l1d_mpki,%l2_mpki,%llc_mpki,%mem_gbps,%peak,%avx512_license,%bound";
+    }
+
+    void start()
+    {
+        if (enable_) {
+            counter_.start();
+        }
+    }
+
+    // gops and gbytes cover every iteration between start and stop,
+    // mem_gbps is measured dram traffic when the imc counters are open
+    void stop(const ppl::common::isa_t isa, const double gops, const double gbytes)
+    {
+        if (!enable_) {
+            return;
+        }
+        ppl::kernel::x86::perf_counter_result_t result;
+        counter_.stop(&result);
+        const ppl::kernel::x86::machine_peak_t peak = ppl::kernel::x86::get_machine_peak(isa, result.num_threads, 0.);
+        roof_ = ppl::kernel::x86::analyze_perf_roofline(&result, gops, gbytes, &peak, peak_bandwidth_gbps_);
+    }
+
+    void print() const
+    {
+        if (!enable_) {
+            return;
+        }
+        fprintf(stderr, ",%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%.1f%%,%.1f%%,%s",
+            roof_.ipc, roof_.freq_ghz, roof_.l1d_mpki, roof_.l2_mpki, roof_.llc_mpki, roof_.gbps,
+            roof_.compute_efficiency * 100, roof_.avx512_license_ratio * 100,
+            ppl::kernel::x86::get_perf_bound_name(roof_.bound));
+    }
+
+private:
+    bool enable_ = false;
+    double peak_bandwidth_gbps_ = 0.;
+    ppl::kernel::x86::perf_counter_t counter_;
+    ppl::kernel::x86::perf_roofline_t roof_ = {};
+};
+
+#endif